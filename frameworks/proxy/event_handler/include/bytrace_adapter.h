@@ -16,6 +16,8 @@
 #ifndef BYTRACE_ADAPTER_H
 #define BYTRACE_ADAPTER_H
 
+#include <vector>
+
 #include "key_event.h"
 #include "pointer_event.h"
 
@@ -42,6 +44,39 @@ public:
         STOP_EVENT = 3
     };
 
+    enum TraceMode {
+        TRACE_MODE_TEXT = 0,
+        TRACE_MODE_BINARY = 1
+    };
+    // Stage ids of binary trace points, the offline tool maps them back to the spans of the text mode.
+    enum TraceStage {
+        TRACE_STAGE_REPORT = 1,
+        TRACE_STAGE_REPORT_FINISH = 2,
+        // Plus the HandlerType of a key handled in the service.
+        TRACE_STAGE_SERVICE_HANDLE_BASE = 16,
+        // Plus twice the HandlerType of a client span, plus one when the span stops.
+        TRACE_STAGE_CLIENT_BASE = 32
+    };
+    enum TraceSource {
+        TRACE_SOURCE_KEY = 0,
+        TRACE_SOURCE_MOUSE = 1,
+        TRACE_SOURCE_TOUCH = 2
+    };
+    struct TracePoint {
+        int32_t eventId { -1 };
+        uint16_t stage { 0 };
+        uint16_t source { 0 };
+        int64_t time { 0 };
+    };
+    // Written once before the raw TracePoint records by DumpTracePoints.
+    struct TracePointHeader {
+        uint32_t magic { 0 };
+        uint16_t version { 0 };
+        uint16_t recordSize { 0 };
+        uint32_t count { 0 };
+        uint32_t reserved { 0 };
+    };
+
     enum MMIThreadLoopDepth {
         MMI_THREAD_LOOP_DEPTH_ZERO = 0,
         MMI_THREAD_LOOP_DEPTH_ONE = 1,
@@ -50,6 +85,15 @@ public:
         MMI_THREAD_LOOP_DEPTH_FOUR = 4
     };
 
+    // Checked before any trace message is formatted, messages are only built while a tracer is attached.
+    static bool IsEnabled();
+    // In binary mode the event spans are recorded as trace points instead of hitrace messages.
+    static void SetTraceMode(TraceMode mode);
+    static TraceMode GetTraceMode();
+    static bool RecordTracePoint(int32_t eventId, int32_t stage, TraceSource source);
+    static std::vector<TracePoint> GetTracePoints();
+    static void DumpTracePoints(int32_t fd);
+
     static void StartBytrace(std::shared_ptr<KeyEvent> keyEvent);
     static void StartBytrace(std::shared_ptr<KeyEvent> key, HandlerType handlerType);
     static void StartBytrace(std::shared_ptr<PointerEvent> pointerEvent, TraceBtn traceBtn);
@@ -123,6 +167,8 @@ public:
     static void StopHardPointerMove();
 
     static void MMIServiceTraceStart(int32_t type, const std::string& msg);
+    static void MMIServiceTraceStartFormat(int32_t type, const char *format, ...)
+        __attribute__((format(printf, 2, 3)));
     static void MMIServiceTraceStop();
     static void MMIClientTraceStart(int32_t type, const std::string& msg);
     static void MMIClientTraceStop();
@@ -131,7 +177,7 @@ public:
     static void StopForegroundAppData();
 
 private:
-    static std::string GetPointerTraceString(std::shared_ptr<PointerEvent> pointerEvent);
+    static int32_t GetClientStage(TraceBtn traceBtn, HandlerType handlerType);
     static std::string GetKeyTraceString(std::shared_ptr<KeyEvent> keyEvent);
 };
 } // namespace MMI
@@ -77,6 +77,8 @@ public:
         std::function<void(LongPressEvent)> callback);
     void UnsubscribeLongPressEvent(int32_t subscriberId);
     int32_t AddInputEventFilter(std::shared_ptr<IInputEventFilter> filter, int32_t priority, uint32_t deviceTags);
+    int32_t AddInputEventFilter(std::shared_ptr<IInputEventFilter> filter, int32_t priority, uint32_t deviceTags,
+        const InputEventFilterRule &rule);
     int32_t RemoveInputEventFilter(int32_t filterId);
     int32_t AddInputEventObserver(std::shared_ptr<MMIEventObserver> observer);
     int32_t RemoveInputEventObserver(std::shared_ptr<MMIEventObserver> observer);
@@ -323,6 +325,8 @@ private:
     void SendEnhanceConfig();
     void PrintEnhanceConfig();
 #endif // OHOS_BUILD_ENABLE_SECURITY_COMPONENT
+    int32_t AddInputEventFilterInner(std::shared_ptr<IInputEventFilter> filter, int32_t priority, uint32_t deviceTags,
+        const InputEventFilterRule *rule);
     void ReAddInputEventFilter();
 
 #ifdef OHOS_BUILD_ENABLE_KEYBOARD
@@ -342,6 +346,7 @@ private:
 
 private:
     std::map<int32_t, std::tuple<sptr<IEventFilter>, int32_t, uint32_t>> eventFilterServices_;
+    std::map<int32_t, InputEventFilterRule> eventFilterRules_;
     std::shared_ptr<MMIEventObserver> eventObserver_ { nullptr };
     std::shared_ptr<IInputEventConsumer> consumer_ { nullptr };
     std::vector<std::shared_ptr<IAnrObserver>> anrObservers_;
@@ -14,8 +14,14 @@
  */
 #include "bytrace_adapter.h"
 
+#include <atomic>
+#include <cstdarg>
+#include <unistd.h>
+
 #include "hitrace_meter.h"
 #include "mmi_log.h"
+#include "securec.h"
+#include "util.h"
 
 #undef MMI_LOG_TAG
 #define MMI_LOG_TAG "BytraceAdapter"
@@ -39,76 +45,200 @@ const char* ON_STOP_EVENT { "StopEvent" };
 constexpr int32_t START_ID { 1 };
 constexpr int32_t LAUNCH_ID { 2 };
 constexpr int32_t STOP_ID { 3 };
+constexpr size_t TRACE_MSG_SIZE { 256 };
+constexpr size_t TRACE_POINT_COUNT { 4096 };
+constexpr uint32_t TRACE_POINT_MAGIC { 0x50544D4D }; // "MMTP"
+constexpr uint16_t TRACE_POINT_VERSION { 1 };
+constexpr int32_t EVENT_ID_BITS { 32 };
+constexpr int32_t STAGE_BITS { 16 };
+constexpr uint64_t FIELD16_MASK { 0xFFFF };
+constexpr int32_t CLIENT_STAGE_STEP { 2 };
+
+std::atomic<int32_t> g_traceMode { BytraceAdapter::TRACE_MODE_TEXT };
+
+// Each slot packs eventId, stage and source into one word and the timestamp into the other.
+struct TracePointSlot {
+    std::atomic<uint64_t> key { 0 };
+    std::atomic<int64_t> time { 0 };
+};
+TracePointSlot g_tracePoints[TRACE_POINT_COUNT];
+std::atomic<uint64_t> g_tracePointCount { 0 };
+
+// Spans opened on this thread by the gated starts, bit n set if the span at depth n was emitted, so that the
+// matching stop finishes exactly what its start began even if the trace tag is switched in between.
+constexpr uint32_t MAX_TRACKED_SPANS { 64 };
+thread_local uint64_t g_emittedSpans { 0 };
+thread_local uint32_t g_spanDepth { 0 };
+
+// Formats into the caller's stack buffer, a message cut at the buffer size is still traced.
+__attribute__((format(printf, 2, 3))) void FormatTrace(char (&buf)[TRACE_MSG_SIZE], const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    if (vsnprintf_s(buf, sizeof(buf), sizeof(buf) - 1, format, args) == -1) {
+        buf[sizeof(buf) - 1] = '\0';
+    }
+    va_end(args);
+}
+
+void TraceMark(const char *msg)
+{
+    StartTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, msg, "");
+    FinishTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT);
+}
+
+void PushSpan(bool isEmitted)
+{
+    if (g_spanDepth < MAX_TRACKED_SPANS) {
+        uint64_t bit = (1ULL << g_spanDepth);
+        g_emittedSpans = isEmitted ? (g_emittedSpans | bit) : (g_emittedSpans & ~bit);
+    }
+    ++g_spanDepth;
+}
+
+void TraceStart(const char *msg)
+{
+    StartTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, msg, "");
+    PushSpan(true);
+}
+
+// A start skipped while the tag was off, its stop must not finish a span either.
+void SkipSpan()
+{
+    PushSpan(false);
+}
+
+void TraceStop()
+{
+    if (g_spanDepth == 0) {
+        return;
+    }
+    --g_spanDepth;
+    bool isEmitted = (g_spanDepth < MAX_TRACKED_SPANS) ?
+        ((g_emittedSpans & (1ULL << g_spanDepth)) != 0) : BytraceAdapter::IsEnabled();
+    if (isEmitted) {
+        FinishTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT);
+    }
+}
+
+BytraceAdapter::TraceSource GetTraceSource(std::shared_ptr<PointerEvent> pointerEvent)
+{
+    return (pointerEvent->GetSourceType() == PointerEvent::SOURCE_TYPE_MOUSE) ?
+        BytraceAdapter::TRACE_SOURCE_MOUSE : BytraceAdapter::TRACE_SOURCE_TOUCH;
+}
 } // namespace
 
+bool BytraceAdapter::IsEnabled()
+{
+    return IsTagEnabled(HITRACE_TAG_MULTIMODALINPUT);
+}
+
+void BytraceAdapter::SetTraceMode(TraceMode mode)
+{
+    g_traceMode.store(mode, std::memory_order_relaxed);
+}
+
+BytraceAdapter::TraceMode BytraceAdapter::GetTraceMode()
+{
+    return static_cast<TraceMode>(g_traceMode.load(std::memory_order_relaxed));
+}
+
+bool BytraceAdapter::RecordTracePoint(int32_t eventId, int32_t stage, TraceSource source)
+{
+    if (g_traceMode.load(std::memory_order_relaxed) != TRACE_MODE_BINARY) {
+        return false;
+    }
+    uint64_t index = g_tracePointCount.fetch_add(1, std::memory_order_relaxed);
+    TracePointSlot &slot = g_tracePoints[index % TRACE_POINT_COUNT];
+    uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(eventId)) << EVENT_ID_BITS) |
+        ((static_cast<uint64_t>(stage) & FIELD16_MASK) << STAGE_BITS) | (static_cast<uint64_t>(source) & FIELD16_MASK);
+    slot.key.store(key, std::memory_order_relaxed);
+    slot.time.store(GetSysClockTime(), std::memory_order_relaxed);
+    return true;
+}
+
+std::vector<BytraceAdapter::TracePoint> BytraceAdapter::GetTracePoints()
+{
+    uint64_t count = g_tracePointCount.load(std::memory_order_relaxed);
+    uint64_t first = (count > TRACE_POINT_COUNT) ? (count - TRACE_POINT_COUNT) : 0;
+    std::vector<TracePoint> tracePoints;
+    tracePoints.reserve(count - first);
+    for (uint64_t index = first; index < count; ++index) {
+        const TracePointSlot &slot = g_tracePoints[index % TRACE_POINT_COUNT];
+        uint64_t key = slot.key.load(std::memory_order_relaxed);
+        TracePoint tracePoint;
+        tracePoint.eventId = static_cast<int32_t>(key >> EVENT_ID_BITS);
+        tracePoint.stage = static_cast<uint16_t>((key >> STAGE_BITS) & FIELD16_MASK);
+        tracePoint.source = static_cast<uint16_t>(key & FIELD16_MASK);
+        tracePoint.time = slot.time.load(std::memory_order_relaxed);
+        tracePoints.push_back(tracePoint);
+    }
+    return tracePoints;
+}
+
+void BytraceAdapter::DumpTracePoints(int32_t fd)
+{
+    std::vector<TracePoint> tracePoints = GetTracePoints();
+    TracePointHeader header;
+    header.magic = TRACE_POINT_MAGIC;
+    header.version = TRACE_POINT_VERSION;
+    header.recordSize = static_cast<uint16_t>(sizeof(TracePoint));
+    header.count = static_cast<uint32_t>(tracePoints.size());
+    if (write(fd, &header, sizeof(header)) != static_cast<ssize_t>(sizeof(header))) {
+        MMI_HILOGE("Write trace point header failed, errno:%{public}d", errno);
+        return;
+    }
+    size_t size = tracePoints.size() * sizeof(TracePoint);
+    if ((size > 0) && (write(fd, tracePoints.data(), size) != static_cast<ssize_t>(size))) {
+        MMI_HILOGE("Write trace points failed, errno:%{public}d", errno);
+    }
+}
+
 void BytraceAdapter::StartBytrace(std::shared_ptr<KeyEvent> keyEvent)
 {
     CHKPV(keyEvent);
     int32_t keyId = keyEvent->GetId();
+    if (RecordTracePoint(keyId, TRACE_STAGE_REPORT, TRACE_SOURCE_KEY) || !IsEnabled()) {
+        return;
+    }
     StartAsyncTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, ON_KEY_EVENT, keyId, "", nullptr);
-    std::string traceMsg = "service report keyId=";
-    traceMsg += std::to_string(keyId);
-    HITRACE_METER_NAME(HITRACE_TAG_MULTIMODALINPUT, traceMsg);
+    char traceMsg[TRACE_MSG_SIZE];
+    FormatTrace(traceMsg, "service report keyId=%d", keyId);
+    TraceMark(traceMsg);
 }
 
-std::string BytraceAdapter::GetKeyTraceString(std::shared_ptr<KeyEvent> keyEvent)
+int32_t BytraceAdapter::GetClientStage(TraceBtn traceBtn, HandlerType handlerType)
 {
-    CHKPS(keyEvent);
-    return KeyEvent::ActionToString(keyEvent->GetKeyAction());
+    return TRACE_STAGE_CLIENT_BASE + handlerType * CLIENT_STAGE_STEP + ((traceBtn == TRACE_START) ? 0 : 1);
 }
 
-std::string BytraceAdapter::GetPointerTraceString(std::shared_ptr<PointerEvent> pointerEvent)
+std::string BytraceAdapter::GetKeyTraceString(std::shared_ptr<KeyEvent> keyEvent)
 {
-    CHKPS(pointerEvent);
-    std::vector<PointerEvent::PointerItem> pointerItems;
-    std::vector<int32_t> pointerIds{ pointerEvent->GetPointerIds() };
-    for (const auto &pointerId : pointerIds) {
-        PointerEvent::PointerItem item;
-        if (!pointerEvent->GetPointerItem(pointerId, item)) {
-            MMI_HILOGE("Invalid pointer:%{public}d", pointerId);
-            return "";
-        }
-        pointerItems.emplace_back(item);
-    }
-    std::string traceStr;
-    for (const auto &item : pointerItems) {
-        auto id = item.GetPointerId();
-        auto displayX = item.GetDisplayX();
-        auto displayY = item.GetDisplayY();
-        traceStr += " [";
-        traceStr += "id: ";
-        traceStr += std::to_string(id);
-        traceStr += ", x:";
-        traceStr += std::to_string(displayX);
-        traceStr += ", y:";
-        traceStr += std::to_string(displayY);
-        traceStr += "]";
-    }
-    return traceStr;
+    CHKPS(keyEvent);
+    return KeyEvent::ActionToString(keyEvent->GetKeyAction());
 }
 
 void BytraceAdapter::StartBytrace(std::shared_ptr<PointerEvent> pointerEvent, TraceBtn traceBtn)
 {
     CHKPV(pointerEvent);
     int32_t eventId = pointerEvent->GetId();
+    int32_t stage = (traceBtn == TRACE_START) ? TRACE_STAGE_REPORT : TRACE_STAGE_REPORT_FINISH;
+    if (RecordTracePoint(eventId, stage, GetTraceSource(pointerEvent)) || !IsEnabled()) {
+        return;
+    }
     if (traceBtn == TRACE_START) {
+        char traceMsg[TRACE_MSG_SIZE];
         if (pointerEvent->GetSourceType() == PointerEvent::SOURCE_TYPE_MOUSE) {
             StartAsyncTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, ON_POINTER_EVENT, eventId,
                 "", nullptr);
-            std::string traceMsg = "service report pointerId:";
-            traceMsg += std::to_string(eventId);
-            traceMsg += ", type: ";
-            traceMsg += pointerEvent->DumpPointerAction();
-            HITRACE_METER_NAME(HITRACE_TAG_MULTIMODALINPUT, traceMsg);
+            FormatTrace(traceMsg, "service report pointerId:%d, type: %s", eventId,
+                pointerEvent->DumpPointerAction());
         } else {
             StartAsyncTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, ON_TOUCH_EVENT, eventId,
                 "", nullptr);
-            std::string traceMsg = "service report touchId:";
-            traceMsg += std::to_string(eventId);
-            traceMsg += ", type: ";
-            traceMsg += pointerEvent->DumpPointerAction();
-            HITRACE_METER_NAME(HITRACE_TAG_MULTIMODALINPUT, traceMsg);
+            FormatTrace(traceMsg, "service report touchId:%d, type: %s", eventId, pointerEvent->DumpPointerAction());
         }
+        TraceMark(traceMsg);
     } else {
         if (pointerEvent->GetSourceType() == PointerEvent::SOURCE_TYPE_MOUSE) {
             FinishAsyncTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, ON_POINTER_EVENT, eventId);
@@ -121,7 +251,11 @@ void BytraceAdapter::StartBytrace(std::shared_ptr<PointerEvent> pointerEvent, Tr
 void BytraceAdapter::StartBytrace(std::shared_ptr<KeyEvent> key, HandlerType handlerType)
 {
     CHKPV(key);
-    std::string checkKeyCode;
+    if (RecordTracePoint(key->GetId(), TRACE_STAGE_SERVICE_HANDLE_BASE + handlerType, TRACE_SOURCE_KEY) ||
+        !IsEnabled()) {
+        return;
+    }
+    const char *checkKeyCode = nullptr;
     switch (handlerType) {
         case KEY_INTERCEPT_EVENT: {
             checkKeyCode = "Intercept keyCode";
@@ -144,7 +278,7 @@ void BytraceAdapter::StartBytrace(std::shared_ptr<KeyEvent> key, HandlerType han
             break;
         }
     }
-    HITRACE_METER_NAME(HITRACE_TAG_MULTIMODALINPUT, checkKeyCode);
+    TraceMark(checkKeyCode);
     int32_t keyId = key->GetId();
     FinishAsyncTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, ON_KEY_EVENT, keyId);
 }
@@ -153,28 +287,31 @@ void BytraceAdapter::StartBytrace(std::shared_ptr<KeyEvent> keyEvent, TraceBtn t
 {
     CHKPV(keyEvent);
     int32_t keyId = keyEvent->GetId();
+    if (RecordTracePoint(keyId, GetClientStage(traceBtn, handlerType), TRACE_SOURCE_KEY) || !IsEnabled()) {
+        return;
+    }
     if (traceBtn == TRACE_START) {
         switch (handlerType) {
             case KEY_INTERCEPT_EVENT: {
                 StartAsyncTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, KEY_EVENT_INTERCEPT, keyId,
                     "", nullptr);
-                HITRACE_METER_NAME(HITRACE_TAG_MULTIMODALINPUT, "client Intercept keyCode");
+                TraceMark("client Intercept keyCode");
                 break;
             }
             case KEY_SUBSCRIBE_EVENT: {
                 StartAsyncTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, KEY_EVENT_SUBSCRIBE, keyId,
                     "", nullptr);
-                HITRACE_METER_NAME(HITRACE_TAG_MULTIMODALINPUT, "client subscribe keyCode");
+                TraceMark("client subscribe keyCode");
                 break;
             }
             case KEY_DISPATCH_EVENT: {
                 StartAsyncTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, KEY_EVENT_DISPATCH, keyId,
                     "", nullptr);
-                HITRACE_METER_NAME(HITRACE_TAG_MULTIMODALINPUT, "client dispatch keyCode");
+                TraceMark("client dispatch keyCode");
                 break;
             }
             default: {
-                HITRACE_METER_NAME(HITRACE_TAG_MULTIMODALINPUT, "Unknown keyCode");
+                TraceMark("Unknown keyCode");
                 break;
             }
         }
@@ -193,7 +330,7 @@ void BytraceAdapter::StartBytrace(std::shared_ptr<KeyEvent> keyEvent, TraceBtn t
                 break;
             }
             default: {
-                HITRACE_METER_NAME(HITRACE_TAG_MULTIMODALINPUT, "Unknown keyCode");
+                TraceMark("Unknown keyCode");
                 break;
             }
         }
@@ -205,29 +342,34 @@ void BytraceAdapter::StartBytrace(
 {
     CHKPV(pointerEvent);
     int32_t eventId = pointerEvent->GetId();
+    if (RecordTracePoint(eventId, GetClientStage(traceBtn, handlerType), GetTraceSource(pointerEvent)) ||
+        !IsEnabled()) {
+        return;
+    }
     if (traceBtn == TRACE_START) {
+        char traceMsg[TRACE_MSG_SIZE];
         if (handlerType == POINT_DISPATCH_EVENT) {
             if (pointerEvent->GetSourceType() == PointerEvent::SOURCE_TYPE_MOUSE) {
                 StartAsyncTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, POINTER_EVENT_DISPATCH, eventId,
                     "", nullptr);
-                HITRACE_METER_NAME(HITRACE_TAG_MULTIMODALINPUT, "client dispatch pointerId:" + std::to_string(eventId));
+                FormatTrace(traceMsg, "client dispatch pointerId:%d", eventId);
             } else {
                 StartAsyncTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, TOUCH_EVENT_DISPATCH, eventId,
                     "", nullptr);
-                HITRACE_METER_NAME(HITRACE_TAG_MULTIMODALINPUT, "client dispatch touchId:" + std::to_string(eventId));
+                FormatTrace(traceMsg, "client dispatch touchId:%d", eventId);
             }
         } else {
             if (pointerEvent->GetSourceType() == PointerEvent::SOURCE_TYPE_MOUSE) {
                 StartAsyncTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, POINTER_EVENT_INTERCEPT, eventId,
                     "", nullptr);
-                HITRACE_METER_NAME(HITRACE_TAG_MULTIMODALINPUT,
-                    "client Intercept pointerId:" + std::to_string(eventId));
+                FormatTrace(traceMsg, "client Intercept pointerId:%d", eventId);
             } else {
                 StartAsyncTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, TOUCH_EVENT_INTERCEPT, eventId,
                     "", nullptr);
-                HITRACE_METER_NAME(HITRACE_TAG_MULTIMODALINPUT, "client Intercept touchId:" + std::to_string(eventId));
+                FormatTrace(traceMsg, "client Intercept touchId:%d", eventId);
             }
         }
+        TraceMark(traceMsg);
     } else {
         if (handlerType == POINT_DISPATCH_EVENT) {
             if (pointerEvent->GetSourceType() == PointerEvent::SOURCE_TYPE_MOUSE) {
@@ -296,14 +438,18 @@ void BytraceAdapter::StartBytrace(TraceBtn traceBtn, EventType eventType)
 
 void BytraceAdapter::StartIpcServer(uint32_t code)
 {
-    std::string traceInfo = "ipcServerHandle code:";
-    traceInfo += std::to_string(code);
-    StartTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, traceInfo.c_str(), "");
+    if (!IsEnabled()) {
+        SkipSpan();
+        return;
+    }
+    char traceInfo[TRACE_MSG_SIZE];
+    FormatTrace(traceInfo, "ipcServerHandle code:%u", code);
+    TraceStart(traceInfo);
 }
 
 void BytraceAdapter::StopIpcServer()
 {
-    FinishTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT);
+    TraceStop();
 }
 
 void BytraceAdapter::StartPackageEvent(const std::string& msg)
@@ -318,80 +464,108 @@ void BytraceAdapter::StopPackageEvent()
 
 void BytraceAdapter::StartHandleInput(int32_t code)
 {
-    std::string traceInfo = "originEventHandle code:";
-    traceInfo += std::to_string(code);
-    StartTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, traceInfo.c_str(), "");
+    if (!IsEnabled()) {
+        SkipSpan();
+        return;
+    }
+    char traceInfo[TRACE_MSG_SIZE];
+    FormatTrace(traceInfo, "originEventHandle code:%d", code);
+    TraceStart(traceInfo);
 }
 
 void BytraceAdapter::StopHandleInput()
 {
-    FinishTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT);
+    TraceStop();
 }
 
 void BytraceAdapter::StartHandleTracker(int32_t pointerId)
 {
-    std::string traceInfo = "pointerId:";
-    traceInfo += std::to_string(pointerId);
-    StartTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, traceInfo.c_str(), "");
+    if (!IsEnabled()) {
+        SkipSpan();
+        return;
+    }
+    char traceInfo[TRACE_MSG_SIZE];
+    FormatTrace(traceInfo, "pointerId:%d", pointerId);
+    TraceStart(traceInfo);
 }
 
 void BytraceAdapter::StopHandleTracker()
 {
-    FinishTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT);
+    TraceStop();
 }
 
 void BytraceAdapter::StartConsumer(std::shared_ptr<PointerEvent> pointerEvent)
 {
     CHKPV(pointerEvent);
-    std::string traceInfo = "eventConsume pointerEventId:";
-    traceInfo += std::to_string(pointerEvent->GetId());
-    StartTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, traceInfo.c_str(), "");
+    if (!IsEnabled()) {
+        SkipSpan();
+        return;
+    }
+    char traceInfo[TRACE_MSG_SIZE];
+    FormatTrace(traceInfo, "eventConsume pointerEventId:%d", pointerEvent->GetId());
+    TraceStart(traceInfo);
 }
 
 void BytraceAdapter::StopConsumer()
 {
-    FinishTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT);
+    TraceStop();
 }
 
 void BytraceAdapter::StartConsumer(std::shared_ptr<KeyEvent> keyEvent)
 {
     CHKPV(keyEvent);
-    std::string traceInfo = "eventConsume keyEventId:";
-    traceInfo += std::to_string(keyEvent->GetId());
-    StartTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, traceInfo.c_str(), "");
+    if (!IsEnabled()) {
+        SkipSpan();
+        return;
+    }
+    char traceInfo[TRACE_MSG_SIZE];
+    FormatTrace(traceInfo, "eventConsume keyEventId:%d", keyEvent->GetId());
+    TraceStart(traceInfo);
 }
 
 void BytraceAdapter::StartPostTaskEvent(std::shared_ptr<PointerEvent> pointerEvent)
 {
     CHKPV(pointerEvent);
-    std::string traceInfo = "startpostEvent pointerEventId:";
-    traceInfo += std::to_string(pointerEvent->GetId());
-    StartTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, traceInfo.c_str(), "");
+    if (!IsEnabled()) {
+        SkipSpan();
+        return;
+    }
+    char traceInfo[TRACE_MSG_SIZE];
+    FormatTrace(traceInfo, "startpostEvent pointerEventId:%d", pointerEvent->GetId());
+    TraceStart(traceInfo);
 }
 
 void BytraceAdapter::StartPostTaskEvent(std::shared_ptr<KeyEvent> keyEvent)
 {
     CHKPV(keyEvent);
-    std::string traceInfo = "startpostEvent keyEventId:";
-    traceInfo += std::to_string(keyEvent->GetId());
-    StartTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, traceInfo.c_str(), "");
+    if (!IsEnabled()) {
+        SkipSpan();
+        return;
+    }
+    char traceInfo[TRACE_MSG_SIZE];
+    FormatTrace(traceInfo, "startpostEvent keyEventId:%d", keyEvent->GetId());
+    TraceStart(traceInfo);
 }
 
 void BytraceAdapter::StopPostTaskEvent()
 {
-    FinishTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT);
+    TraceStop();
 }
 
 void BytraceAdapter::StartSocketHandle(int32_t msgId)
 {
-    std::string traceInfo = "socketMsgHandle msgId:";
-    traceInfo += std::to_string(msgId);
-    StartTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, traceInfo.c_str(), "");
+    if (!IsEnabled()) {
+        SkipSpan();
+        return;
+    }
+    char traceInfo[TRACE_MSG_SIZE];
+    FormatTrace(traceInfo, "socketMsgHandle msgId:%d", msgId);
+    TraceStart(traceInfo);
 }
 
 void BytraceAdapter::StopSocketHandle()
 {
-    FinishTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT);
+    TraceStop();
 }
 
 void BytraceAdapter::StartDevListener(const std::string& type, int32_t deviceId)
@@ -424,79 +598,117 @@ void BytraceAdapter::StopLaunchAbility()
 
 void BytraceAdapter::MMIServiceTraceStart(int32_t type, const std::string& msg)
 {
-    std::string traceInfo = "trace type:";
-    traceInfo += std::to_string(type);
-    traceInfo += ", msg:";
-    traceInfo += msg;
-    StartTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, traceInfo.c_str(), "");
+    if (!IsEnabled()) {
+        SkipSpan();
+        return;
+    }
+    char traceInfo[TRACE_MSG_SIZE];
+    FormatTrace(traceInfo, "trace type:%d, msg:%s", type, msg.c_str());
+    TraceStart(traceInfo);
+}
+
+void BytraceAdapter::MMIServiceTraceStartFormat(int32_t type, const char *format, ...)
+{
+    if (!IsEnabled()) {
+        SkipSpan();
+        return;
+    }
+    char msg[TRACE_MSG_SIZE];
+    va_list args;
+    va_start(args, format);
+    if (vsnprintf_s(msg, sizeof(msg), sizeof(msg) - 1, format, args) == -1) {
+        msg[sizeof(msg) - 1] = '\0';
+    }
+    va_end(args);
+    char traceInfo[TRACE_MSG_SIZE];
+    FormatTrace(traceInfo, "trace type:%d, msg:%s", type, msg);
+    TraceStart(traceInfo);
 }
 
 void BytraceAdapter::MMIServiceTraceStop()
 {
-    FinishTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT);
+    TraceStop();
 }
 
 void BytraceAdapter::MMIClientTraceStart(int32_t type, const std::string& msg)
 {
-    std::string traceInfo = "client trace type:";
-    traceInfo += std::to_string(type);
-    traceInfo += ", msg:";
-    traceInfo += msg;
-    StartTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, traceInfo.c_str(), "");
+    if (!IsEnabled()) {
+        SkipSpan();
+        return;
+    }
+    char traceInfo[TRACE_MSG_SIZE];
+    FormatTrace(traceInfo, "client trace type:%d, msg:%s", type, msg.c_str());
+    TraceStart(traceInfo);
 }
 
 void BytraceAdapter::MMIClientTraceStop()
 {
-    FinishTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT);
+    TraceStop();
 }
 
 
 void BytraceAdapter::StartMarkedTracker(int32_t eventId)
 {
-    std::string traceInfo = "markProcessed eventId:";
-    traceInfo += std::to_string(eventId);
-    StartTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, traceInfo.c_str(), "");
+    if (!IsEnabled()) {
+        SkipSpan();
+        return;
+    }
+    char traceInfo[TRACE_MSG_SIZE];
+    FormatTrace(traceInfo, "markProcessed eventId:%d", eventId);
+    TraceStart(traceInfo);
 }
 
 void BytraceAdapter::StopMarkedTracker()
 {
-    FinishTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT);
+    TraceStop();
 }
 
 void BytraceAdapter::StartTouchEvent(int32_t pointerId)
 {
-    std::string traceInfo = "startTouchEvent pointerId:";
-    traceInfo += std::to_string(pointerId);
-    StartTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, traceInfo.c_str(), "");
+    if (!IsEnabled()) {
+        SkipSpan();
+        return;
+    }
+    char traceInfo[TRACE_MSG_SIZE];
+    FormatTrace(traceInfo, "startTouchEvent pointerId:%d", pointerId);
+    TraceStart(traceInfo);
 }
 
 void BytraceAdapter::StopTouchEvent()
 {
-    FinishTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT);
+    TraceStop();
 }
 
 void BytraceAdapter::StartToolType(int32_t toolType)
 {
-    std::string traceInfo = "current ToolType:";
-    traceInfo += std::to_string(toolType);
-    StartTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, traceInfo.c_str(), "");
+    if (!IsEnabled()) {
+        SkipSpan();
+        return;
+    }
+    char traceInfo[TRACE_MSG_SIZE];
+    FormatTrace(traceInfo, "current ToolType:%d", toolType);
+    TraceStart(traceInfo);
 }
 
 void BytraceAdapter::StopToolType()
 {
-    FinishTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT);
+    TraceStop();
 }
 
 void BytraceAdapter::StartTouchUp(int32_t pointerId)
 {
-    std::string traceInfo = "startTouchUp pointerId:";
-    traceInfo += std::to_string(pointerId);
-    StartTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT, traceInfo.c_str(), "");
+    if (!IsEnabled()) {
+        SkipSpan();
+        return;
+    }
+    char traceInfo[TRACE_MSG_SIZE];
+    FormatTrace(traceInfo, "startTouchUp pointerId:%d", pointerId);
+    TraceStart(traceInfo);
 }
 
 void BytraceAdapter::StopTouchUp()
 {
-    FinishTraceEx(HITRACE_LEVEL_INFO, HITRACE_TAG_MULTIMODALINPUT);
+    TraceStop();
 }
 
 void BytraceAdapter::StartUpdateDisplayMode(const std::string &modeMsg)
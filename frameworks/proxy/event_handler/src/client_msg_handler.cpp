@@ -267,8 +267,7 @@ int32_t ClientMsgHandler::OnPointerEvent(const UDSClient& client, NetPacket& pkt
     MMI_HILOGD("Report current pointer event, No:%{public}d,PA:%{public}s,PI:%{public}d,WI:%{public}d,DI:%{public}d",
         pointerEvent->GetId(), pointerEvent->DumpPointerAction(), pointerEvent->GetPointerId(),
         pointerEvent->GetTargetWindowId(), pointerEvent->GetTargetDisplayId());
-    std::list<PointerEvent::PointerItem> pointerItems{ pointerEvent->GetAllPointerItems() };
-    for (const auto &item : pointerItems) {
+    for (const auto &item : pointerEvent->GetPointerItems()) {
         MMI_HILOGD("Report pointer event,PI:%{public}d,WI:%{public}d,DX:%{private}d,DY:%{private}d"
             ",DXP:%{private}f,DYP:%{private}f,WXP:%{private}f,WYP:%{private}f,GX:%{private}f,GY:%{private}f,"
             "ToolType:%{public}d",
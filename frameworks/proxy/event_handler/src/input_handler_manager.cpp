@@ -549,7 +549,7 @@ void InputHandlerManager::GetConsumerInfos(std::shared_ptr<PointerEvent> pointer
     std::lock_guard guard(mtxHandlers_);
     int32_t consumerCount = 0;
     if (GetHandlerType() == InputHandlerType::MONITOR) {
-        lastPointerEvent_ = std::make_shared<PointerEvent>(*pointerEvent);
+        lastPointerEvent_ = PointerEvent::Clone(pointerEvent);
         consumerCount = GetMonitorConsumerInfos(pointerEvent, consumerInfos);
     }
     if (GetHandlerType() == InputHandlerType::INTERCEPTOR) {
@@ -765,7 +765,7 @@ void InputHandlerManager::OnInputEvent(std::shared_ptr<PointerEvent> pointerEven
     std::map<int32_t, std::shared_ptr<IInputEventConsumer>> consumerInfos;
     GetConsumerInfos(pointerEvent, deviceTags, consumerInfos);
     for (auto iter = consumerInfos.begin(); iter != consumerInfos.end(); ++iter) {
-        auto tempEvent = std::make_shared<PointerEvent>(*pointerEvent);
+        auto tempEvent = PointerEvent::Clone(pointerEvent);
         PointerEvent::PointerItem pointerItem;
         tempEvent->GetPointerItem(tempEvent->GetPointerId(), pointerItem);
         if (std::next(iter) == consumerInfos.end()) {
@@ -808,7 +808,7 @@ bool InputHandlerManager::RecoverPointerEvent(std::initializer_list<T> pointerAc
             item.SetPressed(false);
             lastPointerEvent_->UpdatePointerItem(pointerId, item);
             lastPointerEvent_->SetPointerAction(pointerActionEvent);
-            auto copiedPointerEvent = std::make_shared<PointerEvent>(*lastPointerEvent_);
+            auto copiedPointerEvent = PointerEvent::Clone(lastPointerEvent_);
             lock.unlock();
 #if defined(OHOS_BUILD_ENABLE_POINTER) || defined(OHOS_BUILD_ENABLE_TOUCH)
             OnInputEvent(copiedPointerEvent, DEVICE_TAGS);
@@ -295,6 +295,18 @@ void InputManagerImpl::SetEnhanceConfig(uint8_t *cfg, uint32_t cfgLen)
 
 int32_t InputManagerImpl::AddInputEventFilter(std::shared_ptr<IInputEventFilter> filter, int32_t priority,
     uint32_t deviceTags)
+{
+    return AddInputEventFilterInner(filter, priority, deviceTags, nullptr);
+}
+
+int32_t InputManagerImpl::AddInputEventFilter(std::shared_ptr<IInputEventFilter> filter, int32_t priority,
+    uint32_t deviceTags, const InputEventFilterRule &rule)
+{
+    return AddInputEventFilterInner(filter, priority, deviceTags, &rule);
+}
+
+int32_t InputManagerImpl::AddInputEventFilterInner(std::shared_ptr<IInputEventFilter> filter, int32_t priority,
+    uint32_t deviceTags, const InputEventFilterRule *rule)
 {
     CALL_DEBUG_ENTER;
     CHKPR(filter, RET_ERR);
@@ -314,7 +326,9 @@ int32_t InputManagerImpl::AddInputEventFilter(std::shared_ptr<IInputEventFilter>
         return RET_ERR;
     }
     const int32_t filterId = EventFilterService::GetNextId();
-    int32_t ret = MULTIMODAL_INPUT_CONNECT_MGR->AddInputEventFilter(service, filterId, priority, deviceTags);
+    int32_t ret = (rule != nullptr) ?
+        MULTIMODAL_INPUT_CONNECT_MGR->AddInputEventFilter(service, filterId, priority, deviceTags, *rule) :
+        MULTIMODAL_INPUT_CONNECT_MGR->AddInputEventFilter(service, filterId, priority, deviceTags);
     if (ret != RET_OK) {
         MMI_HILOGE("AddInputEventFilter has send to server failed, priority:%{public}d, ret:%{public}d", priority, ret);
         service = nullptr;
@@ -325,6 +339,9 @@ int32_t InputManagerImpl::AddInputEventFilter(std::shared_ptr<IInputEventFilter>
     if (!it.second) {
         MMI_HILOGW("filterId duplicate");
     }
+    if (rule != nullptr) {
+        eventFilterRules_.insert_or_assign(filterId, *rule);
+    }
     BytraceAdapter::MMIClientTraceStop();
     return filterId;
 }
@@ -390,8 +407,10 @@ int32_t InputManagerImpl::RemoveInputEventFilter(int32_t filterId)
     }
     if (filterId != -1) {
         eventFilterServices_.erase(it);
+        eventFilterRules_.erase(filterId);
     } else {
         eventFilterServices_.clear();
+        eventFilterRules_.clear();
     }
     MMI_HILOGI("Filter remove success");
     BytraceAdapter::MMIClientTraceStop();
@@ -705,7 +724,7 @@ void InputManagerImpl::OnPointerEvent(std::shared_ptr<PointerEvent> pointerEvent
         CHKPV(consumer_);
         eventHandler = eventHandler_;
         inputConsumer = consumer_;
-        lastPointerEvent_ = std::make_shared<PointerEvent>(*pointerEvent);
+        lastPointerEvent_ = PointerEvent::Clone(pointerEvent);
     }
     pointerEventRecorder_.PushEvent(pointerEvent);
     BytraceAdapter::StartBytrace(pointerEvent, BytraceAdapter::TRACE_STOP, BytraceAdapter::POINT_DISPATCH_EVENT);
@@ -1931,7 +1950,7 @@ bool InputManagerImpl::RecoverPointerEvent(std::initializer_list<T> pointerActio
     {
         std::lock_guard<std::mutex> guard(resourceMtx_);
         CHKPF(lastPointerEvent_);
-        currentPointerEvent = std::make_shared<PointerEvent>(*lastPointerEvent_);
+        currentPointerEvent = PointerEvent::Clone(lastPointerEvent_);
     }
 
     CHKPF(currentPointerEvent);
@@ -1950,7 +1969,7 @@ bool InputManagerImpl::RecoverPointerEvent(std::initializer_list<T> pointerActio
             currentPointerEvent->SetPointerAction(pointerActionEvent);
             OnPointerEvent(currentPointerEvent);
             if (currentPointerEvent->GetSourceType() == PointerEvent::SOURCE_TYPE_MOUSE) {
-                std::shared_ptr<PointerEvent> leaveWindowEvent = std::make_shared<PointerEvent>(*currentPointerEvent);
+                std::shared_ptr<PointerEvent> leaveWindowEvent = PointerEvent::Clone(currentPointerEvent);
                 if (leaveWindowEvent != nullptr) {
                     leaveWindowEvent->SetPointerAction(PointerEvent::POINTER_ACTION_LEAVE_WINDOW);
                     OnPointerEvent(leaveWindowEvent);
@@ -2118,7 +2137,10 @@ void InputManagerImpl::ReAddInputEventFilter()
     }
     for (const auto &[filterId, t] : eventFilterServices_) {
         const auto &[service, priority, deviceTags] = t;
-        int32_t ret = MULTIMODAL_INPUT_CONNECT_MGR->AddInputEventFilter(service, filterId, priority, deviceTags);
+        auto iter = eventFilterRules_.find(filterId);
+        int32_t ret = (iter != eventFilterRules_.end()) ?
+            MULTIMODAL_INPUT_CONNECT_MGR->AddInputEventFilter(service, filterId, priority, deviceTags, iter->second) :
+            MULTIMODAL_INPUT_CONNECT_MGR->AddInputEventFilter(service, filterId, priority, deviceTags);
         if (ret != RET_OK) {
             MMI_HILOGE("AddInputEventFilter has send to server failed, filterId:%{public}d, priority:%{public}d,"
                 "deviceTags:%{public}u, ret:%{public}d", filterId, priority, deviceTags, ret);
@@ -77,8 +77,7 @@ void PointerEventRecorder::PushEvent(const std::shared_ptr<PointerEvent> &event)
     record.pointerId = event->GetPointerId();
     record.itemPointerIds.clear();
     record.itemToolTypes.clear();
-    std::list<PointerEvent::PointerItem> pointerItems = event->GetAllPointerItems();
-    for (const auto &item : pointerItems) {
+    for (const auto &item : event->GetPointerItems()) {
         record.itemPointerIds.push_back(item.GetPointerId());
         record.itemToolTypes.push_back(item.GetToolType());
     }
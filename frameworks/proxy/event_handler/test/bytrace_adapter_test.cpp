@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "bytrace_adapter.h"
+#include "mmi_log.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "BytraceAdapterTest"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+constexpr size_t TRACE_POINT_COUNT { 4096 };
+constexpr uint32_t TRACE_POINT_MAGIC { 0x50544D4D };
+constexpr uint16_t TRACE_POINT_VERSION { 1 };
+constexpr int32_t EVENT_ID { 1000 };
+} // namespace
+
+class BytraceAdapterTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void) {}
+    void TearDown() override
+    {
+        BytraceAdapter::SetTraceMode(BytraceAdapter::TRACE_MODE_TEXT);
+    }
+};
+
+/**
+ * @tc.name: BytraceAdapterTest_RecordTracePoint_001
+ * @tc.desc: Verify trace points are only recorded in binary mode and keep event id, stage and source
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(BytraceAdapterTest, BytraceAdapterTest_RecordTracePoint_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    BytraceAdapter::SetTraceMode(BytraceAdapter::TRACE_MODE_TEXT);
+    size_t count = BytraceAdapter::GetTracePoints().size();
+    EXPECT_FALSE(BytraceAdapter::RecordTracePoint(EVENT_ID, BytraceAdapter::TRACE_STAGE_REPORT,
+        BytraceAdapter::TRACE_SOURCE_TOUCH));
+    EXPECT_EQ(BytraceAdapter::GetTracePoints().size(), count);
+
+    BytraceAdapter::SetTraceMode(BytraceAdapter::TRACE_MODE_BINARY);
+    EXPECT_EQ(BytraceAdapter::GetTraceMode(), BytraceAdapter::TRACE_MODE_BINARY);
+    EXPECT_TRUE(BytraceAdapter::RecordTracePoint(EVENT_ID, BytraceAdapter::TRACE_STAGE_REPORT,
+        BytraceAdapter::TRACE_SOURCE_TOUCH));
+    auto keyEvent = KeyEvent::Create();
+    ASSERT_NE(keyEvent, nullptr);
+    keyEvent->SetId(EVENT_ID + 1);
+    BytraceAdapter::StartBytrace(keyEvent, BytraceAdapter::KEY_LAUNCH_EVENT);
+
+    auto tracePoints = BytraceAdapter::GetTracePoints();
+    ASSERT_GE(tracePoints.size(), 2U);
+    const auto &touchPoint = tracePoints[tracePoints.size() - 2];
+    EXPECT_EQ(touchPoint.eventId, EVENT_ID);
+    EXPECT_EQ(touchPoint.stage, BytraceAdapter::TRACE_STAGE_REPORT);
+    EXPECT_EQ(touchPoint.source, BytraceAdapter::TRACE_SOURCE_TOUCH);
+    EXPECT_GT(touchPoint.time, 0);
+    const auto &keyPoint = tracePoints.back();
+    EXPECT_EQ(keyPoint.eventId, EVENT_ID + 1);
+    EXPECT_EQ(keyPoint.stage, BytraceAdapter::TRACE_STAGE_SERVICE_HANDLE_BASE + BytraceAdapter::KEY_LAUNCH_EVENT);
+    EXPECT_EQ(keyPoint.source, BytraceAdapter::TRACE_SOURCE_KEY);
+    EXPECT_GE(keyPoint.time, touchPoint.time);
+}
+
+/**
+ * @tc.name: BytraceAdapterTest_GetTracePoints_001
+ * @tc.desc: Verify the ring keeps the newest trace points in record order once it wraps
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(BytraceAdapterTest, BytraceAdapterTest_GetTracePoints_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    BytraceAdapter::SetTraceMode(BytraceAdapter::TRACE_MODE_BINARY);
+    int32_t total = static_cast<int32_t>(TRACE_POINT_COUNT) * 2 + 1;
+    for (int32_t eventId = 0; eventId < total; ++eventId) {
+        BytraceAdapter::RecordTracePoint(eventId, BytraceAdapter::TRACE_STAGE_REPORT_FINISH,
+            BytraceAdapter::TRACE_SOURCE_MOUSE);
+    }
+    auto tracePoints = BytraceAdapter::GetTracePoints();
+    ASSERT_EQ(tracePoints.size(), TRACE_POINT_COUNT);
+    int32_t firstId = total - static_cast<int32_t>(TRACE_POINT_COUNT);
+    for (size_t i = 0; i < tracePoints.size(); ++i) {
+        EXPECT_EQ(tracePoints[i].eventId, firstId + static_cast<int32_t>(i));
+        EXPECT_EQ(tracePoints[i].stage, BytraceAdapter::TRACE_STAGE_REPORT_FINISH);
+        EXPECT_EQ(tracePoints[i].source, BytraceAdapter::TRACE_SOURCE_MOUSE);
+    }
+}
+
+/**
+ * @tc.name: BytraceAdapterTest_DumpTracePoints_001
+ * @tc.desc: Verify the dump writes the header followed by the raw trace point records
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(BytraceAdapterTest, BytraceAdapterTest_DumpTracePoints_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    BytraceAdapter::SetTraceMode(BytraceAdapter::TRACE_MODE_BINARY);
+    BytraceAdapter::RecordTracePoint(EVENT_ID, BytraceAdapter::TRACE_STAGE_CLIENT_BASE,
+        BytraceAdapter::TRACE_SOURCE_KEY);
+    auto tracePoints = BytraceAdapter::GetTracePoints();
+    ASSERT_FALSE(tracePoints.empty());
+
+    FILE *file = tmpfile();
+    ASSERT_NE(file, nullptr);
+    int32_t fd = fileno(file);
+    BytraceAdapter::DumpTracePoints(fd);
+    ASSERT_EQ(lseek(fd, 0, SEEK_SET), 0);
+
+    BytraceAdapter::TracePointHeader header;
+    ASSERT_EQ(read(fd, &header, sizeof(header)), static_cast<ssize_t>(sizeof(header)));
+    EXPECT_EQ(header.magic, TRACE_POINT_MAGIC);
+    EXPECT_EQ(header.version, TRACE_POINT_VERSION);
+    EXPECT_EQ(header.recordSize, sizeof(BytraceAdapter::TracePoint));
+    ASSERT_EQ(header.count, tracePoints.size());
+
+    std::vector<BytraceAdapter::TracePoint> records(header.count);
+    ssize_t size = static_cast<ssize_t>(records.size() * sizeof(BytraceAdapter::TracePoint));
+    ASSERT_EQ(read(fd, records.data(), size), size);
+    EXPECT_EQ(records.back().eventId, EVENT_ID);
+    EXPECT_EQ(records.back().stage, BytraceAdapter::TRACE_STAGE_CLIENT_BASE);
+    EXPECT_EQ(records.back().source, BytraceAdapter::TRACE_SOURCE_KEY);
+    EXPECT_EQ(records.back().time, tracePoints.back().time);
+    fclose(file);
+}
+} // namespace MMI
+} // namespace OHOS
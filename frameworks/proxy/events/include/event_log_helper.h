@@ -253,7 +253,7 @@ private:
             event->GetPointerAction() == PointerEvent::POINTER_ACTION_FINGERPRINT_SLIDE) {
             return;
         }
-        std::list<PointerEvent::PointerItem> pointerItems{ event->GetAllPointerItems() };
+        const auto &pointerItems = event->GetPointerItems();
         std::string isSimulate = event->HasFlag(InputEvent::EVENT_FLAG_SIMULATE) ? "true" : "false";
         MMI_HILOGD("See InputTracking-Dict I:%{public}d, ET:%{public}s, AT:%{public}" PRId64
             ", PA:%{public}s, ST:%{public}s, DI:%{public}d, WI:%{public}d, DPT:%{public}d"
@@ -299,7 +299,7 @@ private:
     static void Print(const std::shared_ptr<PointerEvent> event, const LogHeader &lh)
     {
         PrintDebugDict();
-        std::list<PointerEvent::PointerItem> pointerItems{ event->GetAllPointerItems() };
+        const auto &pointerItems = event->GetPointerItems();
         std::string str;
         std::vector<uint8_t> buffer = event->GetBuffer();
         for (const auto &buff : buffer) {
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INPUT_EVENT_POOL_H
+#define INPUT_EVENT_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace OHOS {
+namespace MMI {
+/*
+ * Recycles the heap blocks of released input events. Each thread keeps its own free lists, so the thread
+ * streaming events reuses the blocks of the events it released. Blocks released on another thread than the
+ * one allocating them travel back through a shared depot in batches.
+ */
+class InputEventPool final {
+public:
+    static void *Alloc(size_t size);
+    static void Free(void *block, size_t size);
+    // Number of cached blocks of this size on the calling thread.
+    static int32_t GetCachedCount(size_t size);
+};
+
+// Allocator for std::allocate_shared, the event and its shared_ptr control block share one recycled block.
+template<typename T>
+class InputEventAllocator {
+public:
+    using value_type = T;
+
+    InputEventAllocator() = default;
+
+    template<typename U>
+    InputEventAllocator(const InputEventAllocator<U> &) noexcept {}
+
+    T *allocate(size_t count)
+    {
+        static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "Over-aligned types can not be pooled");
+        return static_cast<T *>(InputEventPool::Alloc(count * sizeof(T)));
+    }
+
+    void deallocate(T *block, size_t count) noexcept
+    {
+        InputEventPool::Free(block, count * sizeof(T));
+    }
+
+    template<typename U>
+    bool operator==(const InputEventAllocator<U> &) const noexcept
+    {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const InputEventAllocator<U> &) const noexcept
+    {
+        return false;
+    }
+};
+} // namespace MMI
+} // namespace OHOS
+#endif // INPUT_EVENT_POOL_H
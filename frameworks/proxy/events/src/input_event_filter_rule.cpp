@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "input_event_filter_rule.h"
+
+#include "mmi_log.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "InputEventFilterRule"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr int32_t MAX_MASK_BIT { 64 };
+constexpr size_t MAX_KEY_CODES { 512 };
+constexpr size_t MAX_REGIONS { 16 };
+
+bool SetBit(uint64_t &mask, int32_t value)
+{
+    if ((value < 0) || (value >= MAX_MASK_BIT)) {
+        return false;
+    }
+    mask |= (uint64_t { 1 } << value);
+    return true;
+}
+
+bool TestBit(uint64_t mask, int32_t value)
+{
+    if (mask == 0) {
+        return true;
+    }
+    if ((value < 0) || (value >= MAX_MASK_BIT)) {
+        return false;
+    }
+    return ((mask & (uint64_t { 1 } << value)) != 0);
+}
+} // namespace
+
+bool InputEventFilterRule::AddSourceType(int32_t sourceType)
+{
+    return SetBit(sourceTypes_, sourceType);
+}
+
+bool InputEventFilterRule::AddPointerAction(int32_t pointerAction)
+{
+    return SetBit(pointerActions_, pointerAction);
+}
+
+bool InputEventFilterRule::AddKeyAction(int32_t keyAction)
+{
+    return SetBit(keyActions_, keyAction);
+}
+
+bool InputEventFilterRule::AddKeyCode(int32_t keyCode)
+{
+    if (keyCodes_.size() >= MAX_KEY_CODES) {
+        MMI_HILOGE("Too many key codes");
+        return false;
+    }
+    keyCodes_.insert(keyCode);
+    return true;
+}
+
+bool InputEventFilterRule::AddRegion(const Region &region)
+{
+    if ((region.width <= 0) || (region.height <= 0)) {
+        MMI_HILOGE("Empty region");
+        return false;
+    }
+    if (regions_.size() >= MAX_REGIONS) {
+        MMI_HILOGE("Too many regions");
+        return false;
+    }
+    regions_.push_back(region);
+    return true;
+}
+
+bool InputEventFilterRule::Match(const KeyEvent &keyEvent) const
+{
+    if (!TestBit(keyActions_, keyEvent.GetKeyAction())) {
+        return false;
+    }
+    return (keyCodes_.empty() || (keyCodes_.find(keyEvent.GetKeyCode()) != keyCodes_.cend()));
+}
+
+bool InputEventFilterRule::Match(const PointerEvent &pointerEvent) const
+{
+    if (!TestBit(sourceTypes_, pointerEvent.GetSourceType()) ||
+        !TestBit(pointerActions_, pointerEvent.GetPointerAction())) {
+        return false;
+    }
+    return (regions_.empty() || MatchRegions(pointerEvent));
+}
+
+bool InputEventFilterRule::MatchRegions(const PointerEvent &pointerEvent) const
+{
+    const PointerEvent::PointerItem *item = pointerEvent.FindPointerItem(pointerEvent.GetPointerId());
+    if (item == nullptr) {
+        return false;
+    }
+    int32_t displayId = pointerEvent.GetTargetDisplayId();
+    int64_t x = item->GetDisplayX();
+    int64_t y = item->GetDisplayY();
+    for (const auto &region : regions_) {
+        if ((region.displayId >= 0) && (region.displayId != displayId)) {
+            continue;
+        }
+        if ((x >= region.x) && (x < static_cast<int64_t>(region.x) + region.width) &&
+            (y >= region.y) && (y < static_cast<int64_t>(region.y) + region.height)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool InputEventFilterRule::Marshalling(Parcel &parcel) const
+{
+    if (!parcel.WriteUint64(sourceTypes_) || !parcel.WriteUint64(pointerActions_) ||
+        !parcel.WriteUint64(keyActions_) || !parcel.WriteUint32(static_cast<uint32_t>(keyCodes_.size()))) {
+        return false;
+    }
+    for (const auto keyCode : keyCodes_) {
+        if (!parcel.WriteInt32(keyCode)) {
+            return false;
+        }
+    }
+    if (!parcel.WriteUint32(static_cast<uint32_t>(regions_.size()))) {
+        return false;
+    }
+    for (const auto &region : regions_) {
+        if (!parcel.WriteInt32(region.displayId) || !parcel.WriteInt32(region.x) || !parcel.WriteInt32(region.y) ||
+            !parcel.WriteInt32(region.width) || !parcel.WriteInt32(region.height)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool InputEventFilterRule::ReadFromParcel(Parcel &parcel)
+{
+    uint32_t nKeyCodes = 0;
+    if (!parcel.ReadUint64(sourceTypes_) || !parcel.ReadUint64(pointerActions_) ||
+        !parcel.ReadUint64(keyActions_) || !parcel.ReadUint32(nKeyCodes)) {
+        return false;
+    }
+    if (nKeyCodes > MAX_KEY_CODES) {
+        MMI_HILOGE("Too many key codes:%{public}u", nKeyCodes);
+        return false;
+    }
+    keyCodes_.clear();
+    for (uint32_t i = 0; i < nKeyCodes; ++i) {
+        int32_t keyCode = 0;
+        if (!parcel.ReadInt32(keyCode)) {
+            return false;
+        }
+        keyCodes_.insert(keyCode);
+    }
+    uint32_t nRegions = 0;
+    if (!parcel.ReadUint32(nRegions)) {
+        return false;
+    }
+    if (nRegions > MAX_REGIONS) {
+        MMI_HILOGE("Too many regions:%{public}u", nRegions);
+        return false;
+    }
+    regions_.clear();
+    for (uint32_t i = 0; i < nRegions; ++i) {
+        Region region;
+        if (!parcel.ReadInt32(region.displayId) || !parcel.ReadInt32(region.x) || !parcel.ReadInt32(region.y) ||
+            !parcel.ReadInt32(region.width) || !parcel.ReadInt32(region.height)) {
+            return false;
+        }
+        regions_.push_back(region);
+    }
+    return true;
+}
+
+InputEventFilterRule* InputEventFilterRule::Unmarshalling(Parcel &parcel)
+{
+    auto data = new (std::nothrow) InputEventFilterRule();
+    if (data && !data->ReadFromParcel(parcel)) {
+        delete data;
+        data = nullptr;
+    }
+    return data;
+}
+} // namespace MMI
+} // namespace OHOS
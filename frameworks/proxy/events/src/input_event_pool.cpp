@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "input_event_pool.h"
+
+#include <mutex>
+#include <new>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+// Block sizes in use are those of pooled pointer events and key events.
+constexpr int32_t POOL_SIZE_CLASSES { 4 };
+constexpr int32_t LOCAL_CACHE_SIZE { 32 };
+constexpr int32_t DEPOT_CACHE_SIZE { 256 };
+constexpr int32_t TRANSFER_BATCH { LOCAL_CACHE_SIZE / 2 };
+
+template<int32_t CAPACITY>
+struct FreeList {
+    size_t blockSize { 0 };
+    void *blocks[CAPACITY] {};
+    int32_t count { 0 };
+};
+
+template<int32_t CAPACITY>
+FreeList<CAPACITY> *FindFreeList(FreeList<CAPACITY> (&freeLists)[POOL_SIZE_CLASSES], size_t size)
+{
+    for (auto &freeList : freeLists) {
+        if (freeList.blockSize == size) {
+            return &freeList;
+        }
+        if (freeList.blockSize == 0) {
+            freeList.blockSize = size;
+            return &freeList;
+        }
+    }
+    return nullptr;
+}
+
+template<int32_t FROM, int32_t TO>
+void MoveBlocks(FreeList<FROM> &from, FreeList<TO> &to, int32_t count)
+{
+    while ((count-- > 0) && (from.count > 0) && (to.count < TO)) {
+        to.blocks[to.count++] = from.blocks[--from.count];
+    }
+}
+
+// Blocks released by threads whose own cache is full, until a thread allocating the same size takes them back.
+class EventBlockDepot final {
+public:
+    EventBlockDepot() = default;
+    DISALLOW_COPY_AND_MOVE(EventBlockDepot);
+
+    void Take(FreeList<LOCAL_CACHE_SIZE> &local, int32_t count)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        FreeList<DEPOT_CACHE_SIZE> *freeList = FindFreeList(freeLists_, local.blockSize);
+        if (freeList != nullptr) {
+            MoveBlocks(*freeList, local, count);
+        }
+    }
+
+    void Put(FreeList<LOCAL_CACHE_SIZE> &local, int32_t count)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        FreeList<DEPOT_CACHE_SIZE> *freeList = FindFreeList(freeLists_, local.blockSize);
+        if (freeList != nullptr) {
+            MoveBlocks(local, *freeList, count);
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    FreeList<DEPOT_CACHE_SIZE> freeLists_[POOL_SIZE_CLASSES];
+};
+
+// Events may still be released while static objects are destroyed, the depot is never torn down.
+__attribute__((no_destroy)) EventBlockDepot g_depot;
+thread_local bool g_cacheDestroyed { false };
+
+class EventBlockCache final {
+public:
+    EventBlockCache() = default;
+    ~EventBlockCache()
+    {
+        g_cacheDestroyed = true;
+        for (auto &freeList : freeLists_) {
+            if (freeList.blockSize == 0) {
+                continue;
+            }
+            g_depot.Put(freeList, LOCAL_CACHE_SIZE);
+            while (freeList.count > 0) {
+                ::operator delete(freeList.blocks[--freeList.count]);
+            }
+        }
+    }
+    DISALLOW_COPY_AND_MOVE(EventBlockCache);
+
+    void *Alloc(size_t size)
+    {
+        FreeList<LOCAL_CACHE_SIZE> *freeList = FindFreeList(freeLists_, size);
+        if (freeList == nullptr) {
+            return ::operator new(size);
+        }
+        if (freeList->count == 0) {
+            g_depot.Take(*freeList, TRANSFER_BATCH);
+        }
+        if (freeList->count > 0) {
+            return freeList->blocks[--freeList->count];
+        }
+        return ::operator new(size);
+    }
+
+    void Free(void *block, size_t size)
+    {
+        FreeList<LOCAL_CACHE_SIZE> *freeList = FindFreeList(freeLists_, size);
+        if (freeList == nullptr) {
+            ::operator delete(block);
+            return;
+        }
+        if (freeList->count == LOCAL_CACHE_SIZE) {
+            g_depot.Put(*freeList, TRANSFER_BATCH);
+        }
+        if (freeList->count < LOCAL_CACHE_SIZE) {
+            freeList->blocks[freeList->count++] = block;
+            return;
+        }
+        ::operator delete(block);
+    }
+
+    int32_t GetCachedCount(size_t size)
+    {
+        FreeList<LOCAL_CACHE_SIZE> *freeList = FindFreeList(freeLists_, size);
+        return (freeList != nullptr) ? freeList->count : 0;
+    }
+
+private:
+    FreeList<LOCAL_CACHE_SIZE> freeLists_[POOL_SIZE_CLASSES];
+};
+
+EventBlockCache *GetCache()
+{
+    if (g_cacheDestroyed) {
+        return nullptr;
+    }
+    thread_local EventBlockCache cache;
+    return &cache;
+}
+} // namespace
+
+void *InputEventPool::Alloc(size_t size)
+{
+    EventBlockCache *cache = GetCache();
+    if (cache == nullptr) {
+        return ::operator new(size);
+    }
+    return cache->Alloc(size);
+}
+
+void InputEventPool::Free(void *block, size_t size)
+{
+    if (block == nullptr) {
+        return;
+    }
+    EventBlockCache *cache = GetCache();
+    if (cache == nullptr) {
+        ::operator delete(block);
+        return;
+    }
+    cache->Free(block, size);
+}
+
+int32_t InputEventPool::GetCachedCount(size_t size)
+{
+    EventBlockCache *cache = GetCache();
+    return (cache != nullptr) ? cache->GetCachedCount(size) : 0;
+}
+} // namespace MMI
+} // namespace OHOS
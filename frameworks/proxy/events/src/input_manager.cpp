@@ -87,6 +87,12 @@ int32_t InputManager::AddInputEventFilter(std::shared_ptr<IInputEventFilter> fil
     return InputMgrImpl.AddInputEventFilter(filter, priority, deviceTags);
 }
 
+int32_t InputManager::AddInputEventFilter(std::shared_ptr<IInputEventFilter> filter, int32_t priority,
+    uint32_t deviceTags, const InputEventFilterRule &rule)
+{
+    return InputMgrImpl.AddInputEventFilter(filter, priority, deviceTags, rule);
+}
+
 int32_t InputManager::RemoveInputEventFilter(int32_t filterId)
 {
     return InputMgrImpl.RemoveInputEventFilter(filterId);
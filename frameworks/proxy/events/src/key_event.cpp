@@ -15,6 +15,7 @@
 
 #include "key_event.h"
 
+#include "input_event_pool.h"
 #include "mmi_log.h"
 
 #undef MMI_LOG_TAG
@@ -446,6 +447,14 @@ const std::map <int32_t, std::string> KEYCODE_TO_STRING = {
 #endif // OHOS_BUILD_ENABLE_WATCH
 };
 } // namespace
+
+// Reaches the protected constructors for std::allocate_shared, it adds nothing to KeyEvent.
+class PooledKeyEvent final : public KeyEvent {
+public:
+    PooledKeyEvent() : KeyEvent(InputEvent::EVENT_TYPE_KEY) {}
+    explicit PooledKeyEvent(const KeyEvent &other) : KeyEvent(other) {}
+};
+
 const int32_t KeyEvent::UNKNOWN_FUNCTION_KEY = -1;
 const int32_t KeyEvent::NUM_LOCK_FUNCTION_KEY = 0;
 const int32_t KeyEvent::CAPS_LOCK_FUNCTION_KEY = 1;
@@ -1045,9 +1054,7 @@ KeyEvent::~KeyEvent() {}
 
 std::shared_ptr<KeyEvent> KeyEvent::Create()
 {
-    auto event = std::shared_ptr<KeyEvent>(new (std::nothrow) KeyEvent(InputEvent::EVENT_TYPE_KEY));
-    CHKPP(event);
-    return event;
+    return std::allocate_shared<PooledKeyEvent>(InputEventAllocator<PooledKeyEvent>());
 }
 
 void KeyEvent::Reset()
@@ -1273,9 +1280,7 @@ std::shared_ptr<KeyEvent> KeyEvent::Clone(std::shared_ptr<KeyEvent> keyEvent)
     if (!keyEvent) {
         return nullptr;
     }
-    auto event = std::shared_ptr<KeyEvent>(new (std::nothrow) KeyEvent(*keyEvent.get()));
-    CHKPP(event);
-    return event;
+    return std::allocate_shared<PooledKeyEvent>(InputEventAllocator<PooledKeyEvent>(), *keyEvent);
 }
 
 bool KeyEvent::IsValidKeyItem() const
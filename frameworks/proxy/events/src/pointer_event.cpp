@@ -15,6 +15,9 @@
 
 #include "pointer_event.h"
 
+#include <algorithm>
+
+#include "input_event_pool.h"
 #include "mmi_log.h"
 
 #undef MMI_LOG_TAG
@@ -26,7 +29,6 @@ namespace MMI {
 namespace {
 constexpr double MAX_PRESSURE { 1.0 };
 constexpr size_t MAX_N_PRESSED_BUTTONS { 10 };
-constexpr size_t MAX_N_POINTER_ITEMS { 10 };
 constexpr int32_t SIMULATE_EVENT_START_ID { 10000 };
 #ifdef OHOS_BUILD_ENABLE_SECURITY_COMPONENT
 constexpr size_t MAX_N_ENHANCE_DATA_SIZE { 64 };
@@ -35,6 +37,13 @@ constexpr size_t MAX_N_BUFFER_SIZE { 512 };
 constexpr size_t MAX_N_PRESSED_KEYS { 10 };
 } // namespace
 
+// Reaches the protected constructors for std::allocate_shared, it adds nothing to PointerEvent.
+class PooledPointerEvent final : public PointerEvent {
+public:
+    PooledPointerEvent() : PointerEvent(InputEvent::EVENT_TYPE_POINTER) {}
+    explicit PooledPointerEvent(const PointerEvent &other) : PointerEvent(other) {}
+};
+
 std::shared_ptr<PointerEvent> PointerEvent::from(std::shared_ptr<InputEvent> inputEvent)
 {
     return nullptr;
@@ -474,6 +483,16 @@ void PointerEvent::PointerItem::SetCanceled(bool canceled)
     canceled_ = canceled;
 }
 
+bool PointerEvent::PointerItem::IsChanged() const
+{
+    return changed_;
+}
+
+void PointerEvent::PointerItem::SetChanged(bool changed)
+{
+    changed_ = changed;
+}
+
 void PointerEvent::PointerItem::SetOrientation(int32_t orientation)
 {
     orientation_ = orientation;
@@ -625,7 +644,8 @@ bool PointerEvent::PointerItem::WriteToParcel(Parcel &out) const
         out.WriteBool(visible_) &&
         out.WriteInt32(style_) &&
         out.WriteInt32(sizeLevel_) &&
-        out.WriteUint32(color_)
+        out.WriteUint32(color_) &&
+        out.WriteBool(changed_)
     );
 }
 
@@ -674,10 +694,43 @@ bool PointerEvent::PointerItem::ReadFromParcel(Parcel &in)
         in.ReadBool(visible_) &&
         in.ReadInt32(style_) &&
         in.ReadInt32(sizeLevel_) &&
-        in.ReadUint32(color_)
+        in.ReadUint32(color_) &&
+        in.ReadBool(changed_)
     );
 }
 
+PointerEvent::PointerItemStore::PointerItemStore(const PointerItemStore &other) : size_(other.size_)
+{
+    std::copy(other.begin(), other.end(), items_.begin());
+}
+
+PointerEvent::PointerItemStore& PointerEvent::PointerItemStore::operator=(const PointerItemStore &other)
+{
+    if (this != &other) {
+        std::copy(other.begin(), other.end(), items_.begin());
+        size_ = other.size_;
+    }
+    return *this;
+}
+
+bool PointerEvent::PointerItemStore::push_back(const PointerItem &item)
+{
+    if (size_ >= items_.size()) {
+        MMI_HILOGE("Exceed maximum allowed number of pointer items");
+        return false;
+    }
+    items_[size_++] = item;
+    return true;
+}
+
+PointerEvent::PointerItemStore::iterator PointerEvent::PointerItemStore::erase(const_iterator pos)
+{
+    auto target = begin() + (pos - begin());
+    std::move(target + 1, end(), target);
+    --size_;
+    return target;
+}
+
 PointerEvent::PointerEvent(int32_t eventType) : InputEvent(eventType) {}
 
 PointerEvent::PointerEvent(const PointerEvent& other)
@@ -713,9 +766,13 @@ PointerEvent::~PointerEvent() {}
 
 std::shared_ptr<PointerEvent> PointerEvent::Create()
 {
-    auto event = std::shared_ptr<PointerEvent>(new (std::nothrow) PointerEvent(InputEvent::EVENT_TYPE_POINTER));
-    CHKPP(event);
-    return event;
+    return std::allocate_shared<PooledPointerEvent>(InputEventAllocator<PooledPointerEvent>());
+}
+
+std::shared_ptr<PointerEvent> PointerEvent::Clone(std::shared_ptr<PointerEvent> pointerEvent)
+{
+    CHKPP(pointerEvent);
+    return std::allocate_shared<PooledPointerEvent>(InputEventAllocator<PooledPointerEvent>(), *pointerEvent);
 }
 
 void PointerEvent::Reset()
@@ -934,14 +991,33 @@ void PointerEvent::SetPointerId(int32_t pointerId)
 }
 
 bool PointerEvent::GetPointerItem(int32_t pointerId, PointerItem &pointerItem) const
+{
+    const PointerItem *item = FindPointerItem(pointerId);
+    if (item == nullptr) {
+        return false;
+    }
+    pointerItem = *item;
+    return true;
+}
+
+const PointerEvent::PointerItem* PointerEvent::FindPointerItem(int32_t pointerId) const
 {
     for (const auto &item : pointers_) {
         if (item.GetPointerId() == pointerId) {
-            pointerItem = item;
-            return true;
+            return &item;
         }
     }
-    return false;
+    return nullptr;
+}
+
+PointerEvent::PointerItem* PointerEvent::FindPointerItem(int32_t pointerId)
+{
+    for (auto &item : pointers_) {
+        if (item.GetPointerId() == pointerId) {
+            return &item;
+        }
+    }
+    return nullptr;
 }
 
 bool PointerEvent::GetOriginPointerItem(int32_t pointerId, PointerItem &pointerItem) const
@@ -1046,6 +1122,7 @@ int32_t PointerEvent::GetPointerCount() const
 std::vector<int32_t> PointerEvent::GetPointerIds() const
 {
     std::vector<int32_t> pointerIdList;
+    pointerIdList.reserve(pointers_.size());
     for (const auto &item : pointers_) {
         pointerIdList.push_back(item.GetPointerId());
     }
@@ -1053,6 +1130,11 @@ std::vector<int32_t> PointerEvent::GetPointerIds() const
 }
 
 std::list<PointerEvent::PointerItem> PointerEvent::GetAllPointerItems() const
+{
+    return std::list<PointerItem>(pointers_.begin(), pointers_.end());
+}
+
+const PointerEvent::PointerItemStore& PointerEvent::GetPointerItems() const
 {
     return pointers_;
 }
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <list>
+#include <new>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "pointer_event.h"
+
+namespace {
+std::atomic<int64_t> g_allocCount { 0 };
+} // namespace
+
+void *operator new(size_t size)
+{
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    void *ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr int32_t FINGERS { 10 };
+constexpr int32_t FINGER_DISTANCE { 50 };
+
+PointerEvent::PointerItem CreatePointerItem(int32_t pointerId)
+{
+    PointerEvent::PointerItem item;
+    item.SetPointerId(pointerId);
+    item.SetDisplayX(pointerId * FINGER_DISTANCE);
+    item.SetDisplayY(pointerId * FINGER_DISTANCE);
+    item.SetPressed(true);
+    return item;
+}
+
+std::shared_ptr<PointerEvent> CreateTouchMove()
+{
+    auto pointerEvent = PointerEvent::Create();
+    pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+    pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
+    for (int32_t i = 0; i < FINGERS; ++i) {
+        PointerEvent::PointerItem item = CreatePointerItem(i);
+        pointerEvent->AddPointerItem(item);
+    }
+    pointerEvent->SetPointerId(0);
+    return pointerEvent;
+}
+
+// Storage used by PointerEvent before the inline store: a list searched and copied out by id.
+class ListPointers {
+public:
+    void AddPointerItem(const PointerEvent::PointerItem &item)
+    {
+        pointers_.push_back(item);
+    }
+
+    bool GetPointerItem(int32_t pointerId, PointerEvent::PointerItem &item) const
+    {
+        for (const auto &pointer : pointers_) {
+            if (pointer.GetPointerId() == pointerId) {
+                item = pointer;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<int32_t> GetPointerIds() const
+    {
+        std::vector<int32_t> pointerIds;
+        for (const auto &pointer : pointers_) {
+            pointerIds.push_back(pointer.GetPointerId());
+        }
+        return pointerIds;
+    }
+
+    std::list<PointerEvent::PointerItem> GetAllPointerItems() const
+    {
+        return pointers_;
+    }
+
+private:
+    std::list<PointerEvent::PointerItem> pointers_;
+};
+
+void ReportAllocs(benchmark::State &state, int64_t allocsBefore)
+{
+    int64_t allocs = g_allocCount.load(std::memory_order_relaxed) - allocsBefore;
+    state.counters["AllocsPerEvent"] = benchmark::Counter(static_cast<double>(allocs),
+        benchmark::Counter::kAvgIterations);
+}
+
+// What a touch move costs the consumers that walk every finger: ids, then one copy per id.
+void BM_ListPointersPerFinger(benchmark::State &state)
+{
+    ListPointers pointers;
+    for (int32_t i = 0; i < FINGERS; ++i) {
+        pointers.AddPointerItem(CreatePointerItem(i));
+    }
+    int64_t allocsBefore = g_allocCount.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        int32_t sum = 0;
+        for (int32_t pointerId : pointers.GetPointerIds()) {
+            PointerEvent::PointerItem item;
+            if (pointers.GetPointerItem(pointerId, item)) {
+                sum += item.GetDisplayX();
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    ReportAllocs(state, allocsBefore);
+}
+BENCHMARK(BM_ListPointersPerFinger);
+
+void BM_PointerStorePerFinger(benchmark::State &state)
+{
+    auto pointerEvent = CreateTouchMove();
+    int64_t allocsBefore = g_allocCount.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        int32_t sum = 0;
+        for (const auto &item : pointerEvent->GetPointerItems()) {
+            sum += item.GetDisplayX();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    ReportAllocs(state, allocsBefore);
+}
+BENCHMARK(BM_PointerStorePerFinger);
+
+void BM_ListPointersCopyAll(benchmark::State &state)
+{
+    ListPointers pointers;
+    for (int32_t i = 0; i < FINGERS; ++i) {
+        pointers.AddPointerItem(CreatePointerItem(i));
+    }
+    int64_t allocsBefore = g_allocCount.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        auto items = pointers.GetAllPointerItems();
+        benchmark::DoNotOptimize(items.size());
+    }
+    ReportAllocs(state, allocsBefore);
+}
+BENCHMARK(BM_ListPointersCopyAll);
+
+// Heap events as created before the event pool, one allocation for the event and one for its control block.
+class HeapPointerEvent final : public PointerEvent {
+public:
+    HeapPointerEvent() : PointerEvent(InputEvent::EVENT_TYPE_POINTER) {}
+    explicit HeapPointerEvent(const PointerEvent &other) : PointerEvent(other) {}
+};
+
+// The client creates one event per received touch move and releases it once dispatched.
+void BM_HeapPointerEventCreate(benchmark::State &state)
+{
+    int64_t allocsBefore = g_allocCount.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        std::shared_ptr<PointerEvent> pointerEvent(new HeapPointerEvent());
+        benchmark::DoNotOptimize(pointerEvent.get());
+    }
+    ReportAllocs(state, allocsBefore);
+}
+BENCHMARK(BM_HeapPointerEventCreate);
+
+void BM_PooledPointerEventCreate(benchmark::State &state)
+{
+    int64_t allocsBefore = g_allocCount.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        auto pointerEvent = PointerEvent::Create();
+        benchmark::DoNotOptimize(pointerEvent.get());
+    }
+    ReportAllocs(state, allocsBefore);
+}
+BENCHMARK(BM_PooledPointerEventCreate);
+
+// The server copies the event for each target that needs a private copy, the client keeps the last one.
+void BM_HeapPointerEventClone(benchmark::State &state)
+{
+    auto pointerEvent = CreateTouchMove();
+    int64_t allocsBefore = g_allocCount.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        std::shared_ptr<PointerEvent> copy(new HeapPointerEvent(*pointerEvent));
+        benchmark::DoNotOptimize(copy->GetPointerCount());
+    }
+    ReportAllocs(state, allocsBefore);
+}
+BENCHMARK(BM_HeapPointerEventClone);
+
+void BM_PooledPointerEventClone(benchmark::State &state)
+{
+    auto pointerEvent = CreateTouchMove();
+    int64_t allocsBefore = g_allocCount.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        auto copy = PointerEvent::Clone(pointerEvent);
+        benchmark::DoNotOptimize(copy->GetPointerCount());
+    }
+    ReportAllocs(state, allocsBefore);
+}
+BENCHMARK(BM_PooledPointerEventClone);
+
+void BM_PointerStoreFind(benchmark::State &state)
+{
+    auto pointerEvent = CreateTouchMove();
+    int64_t allocsBefore = g_allocCount.load(std::memory_order_relaxed);
+    int32_t pointerId = 0;
+    for (auto _ : state) {
+        const PointerEvent::PointerItem *item = pointerEvent->FindPointerItem(pointerId);
+        benchmark::DoNotOptimize(item);
+        pointerId = (pointerId + 1) % FINGERS;
+    }
+    ReportAllocs(state, allocsBefore);
+}
+BENCHMARK(BM_PointerStoreFind);
+
+void BM_ListPointersFind(benchmark::State &state)
+{
+    ListPointers pointers;
+    for (int32_t i = 0; i < FINGERS; ++i) {
+        pointers.AddPointerItem(CreatePointerItem(i));
+    }
+    int64_t allocsBefore = g_allocCount.load(std::memory_order_relaxed);
+    int32_t pointerId = 0;
+    for (auto _ : state) {
+        PointerEvent::PointerItem item;
+        benchmark::DoNotOptimize(pointers.GetPointerItem(pointerId, item));
+        pointerId = (pointerId + 1) % FINGERS;
+    }
+    ReportAllocs(state, allocsBefore);
+}
+BENCHMARK(BM_ListPointersFind);
+} // namespace
+} // namespace MMI
+} // namespace OHOS
+
+BENCHMARK_MAIN();
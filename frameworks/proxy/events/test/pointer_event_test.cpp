@@ -3402,5 +3402,112 @@ HWTEST_F(PointerEventTest, PointerEventTest_SetCallingUid_001, TestSize.Level2)
     ASSERT_EQ(pointerEvent->GetCallingUid(), callingUid);
 }
 
+/**
+ * @tc.name: PointerEventTest_FindPointerItem_001
+ * @tc.desc: Verify FindPointerItem and GetPointerItems access the stored items in place
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PointerEventTest, PointerEventTest_FindPointerItem_001, TestSize.Level2)
+{
+    CALL_TEST_DEBUG;
+    auto pointerEvent = PointerEvent::Create();
+    ASSERT_NE(pointerEvent, nullptr);
+    for (int32_t i = 0; i < static_cast<int32_t>(PointerEvent::MAX_N_POINTER_ITEMS); ++i) {
+        PointerEvent::PointerItem item;
+        item.SetPointerId(i);
+        item.SetDisplayX(i);
+        pointerEvent->AddPointerItem(item);
+    }
+    EXPECT_EQ(pointerEvent->GetPointerItems().size(), PointerEvent::MAX_N_POINTER_ITEMS);
+    EXPECT_EQ(pointerEvent->FindPointerItem(static_cast<int32_t>(PointerEvent::MAX_N_POINTER_ITEMS)), nullptr);
+
+    PointerEvent::PointerItem *item = pointerEvent->FindPointerItem(1);
+    ASSERT_NE(item, nullptr);
+    item->SetDisplayX(100);
+    PointerEvent::PointerItem copy;
+    ASSERT_TRUE(pointerEvent->GetPointerItem(1, copy));
+    EXPECT_EQ(copy.GetDisplayX(), 100);
+
+    pointerEvent->RemovePointerItem(0);
+    const auto &items = pointerEvent->GetPointerItems();
+    ASSERT_EQ(items.size(), PointerEvent::MAX_N_POINTER_ITEMS - 1);
+    EXPECT_EQ(items.front().GetPointerId(), 1);
+    EXPECT_EQ(pointerEvent->FindPointerItem(0), nullptr);
+}
+
+/**
+ * @tc.name: PointerEventTest_Clone_001
+ * @tc.desc: Verify Clone copies the pointer event and rejects nullptr
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PointerEventTest, PointerEventTest_Clone_001, TestSize.Level2)
+{
+    CALL_TEST_DEBUG;
+    EXPECT_EQ(PointerEvent::Clone(nullptr), nullptr);
+    auto pointerEvent = PointerEvent::Create();
+    ASSERT_NE(pointerEvent, nullptr);
+    pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
+    PointerEvent::PointerItem item;
+    item.SetPointerId(1);
+    item.SetDisplayX(100);
+    pointerEvent->AddPointerItem(item);
+    pointerEvent->SetPointerId(1);
+
+    auto copy = PointerEvent::Clone(pointerEvent);
+    ASSERT_NE(copy, nullptr);
+    EXPECT_NE(copy, pointerEvent);
+    EXPECT_EQ(copy->GetPointerAction(), PointerEvent::POINTER_ACTION_MOVE);
+    EXPECT_EQ(copy->GetPointerId(), 1);
+    const PointerEvent::PointerItem *copiedItem = copy->FindPointerItem(1);
+    ASSERT_NE(copiedItem, nullptr);
+    EXPECT_EQ(copiedItem->GetDisplayX(), 100);
+}
+
+/**
+ * @tc.name: PointerEventTest_Create_Recycle_001
+ * @tc.desc: Verify a released pointer event hands its storage to the next one, which starts fresh
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PointerEventTest, PointerEventTest_Create_Recycle_001, TestSize.Level2)
+{
+    CALL_TEST_DEBUG;
+    auto pointerEvent = PointerEvent::Create();
+    ASSERT_NE(pointerEvent, nullptr);
+    PointerEvent::PointerItem item;
+    item.SetPointerId(0);
+    pointerEvent->AddPointerItem(item);
+    pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_DOWN);
+    const PointerEvent *released = pointerEvent.get();
+    pointerEvent.reset();
+
+    auto recycled = PointerEvent::Create();
+    ASSERT_NE(recycled, nullptr);
+    EXPECT_EQ(recycled.get(), released);
+    EXPECT_EQ(recycled->GetPointerCount(), 0);
+    EXPECT_EQ(recycled->GetPointerAction(), PointerEvent::POINTER_ACTION_UNKNOWN);
+}
+
+/**
+ * @tc.name: PointerEventTest_IsChanged_001
+ * @tc.desc: Verify a pointer item is changed by default and that the flag survives the parcel
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PointerEventTest, PointerEventTest_IsChanged_001, TestSize.Level2)
+{
+    CALL_TEST_DEBUG;
+    PointerEvent::PointerItem item;
+    EXPECT_TRUE(item.IsChanged());
+    item.SetChanged(false);
+    Parcel parcel;
+    ASSERT_TRUE(item.WriteToParcel(parcel));
+    PointerEvent::PointerItem copy;
+    ASSERT_TRUE(copy.ReadFromParcel(parcel));
+    EXPECT_FALSE(copy.IsChanged());
+}
+
 } // namespace MMI
 } // namespace OHOS
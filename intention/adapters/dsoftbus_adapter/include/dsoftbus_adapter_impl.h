@@ -17,7 +17,9 @@
 #define DSOFTBUS_ADAPTER_IMPL_H
 
 #include <map>
+#include <mutex>
 #include <set>
+#include <vector>
 
 #include "nocopyable.h"
 #include "socket.h"
@@ -52,15 +54,21 @@ class DSoftbusAdapterImpl final : public IDSoftbusAdapter {
         std::weak_ptr<IDSoftbusObserver> observer_;
     };
 
+    // Receiving state of a session, locked on its own so that receiving does not hold up the adapter.
+    struct Receiver {
+        std::mutex lock_;
+        CircleStreamBuffer buffer_;
+    };
+
     struct Session {
-        Session(int32_t socket) : socket_(socket) { }
-        Session(const Session &other) : socket_(other.socket_) { }
+        Session(int32_t socket) : socket_(socket), receiver_(std::make_shared<Receiver>()) { }
+        Session(const Session &other) : socket_(other.socket_), receiver_(other.receiver_) { }
         DISALLOW_MOVE(Session);
 
         Session &operator=(const Session &other) = delete;
 
         int32_t socket_;
-        CircleStreamBuffer buffer_;
+        std::shared_ptr<Receiver> receiver_;
     };
 
 public:
@@ -98,9 +106,15 @@ private:
     void OnConnectedLocked(const std::string &networkId);
     void ConfigTcpAlive(int32_t socket);
     int32_t FindConnection(const std::string &networkId);
-    void HandleSessionData(const std::string &networkId, CircleStreamBuffer &circleBuffer);
-    void HandlePacket(const std::string &networkId, NetPacket &packet);
-    void HandleRawData(const std::string &networkId, const void *data, uint32_t dataLen);
+    std::vector<std::shared_ptr<IDSoftbusObserver>> GetObserversLocked() const;
+    void HandleSessionData(const std::string &networkId, Receiver &receiver, const char *data, size_t dataLen,
+        const std::vector<std::shared_ptr<IDSoftbusObserver>> &observers);
+    bool HandlePackets(const std::string &networkId, const char *buf, size_t bufSize, size_t &consumed,
+        const std::vector<std::shared_ptr<IDSoftbusObserver>> &observers);
+    void HandlePacket(const std::string &networkId, NetPacket &packet,
+        const std::vector<std::shared_ptr<IDSoftbusObserver>> &observers);
+    void HandleRawData(const std::string &networkId, const void *data, uint32_t dataLen,
+        const std::vector<std::shared_ptr<IDSoftbusObserver>> &observers);
     bool CheckDeviceOnline(const std::string &networkId);
 
     std::recursive_mutex lock_;
@@ -326,25 +326,34 @@ void DSoftbusAdapterImpl::OnShutdown(int32_t socket, ShutdownReason reason)
 void DSoftbusAdapterImpl::OnBytes(int32_t socket, const void *data, uint32_t dataLen)
 {
     CALL_DEBUG_ENTER;
-    std::lock_guard guard(lock_);
-    auto iter = std::find_if(sessions_.begin(), sessions_.end(), [socket](const auto &item) {
-        return (item.second.socket_ == socket);
-    });
-    if (iter == sessions_.end()) {
-        FI_HILOGE("Invalid socket:%{public}d", socket);
+    CHKPV(data);
+    if (dataLen < sizeof(uint32_t)) {
+        FI_HILOGE("Invalid data length:%{public}u", dataLen);
         return;
     }
-    const std::string networkId = iter->first;
+    std::string networkId;
+    std::shared_ptr<Receiver> receiver;
+    std::vector<std::shared_ptr<IDSoftbusObserver>> observers;
+    {
+        std::lock_guard guard(lock_);
+        auto iter = std::find_if(sessions_.begin(), sessions_.end(), [socket](const auto &item) {
+            return (item.second.socket_ == socket);
+        });
+        if (iter == sessions_.end()) {
+            FI_HILOGE("Invalid socket:%{public}d", socket);
+            return;
+        }
+        networkId = iter->first;
+        receiver = iter->second.receiver_;
+        observers = GetObserversLocked();
+    }
+    CHKPV(receiver);
 
     if (*reinterpret_cast<const uint32_t *>(data) < static_cast<uint32_t>(MessageId::MAX_MESSAGE_ID)) {
-        CircleStreamBuffer &circleBuffer = iter->second.buffer_;
-
-        if (!circleBuffer.Write(reinterpret_cast<const char *>(data), dataLen)) {
-            FI_HILOGE("Failed to write buffer");
-        }
-        HandleSessionData(networkId, circleBuffer);
+        std::lock_guard guard(receiver->lock_);
+        HandleSessionData(networkId, *receiver, reinterpret_cast<const char *>(data), dataLen, observers);
     } else {
-        HandleRawData(networkId, data, dataLen);
+        HandleRawData(networkId, data, dataLen, observers);
     }
 }
 
@@ -524,49 +533,97 @@ void DSoftbusAdapterImpl::ConfigTcpAlive(int32_t socket)
     }
 }
 
-void DSoftbusAdapterImpl::HandleSessionData(const std::string &networkId, CircleStreamBuffer &circleBuffer)
+std::vector<std::shared_ptr<IDSoftbusObserver>> DSoftbusAdapterImpl::GetObserversLocked() const
+{
+    std::vector<std::shared_ptr<IDSoftbusObserver>> observers;
+    observers.reserve(observers_.size());
+    for (const auto &item : observers_) {
+        if (auto observer = item.Lock(); observer != nullptr) {
+            observers.push_back(observer);
+        }
+    }
+    return observers;
+}
+
+void DSoftbusAdapterImpl::HandleSessionData(const std::string &networkId, Receiver &receiver, const char *data,
+    size_t dataLen, const std::vector<std::shared_ptr<IDSoftbusObserver>> &observers)
 {
     CALL_DEBUG_ENTER;
-    while (circleBuffer.ResidualSize() >= static_cast<int32_t>(sizeof(PackHead))) {
-        const char *buf = circleBuffer.ReadBuf();
-        const PackHead *head = reinterpret_cast<const PackHead *>(buf);
+    CircleStreamBuffer &circleBuffer = receiver.buffer_;
+    size_t consumed = 0;
+
+    if (circleBuffer.ResidualSize() <= 0) {
+        // Nothing is pending, so packets are parsed right from the bytes delivered and only a trailing
+        // incomplete packet is kept.
+        circleBuffer.Reset();
+        if (!HandlePackets(networkId, data, dataLen, consumed, observers)) {
+            return;
+        }
+        if ((consumed < dataLen) && !circleBuffer.Write(&data[consumed], dataLen - consumed)) {
+            FI_HILOGE("Failed to write buffer");
+        }
+        return;
+    }
+    if (!circleBuffer.Write(data, dataLen)) {
+        FI_HILOGE("Failed to write buffer");
+    }
+    if (!HandlePackets(networkId, circleBuffer.ReadBuf(), static_cast<size_t>(circleBuffer.ResidualSize()),
+        consumed, observers)) {
+        circleBuffer.Reset();
+        return;
+    }
+    circleBuffer.SeekReadPos(static_cast<int32_t>(consumed));
+}
 
-        if ((head->size < 0) || (static_cast<size_t>(head->size) > MAX_PACKET_BUF_SIZE)) {
+bool DSoftbusAdapterImpl::HandlePackets(const std::string &networkId, const char *buf, size_t bufSize,
+    size_t &consumed, const std::vector<std::shared_ptr<IDSoftbusObserver>> &observers)
+{
+    consumed = 0;
+    while ((bufSize - consumed) >= sizeof(PackHead)) {
+        const char *pkt = &buf[consumed];
+        PackHead head {};
+        if (memcpy_s(&head, sizeof(head), pkt, sizeof(PackHead)) != EOK) {
+            FI_HILOGE("Failed to read packet head");
+            return false;
+        }
+        if ((head.size < 0) || (static_cast<size_t>(head.size) > MAX_PACKET_BUF_SIZE)) {
             FI_HILOGE("Corrupted net packet");
-            break;
+            return false;
         }
-        if ((head->size + static_cast<int32_t>(sizeof(PackHead))) > circleBuffer.ResidualSize()) {
-            FI_HILOGI("Incomplete package, package size:%{public}d, residual size:%{public}d",
-                (head->size + static_cast<int32_t>(sizeof(PackHead))), circleBuffer.ResidualSize());
+        size_t pktSize = sizeof(PackHead) + static_cast<size_t>(head.size);
+        if (pktSize > (bufSize - consumed)) {
+            FI_HILOGD("Incomplete package, package size:%{public}zu, residual size:%{public}zu",
+                pktSize, (bufSize - consumed));
             break;
         }
-        NetPacket packet(head->idMsg);
+        NetPacket packet(head.idMsg);
 
-        if ((head->size > 0) && !packet.Write(&buf[sizeof(PackHead)], head->size)) {
-            FI_HILOGE("Failed to fill packet, PacketSize:%{public}d", head->size);
-            break;
+        if ((head.size > 0) && !packet.Write(&pkt[sizeof(PackHead)], head.size)) {
+            FI_HILOGE("Failed to fill packet, PacketSize:%{public}d", head.size);
+            return false;
         }
-        circleBuffer.SeekReadPos(packet.GetPacketLength());
-        HandlePacket(networkId, packet);
+        consumed += pktSize;
+        HandlePacket(networkId, packet, observers);
     }
+    return true;
 }
 
-void DSoftbusAdapterImpl::HandlePacket(const std::string &networkId, NetPacket &packet)
+void DSoftbusAdapterImpl::HandlePacket(const std::string &networkId, NetPacket &packet,
+    const std::vector<std::shared_ptr<IDSoftbusObserver>> &observers)
 {
     CALL_DEBUG_ENTER;
-    for (const auto &item : observers_) {
-        std::shared_ptr<IDSoftbusObserver> observer = item.Lock();
+    for (const auto &observer : observers) {
         if ((observer != nullptr) && observer->OnPacket(networkId, packet)) {
             return;
         }
     }
 }
 
-void DSoftbusAdapterImpl::HandleRawData(const std::string &networkId, const void *data, uint32_t dataLen)
+void DSoftbusAdapterImpl::HandleRawData(const std::string &networkId, const void *data, uint32_t dataLen,
+    const std::vector<std::shared_ptr<IDSoftbusObserver>> &observers)
 {
     CALL_DEBUG_ENTER;
-    for (const auto &item : observers_) {
-        std::shared_ptr<IDSoftbusObserver> observer = item.Lock();
+    for (const auto &observer : observers) {
         if ((observer != nullptr) && observer->OnRawData(networkId, data, dataLen)) {
             return;
         }
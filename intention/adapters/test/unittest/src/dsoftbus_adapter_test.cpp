@@ -52,6 +52,7 @@ constexpr size_t PKG_NAME_SIZE_MAX { 65 };
 constexpr int32_t SOCKET_SERVER { 0 };
 constexpr int32_t SOCKET_CLIENT { 1 };
 constexpr int32_t SOCKET { 1 };
+constexpr int32_t PACKET_COUNT { 3 };
 const char *g_cores[] = { "ohos.permission.INPUT_MONITORING" };
 } // namespace
 
@@ -125,6 +126,29 @@ public:
     }
 };
 
+class CountingObserver final : public IDSoftbusObserver {
+public:
+    CountingObserver() = default;
+    ~CountingObserver() = default;
+
+    void OnBind(const std::string &networkId) { }
+    void OnShutdown(const std::string &networkId) { }
+    void OnConnected(const std::string &networkId) { }
+    bool OnPacket(const std::string &networkId, NetPacket &packet)
+    {
+        ++nPackets_;
+        packet >> value_;
+        return true;
+    }
+    bool OnRawData(const std::string &networkId, const void *data, uint32_t dataLen)
+    {
+        return false;
+    }
+
+    int32_t nPackets_ { 0 };
+    int32_t value_ { 0 };
+};
+
 std::string DsoftbusAdapterTest::GetLocalNetworkId()
 {
     auto packageName = PKG_NAME_PREFIX + std::to_string(getpid());
@@ -374,11 +398,46 @@ HWTEST_F(DsoftbusAdapterTest, HandleSessionData, TestSize.Level1)
     CALL_TEST_DEBUG;
     SetPermission(SYSTEM_CORE, g_cores, sizeof(g_cores) / sizeof(g_cores[0]));
     std::string networkId("softbus");
-    CircleStreamBuffer circleBuffer;
-    ASSERT_NO_FATAL_FAILURE(DSoftbusAdapterImpl::GetInstance()->HandleSessionData(networkId, circleBuffer));
+    DSoftbusAdapterImpl::Receiver receiver;
+    int32_t data = SOCKET;
+    std::vector<std::shared_ptr<IDSoftbusObserver>> observers { std::make_shared<DSoftbusObserver>() };
+    ASSERT_NO_FATAL_FAILURE(DSoftbusAdapterImpl::GetInstance()->HandleSessionData(
+        networkId, receiver, reinterpret_cast<const char *>(&data), sizeof(data), observers));
     RemovePermission();
 }
 
+/**
+ * @tc.name: TestHandleSessionData_002
+ * @tc.desc: Test HandleSessionData with packets split across and packed into deliveries
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DsoftbusAdapterTest, HandleSessionData_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    std::string networkId("softbus");
+    int32_t value = SOCKET;
+    NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+    packet << value;
+    StreamBuffer buffer;
+    ASSERT_TRUE(packet.MakeData(buffer));
+    ASSERT_TRUE(packet.MakeData(buffer));
+    ASSERT_TRUE(packet.MakeData(buffer));
+    size_t pktSize = buffer.Size() / PACKET_COUNT;
+    size_t splitPos = pktSize + pktSize / PACKET_COUNT;
+
+    auto observer = std::make_shared<CountingObserver>();
+    std::vector<std::shared_ptr<IDSoftbusObserver>> observers { observer };
+    DSoftbusAdapterImpl::Receiver receiver;
+    DSoftbusAdapterImpl::GetInstance()->HandleSessionData(networkId, receiver, buffer.Data(), splitPos, observers);
+    EXPECT_EQ(observer->nPackets_, 1);
+    DSoftbusAdapterImpl::GetInstance()->HandleSessionData(
+        networkId, receiver, &buffer.Data()[splitPos], buffer.Size() - splitPos, observers);
+    EXPECT_EQ(observer->nPackets_, PACKET_COUNT);
+    EXPECT_EQ(observer->value_, value);
+    EXPECT_EQ(receiver.buffer_.ResidualSize(), 0);
+}
+
 /**
  * @tc.name: TestHandleRawData
  * @tc.desc: Test HandleRawData
@@ -391,7 +450,9 @@ HWTEST_F(DsoftbusAdapterTest, HandleRawData, TestSize.Level1)
     SetPermission(SYSTEM_CORE, g_cores, sizeof(g_cores) / sizeof(g_cores[0]));
     std::string networkId("softbus");
     int32_t *data = new int32_t(SOCKET);
-    ASSERT_NO_FATAL_FAILURE(DSoftbusAdapterImpl::GetInstance()->HandleRawData(networkId, data, sizeof(data)));
+    std::vector<std::shared_ptr<IDSoftbusObserver>> observers { std::make_shared<DSoftbusObserver>() };
+    ASSERT_NO_FATAL_FAILURE(
+        DSoftbusAdapterImpl::GetInstance()->HandleRawData(networkId, data, sizeof(data), observers));
     RemovePermission();
 }
 
@@ -23,6 +23,7 @@
 #include "cooperate_events.h"
 #include "i_context.h"
 #include "i_dsoftbus_adapter.h"
+#include "input_event_transmission/pointer_event_delta.h"
 #include "net_packet.h"
 
 namespace OHOS {
@@ -74,9 +75,11 @@ public:
     static bool IsLocalEvent(const InputPointerEvent &event);
 
 private:
+    void Advertise();
     bool OnPacket(const std::string &networkId, Msdp::NetPacket &packet);
     void OnPointerEvent(Msdp::NetPacket &packet);
     void OnKeyEvent(Msdp::NetPacket &packet);
+    void SimulatePointerEvent();
     bool UpdatePointerEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent);
     bool IsActive(std::shared_ptr<MMI::PointerEvent> pointerEvent);
     void ResetPressedEvents();
@@ -91,6 +94,7 @@ private:
     std::shared_ptr<DSoftbusObserver> observer_;
     std::shared_ptr<MMI::PointerEvent> pointerEvent_;
     std::shared_ptr<MMI::KeyEvent> keyEvent_;
+    PointerEventDecoder decoder_;
     void TagRemoteEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent);
 };
 
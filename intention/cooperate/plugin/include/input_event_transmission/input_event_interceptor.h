@@ -21,6 +21,8 @@
 #include "channel.h"
 #include "cooperate_events.h"
 #include "i_context.h"
+#include "i_dsoftbus_adapter.h"
+#include "input_event_transmission/pointer_event_batch.h"
 
 namespace OHOS {
 namespace Msdp {
@@ -29,8 +31,35 @@ namespace Cooperate {
 class Context;
 
 class InputEventInterceptor final {
+    class DSoftbusObserver final : public IDSoftbusObserver {
+    public:
+        DSoftbusObserver(InputEventInterceptor &parent) : parent_(parent) { }
+        ~DSoftbusObserver() = default;
+
+        void OnBind(const std::string &networkId) override { }
+        void OnConnected(const std::string &networkId) override { }
+
+        void OnShutdown(const std::string &networkId) override
+        {
+            parent_.batch_->OnShutdown(networkId);
+        }
+
+        bool OnPacket(const std::string &networkId, Msdp::NetPacket &packet) override
+        {
+            return parent_.OnPacket(networkId, packet);
+        }
+
+        bool OnRawData(const std::string &networkId, const void *data, uint32_t dataLen) override
+        {
+            return false;
+        }
+
+    private:
+        InputEventInterceptor &parent_;
+    };
+
 public:
-    InputEventInterceptor(IContext *env) : env_(env) { }
+    InputEventInterceptor(IContext *env);
     ~InputEventInterceptor();
     DISALLOW_COPY_AND_MOVE(InputEventInterceptor);
 
@@ -39,14 +68,18 @@ public:
     void Update(Context &context);
 
 private:
+    bool OnPacket(const std::string &networkId, Msdp::NetPacket &packet);
     void OnPointerEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent);
     void OnKeyEvent(std::shared_ptr<MMI::KeyEvent> keyEvent);
     void ReportPointerEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent);
+    void PostFlush();
 
     IContext *env_ { nullptr };
     int32_t interceptorId_ { -1 };
     std::string remoteNetworkId_;
     Channel<CooperateEvent>::Sender sender_;
+    std::shared_ptr<DSoftbusObserver> observer_;
+    std::shared_ptr<PointerEventBatch> batch_;
     static std::set<int32_t> filterKeys_;
     static std::set<int32_t> filterPointers_;
 };
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POINTER_EVENT_BATCH_H
+#define POINTER_EVENT_BATCH_H
+
+#include <mutex>
+#include <unordered_set>
+
+#include "nocopyable.h"
+
+#include "i_dsoftbus_adapter.h"
+#include "input_event_transmission/pointer_event_delta.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+/*
+ * Pointer events waiting to go to the peer in one packet, flushed once the burst they arrived in is over.
+ * Peers that have not advertised frame support get every event at once, fully serialized in a packet of its own.
+ */
+class PointerEventBatch final {
+public:
+    explicit PointerEventBatch(IDSoftbusAdapter &dsoftbus) : dsoftbus_(dsoftbus) { }
+    ~PointerEventBatch() = default;
+    DISALLOW_COPY_AND_MOVE(PointerEventBatch);
+
+    void SetPeer(const std::string &networkId);
+    void OnAdvertisement(const std::string &networkId);
+    void OnShutdown(const std::string &networkId);
+    // Returns true if the caller has to post a flush for the event just added.
+    bool Add(std::shared_ptr<MMI::PointerEvent> pointerEvent);
+    void Flush();
+    void Reset();
+
+private:
+    void SendEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent);
+    void FlushLocked();
+
+    std::mutex mutex_;
+    IDSoftbusAdapter &dsoftbus_;
+    std::string networkId_;
+    std::unordered_set<std::string> framePeers_;
+    bool sendFrames_ { false };
+    PointerEventEncoder encoder_;
+    NetPacket packet_ { MessageId::DSOFTBUS_INPUT_POINTER_EVENT };
+    size_t nEvents_ { 0 };
+    bool isFlushPosted_ { false };
+};
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // POINTER_EVENT_BATCH_H
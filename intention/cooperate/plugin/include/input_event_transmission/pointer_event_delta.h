@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POINTER_EVENT_DELTA_H
+#define POINTER_EVENT_DELTA_H
+
+#include <array>
+#include <set>
+#include <vector>
+
+#include "net_packet.h"
+#include "nocopyable.h"
+#include "pointer_event.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+/*
+ * Compact form of the pointer events sent to the peer during cooperation. A frame packet starts with FRAME_TAG,
+ * in place of the event type a fully serialized event starts with, and carries one or more records:
+ *   RECORD_KEYFRAME, the event as written by InputEventSerialization::Marshalling;
+ *   RECORD_DELTA, a one byte length and the varint encoded changes of a MOVE or AXIS update against the
+ *   previous event of the stream.
+ * A keyframe is sent whenever the event differs from the previous one in more than a delta carries, and at least
+ * every KEYFRAME_INTERVAL events so that fields a delta does not carry cannot stay stale for long.
+ * Frame packets are only sent to a peer once it has sent an advertisement, a packet of the same message that
+ * holds only ADVERTISEMENT_TAG. Peers that never advertise get one fully serialized event per packet.
+ */
+class PointerEventEncoder final {
+public:
+    PointerEventEncoder() = default;
+    ~PointerEventEncoder() = default;
+    DISALLOW_COPY_AND_MOVE(PointerEventEncoder);
+
+    static void BeginFrames(NetPacket &pkt);
+    // Tells whether the packet is an advertisement, without consuming it.
+    static bool IsAdvertisement(NetPacket &pkt);
+    // Tells whether the action is an update worth batching with the ones following it.
+    static bool IsUpdate(int32_t pointerAction);
+    int32_t Encode(std::shared_ptr<MMI::PointerEvent> event, NetPacket &pkt);
+    // The next event is sent as a keyframe.
+    void Reset();
+
+private:
+    bool CanEncodeDelta(std::shared_ptr<MMI::PointerEvent> event, const MMI::PointerEvent::PointerItem &item) const;
+    int32_t EncodeKeyframe(std::shared_ptr<MMI::PointerEvent> event, const MMI::PointerEvent::PointerItem &item,
+        NetPacket &pkt);
+    int32_t EncodeDelta(std::shared_ptr<MMI::PointerEvent> event, const MMI::PointerEvent::PointerItem &item,
+        NetPacket &pkt);
+    void Update(std::shared_ptr<MMI::PointerEvent> event, const MMI::PointerEvent::PointerItem &item);
+
+    bool hasBase_ { false };
+    bool hasBuffer_ { false };
+    size_t nDeltas_ { 0 };
+    int32_t id_ { 0 };
+    int32_t pointerAction_ { MMI::PointerEvent::POINTER_ACTION_UNKNOWN };
+    int32_t pointerId_ { -1 };
+    int32_t sourceType_ { MMI::PointerEvent::SOURCE_TYPE_UNKNOWN };
+    int32_t deviceId_ { -1 };
+    int32_t buttonId_ { -1 };
+    int32_t targetDisplayId_ { -1 };
+    int32_t targetWindowId_ { -1 };
+    int32_t agentWindowId_ { -1 };
+    uint32_t flag_ { 0 };
+    uint32_t axes_ { 0 };
+    int64_t actionTime_ { 0 };
+    int64_t actionStartTime_ { 0 };
+    uint64_t sensorTime_ { 0 };
+    std::array<double, MMI::PointerEvent::AXIS_TYPE_MAX> axisValues_ {};
+    std::set<int32_t> pressedButtons_;
+    std::vector<int32_t> pressedKeys_;
+    MMI::PointerEvent::PointerItem item_;
+};
+
+/*
+ * Rebuilds the events of frame packets. Deltas are applied to the event passed in, which has to be the same
+ * object for the whole stream and must only be changed by the caller in ways a delta does not depend on.
+ */
+class PointerEventDecoder final {
+public:
+    PointerEventDecoder() = default;
+    ~PointerEventDecoder() = default;
+    DISALLOW_COPY_AND_MOVE(PointerEventDecoder);
+
+    // Writes the advertisement telling the peer that frame packets are decoded here.
+    static void Advertise(NetPacket &pkt);
+    // Consumes FRAME_TAG if the packet starts with it.
+    static bool IsFrames(NetPacket &pkt);
+    static bool HasMore(NetPacket &pkt);
+    int32_t Decode(NetPacket &pkt, std::shared_ptr<MMI::PointerEvent> event);
+    // Deltas are dropped until the next keyframe.
+    void Reset();
+
+private:
+    int32_t DecodeDelta(NetPacket &pkt, std::shared_ptr<MMI::PointerEvent> event);
+
+    bool hasBase_ { false };
+    int32_t id_ { 0 };
+    int64_t actionTime_ { 0 };
+    int64_t actionStartTime_ { 0 };
+    uint64_t sensorTime_ { 0 };
+};
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // POINTER_EVENT_DELTA_H
@@ -53,11 +53,13 @@ void InputEventBuilder::Enable(Context &context)
         return;
     }
     enable_ = true;
+    decoder_.Reset();
     xDir_ = 0;
     movement_ = 0;
     freezing_ = (context.CooperateFlag() & COOPERATE_FLAG_FREEZE_CURSOR);
     remoteNetworkId_ = context.Peer();
     env_->GetDSoftbus().AddObserver(observer_);
+    Advertise();
     Coordinate cursorPos = context.CursorPosition();
     FI_HILOGI("Cursor transite in (%{private}d, %{private}d)", cursorPos.x, cursorPos.y);
 }
@@ -75,6 +77,9 @@ void InputEventBuilder::Disable()
 void InputEventBuilder::Update(Context &context)
 {
     remoteNetworkId_ = context.Peer();
+    if (enable_) {
+        Advertise();
+    }
     FI_HILOGI("Update peer to \'%{public}s\'", Utility::Anonymize(remoteNetworkId_).c_str());
 }
 
@@ -98,8 +103,21 @@ void InputEventBuilder::Thaw()
     FI_HILOGI("Thaw remote input from '%{public}s'", Utility::Anonymize(remoteNetworkId_).c_str());
 }
 
+void InputEventBuilder::Advertise()
+{
+    NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+    PointerEventDecoder::Advertise(packet);
+    if (env_->GetDSoftbus().SendPacket(remoteNetworkId_, packet) != RET_OK) {
+        FI_HILOGW("Failed to advertise frames, the peer sends full events");
+    }
+}
+
 bool InputEventBuilder::OnPacket(const std::string &networkId, Msdp::NetPacket &packet)
 {
+    if ((packet.GetMsgId() == MessageId::DSOFTBUS_INPUT_POINTER_EVENT) &&
+        PointerEventEncoder::IsAdvertisement(packet)) {
+        return false;
+    }
     if (networkId != remoteNetworkId_) {
         FI_HILOGW("Unexpected packet from \'%{public}s\'", Utility::Anonymize(networkId).c_str());
         return false;
@@ -125,17 +143,33 @@ bool InputEventBuilder::OnPacket(const std::string &networkId, Msdp::NetPacket &
 void InputEventBuilder::OnPointerEvent(Msdp::NetPacket &packet)
 {
     CHKPV(pointerEvent_);
-    pointerEvent_->Reset();
-    int32_t ret = InputEventSerialization::Unmarshalling(packet, pointerEvent_);
-    if (ret != RET_OK) {
-        FI_HILOGE("Failed to deserialize pointer event");
+    if (!PointerEventDecoder::IsFrames(packet)) {
+        pointerEvent_->Reset();
+        decoder_.Reset();
+        int32_t ret = InputEventSerialization::Unmarshalling(packet, pointerEvent_);
+        if (ret != RET_OK) {
+            FI_HILOGE("Failed to deserialize pointer event");
+            return;
+        }
+        SimulatePointerEvent();
         return;
     }
+    while (PointerEventDecoder::HasMore(packet)) {
+        if (decoder_.Decode(packet, pointerEvent_) != RET_OK) {
+            FI_HILOGE("Failed to decode pointer event, skip the rest of the packet");
+            return;
+        }
+        SimulatePointerEvent();
+    }
+}
+
+void InputEventBuilder::SimulatePointerEvent()
+{
     if (!UpdatePointerEvent(pointerEvent_)) {
         return;
     }
     TagRemoteEvent(pointerEvent_);
-    FI_HILOGI("PointerEvent(No:%{public}d,Source:%{public}s,Action:%{public}s)", pointerEvent_->GetId(),
+    FI_HILOGD("PointerEvent(No:%{public}d,Source:%{public}s,Action:%{public}s)", pointerEvent_->GetId(),
         pointerEvent_->DumpSourceType(), pointerEvent_->DumpPointerAction());
     if (IsActive(pointerEvent_)) {
         env_->GetInput().SimulateInputEvent(pointerEvent_);
@@ -145,7 +179,7 @@ void InputEventBuilder::OnPointerEvent(Msdp::NetPacket &packet)
 void InputEventBuilder::OnKeyEvent(Msdp::NetPacket &packet)
 {
     CHKPV(keyEvent_);
-    pointerEvent_->Reset();
+    keyEvent_->Reset();
     int32_t ret = InputEventSerialization::NetPacketToKeyEvent(packet, keyEvent_);
     if (ret != RET_OK) {
         FI_HILOGE("Failed to deserialize key event");
@@ -228,6 +262,7 @@ void InputEventBuilder::ResetPressedEvents()
             FI_HILOGI("Simulate button-up event, buttonId:%{public}d", buttonId);
         }
         pointerEvent_->Reset();
+        decoder_.Reset();
     }
 }
 } // namespace Cooperate
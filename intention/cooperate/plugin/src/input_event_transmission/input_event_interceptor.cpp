@@ -43,9 +43,19 @@ std::unordered_set<int32_t> InputEventInterceptor::filterPointers_ {
     MMI::PointerEvent::POINTER_ACTION_PULL_OUT_WINDOW,
 };
 
+InputEventInterceptor::InputEventInterceptor(IContext *env) : env_(env)
+{
+    observer_ = std::make_shared<DSoftbusObserver>(*this);
+    CHKPV(env_);
+    batch_ = std::make_shared<PointerEventBatch>(env_->GetDSoftbus());
+    env_->GetDSoftbus().AddObserver(observer_);
+}
+
 InputEventInterceptor::~InputEventInterceptor()
 {
     Disable();
+    CHKPV(env_);
+    env_->GetDSoftbus().RemoveObserver(observer_);
 }
 
 void InputEventInterceptor::Enable(Context &context)
@@ -58,6 +68,8 @@ void InputEventInterceptor::Enable(Context &context)
     FI_HILOGI("Cursor transite out at (%{private}d, %{private}d)", cursorPos.x, cursorPos.y);
     remoteNetworkId_ = context.Peer();
     sender_ = context.Sender();
+    batch_->Reset();
+    batch_->SetPeer(remoteNetworkId_);
     interceptorId_ = env_->GetInput().AddInterceptor(
         [this](std::shared_ptr<MMI::PointerEvent> pointerEvent) {
             this->OnPointerEvent(pointerEvent);
@@ -76,15 +88,28 @@ void InputEventInterceptor::Disable()
     if (interceptorId_ > 0) {
         env_->GetInput().RemoveInterceptor(interceptorId_);
         interceptorId_ = -1;
+        batch_->Reset();
     }
 }
 
 void InputEventInterceptor::Update(Context &context)
 {
     remoteNetworkId_ = context.Peer();
+    batch_->Reset();
+    batch_->SetPeer(remoteNetworkId_);
     FI_HILOGI("Update peer to \'%{public}s\'", Utility::Anonymize(remoteNetworkId_).c_str());
 }
 
+bool InputEventInterceptor::OnPacket(const std::string &networkId, Msdp::NetPacket &packet)
+{
+    if ((packet.GetMsgId() != MessageId::DSOFTBUS_INPUT_POINTER_EVENT) ||
+        !PointerEventEncoder::IsAdvertisement(packet)) {
+        return false;
+    }
+    batch_->OnAdvertisement(networkId);
+    return true;
+}
+
 void InputEventInterceptor::OnPointerEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent)
 {
     CHKPV(pointerEvent);
@@ -99,16 +124,11 @@ void InputEventInterceptor::OnPointerEvent(std::shared_ptr<MMI::PointerEvent> po
         FI_HILOGI("Reset to origin action:%{public}d", static_cast<int32_t>(originAction));
         pointerEvent->SetPointerAction(originAction);
     }
-    NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
-
-    int32_t ret = InputEventSerialization::Marshalling(pointerEvent, packet);
-    if (ret != RET_OK) {
-        FI_HILOGE("Failed to serialize pointer event");
-        return;
-    }
-    FI_HILOGI("PointerEvent(No:%{public}d,Source:%{public}s,Action:%{public}s)", pointerEvent->GetId(),
+    FI_HILOGD("PointerEvent(No:%{public}d,Source:%{public}s,Action:%{public}s)", pointerEvent->GetId(),
         pointerEvent->DumpSourceType(), pointerEvent->DumpPointerAction());
-    env_->GetDSoftbus().SendPacket(remoteNetworkId_, packet);
+    if (batch_->Add(pointerEvent)) {
+        PostFlush();
+    }
 }
 
 void InputEventInterceptor::OnKeyEvent(std::shared_ptr<MMI::KeyEvent> keyEvent)
@@ -119,6 +139,7 @@ void InputEventInterceptor::OnKeyEvent(std::shared_ptr<MMI::KeyEvent> keyEvent)
         env_->GetInput().SimulateInputEvent(keyEvent);
         return;
     }
+    batch_->Flush();
     NetPacket packet(MessageId::DSOFTBUS_INPUT_KEY_EVENT);
 
     int32_t ret = InputEventSerialization::KeyEventToNetPacket(keyEvent, packet);
@@ -131,6 +152,21 @@ void InputEventInterceptor::OnKeyEvent(std::shared_ptr<MMI::KeyEvent> keyEvent)
     env_->GetDSoftbus().SendPacket(remoteNetworkId_, packet);
 }
 
+void InputEventInterceptor::PostFlush()
+{
+    std::weak_ptr<PointerEventBatch> weakBatch = batch_;
+    int32_t ret = env_->GetDelegateTasks().PostAsyncTask([weakBatch] {
+        if (auto batch = weakBatch.lock(); batch != nullptr) {
+            batch->Flush();
+        }
+        return RET_OK;
+    });
+    if (ret != RET_OK) {
+        FI_HILOGE("Failed to post flush, send pointer events now");
+        batch_->Flush();
+    }
+}
+
 void InputEventInterceptor::ReportPointerEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent)
 {
     MMI::PointerEvent::PointerItem pointerItem;
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "input_event_transmission/pointer_event_batch.h"
+
+#include "devicestatus_define.h"
+#include "input_event_transmission/input_event_serialization.h"
+#include "utility.h"
+
+#undef LOG_TAG
+#define LOG_TAG "PointerEventBatch"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+namespace {
+constexpr size_t MAX_BATCH_EVENTS { 8 };
+} // namespace
+
+void PointerEventBatch::SetPeer(const std::string &networkId)
+{
+    std::lock_guard guard(mutex_);
+    networkId_ = networkId;
+    sendFrames_ = (framePeers_.find(networkId) != framePeers_.end());
+    encoder_.Reset();
+}
+
+void PointerEventBatch::OnAdvertisement(const std::string &networkId)
+{
+    std::lock_guard guard(mutex_);
+    framePeers_.insert(networkId);
+    if ((networkId == networkId_) && !sendFrames_) {
+        FI_HILOGI("Send frames to \'%{public}s\'", Utility::Anonymize(networkId).c_str());
+        sendFrames_ = true;
+        encoder_.Reset();
+    }
+}
+
+void PointerEventBatch::OnShutdown(const std::string &networkId)
+{
+    std::lock_guard guard(mutex_);
+    framePeers_.erase(networkId);
+    if ((networkId == networkId_) && sendFrames_) {
+        FlushLocked();
+        sendFrames_ = false;
+    }
+}
+
+bool PointerEventBatch::Add(std::shared_ptr<MMI::PointerEvent> pointerEvent)
+{
+    std::lock_guard guard(mutex_);
+    if (!sendFrames_) {
+        SendEvent(pointerEvent);
+        return false;
+    }
+    bool isUpdate = PointerEventEncoder::IsUpdate(pointerEvent->GetPointerAction());
+    if (!isUpdate) {
+        FlushLocked();
+    }
+    if (nEvents_ == 0) {
+        packet_.Reset();
+        PointerEventEncoder::BeginFrames(packet_);
+    }
+    if (encoder_.Encode(pointerEvent, packet_) != RET_OK) {
+        FI_HILOGE("Failed to serialize pointer event, drop %{public}zu pending", nEvents_);
+        encoder_.Reset();
+        nEvents_ = 0;
+        return false;
+    }
+    ++nEvents_;
+    if (!isUpdate || (nEvents_ >= MAX_BATCH_EVENTS)) {
+        FlushLocked();
+        return false;
+    }
+    if (isFlushPosted_) {
+        return false;
+    }
+    isFlushPosted_ = true;
+    return true;
+}
+
+void PointerEventBatch::Flush()
+{
+    std::lock_guard guard(mutex_);
+    isFlushPosted_ = false;
+    FlushLocked();
+}
+
+void PointerEventBatch::Reset()
+{
+    std::lock_guard guard(mutex_);
+    FlushLocked();
+    encoder_.Reset();
+}
+
+void PointerEventBatch::SendEvent(std::shared_ptr<MMI::PointerEvent> pointerEvent)
+{
+    NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+
+    if (InputEventSerialization::Marshalling(pointerEvent, packet) != RET_OK) {
+        FI_HILOGE("Failed to serialize pointer event");
+        return;
+    }
+    dsoftbus_.SendPacket(networkId_, packet);
+}
+
+void PointerEventBatch::FlushLocked()
+{
+    if (nEvents_ == 0) {
+        return;
+    }
+    FI_HILOGD("Send %{public}zu pointer events in %{public}zu bytes", nEvents_, packet_.Size());
+    nEvents_ = 0;
+    if (dsoftbus_.SendPacket(networkId_, packet_) != RET_OK) {
+        FI_HILOGE("Failed to send pointer events, resend a keyframe next");
+        encoder_.Reset();
+    }
+}
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -0,0 +1,577 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "input_event_transmission/pointer_event_delta.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "devicestatus_define.h"
+#include "input_event_transmission/input_event_serialization.h"
+
+#undef LOG_TAG
+#define LOG_TAG "PointerEventDelta"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+namespace {
+constexpr int32_t FRAME_TAG { 0x50444631 };
+constexpr int32_t ADVERTISEMENT_TAG { 0x50444641 };
+constexpr uint8_t RECORD_KEYFRAME { 1 };
+constexpr uint8_t RECORD_DELTA { 2 };
+constexpr size_t KEYFRAME_INTERVAL { 64 };
+constexpr size_t MAX_DELTA_SIZE { UINT8_MAX };
+constexpr int32_t VARINT_SHIFT { 7 };
+constexpr uint64_t VARINT_MORE { 0x80 };
+constexpr uint64_t VARINT_MASK { 0x7F };
+constexpr int32_t MAX_VARINT_SHIFT { 63 };
+constexpr double MAX_EXACT_VALUE { 4503599627370496.0 };
+constexpr double MAX_EXACT_DELTA { 1099511627776.0 };
+
+enum DeltaField : uint32_t {
+    FIELD_ACTION = 1U << 0,
+    FIELD_ACTION_START_TIME = 1U << 1,
+    FIELD_SENSOR_TIME = 1U << 2,
+    FIELD_DISPLAY_X = 1U << 3,
+    FIELD_DISPLAY_Y = 1U << 4,
+    FIELD_WINDOW_X = 1U << 5,
+    FIELD_WINDOW_Y = 1U << 6,
+    FIELD_WINDOW_X_POS = 1U << 7,
+    FIELD_WINDOW_Y_POS = 1U << 8,
+    FIELD_RAW_DX = 1U << 9,
+    FIELD_RAW_DY = 1U << 10,
+    FIELD_RAW_DISPLAY_X = 1U << 11,
+    FIELD_RAW_DISPLAY_Y = 1U << 12,
+    FIELD_GLOBAL_X = 1U << 13,
+    FIELD_GLOBAL_Y = 1U << 14,
+    FIELD_AXES = 1U << 15,
+};
+
+uint64_t ZigZag(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> MAX_VARINT_SHIFT);
+}
+
+int64_t UnZigZag(uint64_t value)
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+// Differences wrap around like the unsigned values they are computed on, so any pair of values round trips.
+int64_t Diff(int64_t value, int64_t base)
+{
+    return static_cast<int64_t>(static_cast<uint64_t>(value) - static_cast<uint64_t>(base));
+}
+
+int64_t Apply(int64_t base, int64_t delta)
+{
+    return static_cast<int64_t>(static_cast<uint64_t>(base) + static_cast<uint64_t>(delta));
+}
+
+bool IsExact(double value)
+{
+    return std::isfinite(value) && (std::fabs(value) < MAX_EXACT_VALUE) && (std::trunc(value) == value);
+}
+
+using Item = MMI::PointerEvent::PointerItem;
+
+struct DoubleField {
+    uint32_t field;
+    double (Item::*get)() const;
+    void (Item::*set)(double);
+};
+
+// Coordinates are sent as the change from the previous event, raw movements as they are.
+struct IntField {
+    uint32_t field;
+    int32_t (Item::*get)() const;
+    void (Item::*set)(int32_t);
+    bool isRelative;
+};
+
+const DoubleField DOUBLE_FIELDS[] {
+    { FIELD_DISPLAY_X, &Item::GetDisplayXPos, &Item::SetDisplayXPos },
+    { FIELD_DISPLAY_Y, &Item::GetDisplayYPos, &Item::SetDisplayYPos },
+    { FIELD_WINDOW_X_POS, &Item::GetWindowXPos, &Item::SetWindowXPos },
+    { FIELD_WINDOW_Y_POS, &Item::GetWindowYPos, &Item::SetWindowYPos },
+    { FIELD_GLOBAL_X, &Item::GetGlobalX, &Item::SetGlobalX },
+    { FIELD_GLOBAL_Y, &Item::GetGlobalY, &Item::SetGlobalY },
+};
+
+const IntField INT_FIELDS[] {
+    { FIELD_WINDOW_X, &Item::GetWindowX, &Item::SetWindowX, true },
+    { FIELD_WINDOW_Y, &Item::GetWindowY, &Item::SetWindowY, true },
+    { FIELD_RAW_DX, &Item::GetRawDx, &Item::SetRawDx, false },
+    { FIELD_RAW_DY, &Item::GetRawDy, &Item::SetRawDy, false },
+    { FIELD_RAW_DISPLAY_X, &Item::GetRawDisplayX, &Item::SetRawDisplayX, true },
+    { FIELD_RAW_DISPLAY_Y, &Item::GetRawDisplayY, &Item::SetRawDisplayY, true },
+};
+
+class DeltaWriter final {
+public:
+    void PutVarint(uint64_t value)
+    {
+        while (value >= VARINT_MORE) {
+            PutByte(static_cast<uint8_t>((value & VARINT_MASK) | VARINT_MORE));
+            value >>= VARINT_SHIFT;
+        }
+        PutByte(static_cast<uint8_t>(value));
+    }
+
+    void PutSigned(int64_t value)
+    {
+        PutVarint(ZigZag(value));
+    }
+
+    // Whole number changes of whole numbers go as an even varint, anything else as 1 and the bytes of the value.
+    void PutDouble(double value, double base)
+    {
+        if (IsExact(value) && IsExact(base) && (std::fabs(value - base) < MAX_EXACT_DELTA)) {
+            PutVarint(ZigZag(static_cast<int64_t>(value - base)) << 1);
+            return;
+        }
+        PutVarint(1);
+        if (size_ + sizeof(value) > buf_.size()) {
+            isOverflow_ = true;
+            return;
+        }
+        std::memcpy(&buf_[size_], &value, sizeof(value));
+        size_ += sizeof(value);
+    }
+
+    bool IsOverflow() const
+    {
+        return isOverflow_;
+    }
+
+    const char *Data() const
+    {
+        return reinterpret_cast<const char *>(buf_.data());
+    }
+
+    size_t Size() const
+    {
+        return size_;
+    }
+
+private:
+    void PutByte(uint8_t byte)
+    {
+        if (size_ >= buf_.size()) {
+            isOverflow_ = true;
+            return;
+        }
+        buf_[size_++] = byte;
+    }
+
+    std::array<uint8_t, MAX_DELTA_SIZE> buf_ {};
+    size_t size_ { 0 };
+    bool isOverflow_ { false };
+};
+
+class DeltaReader final {
+public:
+    DeltaReader(const uint8_t *buf, size_t size) : buf_(buf), size_(size) { }
+
+    bool GetVarint(uint64_t &value)
+    {
+        value = 0;
+        for (int32_t shift = 0; (shift <= MAX_VARINT_SHIFT) && (pos_ < size_); shift += VARINT_SHIFT) {
+            uint8_t byte = buf_[pos_++];
+            value |= (static_cast<uint64_t>(byte) & VARINT_MASK) << shift;
+            if ((byte & VARINT_MORE) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool GetSigned(int64_t &value)
+    {
+        uint64_t raw = 0;
+        if (!GetVarint(raw)) {
+            return false;
+        }
+        value = UnZigZag(raw);
+        return true;
+    }
+
+    bool GetDouble(double base, double &value)
+    {
+        uint64_t raw = 0;
+        if (!GetVarint(raw)) {
+            return false;
+        }
+        if ((raw & 1) == 0) {
+            value = base + static_cast<double>(UnZigZag(raw >> 1));
+            return true;
+        }
+        if (pos_ + sizeof(value) > size_) {
+            return false;
+        }
+        std::memcpy(&value, &buf_[pos_], sizeof(value));
+        pos_ += sizeof(value);
+        return true;
+    }
+
+    bool IsEnd() const
+    {
+        return (pos_ == size_);
+    }
+
+private:
+    const uint8_t *buf_ { nullptr };
+    size_t size_ { 0 };
+    size_t pos_ { 0 };
+};
+
+struct DeltaValues {
+    uint32_t fields { 0 };
+    int32_t pointerAction { MMI::PointerEvent::POINTER_ACTION_UNKNOWN };
+    uint32_t axes { 0 };
+    int64_t idDelta { 0 };
+    int64_t timeDelta { 0 };
+    int64_t startTimeDelta { 0 };
+    int64_t sensorTimeDelta { 0 };
+    std::array<double, MMI::PointerEvent::AXIS_TYPE_MAX> axisValues {};
+};
+
+// Reads the changes of a delta, applying those of the pointer item to item.
+bool ReadDelta(DeltaReader &reader, std::shared_ptr<MMI::PointerEvent> event, Item &item, DeltaValues &values)
+{
+    uint64_t fields = 0;
+    if (!reader.GetVarint(fields) || !reader.GetSigned(values.idDelta) || !reader.GetSigned(values.timeDelta)) {
+        return false;
+    }
+    values.fields = static_cast<uint32_t>(fields);
+    int64_t value = 0;
+    if (fields & FIELD_ACTION) {
+        if (!reader.GetSigned(value)) {
+            return false;
+        }
+        values.pointerAction = static_cast<int32_t>(value);
+    }
+    if ((fields & FIELD_ACTION_START_TIME) && !reader.GetSigned(values.startTimeDelta)) {
+        return false;
+    }
+    if ((fields & FIELD_SENSOR_TIME) && !reader.GetSigned(values.sensorTimeDelta)) {
+        return false;
+    }
+    for (const auto &desc : DOUBLE_FIELDS) {
+        double pos = 0.0;
+        if (fields & desc.field) {
+            if (!reader.GetDouble((item.*desc.get)(), pos)) {
+                return false;
+            }
+            (item.*desc.set)(pos);
+        }
+    }
+    for (const auto &desc : INT_FIELDS) {
+        if (fields & desc.field) {
+            if (!reader.GetSigned(value)) {
+                return false;
+            }
+            (item.*desc.set)(static_cast<int32_t>(desc.isRelative ? Apply((item.*desc.get)(), value) : value));
+        }
+    }
+    if (fields & FIELD_AXES) {
+        uint64_t axes = 0;
+        if (!reader.GetVarint(axes)) {
+            return false;
+        }
+        values.axes = static_cast<uint32_t>(axes);
+        for (int32_t i = MMI::PointerEvent::AXIS_TYPE_UNKNOWN; i < MMI::PointerEvent::AXIS_TYPE_MAX; ++i) {
+            auto axis = static_cast<MMI::PointerEvent::AxisType>(i);
+            if (MMI::PointerEvent::HasAxis(values.axes, axis) &&
+                !reader.GetDouble(event->HasAxis(axis) ? event->GetAxisValue(axis) : 0.0, values.axisValues[i])) {
+                return false;
+            }
+        }
+    }
+    return reader.IsEnd();
+}
+
+bool HasTag(NetPacket &pkt, int32_t expected)
+{
+    int32_t tag = 0;
+    if ((pkt.UnreadSize() < static_cast<int32_t>(sizeof(tag)))) {
+        return false;
+    }
+    std::memcpy(&tag, pkt.ReadBuf(), sizeof(tag));
+    return (tag == expected);
+}
+} // namespace
+
+void PointerEventEncoder::BeginFrames(NetPacket &pkt)
+{
+    pkt << FRAME_TAG;
+}
+
+bool PointerEventEncoder::IsAdvertisement(NetPacket &pkt)
+{
+    return HasTag(pkt, ADVERTISEMENT_TAG);
+}
+
+bool PointerEventEncoder::IsUpdate(int32_t pointerAction)
+{
+    return ((pointerAction == MMI::PointerEvent::POINTER_ACTION_MOVE) ||
+        (pointerAction == MMI::PointerEvent::POINTER_ACTION_PULL_MOVE) ||
+        (pointerAction == MMI::PointerEvent::POINTER_ACTION_AXIS_BEGIN) ||
+        (pointerAction == MMI::PointerEvent::POINTER_ACTION_AXIS_UPDATE) ||
+        (pointerAction == MMI::PointerEvent::POINTER_ACTION_AXIS_END));
+}
+
+int32_t PointerEventEncoder::Encode(std::shared_ptr<MMI::PointerEvent> event, NetPacket &pkt)
+{
+    CHKPR(event, RET_ERR);
+    MMI::PointerEvent::PointerItem item;
+    bool hasItem = event->GetPointerItem(event->GetPointerId(), item);
+    if (hasItem && CanEncodeDelta(event, item) && (EncodeDelta(event, item, pkt) == RET_OK)) {
+        ++nDeltas_;
+        Update(event, item);
+        return RET_OK;
+    }
+    if (EncodeKeyframe(event, item, pkt) != RET_OK) {
+        return RET_ERR;
+    }
+    nDeltas_ = 0;
+    hasBase_ = hasItem;
+    if (hasItem) {
+        hasBuffer_ = !event->GetBuffer().empty();
+        pressedButtons_ = event->GetPressedButtons();
+        pressedKeys_ = event->GetPressedKeys();
+        Update(event, item);
+    }
+    return RET_OK;
+}
+
+void PointerEventEncoder::Reset()
+{
+    hasBase_ = false;
+    nDeltas_ = 0;
+}
+
+bool PointerEventEncoder::CanEncodeDelta(std::shared_ptr<MMI::PointerEvent> event,
+    const MMI::PointerEvent::PointerItem &item) const
+{
+    if (!hasBase_ || (nDeltas_ >= KEYFRAME_INTERVAL) || hasBuffer_ || !IsUpdate(event->GetPointerAction())) {
+        return false;
+    }
+    if ((event->GetPointerCount() != 1) || (event->GetPointerId() != pointerId_) ||
+        (event->GetSourceType() != sourceType_) || (event->GetDeviceId() != deviceId_) ||
+        (event->GetButtonId() != buttonId_) || (event->GetFlag() != flag_) ||
+        (event->GetTargetDisplayId() != targetDisplayId_) || (event->GetTargetWindowId() != targetWindowId_) ||
+        (event->GetAgentWindowId() != agentWindowId_)) {
+        return false;
+    }
+    if ((item.IsPressed() != item_.IsPressed()) || (item.GetDownTime() != item_.GetDownTime()) ||
+        (item.GetToolType() != item_.GetToolType()) || (item.GetDeviceId() != item_.GetDeviceId()) ||
+        (item.GetTargetWindowId() != item_.GetTargetWindowId()) || (item.GetPressure() != item_.GetPressure())) {
+        return false;
+    }
+    return (event->GetPressedButtons() == pressedButtons_) && (event->GetPressedKeys() == pressedKeys_) &&
+        event->GetBuffer().empty();
+}
+
+int32_t PointerEventEncoder::EncodeKeyframe(std::shared_ptr<MMI::PointerEvent> event,
+    const MMI::PointerEvent::PointerItem &item, NetPacket &pkt)
+{
+    pkt << RECORD_KEYFRAME;
+    if (InputEventSerialization::Marshalling(event, pkt) != RET_OK) {
+        FI_HILOGE("Failed to serialize keyframe");
+        return RET_ERR;
+    }
+    return RET_OK;
+}
+
+int32_t PointerEventEncoder::EncodeDelta(std::shared_ptr<MMI::PointerEvent> event,
+    const MMI::PointerEvent::PointerItem &item, NetPacket &pkt)
+{
+    uint32_t fields = 0;
+    fields |= (event->GetPointerAction() != pointerAction_) ? FIELD_ACTION : 0;
+    fields |= (event->GetActionStartTime() != actionStartTime_) ? FIELD_ACTION_START_TIME : 0;
+    fields |= (event->GetSensorInputTime() != sensorTime_) ? FIELD_SENSOR_TIME : 0;
+    for (const auto &desc : DOUBLE_FIELDS) {
+        fields |= ((item.*desc.get)() != (item_.*desc.get)()) ? desc.field : 0;
+    }
+    for (const auto &desc : INT_FIELDS) {
+        fields |= ((item.*desc.get)() != (item_.*desc.get)()) ? desc.field : 0;
+    }
+    fields |= ((event->GetAxes() != 0) || (axes_ != 0)) ? FIELD_AXES : 0;
+
+    DeltaWriter writer;
+    writer.PutVarint(fields);
+    writer.PutSigned(Diff(event->GetId(), id_));
+    writer.PutSigned(Diff(event->GetActionTime(), actionTime_));
+    if (fields & FIELD_ACTION) {
+        writer.PutSigned(event->GetPointerAction());
+    }
+    if (fields & FIELD_ACTION_START_TIME) {
+        writer.PutSigned(Diff(event->GetActionStartTime(), actionStartTime_));
+    }
+    if (fields & FIELD_SENSOR_TIME) {
+        writer.PutSigned(Diff(static_cast<int64_t>(event->GetSensorInputTime()), static_cast<int64_t>(sensorTime_)));
+    }
+    for (const auto &desc : DOUBLE_FIELDS) {
+        if (fields & desc.field) {
+            writer.PutDouble((item.*desc.get)(), (item_.*desc.get)());
+        }
+    }
+    for (const auto &desc : INT_FIELDS) {
+        if (fields & desc.field) {
+            writer.PutSigned(desc.isRelative ? Diff((item.*desc.get)(), (item_.*desc.get)()) : (item.*desc.get)());
+        }
+    }
+    if (fields & FIELD_AXES) {
+        uint32_t axes = event->GetAxes();
+        writer.PutVarint(axes);
+        for (int32_t i = MMI::PointerEvent::AXIS_TYPE_UNKNOWN; i < MMI::PointerEvent::AXIS_TYPE_MAX; ++i) {
+            auto axis = static_cast<MMI::PointerEvent::AxisType>(i);
+            if (MMI::PointerEvent::HasAxis(axes, axis)) {
+                writer.PutDouble(event->GetAxisValue(axis),
+                    MMI::PointerEvent::HasAxis(axes_, axis) ? axisValues_[i] : 0.0);
+            }
+        }
+    }
+    if (writer.IsOverflow()) {
+        return RET_ERR;
+    }
+    pkt << RECORD_DELTA << static_cast<uint8_t>(writer.Size());
+    if (!pkt.Write(writer.Data(), writer.Size())) {
+        FI_HILOGE("Failed to write delta");
+        return RET_ERR;
+    }
+    return RET_OK;
+}
+
+void PointerEventEncoder::Update(std::shared_ptr<MMI::PointerEvent> event, const MMI::PointerEvent::PointerItem &item)
+{
+    id_ = event->GetId();
+    pointerAction_ = event->GetPointerAction();
+    pointerId_ = event->GetPointerId();
+    sourceType_ = event->GetSourceType();
+    deviceId_ = event->GetDeviceId();
+    buttonId_ = event->GetButtonId();
+    targetDisplayId_ = event->GetTargetDisplayId();
+    targetWindowId_ = event->GetTargetWindowId();
+    agentWindowId_ = event->GetAgentWindowId();
+    flag_ = event->GetFlag();
+    actionTime_ = event->GetActionTime();
+    actionStartTime_ = event->GetActionStartTime();
+    sensorTime_ = event->GetSensorInputTime();
+    axes_ = event->GetAxes();
+    for (int32_t i = MMI::PointerEvent::AXIS_TYPE_UNKNOWN; i < MMI::PointerEvent::AXIS_TYPE_MAX; ++i) {
+        axisValues_[i] = event->GetAxisValue(static_cast<MMI::PointerEvent::AxisType>(i));
+    }
+    item_ = item;
+}
+
+void PointerEventDecoder::Advertise(NetPacket &pkt)
+{
+    pkt << ADVERTISEMENT_TAG;
+}
+
+bool PointerEventDecoder::IsFrames(NetPacket &pkt)
+{
+    return (HasTag(pkt, FRAME_TAG) && pkt.SeekReadPos(sizeof(FRAME_TAG)));
+}
+
+bool PointerEventDecoder::HasMore(NetPacket &pkt)
+{
+    return (pkt.UnreadSize() > 0);
+}
+
+int32_t PointerEventDecoder::Decode(NetPacket &pkt, std::shared_ptr<MMI::PointerEvent> event)
+{
+    CHKPR(event, RET_ERR);
+    uint8_t record = 0;
+    pkt >> record;
+    CHKRWER(pkt, RET_ERR);
+    if (record == RECORD_DELTA) {
+        return DecodeDelta(pkt, event);
+    }
+    if (record != RECORD_KEYFRAME) {
+        FI_HILOGE("Unknown record:%{public}u", record);
+        return RET_ERR;
+    }
+    event->Reset();
+    if (InputEventSerialization::Unmarshalling(pkt, event) != RET_OK) {
+        FI_HILOGE("Failed to deserialize keyframe");
+        hasBase_ = false;
+        return RET_ERR;
+    }
+    hasBase_ = true;
+    id_ = event->GetId();
+    actionTime_ = event->GetActionTime();
+    actionStartTime_ = event->GetActionStartTime();
+    sensorTime_ = event->GetSensorInputTime();
+    return RET_OK;
+}
+
+void PointerEventDecoder::Reset()
+{
+    hasBase_ = false;
+}
+
+int32_t PointerEventDecoder::DecodeDelta(NetPacket &pkt, std::shared_ptr<MMI::PointerEvent> event)
+{
+    uint8_t size = 0;
+    pkt >> size;
+    std::array<uint8_t, MAX_DELTA_SIZE> buf {};
+    if (pkt.ChkRWError() || !pkt.Read(reinterpret_cast<char *>(buf.data()), size)) {
+        FI_HILOGE("Failed to read delta");
+        return RET_ERR;
+    }
+    MMI::PointerEvent::PointerItem item;
+    if (!hasBase_ || !event->GetPointerItem(event->GetPointerId(), item)) {
+        FI_HILOGW("Delta without keyframe, skip");
+        return RET_ERR;
+    }
+    DeltaReader reader(buf.data(), size);
+    DeltaValues values;
+    if (!ReadDelta(reader, event, item, values)) {
+        FI_HILOGE("Corrupted delta");
+        hasBase_ = false;
+        return RET_ERR;
+    }
+    id_ = static_cast<int32_t>(Apply(id_, values.idDelta));
+    actionTime_ = Apply(actionTime_, values.timeDelta);
+    actionStartTime_ = Apply(actionStartTime_, values.startTimeDelta);
+    sensorTime_ = static_cast<uint64_t>(Apply(static_cast<int64_t>(sensorTime_), values.sensorTimeDelta));
+    event->SetId(id_);
+    event->SetActionTime(actionTime_);
+    event->SetActionStartTime(actionStartTime_);
+    event->SetSensorInputTime(sensorTime_);
+    if (values.fields & FIELD_ACTION) {
+        event->SetPointerAction(values.pointerAction);
+    }
+    if (values.fields & FIELD_AXES) {
+        event->ClearAxisValue();
+        for (int32_t i = MMI::PointerEvent::AXIS_TYPE_UNKNOWN; i < MMI::PointerEvent::AXIS_TYPE_MAX; ++i) {
+            auto axis = static_cast<MMI::PointerEvent::AxisType>(i);
+            if (MMI::PointerEvent::HasAxis(values.axes, axis)) {
+                event->SetAxisValue(axis, values.axisValues[i]);
+            }
+        }
+    }
+    event->UpdatePointerItem(event->GetPointerId(), item);
+    return RET_OK;
+}
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOOPBACK_DSOFTBUS_ADAPTER_H
+#define LOOPBACK_DSOFTBUS_ADAPTER_H
+
+#include <set>
+
+#include "nocopyable.h"
+
+#include "i_dsoftbus_adapter.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+// Hands every packet sent to the observers added to it, as if the peer had sent it, after a trip through bytes.
+class LoopbackDSoftbusAdapter final : public IDSoftbusAdapter {
+public:
+    LoopbackDSoftbusAdapter() = default;
+    ~LoopbackDSoftbusAdapter() = default;
+    DISALLOW_COPY_AND_MOVE(LoopbackDSoftbusAdapter);
+
+    int32_t Enable() override;
+    void Disable() override;
+
+    void AddObserver(std::shared_ptr<IDSoftbusObserver> observer) override;
+    void RemoveObserver(std::shared_ptr<IDSoftbusObserver> observer) override;
+
+    int32_t OpenSession(const std::string &networkId) override;
+    void CloseSession(const std::string &networkId) override;
+    void CloseAllSessions() override;
+
+    int32_t SendPacket(const std::string &networkId, NetPacket &packet) override;
+    int32_t SendParcel(const std::string &networkId, Parcel &parcel) override;
+    int32_t BroadcastPacket(NetPacket &packet) override;
+
+    size_t GetBytesSent() const;
+    size_t GetPacketsSent() const;
+    void ResetStatistics();
+
+private:
+    std::set<std::shared_ptr<IDSoftbusObserver>> observers_;
+    size_t bytesSent_ { 0 };
+    size_t packetsSent_ { 0 };
+};
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+#endif // LOOPBACK_DSOFTBUS_ADAPTER_H
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "devicestatus_define.h"
+#include "input_event_transmission/input_event_serialization.h"
+#include "input_event_transmission/pointer_event_delta.h"
+#include "loopback_dsoftbus_adapter.h"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+namespace {
+const std::string PEER_NETWORK_ID { "loopback" };
+constexpr int32_t POINTER_ID { 0 };
+constexpr int64_t FRAME_INTERVAL_US { 8000 };
+constexpr int32_t N_EVENTS { 1024 };
+constexpr int32_t MAX_STEP { 5 };
+constexpr int64_t BATCH_SIZE { 8 };
+
+// Rebuilds the events on the receiving side and notes when the last one of a packet was ready.
+class ReceivingObserver final : public IDSoftbusObserver {
+public:
+    void OnBind(const std::string &networkId) override {}
+    void OnShutdown(const std::string &networkId) override {}
+    void OnConnected(const std::string &networkId) override {}
+
+    bool OnPacket(const std::string &networkId, NetPacket &packet) override
+    {
+        if (!PointerEventDecoder::IsFrames(packet)) {
+            event_->Reset();
+            if (InputEventSerialization::Unmarshalling(packet, event_) == RET_OK) {
+                ++nReceived_;
+            }
+        } else {
+            while (PointerEventDecoder::HasMore(packet) && (decoder_.Decode(packet, event_) == RET_OK)) {
+                ++nReceived_;
+            }
+        }
+        benchmark::DoNotOptimize(event_->GetId());
+        return true;
+    }
+
+    bool OnRawData(const std::string &networkId, const void *data, uint32_t dataLen) override
+    {
+        return false;
+    }
+
+    PointerEventDecoder decoder_;
+    std::shared_ptr<MMI::PointerEvent> event_ { MMI::PointerEvent::Create() };
+    size_t nReceived_ { 0 };
+};
+
+std::vector<std::shared_ptr<MMI::PointerEvent>> CreateMouseMoves()
+{
+    std::vector<std::shared_ptr<MMI::PointerEvent>> events;
+    int32_t x = 0;
+    for (int32_t id = 0; id < N_EVENTS; ++id) {
+        x += id % MAX_STEP;
+        auto pointerEvent = MMI::PointerEvent::Create();
+        pointerEvent->SetId(id);
+        pointerEvent->SetActionTime(id * FRAME_INTERVAL_US);
+        pointerEvent->SetSourceType(MMI::PointerEvent::SOURCE_TYPE_MOUSE);
+        pointerEvent->SetPointerAction(MMI::PointerEvent::POINTER_ACTION_MOVE);
+        pointerEvent->SetPointerId(POINTER_ID);
+        MMI::PointerEvent::PointerItem item;
+        item.SetPointerId(POINTER_ID);
+        item.SetDisplayX(x);
+        item.SetDisplayY(x);
+        item.SetRawDx(id % MAX_STEP);
+        item.SetRawDy(id % MAX_STEP);
+        pointerEvent->AddPointerItem(item);
+        events.push_back(pointerEvent);
+    }
+    return events;
+}
+
+// Sends the moves in packets of batchSize events and reports the bytes and the time from the first event of a
+// packet being serialized to the last one being rebuilt on the receiving side, per event.
+void RunTransmission(benchmark::State &state, bool isCompact, int64_t batchSize)
+{
+    auto events = CreateMouseMoves();
+    LoopbackDSoftbusAdapter adapter;
+    auto observer = std::make_shared<ReceivingObserver>();
+    adapter.AddObserver(observer);
+    PointerEventEncoder encoder;
+    size_t nSent = 0;
+    size_t index = 0;
+    for (auto _ : state) {
+        auto start = std::chrono::steady_clock::now();
+        NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+        if (isCompact) {
+            PointerEventEncoder::BeginFrames(packet);
+        }
+        for (int64_t i = 0; i < batchSize; ++i, index = (index + 1) % events.size()) {
+            if (isCompact) {
+                encoder.Encode(events[index], packet);
+            } else {
+                InputEventSerialization::Marshalling(events[index], packet);
+            }
+        }
+        adapter.SendPacket(PEER_NETWORK_ID, packet);
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+        state.SetIterationTime(elapsed.count());
+        nSent += static_cast<size_t>(batchSize);
+    }
+    adapter.RemoveObserver(observer);
+    if ((nSent == 0) || (observer->nReceived_ != nSent)) {
+        state.SkipWithError("Events were lost on the way");
+        return;
+    }
+    state.counters["BytesPerEvent"] = benchmark::Counter(static_cast<double>(adapter.GetBytesSent()) / nSent);
+    state.counters["PacketsPerEvent"] = benchmark::Counter(static_cast<double>(adapter.GetPacketsSent()) / nSent);
+    state.SetItemsProcessed(static_cast<int64_t>(nSent));
+}
+
+void BM_FullPointerEvent(benchmark::State &state)
+{
+    RunTransmission(state, false, 1);
+}
+
+void BM_CompactPointerEvent(benchmark::State &state)
+{
+    RunTransmission(state, true, state.range(0));
+}
+} // namespace
+
+BENCHMARK(BM_FullPointerEvent)->UseManualTime();
+BENCHMARK(BM_CompactPointerEvent)->Arg(1)->Arg(BATCH_SIZE)->UseManualTime();
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "devicestatus_define.h"
+#include "fi_log.h"
+#include "input_event_transmission/input_event_serialization.h"
+#include "input_event_transmission/pointer_event_batch.h"
+#include "input_event_transmission/pointer_event_delta.h"
+#include "loopback_dsoftbus_adapter.h"
+
+#undef LOG_TAG
+#define LOG_TAG "InputEventTransmissionTest"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+namespace Cooperate {
+using namespace testing::ext;
+namespace {
+const std::string PEER_NETWORK_ID { "loopback" };
+constexpr int32_t POINTER_ID { 0 };
+constexpr int32_t DEVICE_ID { 3 };
+constexpr int64_t ACTION_TIME { 1000000 };
+constexpr int64_t FRAME_INTERVAL_US { 8000 };
+constexpr int32_t N_MOVES { 100 };
+constexpr int32_t MAX_STEP { 5 };
+constexpr double SCROLL_STEP { 15.0 };
+constexpr double FRACTION_X { 0.25 };
+constexpr size_t MIN_COMPRESSION_RATIO { 10 };
+constexpr int32_t MAX_BATCH_EVENTS { 8 };
+} // namespace
+
+class DecodingObserver final : public IDSoftbusObserver {
+public:
+    void OnBind(const std::string &networkId) override {}
+    void OnShutdown(const std::string &networkId) override {}
+    void OnConnected(const std::string &networkId) override {}
+
+    bool OnPacket(const std::string &networkId, NetPacket &packet) override
+    {
+        if (!PointerEventDecoder::IsFrames(packet)) {
+            auto event = MMI::PointerEvent::Create();
+            if (InputEventSerialization::Unmarshalling(packet, event) == RET_OK) {
+                events_.push_back(event);
+            }
+            return true;
+        }
+        ++nFramePackets_;
+        while (PointerEventDecoder::HasMore(packet)) {
+            if (decoder_.Decode(packet, event_) != RET_OK) {
+                ++nErrors_;
+                break;
+            }
+            events_.push_back(std::make_shared<MMI::PointerEvent>(*event_));
+        }
+        return true;
+    }
+
+    bool OnRawData(const std::string &networkId, const void *data, uint32_t dataLen) override
+    {
+        return false;
+    }
+
+    PointerEventDecoder decoder_;
+    std::shared_ptr<MMI::PointerEvent> event_ { MMI::PointerEvent::Create() };
+    std::vector<std::shared_ptr<MMI::PointerEvent>> events_;
+    size_t nErrors_ { 0 };
+    size_t nFramePackets_ { 0 };
+};
+
+class InputEventTransmissionTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        observer_ = std::make_shared<DecodingObserver>();
+        adapter_.AddObserver(observer_);
+    }
+
+    void TearDown() override
+    {
+        adapter_.RemoveObserver(observer_);
+    }
+
+    static std::shared_ptr<MMI::PointerEvent> CreateMouseEvent(int32_t pointerAction, int32_t id, double x, double y)
+    {
+        auto pointerEvent = MMI::PointerEvent::Create();
+        pointerEvent->SetId(id);
+        pointerEvent->SetActionTime(ACTION_TIME + id * FRAME_INTERVAL_US);
+        pointerEvent->SetActionStartTime(ACTION_TIME);
+        pointerEvent->SetDeviceId(DEVICE_ID);
+        pointerEvent->SetSourceType(MMI::PointerEvent::SOURCE_TYPE_MOUSE);
+        pointerEvent->SetPointerAction(pointerAction);
+        pointerEvent->SetPointerId(POINTER_ID);
+        MMI::PointerEvent::PointerItem item;
+        item.SetPointerId(POINTER_ID);
+        item.SetDeviceId(DEVICE_ID);
+        item.SetDisplayXPos(x);
+        item.SetDisplayYPos(y);
+        item.SetRawDx(id % MAX_STEP);
+        item.SetRawDy(-(id % MAX_STEP));
+        pointerEvent->AddPointerItem(item);
+        return pointerEvent;
+    }
+
+    // Sends events in one frame packet and returns the number of bytes it took.
+    size_t SendFrames(PointerEventEncoder &encoder, const std::vector<std::shared_ptr<MMI::PointerEvent>> &events)
+    {
+        NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+        PointerEventEncoder::BeginFrames(packet);
+        for (const auto &event : events) {
+            EXPECT_EQ(encoder.Encode(event, packet), RET_OK);
+        }
+        adapter_.ResetStatistics();
+        EXPECT_EQ(adapter_.SendPacket(PEER_NETWORK_ID, packet), RET_OK);
+        return adapter_.GetBytesSent();
+    }
+
+    static void ExpectSameEvent(std::shared_ptr<MMI::PointerEvent> decoded, std::shared_ptr<MMI::PointerEvent> sent)
+    {
+        EXPECT_EQ(decoded->GetId(), sent->GetId());
+        EXPECT_EQ(decoded->GetActionTime(), sent->GetActionTime());
+        EXPECT_EQ(decoded->GetActionStartTime(), sent->GetActionStartTime());
+        EXPECT_EQ(decoded->GetPointerAction(), sent->GetPointerAction());
+        EXPECT_EQ(decoded->GetSourceType(), sent->GetSourceType());
+        EXPECT_EQ(decoded->GetDeviceId(), sent->GetDeviceId());
+        EXPECT_EQ(decoded->GetAxes(), sent->GetAxes());
+        EXPECT_EQ(decoded->GetAxisValue(MMI::PointerEvent::AXIS_TYPE_SCROLL_VERTICAL),
+            sent->GetAxisValue(MMI::PointerEvent::AXIS_TYPE_SCROLL_VERTICAL));
+        MMI::PointerEvent::PointerItem decodedItem;
+        MMI::PointerEvent::PointerItem sentItem;
+        ASSERT_TRUE(decoded->GetPointerItem(POINTER_ID, decodedItem));
+        ASSERT_TRUE(sent->GetPointerItem(POINTER_ID, sentItem));
+        EXPECT_EQ(decodedItem.GetDisplayXPos(), sentItem.GetDisplayXPos());
+        EXPECT_EQ(decodedItem.GetDisplayYPos(), sentItem.GetDisplayYPos());
+        EXPECT_EQ(decodedItem.GetRawDx(), sentItem.GetRawDx());
+        EXPECT_EQ(decodedItem.GetRawDy(), sentItem.GetRawDy());
+    }
+
+    LoopbackDSoftbusAdapter adapter_;
+    std::shared_ptr<DecodingObserver> observer_ { nullptr };
+};
+
+/**
+ * @tc.name: InputEventTransmissionTest_RoundTrip_001
+ * @tc.desc: Moves and scrolls sent as a keyframe and deltas are rebuilt as they were sent
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventTransmissionTest, InputEventTransmissionTest_RoundTrip_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    std::vector<std::shared_ptr<MMI::PointerEvent>> events;
+    double x = 0.0;
+    for (int32_t id = 0; id < N_MOVES; ++id) {
+        x += id % MAX_STEP;
+        events.push_back(CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, id, x, -x));
+    }
+    int32_t scrollActions[] { MMI::PointerEvent::POINTER_ACTION_AXIS_BEGIN,
+        MMI::PointerEvent::POINTER_ACTION_AXIS_UPDATE, MMI::PointerEvent::POINTER_ACTION_AXIS_END };
+    for (int32_t pointerAction : scrollActions) {
+        auto event = CreateMouseEvent(pointerAction, static_cast<int32_t>(events.size()), x, -x);
+        event->SetAxisValue(MMI::PointerEvent::AXIS_TYPE_SCROLL_VERTICAL, SCROLL_STEP * events.size());
+        events.push_back(event);
+    }
+    PointerEventEncoder encoder;
+    SendFrames(encoder, events);
+    ASSERT_EQ(observer_->events_.size(), events.size());
+    EXPECT_EQ(observer_->nErrors_, 0);
+    for (size_t i = 0; i < events.size(); ++i) {
+        ExpectSameEvent(observer_->events_[i], events[i]);
+    }
+}
+
+/**
+ * @tc.name: InputEventTransmissionTest_RoundTrip_002
+ * @tc.desc: Coordinates that are not whole numbers go as they are and keep their exact value
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventTransmissionTest, InputEventTransmissionTest_RoundTrip_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    std::vector<std::shared_ptr<MMI::PointerEvent>> events {
+        CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, 0, 1.0, 1.0),
+        CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, 1, 1.0 + FRACTION_X, 1.0),
+        CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, 2, -FRACTION_X, 1.0),
+    };
+    PointerEventEncoder encoder;
+    SendFrames(encoder, events);
+    ASSERT_EQ(observer_->events_.size(), events.size());
+    for (size_t i = 0; i < events.size(); ++i) {
+        ExpectSameEvent(observer_->events_[i], events[i]);
+    }
+}
+
+/**
+ * @tc.name: InputEventTransmissionTest_Encode_001
+ * @tc.desc: A stream of moves takes a fraction of the bytes the fully serialized events take
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventTransmissionTest, InputEventTransmissionTest_Encode_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    std::vector<std::shared_ptr<MMI::PointerEvent>> events;
+    size_t fullBytes = 0;
+    double x = 0.0;
+    for (int32_t id = 0; id < N_MOVES; ++id) {
+        x += id % MAX_STEP;
+        events.push_back(CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, id, x, x));
+        NetPacket packet(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+        ASSERT_EQ(InputEventSerialization::Marshalling(events.back(), packet), RET_OK);
+        adapter_.ResetStatistics();
+        ASSERT_EQ(adapter_.SendPacket(PEER_NETWORK_ID, packet), RET_OK);
+        fullBytes += adapter_.GetBytesSent();
+    }
+    PointerEventEncoder encoder;
+    size_t compactBytes = SendFrames(encoder, events);
+    FI_HILOGI("Bytes per event, full:%{public}zu, compact:%{public}zu", fullBytes / N_MOVES, compactBytes / N_MOVES);
+    EXPECT_LT(compactBytes * MIN_COMPRESSION_RATIO, fullBytes);
+}
+
+/**
+ * @tc.name: InputEventTransmissionTest_Decode_001
+ * @tc.desc: Deltas are dropped until a keyframe arrives once the decoder lost its base
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventTransmissionTest, InputEventTransmissionTest_Decode_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    PointerEventEncoder encoder;
+    SendFrames(encoder, { CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, 0, 0.0, 0.0) });
+    observer_->decoder_.Reset();
+    SendFrames(encoder, { CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, 1, 1.0, 1.0) });
+    EXPECT_EQ(observer_->nErrors_, 1);
+    encoder.Reset();
+    SendFrames(encoder, { CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, 2, 2.0, 2.0) });
+    ASSERT_EQ(observer_->events_.size(), 2);
+    EXPECT_EQ(observer_->events_.back()->GetId(), 2);
+}
+/**
+ * @tc.name: InputEventTransmissionTest_Batch_001
+ * @tc.desc: Moves to a peer that advertised frames are held until flushed, or until the batch is full
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventTransmissionTest, InputEventTransmissionTest_Batch_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    PointerEventBatch batch(adapter_);
+    batch.SetPeer(PEER_NETWORK_ID);
+    batch.OnAdvertisement(PEER_NETWORK_ID);
+    adapter_.ResetStatistics();
+    EXPECT_TRUE(batch.Add(CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, 0, 0.0, 0.0)));
+    EXPECT_FALSE(batch.Add(CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, 1, 1.0, 1.0)));
+    EXPECT_FALSE(batch.Add(CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, 2, 2.0, 2.0)));
+    EXPECT_EQ(adapter_.GetPacketsSent(), 0);
+    batch.Flush();
+    EXPECT_EQ(adapter_.GetPacketsSent(), 1);
+    ASSERT_EQ(observer_->events_.size(), 3);
+    for (int32_t id = 0; id < 3; ++id) {
+        EXPECT_EQ(observer_->events_[id]->GetId(), id);
+    }
+
+    int32_t id = static_cast<int32_t>(observer_->events_.size());
+    EXPECT_TRUE(batch.Add(CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, id, id, id)));
+    for (++id; id < 3 + MAX_BATCH_EVENTS; ++id) {
+        EXPECT_FALSE(batch.Add(CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, id, id, id)));
+    }
+    EXPECT_EQ(adapter_.GetPacketsSent(), 2);
+    EXPECT_EQ(observer_->nFramePackets_, 2);
+    EXPECT_EQ(observer_->nErrors_, 0);
+    ASSERT_EQ(observer_->events_.size(), 3 + MAX_BATCH_EVENTS);
+    EXPECT_EQ(observer_->events_.back()->GetId(), 2 + MAX_BATCH_EVENTS);
+}
+
+/**
+ * @tc.name: InputEventTransmissionTest_Batch_002
+ * @tc.desc: A button event sends the moves pending before it first, then goes at once
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventTransmissionTest, InputEventTransmissionTest_Batch_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    PointerEventBatch batch(adapter_);
+    batch.SetPeer(PEER_NETWORK_ID);
+    batch.OnAdvertisement(PEER_NETWORK_ID);
+    adapter_.ResetStatistics();
+    std::vector<std::shared_ptr<MMI::PointerEvent>> events {
+        CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, 0, 0.0, 0.0),
+        CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, 1, 1.0, 1.0),
+        CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_BUTTON_DOWN, 2, 1.0, 1.0),
+        CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, 3, 2.0, 2.0),
+        CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_BUTTON_UP, 4, 2.0, 2.0),
+    };
+    for (const auto &event : events) {
+        batch.Add(event);
+    }
+    EXPECT_EQ(adapter_.GetPacketsSent(), 4);
+    EXPECT_EQ(observer_->nErrors_, 0);
+    ASSERT_EQ(observer_->events_.size(), events.size());
+    for (size_t i = 0; i < events.size(); ++i) {
+        ExpectSameEvent(observer_->events_[i], events[i]);
+    }
+}
+
+/**
+ * @tc.name: InputEventTransmissionTest_Batch_003
+ * @tc.desc: A peer that did not advertise frames gets one full event per packet, also after its session shut down
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventTransmissionTest, InputEventTransmissionTest_Batch_003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    PointerEventBatch batch(adapter_);
+    batch.SetPeer(PEER_NETWORK_ID);
+    adapter_.ResetStatistics();
+    EXPECT_FALSE(batch.Add(CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, 0, 0.0, 0.0)));
+    EXPECT_FALSE(batch.Add(CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, 1, 1.0, 1.0)));
+    EXPECT_EQ(adapter_.GetPacketsSent(), 2);
+
+    batch.OnAdvertisement(PEER_NETWORK_ID);
+    EXPECT_TRUE(batch.Add(CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, 2, 2.0, 2.0)));
+    batch.OnShutdown(PEER_NETWORK_ID);
+    EXPECT_EQ(adapter_.GetPacketsSent(), 3);
+    EXPECT_FALSE(batch.Add(CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, 3, 3.0, 3.0)));
+    EXPECT_EQ(adapter_.GetPacketsSent(), 4);
+
+    EXPECT_EQ(observer_->nFramePackets_, 1);
+    EXPECT_EQ(observer_->nErrors_, 0);
+    ASSERT_EQ(observer_->events_.size(), 4);
+    for (int32_t id = 0; id < 4; ++id) {
+        EXPECT_EQ(observer_->events_[id]->GetId(), id);
+    }
+}
+
+/**
+ * @tc.name: InputEventTransmissionTest_Advertise_001
+ * @tc.desc: An advertisement is told apart from frames and from fully serialized events
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventTransmissionTest, InputEventTransmissionTest_Advertise_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    NetPacket advertisement(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+    PointerEventDecoder::Advertise(advertisement);
+    EXPECT_TRUE(PointerEventEncoder::IsAdvertisement(advertisement));
+    EXPECT_TRUE(PointerEventEncoder::IsAdvertisement(advertisement));
+    EXPECT_FALSE(PointerEventDecoder::IsFrames(advertisement));
+
+    NetPacket frames(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+    PointerEventEncoder::BeginFrames(frames);
+    EXPECT_FALSE(PointerEventEncoder::IsAdvertisement(frames));
+
+    NetPacket full(MessageId::DSOFTBUS_INPUT_POINTER_EVENT);
+    ASSERT_EQ(InputEventSerialization::Marshalling(
+        CreateMouseEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, 0, 0.0, 0.0), full), RET_OK);
+    EXPECT_FALSE(PointerEventEncoder::IsAdvertisement(full));
+}
+} // namespace Cooperate
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "loopback_dsoftbus_adapter.h"
+
+#include "devicestatus_define.h"
+
+#undef LOG_TAG
+#define LOG_TAG "LoopbackDSoftbusAdapter"
+
+namespace OHOS {
+namespace Msdp {
+namespace DeviceStatus {
+int32_t LoopbackDSoftbusAdapter::Enable()
+{
+    return RET_OK;
+}
+
+void LoopbackDSoftbusAdapter::Disable()
+{}
+
+void LoopbackDSoftbusAdapter::AddObserver(std::shared_ptr<IDSoftbusObserver> observer)
+{
+    CHKPV(observer);
+    observers_.insert(observer);
+}
+
+void LoopbackDSoftbusAdapter::RemoveObserver(std::shared_ptr<IDSoftbusObserver> observer)
+{
+    observers_.erase(observer);
+}
+
+int32_t LoopbackDSoftbusAdapter::OpenSession(const std::string &networkId)
+{
+    return RET_OK;
+}
+
+void LoopbackDSoftbusAdapter::CloseSession(const std::string &networkId)
+{}
+
+void LoopbackDSoftbusAdapter::CloseAllSessions()
+{}
+
+int32_t LoopbackDSoftbusAdapter::SendPacket(const std::string &networkId, NetPacket &packet)
+{
+    StreamBuffer buffer;
+    if (!packet.MakeData(buffer)) {
+        FI_HILOGE("Failed to buffer packet");
+        return RET_ERR;
+    }
+    bytesSent_ += buffer.Size();
+    ++packetsSent_;
+    const PackHead *head = reinterpret_cast<const PackHead *>(buffer.Data());
+    NetPacket received(head->idMsg);
+    if ((head->size > 0) && !received.Write(buffer.Data() + sizeof(PackHead), head->size)) {
+        FI_HILOGE("Failed to fill packet");
+        return RET_ERR;
+    }
+    for (const auto &observer : observers_) {
+        if (observer->OnPacket(networkId, received)) {
+            break;
+        }
+    }
+    return RET_OK;
+}
+
+int32_t LoopbackDSoftbusAdapter::SendParcel(const std::string &networkId, Parcel &parcel)
+{
+    bytesSent_ += parcel.GetDataSize();
+    ++packetsSent_;
+    for (const auto &observer : observers_) {
+        if (observer->OnRawData(networkId, reinterpret_cast<const void *>(parcel.GetData()),
+            static_cast<uint32_t>(parcel.GetDataSize()))) {
+            break;
+        }
+    }
+    return RET_OK;
+}
+
+int32_t LoopbackDSoftbusAdapter::BroadcastPacket(NetPacket &packet)
+{
+    return SendPacket(std::string(), packet);
+}
+
+size_t LoopbackDSoftbusAdapter::GetBytesSent() const
+{
+    return bytesSent_;
+}
+
+size_t LoopbackDSoftbusAdapter::GetPacketsSent() const
+{
+    return packetsSent_;
+}
+
+void LoopbackDSoftbusAdapter::ResetStatistics()
+{
+    bytesSent_ = 0;
+    packetsSent_ = 0;
+}
+} // namespace DeviceStatus
+} // namespace Msdp
+} // namespace OHOS
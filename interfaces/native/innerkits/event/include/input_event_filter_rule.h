@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INPUT_EVENT_FILTER_RULE_H
+#define INPUT_EVENT_FILTER_RULE_H
+
+#include <set>
+#include <vector>
+
+#include "parcel.h"
+
+#include "key_event.h"
+#include "pointer_event.h"
+
+namespace OHOS {
+namespace MMI {
+/**
+ * @brief Describes the events an input event filter wants to see. The service evaluates the rule before calling
+ * the filter, so events the rule rejects never leave the service. Every condition left empty accepts any event,
+ * and conditions that do not apply to a kind of event, such as key codes for pointer events, are ignored for it.
+ * A filter that consumes events should make its rule cover every action of the sequences it consumes.
+ * @since 20
+ */
+class InputEventFilterRule final : public Parcelable {
+public:
+    struct Region {
+        int32_t displayId { -1 };
+        int32_t x { 0 };
+        int32_t y { 0 };
+        int32_t width { 0 };
+        int32_t height { 0 };
+    };
+
+    InputEventFilterRule() = default;
+    ~InputEventFilterRule() = default;
+
+    /**
+     * @brief Accepts pointer events of the source type, one of PointerEvent::SOURCE_TYPE_*.
+     * @return Returns <b>false</b> if the source type cannot be represented.
+     * @since 20
+     */
+    bool AddSourceType(int32_t sourceType);
+
+    /**
+     * @brief Accepts pointer events with the action, one of PointerEvent::POINTER_ACTION_*.
+     * @return Returns <b>false</b> if the action cannot be represented.
+     * @since 20
+     */
+    bool AddPointerAction(int32_t pointerAction);
+
+    /**
+     * @brief Accepts key events with the action, one of KeyEvent::KEY_ACTION_*.
+     * @return Returns <b>false</b> if the action cannot be represented.
+     * @since 20
+     */
+    bool AddKeyAction(int32_t keyAction);
+
+    /**
+     * @brief Accepts key events of the key code.
+     * @return Returns <b>false</b> if the rule holds too many key codes.
+     * @since 20
+     */
+    bool AddKeyCode(int32_t keyCode);
+
+    /**
+     * @brief Accepts pointer events whose pointer lies in the region, in display coordinates. A display id of -1
+     * matches every display.
+     * @return Returns <b>false</b> if the region is empty or the rule holds too many regions.
+     * @since 20
+     */
+    bool AddRegion(const Region &region);
+
+    bool Match(const KeyEvent &keyEvent) const;
+    bool Match(const PointerEvent &pointerEvent) const;
+
+    bool Marshalling(Parcel &parcel) const override;
+    bool ReadFromParcel(Parcel &parcel);
+    static InputEventFilterRule* Unmarshalling(Parcel &parcel);
+
+private:
+    bool MatchRegions(const PointerEvent &pointerEvent) const;
+
+    uint64_t sourceTypes_ { 0 };
+    uint64_t pointerActions_ { 0 };
+    uint64_t keyActions_ { 0 };
+    std::set<int32_t> keyCodes_;
+    std::vector<Region> regions_;
+};
+} // namespace MMI
+} // namespace OHOS
+#endif // INPUT_EVENT_FILTER_RULE_H
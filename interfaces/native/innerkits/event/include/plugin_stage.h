@@ -93,6 +93,50 @@ struct IPluginData {
     LibInputEventData libInputEventData;
 };
 
+// Kinds of PluginEventType, one bit per alternative of the variant.
+enum PluginEventKind : uint32_t {
+    PLUGIN_EVENT_LIBINPUT = 1U << 0,
+    PLUGIN_EVENT_POINTER = 1U << 1,
+    PLUGIN_EVENT_AXIS = 1U << 2,
+    PLUGIN_EVENT_KEY = 1U << 3,
+    PLUGIN_EVENT_ALL = PLUGIN_EVENT_LIBINPUT | PLUGIN_EVENT_POINTER | PLUGIN_EVENT_AXIS | PLUGIN_EVENT_KEY,
+};
+
+// The events a plugin handles at a stage. Bit n of an action mask stands for action n; actions
+// beyond the width of the masks always match. The default subscription matches every event.
+// A plugin declares its subscriptions by exporting GetPluginSubscription next to InitPlugin; the
+// symbol is optional, and a plugin without it keeps getting every event.
+struct PluginSubscription {
+    uint32_t eventKinds { PLUGIN_EVENT_ALL };
+    uint64_t pointerActions { UINT64_MAX };
+    uint64_t keyActions { UINT64_MAX };
+
+    bool Match(const PluginEventType &event) const
+    {
+        if ((eventKinds & (1U << event.index())) == 0) {
+            return false;
+        }
+        if (auto pointerEvent = std::get_if<std::shared_ptr<PointerEvent>>(&event);
+            (pointerEvent != nullptr) && (*pointerEvent != nullptr)) {
+            return MatchAction(pointerActions, (*pointerEvent)->GetPointerAction());
+        }
+        if (auto keyEvent = std::get_if<std::shared_ptr<KeyEvent>>(&event);
+            (keyEvent != nullptr) && (*keyEvent != nullptr)) {
+            return MatchAction(keyActions, (*keyEvent)->GetKeyAction());
+        }
+        return true;
+    }
+
+    static bool MatchAction(uint64_t actions, int32_t action)
+    {
+        constexpr int32_t nActionBits { 64 };
+        if ((action < 0) || (action >= nActionBits)) {
+            return true;
+        }
+        return ((actions & (uint64_t { 1 } << action)) != 0);
+    }
+};
+
 struct IShortcutKey {
     std::set<int32_t> preKeys;
     int32_t finalKey { -1 };
@@ -212,11 +256,16 @@ struct IPluginContext {
     virtual int32_t EnableInputDeviceForPlugin(int32_t deviceId) = 0;
     virtual int32_t DisableInputDeviceForPlugin(int32_t deviceId) = 0;
     virtual double ConvertVPToPX(double vp) const = 0;
+    virtual bool IsSubscribed(InputPluginStage stage, const PluginEventType &event) const { return true; }
+    virtual void SetCallback(InputPluginStage stage, std::function<void(PluginEventType, int64_t)> callback)
+    {
+        SetCallback(callback);
+    }
 };
 
-inline bool checkPluginEventNull(PluginEventType &event)
+inline bool checkPluginEventNull(const PluginEventType &event)
 {
-    return std::visit([](auto &&v) { return v == nullptr; }, event);
+    return std::visit([](const auto &v) { return v == nullptr; }, event);
 }
 } // namespace MMI
 } // namespace OHOS
@@ -1358,6 +1358,22 @@ public:
          */
         void SetCanceled(bool canceled);
 
+        /**
+         * @brief Checks whether the pointer changed in the hardware frame reported by this event. When touch moves
+         * are delivered once per frame, a move carries every finger on the screen and marks the ones that moved.
+         * @return Returns <b>true</b> if the pointer changed; returns <b>false</b> otherwise.
+         * @since 23
+         */
+        bool IsChanged() const;
+
+        /**
+         * @brief Sets whether the pointer changed in the hardware frame reported by this event.
+         * @param changed Specifies whether the pointer changed.
+         * @return void
+         * @since 23
+         */
+        void SetChanged(bool changed);
+
         /**
          * @brief Obtains the x coordinate relative to the upper left corner of the virtual screen in one-hand mode.
          */
@@ -1535,6 +1551,7 @@ public:
         int32_t blobId_ {};
         int32_t twist_ {};
         bool canceled_ { false };
+        bool changed_ { true };
         int32_t orientation_ {-1};
         bool visible_ { false };
         int32_t style_ {};
@@ -1571,6 +1588,52 @@ public:
         std::vector<ExtensionData> extensionData_;
     };
 
+    /**
+     * Maximum number of pointer items an event carries.
+     *
+     * @since 23
+     */
+    static constexpr size_t MAX_N_POINTER_ITEMS = 10;
+
+    /**
+     * @brief Contiguous storage of the pointer items of an event, sized to MAX_N_POINTER_ITEMS so that adding,
+     * looking up and iterating pointers never allocates.
+     * @since 23
+     */
+    class PointerItemStore {
+    public:
+        using iterator = PointerItem*;
+        using const_iterator = const PointerItem*;
+
+        PointerItemStore() = default;
+        PointerItemStore(const PointerItemStore &other);
+        PointerItemStore& operator=(const PointerItemStore &other);
+
+        size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        iterator begin() { return items_.data(); }
+        iterator end() { return items_.data() + size_; }
+        const_iterator begin() const { return items_.data(); }
+        const_iterator end() const { return items_.data() + size_; }
+        PointerItem& front() { return items_[0]; }
+        const PointerItem& front() const { return items_[0]; }
+        PointerItem& back() { return items_[size_ - 1]; }
+        const PointerItem& back() const { return items_[size_ - 1]; }
+
+        /**
+         * @brief Appends a copy of the item, the store is left unchanged once it is full.
+         * @return Returns <b>true</b> if the item was appended; returns <b>false</b> otherwise.
+         * @since 23
+         */
+        bool push_back(const PointerItem &item);
+        iterator erase(const_iterator pos);
+        void clear() { size_ = 0; }
+
+    private:
+        std::array<PointerItem, MAX_N_POINTER_ITEMS> items_ {};
+        size_t size_ { 0 };
+    };
+
 public:
     /**
      * @brief Copy constructor function for PointerEvent
@@ -1594,6 +1657,14 @@ public:
      */
     static std::shared_ptr<PointerEvent> Create();
 
+    /**
+     * @brief Creates a copy of the pointer event.
+     * @param pointerEvent Indicates the pointer event to copy.
+     * @return Returns the copy, or <b>nullptr</b> if pointerEvent is <b>nullptr</b>.
+     * @since 23
+     */
+    static std::shared_ptr<PointerEvent> Clone(std::shared_ptr<PointerEvent> pointerEvent);
+
     virtual void Reset() override;
 
     virtual std::string ToString() override;
@@ -1690,6 +1761,16 @@ public:
      */
     bool GetOriginPointerItem(int32_t pointerId, PointerItem &pointerItem) const;
 
+    /**
+     * @brief Finds the pointer item of a specified pointer ID in place, without copying it.
+     * @param pointerId Indicates the pointer ID.
+     * @return Returns the pointer item, or <b>nullptr</b> if no pointer with the specified ID exists.
+     * The item is valid until the pointer items of this event are modified.
+     * @since 23
+     */
+    const PointerItem* FindPointerItem(int32_t pointerId) const;
+    PointerItem* FindPointerItem(int32_t pointerId);
+
     /**
      * @brief Adds a pointer item.
      * @param pointerItem Indicates the pointer item to add.
@@ -1720,6 +1801,13 @@ public:
      */
     std::list<PointerItem> GetAllPointerItems() const;
 
+    /**
+     * @brief Obtains read access to all the pointer items without copying them.
+     * @return Returns the pointer items, valid until the pointer items of this event are modified.
+     * @since 23
+     */
+    const PointerItemStore& GetPointerItems() const;
+
     /**
      * @brief Updates a pointer item based on the pointer ID.
      * @param pointerId Indicates the ID of the pointer from which the pointer item is to be updated.
@@ -2146,7 +2234,7 @@ private:
     };
 
     int32_t pointerId_ { -1 };
-    std::list<PointerItem> pointers_;
+    PointerItemStore pointers_;
     std::set<int32_t> pressedButtons_;
     int32_t pointerAction_ { POINTER_ACTION_UNKNOWN };
     int32_t originPointerAction_ { POINTER_ACTION_UNKNOWN };
@@ -29,6 +29,7 @@
 #include "i_window_checker.h"
 #include "infrared_frequency_info.h"
 #include "input_device.h"
+#include "input_event_filter_rule.h"
 #include "key_option.h"
 #include "long_press_event.h"
 #include "mmi_event_observer.h"
@@ -78,6 +79,18 @@ public:
     int32_t UpdateWindowInfo(const WindowGroupInfo &windowGroupInfo);
 
     int32_t AddInputEventFilter(std::shared_ptr<IInputEventFilter> filter, int32_t priority, uint32_t deviceTags);
+
+    /**
+     * @brief Adds an input event filter that is only called for the events matching the rule.
+     * @param filter Indicates the filter.
+     * @param priority Indicates the priority of the filter.
+     * @param deviceTags Indicates the capabilities of the devices whose events are filtered.
+     * @param rule Indicates the events the filter is called for.
+     * @return Returns the filter ID if the operation is successful; returns a negative value otherwise.
+     * @since 20
+     */
+    int32_t AddInputEventFilter(std::shared_ptr<IInputEventFilter> filter, int32_t priority, uint32_t deviceTags,
+        const InputEventFilterRule &rule);
     int32_t RemoveInputEventFilter(int32_t filterId);
 
     /**
@@ -16,7 +16,9 @@
 #ifndef TIMER_MANAGER_H
 #define TIMER_MANAGER_H
 
+#include <array>
 #include <list>
+#include <vector>
 
 #include "singleton.h"
 
@@ -25,6 +27,12 @@
 
 namespace OHOS {
 namespace MMI {
+/*
+ * Timers live in a hierarchical timer wheel with 128us ticks: four levels of 64 buckets cover about 35 minutes
+ * and an overflow bucket holds anything further away. Insertion and removal are O(1), a bucket is cascaded into
+ * the finer levels only when the wheel reaches it. Timer ids are slot indexes tagged with a generation, so an id
+ * that outlived its timer never matches the timer that reuses the slot.
+ */
 class TimerManager final : public ITimerManager {
 public:
     ~TimerManager();
@@ -34,6 +42,8 @@ public:
         const std::string &name = "") override;
     int32_t AddLongTimer(int32_t intervalMs, int32_t repeatCount, std::function<void()> callback,
         const std::string &name = "");
+    int32_t AddPreciseTimer(int64_t intervalUs, int32_t repeatCount, std::function<void()> callback,
+        const std::string &name = "");
     int32_t RemoveTimer(int32_t timerId, const std::string &name = "") override;
     int32_t ResetTimer(int32_t timerId) override;
     bool IsExist(int32_t timerId) override;
@@ -44,28 +54,51 @@ public:
 
 private:
     struct TimerItem {
-        int32_t id { 0 };
-        int32_t intervalMs { 0 };
+        int32_t id { -1 };
+        int64_t intervalUs { 0 };
         int32_t repeatCount { 0 };
         int32_t callbackCount { 0 };
         int64_t nextCallTime { 0 };
         std::function<void()> callback;
         std::string name { "" };
+        int32_t generation { 0 };
+        int32_t bucket { -1 };
+        int32_t prev { -1 };
+        int32_t next { -1 };
     };
 private:
     TimerManager();
     int32_t TakeNextTimerId();
+    int32_t AddTimerUsInternal(int64_t intervalUs, int32_t repeatCount, std::function<void()> callback,
+        const std::string &name);
+    int32_t FindTimerInternal(int32_t timerId) const;
+    void ReleaseTimerInternal(int32_t slot);
     int32_t RemoveTimerInternal(int32_t timerId, const std::string &name = "");
     int32_t ResetTimerInternal(int32_t timerId);
     bool IsExistInternal(int32_t timerId);
-    void InsertTimerInternal(std::unique_ptr<TimerItem>& timer);
+    void InsertTimerInternal(int32_t slot);
+    void UnlinkTimerInternal(int32_t slot);
+    int32_t GetBucketInternal(int64_t expireTick) const;
+    int32_t NextBucketInternal(int64_t &tick) const;
+    void CascadeInternal(int32_t bucket);
+    void ExpireBucketInternal(int32_t bucket, int64_t nowTime, std::list<std::function<void()>>& callbacks);
     int32_t CalcNextDelayInternal();
     void ProcessTimersInternal(std::list<std::function<void()>>& callbacks);
 
 private:
+    static constexpr int32_t WHEEL_BITS { 6 };
+    static constexpr int32_t WHEEL_SIZE { 1 << WHEEL_BITS };
+    static constexpr int32_t WHEEL_LEVELS { 4 };
+    static constexpr int32_t OVERFLOW_BUCKET { WHEEL_LEVELS * WHEEL_SIZE };
+
     static std::once_flag initFlag_;
     static std::shared_ptr<TimerManager> instance_;
-    std::list<std::unique_ptr<TimerItem>> timers_;
+    std::vector<TimerItem> timers_;
+    std::vector<int32_t> freeSlots_;
+    std::array<int32_t, OVERFLOW_BUCKET + 1> buckets_ {};
+    std::array<uint64_t, WHEEL_LEVELS> occupied_ {};
+    int32_t timerCount_ { 0 };
+    int64_t currentTick_ { 0 };
     std::recursive_mutex timerMutex_;
 };
 
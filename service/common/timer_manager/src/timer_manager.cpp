@@ -14,6 +14,10 @@
  */
 
 #include "timer_manager.h"
+
+#include <algorithm>
+#include <limits>
+
 #include "bytrace_adapter.h"
 
 #undef MMI_LOG_TAG
@@ -28,8 +32,17 @@ constexpr int32_t MIN_DELAY { -1 };
 constexpr int32_t MIN_INTERVAL { 36 };
 constexpr int32_t MAX_INTERVAL_MS { 10000 };
 constexpr int32_t MAX_LONG_INTERVAL_MS { 30000 };
-constexpr int32_t MAX_TIMER_COUNT { 64 };
+constexpr int32_t MAX_TIMER_COUNT { 4096 };
 constexpr int32_t NONEXISTENT_ID { -1 };
+// Timer ids carry the slot in the low bits and the slot generation above, MAX_TIMER_COUNT is 1 << SLOT_BITS.
+constexpr int32_t SLOT_BITS { 12 };
+constexpr int32_t SLOT_MASK { (1 << SLOT_BITS) - 1 };
+constexpr int32_t GENERATION_MASK { (1 << (31 - SLOT_BITS)) - 1 };
+static_assert(MAX_TIMER_COUNT == (1 << SLOT_BITS), "Timer slots must fit in the id");
+// One wheel tick is 128us.
+constexpr int32_t TICK_SHIFT { 7 };
+constexpr int64_t MIN_PRECISE_INTERVAL_US { 1 << TICK_SHIFT };
+constexpr int64_t US_PER_MS { 1000 };
 } // namespace
 
 std::once_flag TimerManager::initFlag_ = std::once_flag();
@@ -58,7 +71,12 @@ private:
     uintptr_t ptr_ = 0;
 };
 
-TimerManager::TimerManager() {}
+TimerManager::TimerManager()
+{
+    buckets_.fill(-1);
+    currentTick_ = GetSysClockTime() >> TICK_SHIFT;
+}
+
 TimerManager::~TimerManager() {}
 
 std::shared_ptr<TimerManager> TimerManager::GetInstance()
@@ -91,6 +109,12 @@ int32_t TimerManager::AddLongTimer(int32_t intervalMs, int32_t repeatCount, std:
     return AddTimerInternal(intervalMs, repeatCount, callback, name);
 }
 
+int32_t TimerManager::AddPreciseTimer(int64_t intervalUs, int32_t repeatCount, std::function<void()> callback,
+    const std::string &name)
+{
+    return AddTimerUsInternal(std::max(intervalUs, MIN_PRECISE_INTERVAL_US), repeatCount, callback, name);
+}
+
 int32_t TimerManager::RemoveTimer(int32_t timerId, const std::string &name)
 {
     return RemoveTimerInternal(timerId, name);
@@ -122,156 +146,294 @@ void TimerManager::ProcessTimers()
 
 int32_t TimerManager::TakeNextTimerId()
 {
-    uint64_t timerSlot = 0;
-    uint64_t one = 1;
     std::lock_guard<std::recursive_mutex> lock(timerMutex_);
-    for (const auto &timer : timers_) {
-        timerSlot |= (one << timer->id);
-    }
-
-    for (int32_t i = 0; i < MAX_TIMER_COUNT; i++) {
-        if ((timerSlot & (one << i)) == 0) {
-            return i;
-        }
+    int32_t slot = NONEXISTENT_ID;
+    if (!freeSlots_.empty()) {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else if (timers_.size() < static_cast<size_t>(MAX_TIMER_COUNT)) {
+        slot = static_cast<int32_t>(timers_.size());
+        timers_.emplace_back();
+    } else {
+        MMI_HILOGE("Timer count reached the maximum number:%{public}d", MAX_TIMER_COUNT);
+        return NONEXISTENT_ID;
     }
-    return NONEXISTENT_ID;
+    TimerItem &timer = timers_[slot];
+    timer.id = (timer.generation << SLOT_BITS) | slot;
+    ++timerCount_;
+    return timer.id;
 }
 
 int32_t TimerManager::AddTimerInternal(int32_t intervalMs, int32_t repeatCount, std::function<void()> callback,
     const std::string &name)
+{
+    return AddTimerUsInternal(static_cast<int64_t>(intervalMs) * US_PER_MS, repeatCount, callback, name);
+}
+
+int32_t TimerManager::AddTimerUsInternal(int64_t intervalUs, int32_t repeatCount, std::function<void()> callback,
+    const std::string &name)
 {
     if (!callback) {
         return NONEXISTENT_ID;
     }
-    auto timer = std::make_unique<TimerItem>();
-    timer->intervalMs = intervalMs;
-    timer->repeatCount = repeatCount;
-    timer->callbackCount = 0;
-    timer->name = name;
-    auto nowTime = GetMillisTime();
-    if (!AddInt64(nowTime, timer->intervalMs, timer->nextCallTime)) {
+    auto nowTime = GetSysClockTime();
+    int64_t nextCallTime = 0;
+    if (!AddInt64(nowTime, intervalUs, nextCallTime)) {
         MMI_HILOGE("The addition of nextCallTime in TimerItem overflows");
         return NONEXISTENT_ID;
     }
-    timer->callback = callback;
     std::lock_guard<std::recursive_mutex> lock(timerMutex_);
+    if (timerCount_ == 0) {
+        currentTick_ = std::max(currentTick_, nowTime >> TICK_SHIFT);
+    }
     int32_t timerId = TakeNextTimerId();
     if (timerId < 0) {
         return NONEXISTENT_ID;
     }
-    timer->id = timerId;
-    InsertTimerInternal(timer);
+    int32_t slot = timerId & SLOT_MASK;
+    TimerItem &timer = timers_[slot];
+    timer.intervalUs = intervalUs;
+    timer.repeatCount = repeatCount;
+    timer.callbackCount = 0;
+    timer.nextCallTime = nextCallTime;
+    timer.callback = callback;
+    timer.name = name;
+    InsertTimerInternal(slot);
     return timerId;
 }
 
+int32_t TimerManager::FindTimerInternal(int32_t timerId) const
+{
+    if (timerId < 0) {
+        return NONEXISTENT_ID;
+    }
+    int32_t slot = timerId & SLOT_MASK;
+    if ((static_cast<size_t>(slot) >= timers_.size()) || (timers_[slot].id != timerId)) {
+        return NONEXISTENT_ID;
+    }
+    return slot;
+}
+
+void TimerManager::ReleaseTimerInternal(int32_t slot)
+{
+    UnlinkTimerInternal(slot);
+    TimerItem &timer = timers_[slot];
+    timer.id = NONEXISTENT_ID;
+    timer.generation = (timer.generation + 1) & GENERATION_MASK;
+    timer.callback = nullptr;
+    freeSlots_.push_back(slot);
+    --timerCount_;
+}
+
 int32_t TimerManager::RemoveTimerInternal(int32_t timerId, const std::string &name)
 {
     std::lock_guard<std::recursive_mutex> lock(timerMutex_);
-    for (auto it = timers_.begin(); it != timers_.end(); ++it) {
-        if ((*it)->id == timerId && (name.empty() || (*it)->name == name)) {
-            timers_.erase(it);
-            return RET_OK;
-        }
+    int32_t slot = FindTimerInternal(timerId);
+    if ((slot < 0) || (!name.empty() && (timers_[slot].name != name))) {
+        return RET_ERR;
     }
-    return RET_ERR;
+    ReleaseTimerInternal(slot);
+    return RET_OK;
 }
 
 int32_t TimerManager::ResetTimerInternal(int32_t timerId)
 {
     std::lock_guard<std::recursive_mutex> lock(timerMutex_);
-    for (auto it = timers_.begin(); it != timers_.end(); ++it) {
-        if ((*it)->id == timerId) {
-            auto timer = std::move(*it);
-            timers_.erase(it);
-            auto nowTime = GetMillisTime();
-            if (!AddInt64(nowTime, timer->intervalMs, timer->nextCallTime)) {
-                MMI_HILOGE("The addition of nextCallTime in TimerItem overflows");
-                return RET_ERR;
-            }
-            timer->callbackCount = 0;
-            InsertTimerInternal(timer);
-            return RET_OK;
-        }
+    int32_t slot = FindTimerInternal(timerId);
+    if (slot < 0) {
+        return RET_ERR;
     }
-    return RET_ERR;
+    UnlinkTimerInternal(slot);
+    TimerItem &timer = timers_[slot];
+    auto nowTime = GetSysClockTime();
+    if (!AddInt64(nowTime, timer.intervalUs, timer.nextCallTime)) {
+        MMI_HILOGE("The addition of nextCallTime in TimerItem overflows");
+        ReleaseTimerInternal(slot);
+        return RET_ERR;
+    }
+    timer.callbackCount = 0;
+    InsertTimerInternal(slot);
+    return RET_OK;
 }
 
 bool TimerManager::IsExistInternal(int32_t timerId)
 {
     std::lock_guard<std::recursive_mutex> lock(timerMutex_);
-    for (auto it = timers_.begin(); it != timers_.end(); ++it) {
-        if ((*it)->id == timerId) {
-            return true;
+    return FindTimerInternal(timerId) >= 0;
+}
+
+int32_t TimerManager::GetBucketInternal(int64_t expireTick) const
+{
+    int64_t tick = std::max(expireTick, currentTick_);
+    // The lowest level whose window still contains the current tick, so a bucket is never behind the wheel.
+    for (int32_t level = 0; level < WHEEL_LEVELS; ++level) {
+        int32_t windowShift = WHEEL_BITS * (level + 1);
+        if ((tick >> windowShift) == (currentTick_ >> windowShift)) {
+            return level * WHEEL_SIZE + static_cast<int32_t>((tick >> (WHEEL_BITS * level)) & (WHEEL_SIZE - 1));
         }
     }
-    return false;
+    return OVERFLOW_BUCKET;
 }
 
-void TimerManager::InsertTimerInternal(std::unique_ptr<TimerItem>& timer)
+void TimerManager::InsertTimerInternal(int32_t slot)
 {
     std::lock_guard<std::recursive_mutex> lock(timerMutex_);
-    for (auto it = timers_.begin(); it != timers_.end(); ++it) {
-        if ((*it)->nextCallTime > timer->nextCallTime) {
-            timers_.insert(it, std::move(timer));
-            return;
+    TimerItem &timer = timers_[slot];
+    int32_t bucket = GetBucketInternal(timer.nextCallTime >> TICK_SHIFT);
+    timer.bucket = bucket;
+    timer.prev = NONEXISTENT_ID;
+    timer.next = buckets_[bucket];
+    if (timer.next != NONEXISTENT_ID) {
+        timers_[timer.next].prev = slot;
+    }
+    buckets_[bucket] = slot;
+    if (bucket < OVERFLOW_BUCKET) {
+        occupied_[bucket / WHEEL_SIZE] |= (uint64_t { 1 } << (bucket % WHEEL_SIZE));
+    }
+}
+
+void TimerManager::UnlinkTimerInternal(int32_t slot)
+{
+    TimerItem &timer = timers_[slot];
+    int32_t bucket = timer.bucket;
+    if (bucket < 0) {
+        return;
+    }
+    if (timer.prev != NONEXISTENT_ID) {
+        timers_[timer.prev].next = timer.next;
+    } else {
+        buckets_[bucket] = timer.next;
+    }
+    if (timer.next != NONEXISTENT_ID) {
+        timers_[timer.next].prev = timer.prev;
+    }
+    if ((buckets_[bucket] == NONEXISTENT_ID) && (bucket < OVERFLOW_BUCKET)) {
+        occupied_[bucket / WHEEL_SIZE] &= ~(uint64_t { 1 } << (bucket % WHEEL_SIZE));
+    }
+    timer.bucket = NONEXISTENT_ID;
+    timer.prev = NONEXISTENT_ID;
+    timer.next = NONEXISTENT_ID;
+}
+
+int32_t TimerManager::NextBucketInternal(int64_t &tick) const
+{
+    // Every level only holds buckets at or after the current tick and each level starts where the one below ends,
+    // so the first occupied bucket from the lowest level up is the next one the wheel reaches.
+    for (int32_t level = 0; level < WHEEL_LEVELS; ++level) {
+        int32_t shift = WHEEL_BITS * level;
+        int32_t digit = static_cast<int32_t>((currentTick_ >> shift) & (WHEEL_SIZE - 1));
+        int32_t first = (level == 0) ? digit : (digit + 1);
+        if (first >= WHEEL_SIZE) {
+            continue;
         }
+        uint64_t pending = occupied_[level] & (~uint64_t { 0 } << first);
+        if (pending == 0) {
+            continue;
+        }
+        int32_t index = __builtin_ctzll(pending);
+        int32_t windowShift = shift + WHEEL_BITS;
+        tick = ((currentTick_ >> windowShift) << windowShift) + (static_cast<int64_t>(index) << shift);
+        return level * WHEEL_SIZE + index;
+    }
+    if (buckets_[OVERFLOW_BUCKET] != NONEXISTENT_ID) {
+        int32_t windowShift = WHEEL_BITS * WHEEL_LEVELS;
+        tick = ((currentTick_ >> windowShift) + 1) << windowShift;
+        return OVERFLOW_BUCKET;
     }
-    timers_.push_back(std::move(timer));
+    return NONEXISTENT_ID;
 }
 
-int32_t TimerManager::CalcNextDelayInternal()
+void TimerManager::CascadeInternal(int32_t bucket)
 {
-    auto delay = MIN_DELAY;
-    std::lock_guard<std::recursive_mutex> lock(timerMutex_);
-    if (!timers_.empty()) {
-        auto nowTime = GetMillisTime();
-        const auto& item = *timers_.begin();
-        if (nowTime >= item->nextCallTime) {
-            delay = 0;
+    int32_t slot = buckets_[bucket];
+    buckets_[bucket] = NONEXISTENT_ID;
+    if (bucket < OVERFLOW_BUCKET) {
+        occupied_[bucket / WHEEL_SIZE] &= ~(uint64_t { 1 } << (bucket % WHEEL_SIZE));
+    }
+    while (slot != NONEXISTENT_ID) {
+        int32_t next = timers_[slot].next;
+        InsertTimerInternal(slot);
+        slot = next;
+    }
+}
+
+void TimerManager::ExpireBucketInternal(int32_t bucket, int64_t nowTime, std::list<std::function<void()>>& callbacks)
+{
+    int32_t slot = buckets_[bucket];
+    buckets_[bucket] = NONEXISTENT_ID;
+    occupied_[bucket / WHEEL_SIZE] &= ~(uint64_t { 1 } << (bucket % WHEEL_SIZE));
+    while (slot != NONEXISTENT_ID) {
+        TimerItem &timer = timers_[slot];
+        int32_t next = timer.next;
+        timer.bucket = NONEXISTENT_ID;
+        if (timer.nextCallTime > nowTime) {
+            // Later in the current tick.
+            InsertTimerInternal(slot);
+            slot = next;
+            continue;
+        }
+        BytraceAdapter::MMIServiceTraceStartFormat(BytraceAdapter::MMI_THREAD_LOOP_DEPTH_THREE,
+            "StartTimer, Name is: %s", timer.name.c_str());
+        CrashObjDumper dumper((timer.name).c_str());
+        ++timer.callbackCount;
+        if ((timer.repeatCount >= 1) && (timer.callbackCount >= timer.repeatCount)) {
+            callbacks.emplace_back(std::move(timer.callback));
+            ReleaseTimerInternal(slot);
+        } else if (!AddInt64(timer.nextCallTime, timer.intervalUs, timer.nextCallTime)) {
+            MMI_HILOGE("The addition of nextCallTime in TimerItem overflows");
+            ReleaseTimerInternal(slot);
         } else {
-            delay = item->nextCallTime - nowTime;
+            callbacks.emplace_back(timer.callback);
+            InsertTimerInternal(slot);
         }
+        BytraceAdapter::MMIServiceTraceStop();
+        slot = next;
     }
-    return delay;
 }
 
-void TimerManager::ProcessTimersInternal(std::list<std::function<void()>>& callbacks)
+int32_t TimerManager::CalcNextDelayInternal()
 {
     std::lock_guard<std::recursive_mutex> lock(timerMutex_);
-    if (timers_.empty()) {
-        return;
+    int64_t tick = 0;
+    int32_t bucket = NextBucketInternal(tick);
+    if (bucket < 0) {
+        return MIN_DELAY;
+    }
+    int64_t nextCallTime = std::numeric_limits<int64_t>::max();
+    for (int32_t slot = buckets_[bucket]; slot != NONEXISTENT_ID; slot = timers_[slot].next) {
+        nextCallTime = std::min(nextCallTime, timers_[slot].nextCallTime);
     }
-    auto nowTime = GetMillisTime();
+    auto nowTime = GetSysClockTime();
+    if (nowTime >= nextCallTime) {
+        return 0;
+    }
+    // Round up, waking before the deadline only costs another turn of the loop.
+    int64_t delay = (nextCallTime - nowTime + US_PER_MS - 1) / US_PER_MS;
+    return static_cast<int32_t>(std::min<int64_t>(delay, std::numeric_limits<int32_t>::max()));
+}
+
+void TimerManager::ProcessTimersInternal(std::list<std::function<void()>>& callbacks)
+{
+    std::lock_guard<std::recursive_mutex> lock(timerMutex_);
+    auto nowTime = GetSysClockTime();
+    int64_t nowTick = nowTime >> TICK_SHIFT;
     for (;;) {
-        auto it = timers_.begin();
-        if (it == timers_.end()) {
-            break;
-        }
-        if ((*it)->nextCallTime > nowTime) {
+        int64_t tick = 0;
+        int32_t bucket = NextBucketInternal(tick);
+        if ((bucket < 0) || (tick > nowTick)) {
             break;
         }
-        auto curTimer = std::move(*it);
-        std::string msg = "StartTimer, Name is: ";
-        msg += curTimer->name;
-        BytraceAdapter::MMIServiceTraceStart(BytraceAdapter::MMI_THREAD_LOOP_DEPTH_THREE, msg);
-        CrashObjDumper dumper((curTimer->name).c_str());
-        timers_.erase(it);
-        ++curTimer->callbackCount;
-        if ((curTimer->repeatCount >= 1) && (curTimer->callbackCount >= curTimer->repeatCount)) {
-            callbacks.emplace_back(curTimer->callback);
-            BytraceAdapter::MMIServiceTraceStop();
+        currentTick_ = std::max(currentTick_, tick);
+        if (bucket >= WHEEL_SIZE) {
+            CascadeInternal(bucket);
             continue;
         }
-        if (!AddInt64(curTimer->nextCallTime, curTimer->intervalMs, curTimer->nextCallTime)) {
-            MMI_HILOGE("The addition of nextCallTime in TimerItem overflows");
-            BytraceAdapter::MMIServiceTraceStop();
-            return;
+        ExpireBucketInternal(bucket, nowTime, callbacks);
+        if (tick == nowTick) {
+            break;
         }
-        auto callback = curTimer->callback;
-        InsertTimerInternal(curTimer);
-        callbacks.emplace_back(callback);
-        BytraceAdapter::MMIServiceTraceStop();
     }
+    currentTick_ = std::max(currentTick_, nowTick);
 }
 } // namespace MMI
 } // namespace OHOS
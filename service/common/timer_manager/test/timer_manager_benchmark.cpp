@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <list>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "timer_manager.h"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr int32_t BASE_INTERVAL_MS { 100 };
+constexpr int32_t INTERVAL_SPREAD_MS { 8000 };
+constexpr int32_t INTERVAL_STEP_MS { 7 };
+constexpr int64_t PRECISE_INTERVAL_US { 500 };
+
+int32_t GetInterval(int32_t index)
+{
+    return BASE_INTERVAL_MS + (index * INTERVAL_STEP_MS) % INTERVAL_SPREAD_MS;
+}
+
+// Storage used by TimerManager before the timer wheel: a list sorted by deadline, searched by id.
+class SortedListTimers {
+public:
+    int32_t Add(int32_t intervalMs)
+    {
+        auto timer = std::make_unique<Timer>();
+        timer->id = nextId_++;
+        timer->nextCallTime = GetMillisTime() + intervalMs;
+        for (auto it = timers_.begin(); it != timers_.end(); ++it) {
+            if ((*it)->nextCallTime > timer->nextCallTime) {
+                int32_t id = timer->id;
+                timers_.insert(it, std::move(timer));
+                return id;
+            }
+        }
+        timers_.push_back(std::move(timer));
+        return timers_.back()->id;
+    }
+
+    void Remove(int32_t id)
+    {
+        for (auto it = timers_.begin(); it != timers_.end(); ++it) {
+            if ((*it)->id == id) {
+                timers_.erase(it);
+                return;
+            }
+        }
+    }
+
+private:
+    struct Timer {
+        int32_t id { 0 };
+        int64_t nextCallTime { 0 };
+    };
+    std::list<std::unique_ptr<Timer>> timers_;
+    int32_t nextId_ { 0 };
+};
+
+class LiveTimers {
+public:
+    explicit LiveTimers(int32_t count)
+    {
+        for (int32_t i = 0; i < count; ++i) {
+            timerIds_.push_back(TimerMgr->AddTimer(GetInterval(i), 1, []() {}, "TimerManagerBenchmark"));
+        }
+    }
+    ~LiveTimers()
+    {
+        for (int32_t timerId : timerIds_) {
+            TimerMgr->RemoveTimer(timerId);
+        }
+    }
+    DISALLOW_COPY_AND_MOVE(LiveTimers);
+
+private:
+    std::vector<int32_t> timerIds_;
+};
+
+// One short lived timer per iteration on top of a loaded manager, the pattern of per-event timers.
+void BM_TimerWheelAddRemove(benchmark::State &state)
+{
+    LiveTimers liveTimers(static_cast<int32_t>(state.range(0)));
+    int32_t index = 0;
+    for (auto _ : state) {
+        int32_t timerId = TimerMgr->AddTimer(GetInterval(index++), 1, []() {}, "TimerManagerBenchmark");
+        benchmark::DoNotOptimize(timerId);
+        TimerMgr->RemoveTimer(timerId);
+    }
+    state.counters["LiveTimers"] = state.range(0);
+}
+BENCHMARK(BM_TimerWheelAddRemove)->Arg(60)->Arg(1000)->Arg(4000);
+
+void BM_SortedListAddRemove(benchmark::State &state)
+{
+    SortedListTimers timers;
+    for (int32_t i = 0; i < state.range(0); ++i) {
+        timers.Add(GetInterval(i));
+    }
+    int32_t index = 0;
+    for (auto _ : state) {
+        int32_t timerId = timers.Add(GetInterval(index++));
+        benchmark::DoNotOptimize(timerId);
+        timers.Remove(timerId);
+    }
+    state.counters["LiveTimers"] = state.range(0);
+}
+BENCHMARK(BM_SortedListAddRemove)->Arg(60)->Arg(1000)->Arg(4000);
+
+void BM_TimerWheelResetTimer(benchmark::State &state)
+{
+    LiveTimers liveTimers(static_cast<int32_t>(state.range(0)));
+    int32_t timerId = TimerMgr->AddTimer(INTERVAL_SPREAD_MS, 1, []() {}, "TimerManagerBenchmark");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(TimerMgr->ResetTimer(timerId));
+    }
+    TimerMgr->RemoveTimer(timerId);
+    state.counters["LiveTimers"] = state.range(0);
+}
+BENCHMARK(BM_TimerWheelResetTimer)->Arg(60)->Arg(1000)->Arg(4000);
+
+// The event loop asks for the next delay and processes timers on every turn.
+void BM_TimerWheelLoopTurn(benchmark::State &state)
+{
+    LiveTimers liveTimers(static_cast<int32_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(TimerMgr->CalcNextDelay());
+        TimerMgr->ProcessTimers();
+    }
+    state.counters["LiveTimers"] = state.range(0);
+}
+BENCHMARK(BM_TimerWheelLoopTurn)->Arg(60)->Arg(1000)->Arg(4000);
+
+// Sub-millisecond repeating timers firing while thousands of others wait in the upper levels.
+void BM_TimerWheelPreciseExpiry(benchmark::State &state)
+{
+    LiveTimers liveTimers(static_cast<int32_t>(state.range(0)));
+    int64_t fired = 0;
+    int32_t timerId = TimerMgr->AddPreciseTimer(PRECISE_INTERVAL_US, 0, [&fired]() { ++fired; },
+        "TimerManagerBenchmark");
+    for (auto _ : state) {
+        TimerMgr->ProcessTimers();
+    }
+    TimerMgr->RemoveTimer(timerId);
+    state.counters["Fired"] = fired;
+    state.counters["LiveTimers"] = state.range(0);
+}
+BENCHMARK(BM_TimerWheelPreciseExpiry)->Arg(60)->Arg(4000);
+} // namespace
+} // namespace MMI
+} // namespace OHOS
+
+BENCHMARK_MAIN();
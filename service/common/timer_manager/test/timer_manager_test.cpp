@@ -13,7 +13,9 @@
  * limitations under the License.
 */
 
+#include <chrono>
 #include <fstream>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -29,6 +31,10 @@ constexpr int32_t MAX_INTERVAL_MS { 10000 };
 constexpr int32_t MIN_INTERVAL { 36 };
 constexpr int32_t MAX_LONG_INTERVAL_MS { 30000 };
 constexpr int32_t NONEXISTENT_ID { -1 };
+constexpr int32_t MANY_TIMER_COUNT { 1000 };
+constexpr int64_t LONG_DELAY_US { 60 * 1000 * 1000 };
+constexpr int64_t PRECISE_INTERVAL_US { 500 };
+constexpr int64_t CASCADE_INTERVAL_US { 20 * 1000 };
 } // namespace
 
 class TimerManagerTest : public testing::Test {
@@ -42,6 +48,26 @@ void AddTimerCallback()
     return;
 }
 
+int32_t InsertTimer(TimerManager &timermanager, int64_t nextCallTime)
+{
+    int32_t timerId = timermanager.TakeNextTimerId();
+    int32_t slot = timermanager.FindTimerInternal(timerId);
+    if (slot < 0) {
+        return NONEXISTENT_ID;
+    }
+    timermanager.timers_[slot].nextCallTime = nextCallTime;
+    timermanager.timers_[slot].callback = []() {};
+    timermanager.InsertTimerInternal(slot);
+    return timerId;
+}
+
+void RunCallbacks(const std::list<std::function<void()>> &callbacks)
+{
+    for (const auto &callback : callbacks) {
+        callback();
+    }
+}
+
 /**
  * @tc.name: TimerManagerTest_ManagerTimer_001
  * @tc.desc: Test the function AddTimer
@@ -319,7 +345,7 @@ HWTEST_F(TimerManagerTest, TimerManagerTest_IsExistInternal_001, TestSize.Level1
 
 /**
  * @tc.name: TimerManagerTest_InsertTimerInternal_001
- * @tc.desc: Test inserting a timer internally within the TimerManager
+ * @tc.desc: Test a timer due within the current tick window is inserted in the lowest wheel level
  * @tc.type: FUNC
  * @tc.require:
  */
@@ -327,15 +353,16 @@ HWTEST_F(TimerManagerTest, TimerManagerTest_InsertTimerInternal_001, TestSize.Le
 {
     CALL_TEST_DEBUG;
     TimerManager timermanager;
-    auto timer = std::make_unique<TimerManager::TimerItem>();
-    timer->nextCallTime = 100;
-    timermanager.InsertTimerInternal(timer);
-    EXPECT_EQ(timermanager.timers_.front()->nextCallTime, 100);
+    int32_t timerId = InsertTimer(timermanager, GetSysClockTime());
+    int32_t slot = timermanager.FindTimerInternal(timerId);
+    ASSERT_GE(slot, 0);
+    EXPECT_LT(timermanager.timers_[slot].bucket, TimerManager::WHEEL_SIZE);
+    EXPECT_EQ(timermanager.CalcNextDelayInternal(), 0);
 }
 
 /**
  * @tc.name: TimerManagerTest_InsertTimerInternal_002
- * @tc.desc: Test inserting a timer internally within the TimerManager
+ * @tc.desc: Test a distant timer is inserted in a higher wheel level and removing it empties the wheel
  * @tc.type: FUNC
  * @tc.require:
  */
@@ -343,18 +370,18 @@ HWTEST_F(TimerManagerTest, TimerManagerTest_InsertTimerInternal_002, TestSize.Le
 {
     CALL_TEST_DEBUG;
     TimerManager timermanager;
-    auto timer1 = std::make_unique<TimerManager::TimerItem>();
-    timer1->nextCallTime = 100;
-    timermanager.InsertTimerInternal(timer1);
-    auto timer2 = std::make_unique<TimerManager::TimerItem>();
-    timer2->nextCallTime = 50;
-    timermanager.InsertTimerInternal(timer2);
-    EXPECT_EQ(timermanager.timers_.front()->nextCallTime, 50);
+    int32_t timerId = InsertTimer(timermanager, GetSysClockTime() + LONG_DELAY_US);
+    int32_t slot = timermanager.FindTimerInternal(timerId);
+    ASSERT_GE(slot, 0);
+    EXPECT_GE(timermanager.timers_[slot].bucket, TimerManager::WHEEL_SIZE);
+    EXPECT_LT(timermanager.timers_[slot].bucket, TimerManager::OVERFLOW_BUCKET);
+    EXPECT_EQ(timermanager.RemoveTimerInternal(timerId), RET_OK);
+    EXPECT_EQ(timermanager.CalcNextDelayInternal(), -1);
 }
 
 /**
  * @tc.name: TimerManagerTest_InsertTimerInternal_003
- * @tc.desc: Test inserting a timer internally within the TimerManager
+ * @tc.desc: Test a timer beyond the wheel span is kept in the overflow bucket and still reports its delay
  * @tc.type: FUNC
  * @tc.require:
  */
@@ -362,16 +389,11 @@ HWTEST_F(TimerManagerTest, TimerManagerTest_InsertTimerInternal_003, TestSize.Le
 {
     CALL_TEST_DEBUG;
     TimerManager timermanager;
-    auto timer1 = std::make_unique<TimerManager::TimerItem>();
-    timer1->nextCallTime = 100;
-    timermanager.InsertTimerInternal(timer1);
-    auto timer2 = std::make_unique<TimerManager::TimerItem>();
-    timer2->nextCallTime = 200;
-    timermanager.InsertTimerInternal(timer2);
-    auto timer3 = std::make_unique<TimerManager::TimerItem>();
-    timer3->nextCallTime = 200;
-    timermanager.InsertTimerInternal(timer3);
-    EXPECT_EQ(timermanager.timers_.front()->nextCallTime, 100);
+    int32_t timerId = timermanager.AddTimerInternal(INT32_MAX, 1, []() {});
+    int32_t slot = timermanager.FindTimerInternal(timerId);
+    ASSERT_GE(slot, 0);
+    EXPECT_EQ(timermanager.timers_[slot].bucket, TimerManager::OVERFLOW_BUCKET);
+    EXPECT_GT(timermanager.CalcNextDelayInternal(), INT32_MAX / 2);
 }
 
 /**
@@ -399,9 +421,7 @@ HWTEST_F(TimerManagerTest, TimerManagerTest_CalcNextDelayInternal_001, TestSize.
 HWTEST_F(TimerManagerTest, TimerManagerTest_CalcNextDelayInternal, TestSize.Level1)
 {
     TimerManager tMgr;
-    auto timer = std::make_unique<TimerManager::TimerItem>();
-    timer->nextCallTime = -1;
-    tMgr.InsertTimerInternal(timer);
+    InsertTimer(tMgr, -1);
     EXPECT_EQ(tMgr.CalcNextDelayInternal(), 0);
 }
 
@@ -428,11 +448,10 @@ HWTEST_F(TimerManagerTest, TimerManagerTest_ProcessTimersInternal_001, TestSize.
 HWTEST_F(TimerManagerTest, TimerManagerTest_ProcessTimersInternal, TestSize.Level1)
 {
     TimerManager tMgr;
-    auto timer = std::make_unique<TimerManager::TimerItem>();
-    timer->nextCallTime = 10000000000;
-    tMgr.InsertTimerInternal(timer);
+    InsertTimer(tMgr, GetSysClockTime() + LONG_DELAY_US);
     std::list<std::function<void()>> callbacks;
     ASSERT_NO_FATAL_FAILURE(tMgr.ProcessTimersInternal(callbacks));
+    EXPECT_TRUE(callbacks.empty());
 }
 
 /**
@@ -737,5 +756,92 @@ HWTEST_F(TimerManagerTest, TimerManagerTest_ProcessTimersInternal_005, TestSize.
     }
     EXPECT_FALSE(callbackExecuted);
 }
+
+/**
+ * @tc.name: TimerManagerTest_AddTimerInternal_006
+ * @tc.desc: Test far more timers than the former 64 slot limit can be added and removed by id
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TimerManagerTest, TimerManagerTest_AddTimerInternal_006, TestSize.Level1)
+{
+    TimerManager timermanager;
+    std::vector<int32_t> timerIds;
+    for (int32_t i = 0; i < MANY_TIMER_COUNT; ++i) {
+        int32_t timerId = timermanager.AddTimerInternal(100 + i, 1, []() {});
+        ASSERT_GE(timerId, 0);
+        timerIds.push_back(timerId);
+    }
+    for (int32_t timerId : timerIds) {
+        EXPECT_EQ(timermanager.RemoveTimerInternal(timerId), RET_OK);
+    }
+    EXPECT_EQ(timermanager.CalcNextDelayInternal(), -1);
+}
+
+/**
+ * @tc.name: TimerManagerTest_RemoveTimer_002
+ * @tc.desc: Test an id whose timer was removed does not match the timer that reuses its slot
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TimerManagerTest, TimerManagerTest_RemoveTimer_002, TestSize.Level1)
+{
+    TimerManager timermanager;
+    int32_t staleId = timermanager.AddTimer(1000, 1, []() {});
+    ASSERT_GE(staleId, 0);
+    EXPECT_EQ(timermanager.RemoveTimer(staleId), RET_OK);
+    int32_t timerId = timermanager.AddTimer(1000, 1, []() {});
+    ASSERT_GE(timerId, 0);
+    EXPECT_NE(timerId, staleId);
+    EXPECT_FALSE(timermanager.IsExist(staleId));
+    EXPECT_EQ(timermanager.RemoveTimer(staleId), RET_ERR);
+    EXPECT_TRUE(timermanager.IsExist(timerId));
+}
+
+/**
+ * @tc.name: TimerManagerTest_AddPreciseTimer_001
+ * @tc.desc: Test a sub-millisecond timer is not clamped and repeats at its own interval
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TimerManagerTest, TimerManagerTest_AddPreciseTimer_001, TestSize.Level1)
+{
+    TimerManager timermanager;
+    int32_t callCount = 0;
+    int32_t timerId = timermanager.AddPreciseTimer(PRECISE_INTERVAL_US, 2, [&callCount]() { ++callCount; });
+    ASSERT_GE(timerId, 0);
+    EXPECT_LE(timermanager.CalcNextDelayInternal(), 1);
+    std::this_thread::sleep_for(std::chrono::microseconds(PRECISE_INTERVAL_US * 2 + 100));
+    std::list<std::function<void()>> callbacks;
+    timermanager.ProcessTimersInternal(callbacks);
+    RunCallbacks(callbacks);
+    EXPECT_EQ(callCount, 2);
+    EXPECT_FALSE(timermanager.IsExist(timerId));
+}
+
+/**
+ * @tc.name: TimerManagerTest_ProcessTimersInternal_006
+ * @tc.desc: Test a timer cascaded down from a higher wheel level fires once it is due and not before
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TimerManagerTest, TimerManagerTest_ProcessTimersInternal_006, TestSize.Level1)
+{
+    TimerManager timermanager;
+    bool callbackExecuted = false;
+    int64_t startTime = GetSysClockTime();
+    int32_t timerId = timermanager.AddPreciseTimer(CASCADE_INTERVAL_US, 1,
+        [&callbackExecuted]() { callbackExecuted = true; });
+    ASSERT_GE(timerId, 0);
+    std::list<std::function<void()>> callbacks;
+    while (!callbackExecuted && (GetSysClockTime() - startTime < LONG_DELAY_US)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        callbacks.clear();
+        timermanager.ProcessTimersInternal(callbacks);
+        RunCallbacks(callbacks);
+    }
+    EXPECT_TRUE(callbackExecuted);
+    EXPECT_GE(GetSysClockTime() - startTime, CASCADE_INTERVAL_US);
+}
 } // namespace MMI
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
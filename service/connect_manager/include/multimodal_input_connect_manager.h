@@ -39,6 +39,8 @@ public:
         return tokenType_;
     }
     int32_t AddInputEventFilter(sptr<IEventFilter> filter, int32_t filterId, int32_t priority, uint32_t deviceTags);
+    int32_t AddInputEventFilter(sptr<IEventFilter> filter, int32_t filterId, int32_t priority, uint32_t deviceTags,
+        const InputEventFilterRule &rule);
     int32_t RemoveInputEventFilter(int32_t filterId);
     int32_t NotifyNapOnline();
     int32_t RemoveInputEventObserver();
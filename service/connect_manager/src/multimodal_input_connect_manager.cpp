@@ -135,6 +135,14 @@ int32_t MultimodalInputConnectManager::AddInputEventFilter(sptr<IEventFilter> fi
     return multimodalInputConnectService_->AddInputEventFilter(filter, filterId, priority, deviceTags);
 }
 
+int32_t MultimodalInputConnectManager::AddInputEventFilter(sptr<IEventFilter> filter, int32_t filterId,
+    int32_t priority, uint32_t deviceTags, const InputEventFilterRule &rule)
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    CHKPR(multimodalInputConnectService_, INVALID_HANDLER_ID);
+    return multimodalInputConnectService_->AddInputEventFilterWithRule(filter, filterId, priority, deviceTags, rule);
+}
+
 int32_t MultimodalInputConnectManager::NotifyNapOnline()
 {
     // LCOV_EXCL_START
@@ -36,6 +36,8 @@ public:
                 (override));
     MOCK_METHOD(int32_t, AddInputEventFilter,
                 (sptr<IEventFilter> filter, int32_t filterId, int32_t priority, uint32_t deviceTags), (override));
+    MOCK_METHOD(int32_t, AddInputEventFilterWithRule, (sptr<IEventFilter> filter, int32_t filterId, int32_t priority,
+        uint32_t deviceTags, const InputEventFilterRule &rule), (override));
     MOCK_METHOD(int32_t, NotifyNapOnline, (), (override));
     MOCK_METHOD(int32_t, RemoveInputEventObserver, (), (override));
     MOCK_METHOD(int32_t, RemoveInputEventFilter, (int32_t filterId), (override));
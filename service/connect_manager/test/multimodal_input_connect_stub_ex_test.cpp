@@ -62,6 +62,8 @@ public:
     }
     int32_t AddInputEventFilter(sptr<IEventFilter> filter, int32_t filterId, int32_t priority,
         uint32_t deviceTags) override { return filterId; }
+    int32_t AddInputEventFilterWithRule(sptr<IEventFilter> filter, int32_t filterId, int32_t priority,
+        uint32_t deviceTags, const InputEventFilterRule &rule) override { return filterId; }
     int32_t NotifyNapOnline() override { return 0; }
     int32_t RemoveInputEventObserver() override { return 0; }
     int32_t RemoveInputEventFilter(int32_t filterId) override { return filterId; }
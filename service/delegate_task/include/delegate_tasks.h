@@ -16,12 +16,14 @@
 #ifndef DELEGATE_TASKS_H
 #define DELEGATE_TASKS_H
 
+#include <atomic>
+#include <chrono>
 #include <cinttypes>
+#include <condition_variable>
 #include <functional>
-#include <future>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <vector>
 
 #include "i_delegate_interface.h"
 #include "id_factory.h"
@@ -29,25 +31,17 @@
 
 namespace OHOS {
 namespace MMI {
-namespace {
-constexpr size_t FDS_SIZE = 2;
-} // namespace
-
 class DelegateTasks {
 public:
-    struct TaskData {
-        uint64_t tid { 0 };
-        int32_t taskId { 0 };
-    };
     class Task : public std::enable_shared_from_this<Task> {
     public:
-        using Promise = std::promise<int32_t>;
-        using Future = std::future<int32_t>;
         using TaskPtr = std::shared_ptr<DelegateTasks::Task>;
-        Task(uint64_t id, DTaskCallback fun, std::shared_ptr<Promise> promise = nullptr)
-            : id_(id), fun_(fun), promise_(promise) {}
+        Task(uint64_t id, DTaskCallback fun, bool isSync = false)
+            : id_(id), fun_(std::move(fun)), isSync_(isSync) {}
         ~Task() = default;
         void ProcessTask();
+        // Waits for the result of a sync task, returns false on timeout.
+        bool WaitResult(std::chrono::milliseconds timeout, int32_t &ret);
 
         uint64_t GetId() const
         {
@@ -67,15 +61,23 @@ public:
         }
 
     private:
+        friend class DelegateTasks;
+
         std::atomic_bool hasWaited_ { false };
         std::atomic_bool taskIsRunning { false };
         uint64_t id_ { 0 };
         DTaskCallback fun_;
-        std::shared_ptr<Promise> promise_ { nullptr };
+        bool isSync_ { false };
+        // The result of a sync task lives in the task, no promise is allocated per call.
+        std::mutex resultMutex_;
+        std::condition_variable resultCond_;
+        bool isDone_ { false };
+        int32_t ret_ { 0 };
+        // Set while the task is queued, the queue holds the task through self_.
+        Task *next_ { nullptr };
+        TaskPtr self_ { nullptr };
     };
     using TaskPtr = Task::TaskPtr;
-    using Promise = Task::Promise;
-    using Future = Task::Future;
 
 public:
     DelegateTasks() = default;
@@ -88,7 +90,7 @@ public:
 
     int32_t GetReadFd() const
     {
-        return fds_[0];
+        return wakeFd_;
     }
     void SetWorkerThreadId(uint64_t tid)
     {
@@ -101,14 +103,16 @@ public:
 
 private:
     void PopPendingTaskList(std::vector<TaskPtr> &tasks);
-    TaskPtr PostTask(DTaskCallback callback, std::shared_ptr<Promise>promise = nullptr);
+    TaskPtr PostTask(DTaskCallback callback, bool isSync = false);
 
 private:
     uint64_t workerThreadId_ { 0 };
-    int32_t fds_[FDS_SIZE] = {};
-    std::timed_mutex mux_;
-    std::queue<TaskPtr> tasks_;
-    uint64_t id_ {0};
+    int32_t wakeFd_ { -1 };
+    // Lock-free stack of posted tasks, newest first. Posting threads push, the worker thread takes it whole.
+    std::atomic<Task *> pendingTasks_ { nullptr };
+    std::atomic<size_t> pendingCount_ { 0 };
+    std::atomic<uint64_t> id_ { 0 };
+    std::vector<TaskPtr> processingTasks_;
 };
 } // namespace MMI
 } // namespace OHOS
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NOTIFICATION_OUTBOX_H
+#define NOTIFICATION_OUTBOX_H
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "mpsc_ring.h"
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace MMI {
+/*
+ * Notifications to other processes that input delivery does not wait for, such as touch reports to the resource
+ * scheduler and the render service. Posting copies a few integers into a bounded lock-free queue, a low priority
+ * worker thread runs the sink of the channel. A notification equal to the one of its channel still waiting in
+ * the queue is coalesced into it, and a full queue drops the notification rather than block the poster.
+ */
+class NotificationOutbox final {
+public:
+    enum Channel : int32_t {
+        CHANNEL_RES_SCHED_TOUCH = 0,
+        CHANNEL_RS_TOUCH,
+        CHANNEL_COUNT,
+    };
+
+    static constexpr size_t MAX_ARGS { 3 };
+
+    struct Notification {
+        int32_t channel { CHANNEL_COUNT };
+        std::array<int32_t, MAX_ARGS> args {};
+        int64_t postTime { 0 };
+    };
+
+    using Sink = std::function<void(const Notification &notification)>;
+
+    static NotificationOutbox& GetInstance();
+    DISALLOW_COPY_AND_MOVE(NotificationOutbox);
+
+    // The sink runs on the worker thread, or on the posting thread while the worker is not running.
+    void SetSink(Channel channel, Sink sink, bool coalesce);
+    // Returns false if the notification was dropped.
+    bool Post(Channel channel, int32_t arg0 = 0, int32_t arg1 = 0, int32_t arg2 = 0);
+    bool Start();
+    // Delivers what is still queued before returning.
+    void Stop();
+    bool IsRunning() const;
+    void Reset();
+    void Dump(int32_t fd);
+
+private:
+    struct ChannelCounter {
+        std::atomic<uint64_t> posted { 0 };
+        std::atomic<uint64_t> coalesced { 0 };
+        std::atomic<uint64_t> dropped { 0 };
+        std::atomic<uint64_t> delivered { 0 };
+        std::atomic<uint64_t> queueTotalUs { 0 };
+        std::atomic<uint64_t> queueMaxUs { 0 };
+        std::atomic<uint64_t> sinkTotalUs { 0 };
+        std::atomic<uint64_t> sinkMaxUs { 0 };
+    };
+
+    NotificationOutbox() = default;
+    ~NotificationOutbox();
+
+    void WorkerLoop();
+    bool Drain();
+    void Deliver(const Notification &notification);
+    bool MarkPending(const Notification &notification);
+    void ClearPending(const Notification &notification);
+    static const char* GetChannelName(int32_t channel);
+
+    static constexpr size_t QUEUE_SIZE { 256 };
+
+    MpscRing<Notification, QUEUE_SIZE> queue_;
+    std::mutex sinkMutex_;
+    std::array<Sink, CHANNEL_COUNT> sinks_ {};
+    std::array<std::atomic_bool, CHANNEL_COUNT> coalesce_ {};
+    std::mutex pendingMutex_;
+    // Arguments of the last notification of each channel still in the queue.
+    std::array<std::array<int32_t, MAX_ARGS>, CHANNEL_COUNT> pendingArgs_ {};
+    std::array<bool, CHANNEL_COUNT> isPending_ {};
+    std::array<ChannelCounter, CHANNEL_COUNT> counters_ {};
+    std::mutex wakeMutex_;
+    std::condition_variable wakeCondition_;
+    std::atomic_bool idle_ { false };
+    std::atomic_bool running_ { false };
+    std::thread worker_;
+};
+
+#define NOTIFY_OUTBOX ::OHOS::MMI::NotificationOutbox::GetInstance()
+} // namespace MMI
+} // namespace OHOS
+#endif // NOTIFICATION_OUTBOX_H
@@ -15,7 +15,8 @@
 
 #include "delegate_tasks.h"
 
-#include <fcntl.h>
+#include <algorithm>
+#include <sys/eventfd.h>
 #include <unistd.h>
 
 #include "backtrace_local.h"
@@ -30,8 +31,8 @@
 namespace OHOS {
 namespace MMI {
 namespace {
-    constexpr int32_t TIMED_WAIT_MS = 2;
     constexpr size_t SKIP_FRAME_NUM = 0;
+    constexpr size_t MAX_TASKS_LIMIT = 1000;
 } // namespace
 void DelegateTasks::Task::ProcessTask()
 {
@@ -42,72 +43,67 @@ void DelegateTasks::Task::ProcessTask()
     }
     taskIsRunning = true;
     int32_t ret = fun_();
-    std::string taskType = ((promise_ == nullptr) ? "Async" : "Sync");
+    std::string taskType = (isSync_ ? "Sync" : "Async");
     MMI_HILOGD("Process taskType:%{public}s, taskId:%{public}" PRId64 ", ret:%{public}d", taskType.c_str(), id_, ret);
-    if (!hasWaited_ && promise_ != nullptr) {
-        promise_->set_value(ret);
+    if (!hasWaited_ && isSync_) {
+        std::lock_guard<std::mutex> guard(resultMutex_);
+        ret_ = ret;
+        isDone_ = true;
+        resultCond_.notify_one();
     }
 }
 
+bool DelegateTasks::Task::WaitResult(std::chrono::milliseconds timeout, int32_t &ret)
+{
+    std::unique_lock<std::mutex> lock(resultMutex_);
+    if (!resultCond_.wait_for(lock, timeout, [this] { return isDone_; })) {
+        return false;
+    }
+    ret = ret_;
+    return true;
+}
+
 DelegateTasks::~DelegateTasks()
 {
-    if (fds_[0] >= 0) {
-        fdsan_close_with_tag(fds_[0], TAG);
-        fds_[0] = -1;
+    Task *task = pendingTasks_.exchange(nullptr, std::memory_order_acquire);
+    while (task != nullptr) {
+        Task *next = task->next_;
+        task->self_ = nullptr;
+        task = next;
     }
-    if (fds_[1] >= 0) {
-        fdsan_close_with_tag(fds_[1], TAG);
-        fds_[1] = -1;
+    if (wakeFd_ >= 0) {
+        fdsan_close_with_tag(wakeFd_, TAG);
+        wakeFd_ = -1;
     }
 }
 
 bool DelegateTasks::Init()
 {
     CALL_DEBUG_ENTER;
-    if (pipe(fds_) == -1) {
-        MMI_HILOGE("The pipe create failed, errno:%{public}d", errno);
-        return false;
-    }
-    if (fds_[0] >= 0) {
-        fdsan_exchange_owner_tag(fds_[0], 0, TAG);
-    }
-    if (fds_[1] >= 0) {
-        fdsan_exchange_owner_tag(fds_[1], 0, TAG);
-    }
-    if (fcntl(fds_[0], F_SETFL, O_NONBLOCK) == -1) {
-        MMI_HILOGE("The fcntl read failed, errno:%{public}d", errno);
-        fdsan_close_with_tag(fds_[0], TAG);
-        return false;
-    }
-    if (fcntl(fds_[1], F_SETFL, O_NONBLOCK) == -1) {
-        MMI_HILOGE("The fcntl write failed, errno:%{public}d", errno);
-        fdsan_close_with_tag(fds_[1], TAG);
+    wakeFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeFd_ == -1) {
+        MMI_HILOGE("The eventfd create failed, errno:%{public}d", errno);
         return false;
     }
+    fdsan_exchange_owner_tag(wakeFd_, 0, TAG);
     return true;
 }
 
 void DelegateTasks::ProcessTasks()
 {
-    std::vector<TaskPtr> tasks;
-    PopPendingTaskList(tasks);
-    size_t count = tasks.size();
-    if (count == 0) {
-        return;
+    // Reset the wakeup before taking the stack, a task posted after that signals again.
+    uint64_t value = 0;
+    if ((read(wakeFd_, &value, sizeof(value)) == -1) && (errno != EAGAIN)) {
+        MMI_HILOGW("Read failed erron:%{public}d", errno);
     }
-    for (const auto &it : tasks) {
-        std::string msg = "DelegateTasks::ProcessTasks, taskId is: ";
-        msg += std::to_string(static_cast<uint32_t>(it->GetId()));
-        BytraceAdapter::MMIServiceTraceStart(BytraceAdapter::MMI_THREAD_LOOP_DEPTH_THREE, msg);
+    PopPendingTaskList(processingTasks_);
+    for (const auto &it : processingTasks_) {
+        BytraceAdapter::MMIServiceTraceStartFormat(BytraceAdapter::MMI_THREAD_LOOP_DEPTH_THREE,
+            "DelegateTasks::ProcessTasks, taskId is: %u", static_cast<uint32_t>(it->GetId()));
         it->ProcessTask();
         BytraceAdapter::MMIServiceTraceStop();
     }
-    std::vector<DelegateTasks::TaskData> datas = {};
-    datas.resize(count);
-    auto res = read(fds_[0], datas.data(), sizeof(DelegateTasks::TaskData) * count);
-    if (res == -1) {
-        MMI_HILOGW("Read failed erron:%{public}d", errno);
-    }
+    processingTasks_.clear();
 }
 
 int32_t DelegateTasks::PostSyncTask(DTaskCallback callback)
@@ -116,30 +112,25 @@ int32_t DelegateTasks::PostSyncTask(DTaskCallback callback)
     if (IsCallFromWorkerThread()) {
         return callback();
     }
-    std::shared_ptr<Promise> promise = std::make_shared<Promise>();
-    Future future = promise->get_future();
-    auto task = PostTask(callback, promise);
+    auto task = PostTask(std::move(callback), true);
     CHKPR(task, ETASKS_POST_SYNCTASK_FAIL);
 
     static constexpr int32_t TIMEOUT = 5000;
-    std::chrono::milliseconds span(TIMEOUT);
-    auto res = future.wait_for(span);
+    int32_t ret = RET_OK;
+    bool isDone = task->WaitResult(std::chrono::milliseconds(TIMEOUT), ret);
     task->SetWaited();
-    if (res == std::future_status::timeout) {
+    if (!isDone) {
         int32_t workerThreadId = static_cast<int32_t>(workerThreadId_);
         std::string stackTrace;
         HiviewDFX::GetBacktraceStringByTid(stackTrace, workerThreadId, SKIP_FRAME_NUM, false);
         MMI_HILOGE("taskId:%{public}" PRId64 ", num of tasks:%{public}zu, stack of workerThread:%{public}s",
-                    id_, tasks_.size(), stackTrace.c_str());
+                    task->GetId(), pendingCount_.load(), stackTrace.c_str());
         if (task->TaskIsRunning()) {
             return ETASKS_WAIT_TIMEOUT_BUT_RUNNING;
         }
         return ETASKS_WAIT_TIMEOUT;
-    } else if (res == std::future_status::deferred) {
-        MMI_HILOGE("Task deferred");
-        return ETASKS_WAIT_DEFERRED;
     }
-    return future.get();
+    return ret;
 }
 
 int32_t DelegateTasks::PostAsyncTask(DTaskCallback callback)
@@ -148,55 +139,58 @@ int32_t DelegateTasks::PostAsyncTask(DTaskCallback callback)
     if (IsCallFromWorkerThread()) {
         return callback();
     }
-    CHKPR(PostTask(callback), ETASKS_POST_ASYNCTASK_FAIL);
+    CHKPR(PostTask(std::move(callback)), ETASKS_POST_ASYNCTASK_FAIL);
     return RET_OK;
 }
 
 void DelegateTasks::PopPendingTaskList(std::vector<TaskPtr> &tasks)
 {
-    static constexpr int32_t ONCE_PROCESS_TASK_LIMIT = 10;
-    if (mux_.try_lock_for(std::chrono::milliseconds(TIMED_WAIT_MS))) {
-        for (int32_t count = 0; count < ONCE_PROCESS_TASK_LIMIT; count++) {
-            if (tasks_.empty()) {
-                break;
-            }
-            auto task = tasks_.front();
-            CHKPB(task);
-            tasks.push_back(task->GetSharedPtr());
-            tasks_.pop();
-        }
-        mux_.unlock();
-    }
+    Task *task = pendingTasks_.exchange(nullptr, std::memory_order_acquire);
+    size_t first = tasks.size();
+    while (task != nullptr) {
+        Task *next = task->next_;
+        task->next_ = nullptr;
+        tasks.push_back(std::move(task->self_));
+        task = next;
+    }
+    // The stack hands tasks over newest first, run them in the order they were posted.
+    std::reverse(tasks.begin() + first, tasks.end());
+    pendingCount_.fetch_sub(tasks.size() - first, std::memory_order_relaxed);
 }
 
-DelegateTasks::TaskPtr DelegateTasks::PostTask(DTaskCallback callback, std::shared_ptr<Promise> promise)
+DelegateTasks::TaskPtr DelegateTasks::PostTask(DTaskCallback callback, bool isSync)
 {
     if (IsCallFromWorkerThread()) {
         MMI_HILOGE("This interface cannot be called from a worker thread");
         return nullptr;
     }
-    TaskPtr taskCopy = nullptr;
-    {
-        std::lock_guard<std::timed_mutex> guard(mux_);
-        auto tsize = tasks_.size();
-        MMI_HILOGD("tasks_ size:%{public}zu", tsize);
-        static constexpr int32_t MAX_TASKS_LIMIT = 1000;
-        if (tsize > MAX_TASKS_LIMIT) {
-            MMI_HILOGE("The task queue is full. size:%{public}zu, MAX_TASKS_LIMIT:%{public}d", tsize, MAX_TASKS_LIMIT);
-            return nullptr;
-        }
-        id_++;
-        TaskData data = { GetThisThreadId(), id_};
-        auto res = write(fds_[1], &data, sizeof(data));
-        if (res == -1) {
-            MMI_HILOGE("Pipe write failed, errno:%{public}d", errno);
-            return nullptr;
+    if (wakeFd_ < 0) {
+        MMI_HILOGE("The task queue is not initialized");
+        return nullptr;
+    }
+    size_t tsize = pendingCount_.fetch_add(1, std::memory_order_relaxed);
+    MMI_HILOGD("tasks_ size:%{public}zu", tsize);
+    if (tsize > MAX_TASKS_LIMIT) {
+        pendingCount_.fetch_sub(1, std::memory_order_relaxed);
+        MMI_HILOGE("The task queue is full. size:%{public}zu, MAX_TASKS_LIMIT:%{public}zu", tsize, MAX_TASKS_LIMIT);
+        return nullptr;
+    }
+    uint64_t id = id_.fetch_add(1, std::memory_order_relaxed) + 1;
+    TaskPtr task = std::make_shared<Task>(id, std::move(callback), isSync);
+    task->self_ = task;
+    Task *head = pendingTasks_.load(std::memory_order_relaxed);
+    do {
+        task->next_ = head;
+    } while (!pendingTasks_.compare_exchange_weak(head, task.get(), std::memory_order_release,
+        std::memory_order_relaxed));
+    // Only the task that finds the stack empty wakes the worker thread, the others ride along.
+    if (head == nullptr) {
+        uint64_t value = 1;
+        if (write(wakeFd_, &value, sizeof(value)) == -1) {
+            MMI_HILOGE("Eventfd write failed, errno:%{public}d", errno);
         }
-        TaskPtr task = std::make_shared<Task>(id_, callback, promise);
-        tasks_.push(task);
-        taskCopy = task->GetSharedPtr();
     }
-    return taskCopy;
+    return task;
 }
 } // namespace MMI
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
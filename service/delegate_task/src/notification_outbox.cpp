@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "notification_outbox.h"
+
+#include <cerrno>
+#include <cinttypes>
+#include <sys/resource.h>
+
+#include "mmi_log.h"
+#include "util.h"
+#include "util_ex.h"
+
+#undef MMI_LOG_DOMAIN
+#define MMI_LOG_DOMAIN MMI_LOG_SERVER
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "NotificationOutbox"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr int32_t WORKER_NICE { 10 };
+
+void AddLatency(std::atomic<uint64_t> &total, std::atomic<uint64_t> &max, int64_t latencyUs)
+{
+    uint64_t latency = (latencyUs > 0) ? static_cast<uint64_t>(latencyUs) : 0;
+    total.fetch_add(latency, std::memory_order_relaxed);
+    uint64_t maxUs = max.load(std::memory_order_relaxed);
+    while ((latency > maxUs) && !max.compare_exchange_weak(maxUs, latency, std::memory_order_relaxed)) {}
+}
+
+uint64_t Average(uint64_t total, uint64_t count)
+{
+    return (count == 0) ? 0 : (total / count);
+}
+} // namespace
+
+NotificationOutbox& NotificationOutbox::GetInstance()
+{
+    static NotificationOutbox outbox;
+    return outbox;
+}
+
+NotificationOutbox::~NotificationOutbox()
+{
+    Stop();
+}
+
+void NotificationOutbox::SetSink(Channel channel, Sink sink, bool coalesce)
+{
+    if ((channel < 0) || (channel >= CHANNEL_COUNT)) {
+        MMI_HILOGE("Invalid channel:%{public}d", channel);
+        return;
+    }
+    std::lock_guard<std::mutex> guard(sinkMutex_);
+    sinks_[channel] = std::move(sink);
+    coalesce_[channel].store(coalesce, std::memory_order_relaxed);
+}
+
+bool NotificationOutbox::Post(Channel channel, int32_t arg0, int32_t arg1, int32_t arg2)
+{
+    if ((channel < 0) || (channel >= CHANNEL_COUNT)) {
+        MMI_HILOGE("Invalid channel:%{public}d", channel);
+        return false;
+    }
+    Notification notification { channel, { arg0, arg1, arg2 }, GetSysClockTime() };
+    ChannelCounter &counter = counters_[channel];
+    counter.posted.fetch_add(1, std::memory_order_relaxed);
+    if (!running_.load(std::memory_order_acquire)) {
+        Deliver(notification);
+        return true;
+    }
+    bool coalesce = coalesce_[channel].load(std::memory_order_relaxed);
+    // Marked before the push, so that the worker never delivers it ahead of the mark.
+    if (coalesce && !MarkPending(notification)) {
+        counter.coalesced.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    if (!queue_.TryPush(notification)) {
+        if (coalesce) {
+            ClearPending(notification);
+        }
+        counter.dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (idle_.load(std::memory_order_relaxed) && idle_.exchange(false)) {
+        std::lock_guard<std::mutex> guard(wakeMutex_);
+        wakeCondition_.notify_one();
+    }
+    return true;
+}
+
+bool NotificationOutbox::Start()
+{
+    if (running_.exchange(true)) {
+        return true;
+    }
+    worker_ = std::thread([this] { WorkerLoop(); });
+    return true;
+}
+
+void NotificationOutbox::Stop()
+{
+    if (!running_.exchange(false)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(wakeMutex_);
+        idle_.store(false);
+        wakeCondition_.notify_one();
+    }
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    Drain();
+}
+
+bool NotificationOutbox::IsRunning() const
+{
+    return running_.load(std::memory_order_acquire);
+}
+
+void NotificationOutbox::WorkerLoop()
+{
+    SetThreadName(std::string("mmi_outbox"));
+    if (setpriority(PRIO_PROCESS, static_cast<id_t>(GetThisThreadId()), WORKER_NICE) != 0) {
+        MMI_HILOGW("Lower the priority of the outbox failed, errno:%{public}d", errno);
+    }
+    MMI_HILOGI("Notification outbox start");
+    while (running_.load(std::memory_order_acquire)) {
+        if (Drain()) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        idle_.store(true);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!queue_.Empty() || !running_.load(std::memory_order_acquire)) {
+            idle_.store(false);
+            continue;
+        }
+        // Posters clear the idle mark under the lock before notifying, so the wakeup cannot be lost.
+        wakeCondition_.wait(lock, [this] {
+            return !idle_.load() || !running_.load(std::memory_order_acquire);
+        });
+        idle_.store(false);
+    }
+    MMI_HILOGI("Notification outbox stop");
+}
+
+bool NotificationOutbox::Drain()
+{
+    bool hasDelivered = false;
+    Notification notification;
+    while (queue_.TryPop(notification)) {
+        Deliver(notification);
+        hasDelivered = true;
+    }
+    return hasDelivered;
+}
+
+void NotificationOutbox::Deliver(const Notification &notification)
+{
+    int32_t channel = notification.channel;
+    ChannelCounter &counter = counters_[channel];
+    int64_t beginTime = GetSysClockTime();
+    AddLatency(counter.queueTotalUs, counter.queueMaxUs, beginTime - notification.postTime);
+    {
+        std::lock_guard<std::mutex> guard(sinkMutex_);
+        if (sinks_[channel]) {
+            sinks_[channel](notification);
+        }
+    }
+    AddLatency(counter.sinkTotalUs, counter.sinkMaxUs, GetSysClockTime() - beginTime);
+    counter.delivered.fetch_add(1, std::memory_order_relaxed);
+    // Equal notifications posted while the sink ran are covered by this one.
+    if (coalesce_[channel].load(std::memory_order_relaxed)) {
+        ClearPending(notification);
+    }
+}
+
+// Returns false if an equal notification of the channel is still in the queue.
+bool NotificationOutbox::MarkPending(const Notification &notification)
+{
+    std::lock_guard<std::mutex> guard(pendingMutex_);
+    int32_t channel = notification.channel;
+    if (isPending_[channel] && (pendingArgs_[channel] == notification.args)) {
+        return false;
+    }
+    isPending_[channel] = true;
+    pendingArgs_[channel] = notification.args;
+    return true;
+}
+
+void NotificationOutbox::ClearPending(const Notification &notification)
+{
+    std::lock_guard<std::mutex> guard(pendingMutex_);
+    int32_t channel = notification.channel;
+    if (isPending_[channel] && (pendingArgs_[channel] == notification.args)) {
+        isPending_[channel] = false;
+    }
+}
+
+void NotificationOutbox::Reset()
+{
+    for (auto &counter : counters_) {
+        counter.posted.store(0, std::memory_order_relaxed);
+        counter.coalesced.store(0, std::memory_order_relaxed);
+        counter.dropped.store(0, std::memory_order_relaxed);
+        counter.delivered.store(0, std::memory_order_relaxed);
+        counter.queueTotalUs.store(0, std::memory_order_relaxed);
+        counter.queueMaxUs.store(0, std::memory_order_relaxed);
+        counter.sinkTotalUs.store(0, std::memory_order_relaxed);
+        counter.sinkMaxUs.store(0, std::memory_order_relaxed);
+    }
+}
+
+void NotificationOutbox::Dump(int32_t fd)
+{
+    mprintf(fd, "Notification outbox: %s, queue depth:%zu capacity:%zu\n", IsRunning() ? "async" : "inline",
+        queue_.Size(), queue_.Capacity());
+    for (int32_t channel = 0; channel < CHANNEL_COUNT; ++channel) {
+        const ChannelCounter &counter = counters_[channel];
+        uint64_t delivered = counter.delivered.load(std::memory_order_relaxed);
+        mprintf(fd, "\tchannel:%s posted:%" PRIu64 " coalesced:%" PRIu64 " dropped:%" PRIu64 " delivered:%" PRIu64
+            " queue avg:%" PRIu64 "us max:%" PRIu64 "us sink avg:%" PRIu64 "us max:%" PRIu64 "us\n",
+            GetChannelName(channel), counter.posted.load(std::memory_order_relaxed),
+            counter.coalesced.load(std::memory_order_relaxed), counter.dropped.load(std::memory_order_relaxed),
+            delivered, Average(counter.queueTotalUs.load(std::memory_order_relaxed), delivered),
+            counter.queueMaxUs.load(std::memory_order_relaxed),
+            Average(counter.sinkTotalUs.load(std::memory_order_relaxed), delivered),
+            counter.sinkMaxUs.load(std::memory_order_relaxed));
+    }
+}
+
+const char* NotificationOutbox::GetChannelName(int32_t channel)
+{
+    switch (channel) {
+        case CHANNEL_RES_SCHED_TOUCH: {
+            return "res_sched_touch";
+        }
+        case CHANNEL_RS_TOUCH: {
+            return "rs_touch";
+        }
+        default: {
+            return "unknown";
+        }
+    }
+}
+} // namespace MMI
+} // namespace OHOS
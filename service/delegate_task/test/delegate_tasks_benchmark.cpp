@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <fcntl.h>
+#include <future>
+#include <mutex>
+#include <poll.h>
+#include <queue>
+#include <thread>
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+
+#include "delegate_tasks.h"
+#include "error_multimodal.h"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr int32_t BINDER_THREADS { 8 };
+constexpr int32_t POLL_TIMEOUT_MS { 100 };
+constexpr int32_t SYNC_TIMEOUT_MS { 5000 };
+constexpr int32_t TIMED_WAIT_MS { 2 };
+constexpr int32_t ONCE_PROCESS_TASK_LIMIT { 10 };
+constexpr size_t MAX_TASKS_LIMIT { 1000 };
+
+// The queue used before the lock-free stack: a locked deque, one pipe write per task, ten tasks per wakeup.
+class PipeTasks {
+public:
+    struct TaskData {
+        uint64_t tid { 0 };
+        uint64_t taskId { 0 };
+    };
+    struct Task {
+        DTaskCallback fun;
+        std::shared_ptr<std::promise<int32_t>> promise;
+    };
+
+    ~PipeTasks()
+    {
+        for (int32_t fd : fds_) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    bool Init()
+    {
+        if (pipe(fds_) == -1) {
+            return false;
+        }
+        return (fcntl(fds_[0], F_SETFL, O_NONBLOCK) != -1) && (fcntl(fds_[1], F_SETFL, O_NONBLOCK) != -1);
+    }
+
+    void ProcessTasks()
+    {
+        std::vector<std::shared_ptr<Task>> tasks;
+        if (mux_.try_lock_for(std::chrono::milliseconds(TIMED_WAIT_MS))) {
+            for (int32_t count = 0; (count < ONCE_PROCESS_TASK_LIMIT) && !tasks_.empty(); ++count) {
+                tasks.push_back(tasks_.front());
+                tasks_.pop();
+            }
+            mux_.unlock();
+        }
+        for (const auto &task : tasks) {
+            int32_t ret = task->fun();
+            if (task->promise != nullptr) {
+                task->promise->set_value(ret);
+            }
+        }
+        std::vector<TaskData> datas(tasks.size());
+        if (!datas.empty()) {
+            benchmark::DoNotOptimize(read(fds_[0], datas.data(), sizeof(TaskData) * datas.size()));
+        }
+    }
+
+    int32_t PostSyncTask(DTaskCallback callback)
+    {
+        auto promise = std::make_shared<std::promise<int32_t>>();
+        std::future<int32_t> future = promise->get_future();
+        if (!PostTask(std::move(callback), promise)) {
+            return ETASKS_POST_SYNCTASK_FAIL;
+        }
+        if (future.wait_for(std::chrono::milliseconds(SYNC_TIMEOUT_MS)) != std::future_status::ready) {
+            return ETASKS_WAIT_TIMEOUT;
+        }
+        return future.get();
+    }
+
+    int32_t PostAsyncTask(DTaskCallback callback)
+    {
+        return PostTask(std::move(callback), nullptr) ? RET_OK : ETASKS_POST_ASYNCTASK_FAIL;
+    }
+
+    int32_t GetReadFd() const
+    {
+        return fds_[0];
+    }
+
+    void SetWorkerThreadId(uint64_t tid) {}
+
+private:
+    bool PostTask(DTaskCallback callback, std::shared_ptr<std::promise<int32_t>> promise)
+    {
+        std::lock_guard<std::timed_mutex> guard(mux_);
+        if (tasks_.size() > MAX_TASKS_LIMIT) {
+            return false;
+        }
+        TaskData data = { GetThisThreadId(), ++id_ };
+        if (write(fds_[1], &data, sizeof(data)) == -1) {
+            return false;
+        }
+        tasks_.push(std::make_shared<Task>(Task { std::move(callback), promise }));
+        return true;
+    }
+
+    int32_t fds_[2] = { -1, -1 };
+    std::timed_mutex mux_;
+    std::queue<std::shared_ptr<Task>> tasks_;
+    uint64_t id_ { 0 };
+};
+
+// Stands in for the service thread: waits on the wakeup fd and runs the posted tasks.
+template<typename Tasks>
+class TaskWorker {
+public:
+    TaskWorker()
+    {
+        if (!tasks_.Init()) {
+            return;
+        }
+        std::promise<void> ready;
+        std::future<void> isReady = ready.get_future();
+        worker_ = std::thread([this, &ready] {
+            tasks_.SetWorkerThreadId(GetThisThreadId());
+            ready.set_value();
+            while (isRunning_) {
+                struct pollfd pfd = { tasks_.GetReadFd(), POLLIN, 0 };
+                if (poll(&pfd, 1, POLL_TIMEOUT_MS) > 0) {
+                    tasks_.ProcessTasks();
+                }
+            }
+        });
+        isReady.wait();
+    }
+
+    ~TaskWorker()
+    {
+        isRunning_ = false;
+        if (worker_.joinable()) {
+            worker_.join();
+        }
+    }
+
+    Tasks &GetTasks()
+    {
+        return tasks_;
+    }
+
+private:
+    Tasks tasks_;
+    std::atomic_bool isRunning_ { true };
+    std::thread worker_;
+};
+
+template<typename Tasks>
+Tasks &GetTasks()
+{
+    static TaskWorker<Tasks> worker;
+    return worker.GetTasks();
+}
+
+// Each benchmark thread plays a binder thread posting a task that only bumps a counter.
+template<typename Tasks>
+void BM_PostAsyncTask(benchmark::State &state)
+{
+    Tasks &tasks = GetTasks<Tasks>();
+    std::atomic<int64_t> processed { 0 };
+    int64_t rejected = 0;
+    for (auto _ : state) {
+        if (tasks.PostAsyncTask([&processed] {
+            processed.fetch_add(1, std::memory_order_relaxed);
+            return RET_OK;
+        }) != RET_OK) {
+            ++rejected;
+            std::this_thread::yield();
+        }
+    }
+    // The tasks capture this frame, let the worker finish them before leaving it.
+    int64_t posted = static_cast<int64_t>(state.iterations()) - rejected;
+    while (processed.load(std::memory_order_relaxed) < posted) {
+        std::this_thread::yield();
+    }
+    state.SetItemsProcessed(posted);
+    state.counters["Rejected"] = benchmark::Counter(static_cast<double>(rejected), benchmark::Counter::kAvgThreads);
+}
+BENCHMARK_TEMPLATE(BM_PostAsyncTask, PipeTasks)->Threads(BINDER_THREADS)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PostAsyncTask, DelegateTasks)->Threads(BINDER_THREADS)->UseRealTime();
+
+template<typename Tasks>
+void BM_PostSyncTask(benchmark::State &state)
+{
+    Tasks &tasks = GetTasks<Tasks>();
+    int64_t failed = 0;
+    for (auto _ : state) {
+        if (tasks.PostSyncTask([] { return RET_OK; }) != RET_OK) {
+            ++failed;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) - failed);
+    state.counters["Failed"] = benchmark::Counter(static_cast<double>(failed), benchmark::Counter::kAvgThreads);
+}
+BENCHMARK_TEMPLATE(BM_PostSyncTask, PipeTasks)->Threads(BINDER_THREADS)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PostSyncTask, DelegateTasks)->Threads(BINDER_THREADS)->UseRealTime();
+} // namespace
+} // namespace MMI
+} // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -15,6 +15,9 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <unistd.h>
+
 #include "delegate_tasks.h"
 #include "error_multimodal.h"
 #include "key_event_napi.h"
@@ -160,9 +163,9 @@ HWTEST_F(DelegateTasksTest, DelegateTasksTest_PostTask_001, TestSize.Level1)
     CALL_TEST_DEBUG;
     DelegateTasks delegateTasks;
     for (int32_t i = 0; i < 1001; i++) {
-        delegateTasks.PostTask(nullptr, nullptr);
+        delegateTasks.PostTask(nullptr);
     }
-    auto task = delegateTasks.PostTask(nullptr, nullptr);
+    auto task = delegateTasks.PostTask(nullptr);
     EXPECT_EQ(task, nullptr);
 }
 
@@ -176,8 +179,7 @@ HWTEST_F(DelegateTasksTest, DelegateTasksTest_PostTask_002, TestSize.Level1)
 {
     CALL_TEST_DEBUG;
     DelegateTasks delegateTasks;
-    std::shared_ptr<DelegateTasks::Promise> promise;
-    auto task = delegateTasks.PostTask(nullptr, promise);
+    auto task = delegateTasks.PostTask(nullptr, true);
     EXPECT_EQ(task, nullptr);
 }
 
@@ -292,8 +294,7 @@ HWTEST_F(DelegateTasksTest, DelegateTasksTest_ProcessTask_002, TestSize.Level1)
     CALL_TEST_DEBUG;
     auto callback = []() { return 42; };
     int32_t id = 3;
-    auto pro = std::make_shared<std::promise<int32_t>>();
-    DelegateTasks::Task task(id, callback, pro);
+    DelegateTasks::Task task(id, callback, true);
     task.hasWaited_ = false;
     ASSERT_NO_FATAL_FAILURE(task.ProcessTask());
 }
@@ -377,7 +378,7 @@ HWTEST_F(DelegateTasksTest, DelegateTasksTest_PostAsyncTask_004, TestSize.Level1
 
 /**
  * @tc.name: DelegateTasksTest_PostTask_003
- * @tc.desc: Test PostTask with valid callback and promise
+ * @tc.desc: Test PostTask with valid callback as a sync task
  * @tc.type: FUNC
  * @tc.require:
  */
@@ -386,9 +387,8 @@ HWTEST_F(DelegateTasksTest, DelegateTasksTest_PostTask_003, TestSize.Level1)
     CALL_TEST_DEBUG;
     DelegateTasks delegateTasks;
     EXPECT_TRUE(delegateTasks.Init());
-    std::shared_ptr<DelegateTasks::Promise> promise = std::make_shared<DelegateTasks::Promise>();
     auto callback = []() { return 99; };
-    auto task = delegateTasks.PostTask(callback, promise);
+    auto task = delegateTasks.PostTask(callback, true);
     EXPECT_NE(task, nullptr);
 }
 
@@ -406,7 +406,7 @@ HWTEST_F(DelegateTasksTest, DelegateTasksTest_PostTask_005, TestSize.Level1)
     // Post 999 tasks
     for (int32_t i = 0; i < 999; i++) {
         auto callback = []() { return 0; };
-        auto task = delegateTasks.PostTask(callback, nullptr);
+        auto task = delegateTasks.PostTask(callback);
         EXPECT_NE(task, nullptr);
     }
 }
@@ -513,5 +513,60 @@ HWTEST_F(DelegateTasksTest, DelegateTasksTest_PostAsyncTask_005, TestSize.Level1
     // Result depends on internal state
     EXPECT_TRUE(result == RET_OK || result == ETASKS_POST_ASYNCTASK_FAIL);
 }
+
+/**
+ * @tc.name: DelegateTasksTest_ProcessTasks_001
+ * @tc.desc: Test that queued tasks run in posting order behind a single wakeup
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DelegateTasksTest, DelegateTasksTest_ProcessTasks_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    DelegateTasks delegateTasks;
+    EXPECT_TRUE(delegateTasks.Init());
+    std::vector<int32_t> order;
+    for (int32_t i = 0; i < 20; i++) {
+        EXPECT_EQ(delegateTasks.PostAsyncTask([&order, i]() { order.push_back(i); return 0; }), RET_OK);
+    }
+    uint64_t value = 0;
+    EXPECT_EQ(read(delegateTasks.GetReadFd(), &value, sizeof(value)), sizeof(value));
+    EXPECT_EQ(value, 1);
+    delegateTasks.ProcessTasks();
+    ASSERT_EQ(order.size(), 20);
+    for (int32_t i = 0; i < 20; i++) {
+        EXPECT_EQ(order[i], i);
+    }
+    EXPECT_EQ(delegateTasks.pendingCount_.load(), 0);
+}
+
+/**
+ * @tc.name: DelegateTasksTest_PostSyncTask_006
+ * @tc.desc: Test that PostSyncTask returns the result computed on the worker thread
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DelegateTasksTest, DelegateTasksTest_PostSyncTask_006, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    DelegateTasks delegateTasks;
+    EXPECT_TRUE(delegateTasks.Init());
+    std::atomic_bool isReady { false };
+    std::atomic_bool isRunning { true };
+    std::thread worker([&delegateTasks, &isReady, &isRunning]() {
+        delegateTasks.SetWorkerThreadId(GetThisThreadId());
+        isReady = true;
+        while (isRunning) {
+            delegateTasks.ProcessTasks();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    while (!isReady) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(delegateTasks.PostSyncTask([]() { return 42; }), 42);
+    isRunning = false;
+    worker.join();
+}
 } // namespace MMI
 } // namespace OHOS
\ No newline at end of file
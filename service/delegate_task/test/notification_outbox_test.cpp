@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "mmi_log.h"
+#include "notification_outbox.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "NotificationOutboxTest"
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+constexpr std::chrono::seconds WAIT_TIMEOUT { 5 };
+} // namespace
+
+class NotificationOutboxTest : public testing::Test {
+public:
+    void TearDown() override
+    {
+        NOTIFY_OUTBOX.Stop();
+        NOTIFY_OUTBOX.SetSink(NotificationOutbox::CHANNEL_RS_TOUCH, nullptr, false);
+        NOTIFY_OUTBOX.Reset();
+    }
+};
+
+/**
+ * @tc.name: NotificationOutboxTest_Post_001
+ * @tc.desc: Verify a notification is delivered on the posting thread while the worker is not running
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(NotificationOutboxTest, NotificationOutboxTest_Post_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    std::thread::id sinkThread;
+    int32_t action = 0;
+    NOTIFY_OUTBOX.SetSink(NotificationOutbox::CHANNEL_RS_TOUCH,
+        [&sinkThread, &action](const NotificationOutbox::Notification &notification) {
+            sinkThread = std::this_thread::get_id();
+            action = notification.args[0];
+        }, true);
+    EXPECT_TRUE(NOTIFY_OUTBOX.Post(NotificationOutbox::CHANNEL_RS_TOUCH, 2, 1, 0));
+    EXPECT_EQ(sinkThread, std::this_thread::get_id());
+    EXPECT_EQ(action, 2);
+}
+
+/**
+ * @tc.name: NotificationOutboxTest_Post_002
+ * @tc.desc: Verify the worker runs the sink off the posting thread and equal pending notifications coalesce
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(NotificationOutboxTest, NotificationOutboxTest_Post_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<std::thread::id> firstCall;
+    std::atomic<int32_t> calls { 0 };
+    NOTIFY_OUTBOX.SetSink(NotificationOutbox::CHANNEL_RS_TOUCH,
+        [&](const NotificationOutbox::Notification &notification) {
+            if (calls.fetch_add(1) == 0) {
+                firstCall.set_value(std::this_thread::get_id());
+                released.wait_for(WAIT_TIMEOUT);
+            }
+        }, true);
+    ASSERT_TRUE(NOTIFY_OUTBOX.Start());
+    EXPECT_TRUE(NOTIFY_OUTBOX.Post(NotificationOutbox::CHANNEL_RS_TOUCH, 1, 1, 0));
+    auto sinkThread = firstCall.get_future();
+    ASSERT_EQ(sinkThread.wait_for(WAIT_TIMEOUT), std::future_status::ready);
+    EXPECT_NE(sinkThread.get(), std::this_thread::get_id());
+    // The worker is held in the sink, the two equal moves behind it make one notification.
+    EXPECT_TRUE(NOTIFY_OUTBOX.Post(NotificationOutbox::CHANNEL_RS_TOUCH, 3, 1, 0));
+    EXPECT_TRUE(NOTIFY_OUTBOX.Post(NotificationOutbox::CHANNEL_RS_TOUCH, 3, 1, 0));
+    release.set_value();
+    NOTIFY_OUTBOX.Stop();
+    EXPECT_EQ(calls.load(), 2);
+}
+/**
+ * @tc.name: NotificationOutboxTest_Post_003
+ * @tc.desc: Verify pending notifications of a channel only coalesce when their arguments are equal
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(NotificationOutboxTest, NotificationOutboxTest_Post_003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<void> firstCall;
+    std::vector<int32_t> actions;
+    NOTIFY_OUTBOX.SetSink(NotificationOutbox::CHANNEL_RS_TOUCH,
+        [&](const NotificationOutbox::Notification &notification) {
+            actions.push_back(notification.args[0]);
+            if (actions.size() == 1) {
+                firstCall.set_value();
+                released.wait_for(WAIT_TIMEOUT);
+            }
+        }, true);
+    ASSERT_TRUE(NOTIFY_OUTBOX.Start());
+    EXPECT_TRUE(NOTIFY_OUTBOX.Post(NotificationOutbox::CHANNEL_RS_TOUCH, 1, 1, 0));
+    ASSERT_EQ(firstCall.get_future().wait_for(WAIT_TIMEOUT), std::future_status::ready);
+    EXPECT_TRUE(NOTIFY_OUTBOX.Post(NotificationOutbox::CHANNEL_RS_TOUCH, 3, 1, 0));
+    EXPECT_TRUE(NOTIFY_OUTBOX.Post(NotificationOutbox::CHANNEL_RS_TOUCH, 3, 2, 0));
+    EXPECT_TRUE(NOTIFY_OUTBOX.Post(NotificationOutbox::CHANNEL_RS_TOUCH, 3, 2, 0));
+    release.set_value();
+    NOTIFY_OUTBOX.Stop();
+    EXPECT_EQ(actions, std::vector<int32_t>({ 1, 3, 3 }));
+}
+} // namespace MMI
+} // namespace OHOS
@@ -18,6 +18,7 @@
 
 #include "i_input_event_handler.h"
 #include "key_event_value_transformation.h"
+#include "pointer_event_packet.h"
 #include "uds_server.h"
 #include "window_info.h"
 
@@ -46,7 +47,7 @@ class EventDispatchHandler final : public IInputEventHandler {
         POINTER_ACTION_PROXIMITY_OUT = 36,
     };
 public:
-    EventDispatchHandler() = default;
+    EventDispatchHandler();
     DISALLOW_COPY_AND_MOVE(EventDispatchHandler);
     ~EventDispatchHandler() override = default;
 #ifdef OHOS_BUILD_ENABLE_KEYBOARD
@@ -71,7 +72,11 @@ public:
     std::chrono::high_resolution_clock::now();
     void SendWindowStateError(int32_t userId, int32_t pid, int32_t windowId);
 private:
-    void DispatchPointerEventInner(std::shared_ptr<PointerEvent> point, int32_t fd);
+    void DispatchPointerEventInner(std::shared_ptr<PointerEvent> point, int32_t fd,
+        std::shared_ptr<PointerEventPacket> packet = nullptr);
+    bool EncodePointerEvent(std::shared_ptr<PointerEvent> point, PointerEventPacket &packet);
+    bool NeedPrivatePointerEvent(std::shared_ptr<PointerEvent> point, int32_t fd);
+    bool GetCoalesceKey(std::shared_ptr<PointerEvent> point, UDSSession::CoalesceKey &key);
     void HandleMultiWindowPointerEvent(std::shared_ptr<PointerEvent> point,
         PointerEvent::PointerItem pointerItem);
     bool ReissueEvent(std::shared_ptr<PointerEvent> &point, int32_t windowId, std::optional<WindowInfo> &windowInfo);
@@ -107,6 +112,7 @@ private:
     std::map<int32_t, std::vector<std::shared_ptr<WindowInfo>>> cancelEventList_;
 #if defined(OHOS_BUILD_ENABLE_POINTER) || defined(OHOS_BUILD_ENABLE_TOUCH)
     void FilterInvalidPointerItem(const std::shared_ptr<PointerEvent> pointEvent, int32_t fd);
+    bool HasInvalidPointerItem(const std::shared_ptr<PointerEvent> pointEvent, int32_t fd);
 #endif // OHOS_BUILD_ENABLE_POINTER || OHOS_BUILD_ENABLE_TOUCH
     bool AcquireEnableMark(std::shared_ptr<PointerEvent> event);
 #ifndef OHOS_BUILD_ENABLE_WATCH
@@ -22,6 +22,8 @@
 #include "event_log_helper.h"
 #include "input_event_data_transformation.h"
 #include "input_event_handler.h"
+#include "input_latency_statistic.h"
+#include "notification_outbox.h"
 #ifdef OHOS_BUILD_ENABLE_INPUT_EVENT_HOOK
 #include "input_event_hook_manager.h"
 #endif // OHOS_BUILD_ENABLE_INPUT_EVENT_HOOK
@@ -29,6 +31,7 @@
 #include "key_event_hook_manager.h"
 #endif // OHOS_BUILD_ENABLE_KEY_HOOK
 #include "pointer_device_manager.h"
+#include "pointer_event_packet.h"
 #ifndef OHOS_BUILD_ENABLE_WATCH
 #include "transaction/rs_render_service_client.h"
 #endif // OHOS_BUILD_ENABLE_WATCH
@@ -54,8 +57,73 @@ constexpr int32_t THREE_FINGERS { 3 };
 #ifndef OHOS_BUILD_ENABLE_WATCH
 static constexpr auto sendConsecutiveEventInterval = std::chrono::milliseconds(1000);
 #endif // OHOS_BUILD_ENABLE_WATCH
+
+#if defined(OHOS_BUILD_ENABLE_POINTER) || defined(OHOS_BUILD_ENABLE_TOUCH)
+// Restores the fields that multi-window dispatching changes on the event for each window.
+class PointerEventRestorer final {
+public:
+    explicit PointerEventRestorer(std::shared_ptr<PointerEvent> point)
+        : point_(point), pointerAction_(point->GetPointerAction()), targetWindowId_(point->GetTargetWindowId()),
+          agentWindowId_(point->GetAgentWindowId()), dispatchTimes_(point->GetDispatchTimes())
+    {
+        hasItem_ = point_->GetPointerItem(point_->GetPointerId(), item_);
+    }
+
+    ~PointerEventRestorer()
+    {
+        RestorePointerAction();
+        point_->SetTargetWindowId(targetWindowId_);
+        point_->SetAgentWindowId(agentWindowId_);
+        point_->SetDispatchTimes(dispatchTimes_);
+        if (hasItem_) {
+            point_->UpdatePointerItem(point_->GetPointerId(), item_);
+        }
+    }
+    DISALLOW_COPY_AND_MOVE(PointerEventRestorer);
+
+    void RestorePointerAction()
+    {
+        point_->SetPointerAction(pointerAction_);
+    }
+
+private:
+    std::shared_ptr<PointerEvent> point_;
+    int32_t pointerAction_ { PointerEvent::POINTER_ACTION_UNKNOWN };
+    int32_t targetWindowId_ { -1 };
+    int32_t agentWindowId_ { -1 };
+    int32_t dispatchTimes_ { 0 };
+    bool hasItem_ { false };
+    PointerEvent::PointerItem item_;
+};
+#endif // OHOS_BUILD_ENABLE_POINTER || OHOS_BUILD_ENABLE_TOUCH
+
+#ifndef OHOS_BUILD_ENABLE_WATCH
+void NotifyTouchEventToRS(const NotificationOutbox::Notification &notification)
+{
+    auto begin = std::chrono::high_resolution_clock::now();
+    auto rsClient = Rosen::RSRenderServiceClient::CreateRenderServiceClient();
+    if (rsClient == nullptr) {
+        MMI_HILOGE("NotifyTouchEvent create rs client failed");
+        return;
+    }
+    rsClient->NotifyTouchEvent(notification.args[0], notification.args[1], notification.args[2]);
+    [[maybe_unused]] auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::high_resolution_clock::now() - begin).count();
+#ifdef OHOS_BUILD_ENABLE_DFX_RADAR
+    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::RS_NOTIFY_TOUCH_EVENT, durationMS);
+#endif // OHOS_BUILD_ENABLE_DFX_RADAR
+}
+#endif // OHOS_BUILD_ENABLE_WATCH
 } // namespace
 
+EventDispatchHandler::EventDispatchHandler()
+{
+#ifndef OHOS_BUILD_ENABLE_WATCH
+    // Repeats of a touch state the render service has not been told about yet add nothing.
+    NOTIFY_OUTBOX.SetSink(NotificationOutbox::CHANNEL_RS_TOUCH, NotifyTouchEventToRS, true);
+#endif // OHOS_BUILD_ENABLE_WATCH
+}
+
 #ifdef OHOS_BUILD_ENABLE_KEYBOARD
 void EventDispatchHandler::HandleKeyEvent(const std::shared_ptr<KeyEvent> keyEvent)
 {
@@ -121,6 +189,26 @@ void EventDispatchHandler::FilterInvalidPointerItem(const std::shared_ptr<Pointe
     }
 }
 
+bool EventDispatchHandler::HasInvalidPointerItem(const std::shared_ptr<PointerEvent> pointerEvent, int32_t fd)
+{
+    CHKPF(pointerEvent);
+    const auto &pointerItems = pointerEvent->GetPointerItems();
+    if (pointerItems.size() <= 1) {
+        return false;
+    }
+    auto udsServer = InputHandler->GetUDSServer();
+    CHKPF(udsServer);
+    int32_t clientPid = udsServer->GetClientPid(fd);
+    int32_t targetDisplayId = pointerEvent->GetTargetDisplayId();
+    for (const auto &pointeritem : pointerItems) {
+        auto itemPid = WIN_MGR->GetAgentPidByDisplayIdAndWindowId(targetDisplayId, pointeritem.GetTargetWindowId());
+        if ((itemPid >= 0) && (itemPid != clientPid)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 std::shared_ptr<WindowInfo> EventDispatchHandler::SearchCancelList (int32_t pointerId, int32_t windowId)
 {
     auto& cancelList = WIN_MGR->GetCancelEventList(cancelEventList_);
@@ -225,31 +313,34 @@ void EventDispatchHandler::HandleMultiWindowPointerEvent(std::shared_ptr<Pointer
         }
     }
     WIN_MGR->FoldScreenRotation(point);
+    // The windows receive the same event apart from a few fields, so it is encoded once and patched per window.
+    auto packet = std::make_shared<PointerEventPacket>(MmiMessageId::ON_POINTER_EVENT);
+    PointerEventRestorer restorer(point);
     for (auto windowId : windowIds) {
-        auto pointerEvent = std::make_shared<PointerEvent>(*point);
+        restorer.RestorePointerAction();
         auto windowInfo = WIN_MGR->GetWindowAndDisplayInfo(windowId, point->GetTargetDisplayId());
-        if (!ReissueEvent(pointerEvent, windowId, windowInfo)) {
+        if (!ReissueEvent(point, windowId, windowInfo)) {
             continue;
         }
         if (!windowInfo) {
             continue;
         }
-        if (pointerEvent->GetPointerAction() == PointerEvent::POINTER_ACTION_PULL_UP &&
+        if (point->GetPointerAction() == PointerEvent::POINTER_ACTION_PULL_UP &&
             (windowInfo->flags & WindowInputPolicy::FLAG_EVENT_TRANSMIT_ALL) ==
             WindowInputPolicy::FLAG_EVENT_TRANSMIT_ALL && windowIds.size() > 1) {
             MMI_HILOGD("When the drag is finished, the multi-window distribution is canceled. window:%{public}d,"
                 "windowInputType:%{public}d", windowId, static_cast<int32_t>(windowInfo->windowInputType));
-            pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_CANCEL);
+            point->SetPointerAction(PointerEvent::POINTER_ACTION_CANCEL);
         }
-        auto fd = WIN_MGR->GetClientFd(pointerEvent, windowInfo->id);
+        auto fd = WIN_MGR->GetClientFd(point, windowInfo->id);
         if (fd < 0) {
             auto udsServer = InputHandler->GetUDSServer();
             CHKPV(udsServer);
             fd = udsServer->GetClientFd(windowInfo->agentPid);
             MMI_HILOGI("Window:%{public}d exit front desk, windowfd:%{public}d", windowId, fd);
         }
-        pointerEvent->SetTargetWindowId(windowId);
-        pointerEvent->SetAgentWindowId(windowInfo->agentWindowId);
+        point->SetTargetWindowId(windowId);
+        point->SetAgentWindowId(windowInfo->agentWindowId);
         double windowX = pointerItem.GetDisplayXPos() - windowInfo->area.x;
         double windowY = pointerItem.GetDisplayYPos() - windowInfo->area.y;
         auto physicalDisplayInfo = WIN_MGR->GetPhysicalDisplay(windowInfo->displayId);
@@ -266,10 +357,11 @@ void EventDispatchHandler::HandleMultiWindowPointerEvent(std::shared_ptr<Pointer
         pointerItem.SetWindowXPos(windowX);
         pointerItem.SetWindowYPos(windowY);
         pointerItem.SetTargetWindowId(windowId);
-        pointerEvent->UpdatePointerItem(pointerId, pointerItem);
-        pointerEvent->SetDispatchTimes(count++);
-        DispatchPointerEventInner(pointerEvent, fd);
+        point->UpdatePointerItem(pointerId, pointerItem);
+        point->SetDispatchTimes(count++);
+        DispatchPointerEventInner(point, fd, packet);
     }
+    restorer.RestorePointerAction();
     if (point->GetPointerAction() == PointerEvent::POINTER_ACTION_UP ||
         point->GetPointerAction() == PointerEvent::POINTER_ACTION_PULL_UP ||
         point->GetPointerAction() == PointerEvent::POINTER_ACTION_CANCEL ||
@@ -318,12 +410,7 @@ void EventDispatchHandler::NotifyTouchEvent(int32_t pointAction, int32_t pointCn
     if (!GetTouchOrPointerAction(pointAction)) {
         return;
     }
-    auto rsClient = Rosen::RSRenderServiceClient::CreateRenderServiceClient();
-    if (rsClient == nullptr) {
-        MMI_HILOGE("NotifyTouchEvent create rs client failed");
-        return;
-    }
-    rsClient->NotifyTouchEvent(pointAction, pointCnt, sourceType);
+    NOTIFY_OUTBOX.Post(NotificationOutbox::CHANNEL_RS_TOUCH, pointAction, pointCnt, sourceType);
 }
 #endif // OHOS_BUILD_ENABLE_WATCH
 
@@ -333,13 +420,7 @@ void EventDispatchHandler::NotifyPointerEventToRS(int32_t pointAction, const std
     (void)programName;
     (void)pid;
 #ifndef OHOS_BUILD_ENABLE_WATCH
-    auto begin = std::chrono::high_resolution_clock::now();
     NotifyTouchEvent(pointAction, pointCnt, sourceType);
-    [[maybe_unused]] auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
-        std::chrono::high_resolution_clock::now() - begin).count();
-#ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::RS_NOTIFY_TOUCH_EVENT, durationMS);
-#endif // OHOS_BUILD_ENABLE_DFX_RADAR
 #endif // OHOS_BUILD_ENABLE_WATCH
 }
 
@@ -509,7 +590,8 @@ void EventDispatchHandler::ResetDisplayXY(const std::shared_ptr<PointerEvent> &p
 #endif // OHOS_BUILD_ENABLE_ONE_HAND_MODE
 }
 
-void EventDispatchHandler::DispatchPointerEventInner(std::shared_ptr<PointerEvent> point, int32_t fd)
+void EventDispatchHandler::DispatchPointerEventInner(std::shared_ptr<PointerEvent> point, int32_t fd,
+    std::shared_ptr<PointerEventPacket> packet)
 {
     currentTime_ = point->GetActionTime();
     if (fd < 0 && currentTime_ - eventTime_ > INTERVAL_TIME) {
@@ -561,20 +643,35 @@ void EventDispatchHandler::DispatchPointerEventInner(std::shared_ptr<PointerEven
             "action:%{public}s)", point->GetDeviceId(), point->DumpPointerAction());
         ANRMgr->HandleAnrState(sess, ANR_DISPATCH, currentTime);
     }
-    auto pointerEvent = std::make_shared<PointerEvent>(*point);
-    pointerEvent->SetMarkEnabled(AcquireEnableMark(pointerEvent));
-    pointerEvent->SetSensorInputTime(point->GetSensorInputTime());
-    FilterInvalidPointerItem(pointerEvent, fd);
+    InputLatencyStatistic::EnterStage(InputLatencyStatistic::STAGE_SERIALIZE, point);
+    bool markEnabled = AcquireEnableMark(point);
+    auto pointerEvent = point;
+    NetPacket privatePkt(MmiMessageId::ON_POINTER_EVENT);
+    NetPacket *pkt = &privatePkt;
+    if (NeedPrivatePointerEvent(point, fd)) {
+        pointerEvent = PointerEvent::Clone(point);
+        pointerEvent->SetMarkEnabled(markEnabled);
+        pointerEvent->SetSensorInputTime(point->GetSensorInputTime());
+        FilterInvalidPointerItem(pointerEvent, fd);
 #ifdef OHOS_BUILD_ENABLE_DRAG_SECURITY
-    if (pointerEvent->GetPointerAction() == PointerEvent::POINTER_ACTION_PULL_UP) {
-        DragSecurityManager::GetInstance().DragSecurityUpdatePointerEvent(pointerEvent);
-    }
+        if (pointerEvent->GetPointerAction() == PointerEvent::POINTER_ACTION_PULL_UP) {
+            DragSecurityManager::GetInstance().DragSecurityUpdatePointerEvent(pointerEvent);
+        }
 #endif // OHOS_BUILD_ENABLE_DRAG_SECURITY
-    NetPacket pkt(MmiMessageId::ON_POINTER_EVENT);
-    InputEventDataTransformation::Marshalling(pointerEvent, pkt);
+        InputEventDataTransformation::Marshalling(pointerEvent, privatePkt);
 #ifdef OHOS_BUILD_ENABLE_SECURITY_COMPONENT
-    InputEventDataTransformation::MarshallingEnhanceData(pointerEvent, pkt);
+        InputEventDataTransformation::MarshallingEnhanceData(pointerEvent, privatePkt);
 #endif // OHOS_BUILD_ENABLE_SECURITY_COMPONENT
+    } else {
+        if (packet == nullptr) {
+            packet = std::make_shared<PointerEventPacket>(MmiMessageId::ON_POINTER_EVENT);
+        }
+        if (!EncodePointerEvent(point, *packet) || !packet->SetMarkEnabled(markEnabled)) {
+            MMI_HILOGE("Encode pointer event failed, errCode:%{public}d", STREAM_BUF_WRITE_FAIL);
+            return;
+        }
+        pkt = &packet->GetPacket();
+    }
     int32_t pointerAc = pointerEvent->GetPointerAction();
     NotifyPointerEventToRS(pointerAc, sess->GetProgramName(),
         static_cast<uint32_t>(sess->GetPid()), pointerEvent->GetPointerCount(), pointerEvent->GetSourceType());
@@ -584,15 +681,59 @@ void EventDispatchHandler::DispatchPointerEventInner(std::shared_ptr<PointerEven
         MMI_HILOG_FREEZEI("SendMsg:%{public}d, pointerAc:%{public}d", sess->GetPid(), pointerAc);
     }
     WIN_MGR->PrintEnterEventInfo(pointerEvent);
-    if (!udsServer->SendMsg(fd, pkt)) {
+    UDSSession::CoalesceKey coalesceKey;
+    InputLatencyStatistic::EnterStage(InputLatencyStatistic::STAGE_SEND, point);
+    bool isSent = (GetCoalesceKey(pointerEvent, coalesceKey) ? udsServer->SendMsg(fd, *pkt, coalesceKey) :
+        udsServer->SendMsg(fd, *pkt));
+    InputLatencyStatistic::EnterStage(InputLatencyStatistic::STAGE_WINDOW_TARGET, point);
+    if (!isSent) {
         MMI_HILOGE("Sending structure of EventTouch failed! errCode:%{public}d", MSG_SEND_FAIL);
         return;
     }
-    if (sess->GetPid() != AppDebugListener::GetInstance()->GetAppDebugPid() && pointerEvent->IsMarkEnabled()) {
+    if (sess->GetPid() != AppDebugListener::GetInstance()->GetAppDebugPid() && markEnabled) {
         MMI_HILOGD("Session pid:%{public}d", sess->GetPid());
         ANRMgr->AddTimer(ANR_DISPATCH, point->GetId(), currentTime, sess);
     }
 }
+
+bool EventDispatchHandler::GetCoalesceKey(std::shared_ptr<PointerEvent> point, UDSSession::CoalesceKey &key)
+{
+    int32_t pointerAction = point->GetPointerAction();
+    if ((pointerAction != PointerEvent::POINTER_ACTION_MOVE) &&
+        (pointerAction != PointerEvent::POINTER_ACTION_AXIS_UPDATE) &&
+        (pointerAction != PointerEvent::POINTER_ACTION_PULL_MOVE)) {
+        return false;
+    }
+    key.deviceId = point->GetDeviceId();
+    key.pointerId = point->GetPointerId();
+    key.action = pointerAction;
+    key.windowId = point->GetTargetWindowId();
+    return true;
+}
+
+bool EventDispatchHandler::NeedPrivatePointerEvent(std::shared_ptr<PointerEvent> point, int32_t fd)
+{
+#ifdef OHOS_BUILD_ENABLE_DRAG_SECURITY
+    if (point->GetPointerAction() == PointerEvent::POINTER_ACTION_PULL_UP) {
+        return true;
+    }
+#endif // OHOS_BUILD_ENABLE_DRAG_SECURITY
+    return HasInvalidPointerItem(point, fd);
+}
+
+bool EventDispatchHandler::EncodePointerEvent(std::shared_ptr<PointerEvent> point, PointerEventPacket &packet)
+{
+    if (packet.IsEncoded() && packet.Patch(point)) {
+        return true;
+    }
+    if (packet.Encode(point) != RET_OK) {
+        return false;
+    }
+#ifdef OHOS_BUILD_ENABLE_SECURITY_COMPONENT
+    InputEventDataTransformation::MarshallingEnhanceData(point, packet.GetPacket());
+#endif // OHOS_BUILD_ENABLE_SECURITY_COMPONENT
+    return true;
+}
 #endif // OHOS_BUILD_ENABLE_POINTER || OHOS_BUILD_ENABLE_POINTER
 
 #ifdef OHOS_BUILD_ENABLE_KEYBOARD
@@ -646,6 +787,7 @@ int32_t EventDispatchHandler::DispatchKeyEvent(int32_t fd, UDSServer& udsServer,
     if (key->GetKeyCode() != keyHandler->GetCurrentHandleKeyCode()) {
         MMI_HILOGW("Keycode has been changed");
     }
+    InputLatencyStatistic::EnterStage(InputLatencyStatistic::STAGE_SERIALIZE, key);
     NetPacket pkt(MmiMessageId::ON_KEY_EVENT);
     InputEventDataTransformation::KeyEventToNetPacket(key, pkt);
     BytraceAdapter::StartBytrace(key, BytraceAdapter::KEY_DISPATCH_EVENT);
@@ -660,7 +802,10 @@ int32_t EventDispatchHandler::DispatchKeyEvent(int32_t fd, UDSServer& udsServer,
     }
     MMI_HILOGD("InputTracking id:%{public}d, SendMsg to %{public}s:pid:%{public}d",
         key->GetId(), session->GetProgramName().c_str(), session->GetPid());
-    if (!udsServer.SendMsg(fd, pkt)) {
+    InputLatencyStatistic::EnterStage(InputLatencyStatistic::STAGE_SEND, key);
+    bool isSent = udsServer.SendMsg(fd, pkt);
+    InputLatencyStatistic::EnterStage(InputLatencyStatistic::STAGE_WINDOW_TARGET, key);
+    if (!isSent) {
         MMI_HILOGE("Sending structure of EventKeyboard failed! errCode:%{public}d", MSG_SEND_FAIL);
         return MSG_SEND_FAIL;
     }
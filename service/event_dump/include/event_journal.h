@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef EVENT_JOURNAL_H
+#define EVENT_JOURNAL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace MMI {
+/*
+ * One input event as kept by EventStatistic, copied from the event on the service thread and turned into text
+ * only when dumped or decoded. Fields hidden by the privacy mode are never stored, the flag tells the decoder to
+ * print them masked.
+ */
+struct EventJournalRecord {
+    enum Kind : uint16_t {
+        KIND_NONE = 0,
+        KIND_POINTER,
+        KIND_KEY,
+        KIND_SWITCH,
+    };
+    enum Flag : uint16_t {
+        FLAG_PRIVACY = 1U << 0,
+    };
+    static constexpr size_t MAX_POINTERS { 10 };
+    static constexpr size_t MAX_BUTTONS { 4 };
+    static constexpr size_t MAX_KEY_ITEMS { 5 };
+
+    struct Pointer {
+        int32_t displayX;
+        int32_t displayY;
+        double pressure;
+    };
+    struct PointerBody {
+        int32_t pointerId;
+        int32_t pointerAction;
+        int32_t buttonId;
+        uint32_t axes;
+        uint8_t pointerCount;
+        uint8_t buttonCount;
+        uint8_t reserved[2];
+        int32_t pressedButtons[MAX_BUTTONS];
+        Pointer pointers[MAX_POINTERS];
+    };
+    struct KeyItem {
+        int64_t downTime;
+        int32_t deviceId;
+        int32_t keyCode;
+        uint32_t unicode;
+        uint8_t pressed;
+        uint8_t reserved[3];
+    };
+    struct KeyBody {
+        int32_t keyCode;
+        int32_t keyAction;
+        uint8_t itemCount;
+        uint8_t reserved[7];
+        KeyItem items[MAX_KEY_ITEMS];
+    };
+    struct SwitchBody {
+        int32_t switchValue;
+        int32_t switchType;
+    };
+
+    uint16_t kind;
+    uint16_t flags;
+    int32_t eventType;
+    int64_t handleTime;
+    int64_t actionTime;
+    int32_t deviceId;
+    int32_t sourceType;
+    union {
+        PointerBody pointer;
+        KeyBody key;
+        SwitchBody switchEvent;
+    };
+};
+static_assert(sizeof(EventJournalRecord) == 232, "The journal file layout depends on the record size");
+
+/*
+ * Rotating file of EventJournalRecord written through a memory mapped window. The file starts with one header
+ * slot, records follow back to back, and the zero filled tail of the last window marks the end. Once the file
+ * reaches its limit it is renamed to the history file and a new one is started, as is a file that is no journal.
+ */
+class EventJournal final {
+public:
+    EventJournal(const std::string &fileName, const std::string &historyName, size_t maxSize);
+    ~EventJournal();
+    DISALLOW_COPY_AND_MOVE(EventJournal);
+
+    bool Append(const EventJournalRecord &record);
+    void Close();
+    // Calls the visitor for each record of the file in order, returns the number of records read or RET_ERR.
+    static int32_t Read(const std::string &fileName, std::function<void(const EventJournalRecord &)> visitor);
+
+private:
+    struct Header {
+        char magic[4];
+        uint16_t version;
+        uint16_t recordSize;
+    };
+
+    bool Open();
+    bool MapWindow(size_t offset);
+    void UnmapWindow();
+    void Rotate();
+    bool MoveToHistory();
+    size_t FindEnd();
+
+    std::string fileName_;
+    std::string historyName_;
+    size_t maxSize_ { 0 };
+    int32_t fd_ { -1 };
+    uint8_t *window_ { nullptr };
+    size_t windowOffset_ { 0 };
+    size_t writeOffset_ { 0 };
+};
+} // namespace MMI
+} // namespace OHOS
+#endif // EVENT_JOURNAL_H
@@ -18,11 +18,12 @@
 
 #include <algorithm>
 #include <array>
-#include <fstream>
-#include <queue>
-#include <sys/stat.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <unistd.h>
 
+#include "event_journal.h"
 #include "pointer_event.h"
 #include "key_event.h"
 #include "switch_event.h"
@@ -31,20 +32,24 @@ namespace OHOS {
 namespace MMI {
 class EventStatistic final {
 public:
-    static void PushEventStr(std::string eventStr);
+    static void PushRecord(const EventJournalRecord &record);
     static void PushPointerEvent(std::shared_ptr<PointerEvent> eventPtr);
     static void PushKeyEvent(std::shared_ptr<KeyEvent> eventPtr);
     static void PushSwitchEvent(std::shared_ptr<SwitchEvent> eventPtr);
     static void PushPointerRecord(std::shared_ptr<PointerEvent> eventPtr);
     static int32_t QueryPointerRecord(int32_t count, std::vector<std::shared_ptr<PointerEvent>> &pointerList);
-    static std::string PopEvent();
+    static bool PopRecords(std::vector<EventJournalRecord> &records);
+    static void SetWriteFileEnabled(bool enabled);
     static void WriteEventFile();
     static void Dump(int32_t fd, const std::vector<std::string> &args);
+    static int32_t DumpJournal(int32_t fd, const std::string &fileName);
     static std::string ConvertInputEventToStr(const std::shared_ptr<InputEvent> eventPtr);
+    static std::string ConvertRecordToStr(const EventJournalRecord &record);
     static std::string ConvertTimeToStr(int64_t timestamp);
     static const char* ConvertEventTypeToString(int32_t eventType);
     static const char* ConvertSourceTypeToString(int32_t sourceType_);
     static const char* ConvertPointerActionToString(std::shared_ptr<PointerEvent> eventPtr);
+    static const char* ConvertPointerActionToString(int32_t pointerAction, uint32_t axes);
     static const char* ConvertKeyActionToString(int32_t keyAction);
     static const char* ConvertSwitchTypeToString(int32_t switchType);
 
@@ -73,11 +78,24 @@ private:
               displayXs(displayXs), displayYs(displayYs)
         {}
     };
-    static std::queue<std::string> eventQueue_;
-    static std::list<std::string> dumperEventList_;
+    static void FillRecordHeader(InputEvent &event, uint16_t kind, EventJournalRecord &record);
+    static void AppendHeaderStr(const EventJournalRecord &record, std::string &eventStr);
+    static void AppendPointerStr(const EventJournalRecord &record, std::string &eventStr);
+    static void AppendKeyStr(const EventJournalRecord &record, std::string &eventStr);
+    static void AppendSwitchStr(const EventJournalRecord &record, std::string &eventStr);
+
+    static constexpr size_t EVENT_OUT_SIZE = 30;
+    static constexpr size_t JOURNAL_QUEUE_SIZE = 1024;
+    static std::array<EventJournalRecord, EVENT_OUT_SIZE> dumperRecords_;
+    static size_t dumperHead_;
+    static size_t dumperSize_;
+    static std::array<EventJournalRecord, JOURNAL_QUEUE_SIZE> journalQueue_;
+    static size_t journalHead_;
+    static size_t journalSize_;
+    static uint64_t journalDropped_;
     static std::mutex queueMutex_;
     static std::condition_variable queueCondition_;
-    static bool writeFileEnabled_;
+    static std::atomic_bool writeFileEnabled_;
     static constexpr int32_t RING_BUFFER_SIZE = 60;
     static std::array<PointerEventRecord, RING_BUFFER_SIZE> pointerRecordRingBuffer_;
     static int32_t ringHead_;
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INPUT_LATENCY_STATISTIC_H
+#define INPUT_LATENCY_STATISTIC_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "key_event.h"
+#include "pointer_event.h"
+
+namespace OHOS {
+namespace MMI {
+/*
+ * Latency histograms of the stages an input event goes through in the service, one per stage and source.
+ * The thread running the handler chain moves a cursor from stage to stage, each move records the time spent
+ * in the stage it leaves. Recording is a few relaxed atomic increments, the dump reads from any thread.
+ */
+class InputLatencyStatistic final {
+public:
+    enum Stage : int32_t {
+        STAGE_SENSOR_TO_READ = 0,
+        STAGE_NORMALIZE,
+        STAGE_FILTER,
+        STAGE_INTERCEPTOR,
+        STAGE_KEY_COMMAND,
+        STAGE_SUBSCRIBER,
+        STAGE_MONITOR,
+        STAGE_WINDOW_TARGET,
+        STAGE_SERIALIZE,
+        STAGE_SEND,
+        STAGE_CLIENT_ROUND_TRIP,
+        STAGE_COUNT,
+    };
+    // Acknowledgements from the client do not say which source the event came from, they count as other.
+    enum Source : int32_t {
+        SOURCE_KEY = 0,
+        SOURCE_MOUSE,
+        SOURCE_TOUCHSCREEN,
+        SOURCE_TOUCHPAD,
+        SOURCE_OTHER,
+        SOURCE_COUNT,
+    };
+
+    // Opens the normalize stage of a libinput event, times in microseconds on the monotonic clock.
+    static void BeginEvent(int64_t beginTime, int64_t sensorTime);
+    static void EnterStage(Stage stage, std::shared_ptr<KeyEvent> keyEvent);
+    static void EnterStage(Stage stage, std::shared_ptr<PointerEvent> pointerEvent);
+    // Closes the stage the event was last in.
+    static void EndEvent();
+    static void Record(Stage stage, Source source, int64_t latencyUs);
+    static uint64_t GetPercentile(Stage stage, Source source, uint32_t perMille);
+    static uint64_t GetCount(Stage stage, Source source);
+    static void Reset();
+    static void Dump(int32_t fd);
+
+private:
+    // Four buckets per power of two below 2^26 us, enough for 25% resolution up to a minute.
+    static constexpr int32_t SUB_BUCKET_BITS { 2 };
+    static constexpr int32_t SUB_BUCKETS { 1 << SUB_BUCKET_BITS };
+    static constexpr int32_t MAX_EXPONENT { 26 };
+    static constexpr size_t BUCKET_COUNT { (MAX_EXPONENT - SUB_BUCKET_BITS + 2) * SUB_BUCKETS };
+
+    struct Histogram {
+        std::atomic<uint64_t> count { 0 };
+        std::atomic<uint64_t> maxUs { 0 };
+        std::atomic<uint64_t> buckets[BUCKET_COUNT] {};
+    };
+
+    static void EnterStage(Stage stage, Source source);
+    static Source GetSource(std::shared_ptr<PointerEvent> pointerEvent);
+    static size_t GetBucket(uint64_t latencyUs);
+    static uint64_t GetBucketUpperBound(size_t bucket);
+    static const char* GetStageName(int32_t stage);
+    static const char* GetSourceName(int32_t source);
+
+    static Histogram histograms_[STAGE_COUNT][SOURCE_COUNT];
+};
+} // namespace MMI
+} // namespace OHOS
+#endif // INPUT_LATENCY_STATISTIC_H
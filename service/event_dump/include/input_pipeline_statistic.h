@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INPUT_PIPELINE_STATISTIC_H
+#define INPUT_PIPELINE_STATISTIC_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace OHOS {
+namespace MMI {
+/*
+ * Counters of the input pipeline mode, where a reader thread drains libinput and hands the events to the
+ * service thread over a ring. The reader and the service thread each update their own stages, the dump reads
+ * them from wherever it runs.
+ */
+class InputPipelineStatistic final {
+public:
+    enum Stage : int32_t {
+        STAGE_READ = 0,
+        STAGE_QUEUE,
+        STAGE_DISPATCH,
+        STAGE_COUNT,
+    };
+
+    static void SetEnabled(size_t ringCapacity);
+    static bool IsEnabled();
+    static void RecordLatency(Stage stage, int64_t latencyUs);
+    static void RecordQueueDepth(size_t depth);
+    static void RecordRingFull();
+    static void Reset();
+    static void Dump(int32_t fd);
+
+private:
+    struct StageCounter {
+        std::atomic<uint64_t> count { 0 };
+        std::atomic<uint64_t> totalUs { 0 };
+        std::atomic<uint64_t> maxUs { 0 };
+    };
+
+    static const char* GetStageName(int32_t stage);
+
+    static std::atomic<size_t> ringCapacity_;
+    static std::atomic<size_t> queueDepth_;
+    static std::atomic<size_t> maxQueueDepth_;
+    static std::atomic<uint64_t> ringFullCount_;
+    static StageCounter stages_[STAGE_COUNT];
+};
+} // namespace MMI
+} // namespace OHOS
+#endif // INPUT_PIPELINE_STATISTIC_H
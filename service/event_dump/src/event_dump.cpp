@@ -17,9 +17,12 @@
 
 #include <getopt.h>
 
+#include "bytrace_adapter.h"
 #include "event_statistic.h"
 #include "input_device_manager.h"
 #include "input_event_handler.h"
+#include "input_latency_statistic.h"
+#include "input_pipeline_statistic.h"
 #ifdef OHOS_BUILD_ENABLE_KEYBOARD
 #include "i_input_windows_manager.h"
 #ifdef OHOS_BUILD_ENABLE_COMBINATION_KEY
@@ -33,6 +36,8 @@
 #ifdef OHOS_BUILD_KNUCKLE
 #include "knuckle_handler_component.h"
 #endif // OHOS_BUILD_KNUCKLE
+#include "multimodal_input_plugin_manager.h"
+#include "notification_outbox.h"
 #ifdef OHOS_BUILD_ENABLE_TOUCH_DRAWING
 #include "touch_drawing_manager.h"
 #endif // #ifdef OHOS_BUILD_ENABLE_TOUCH_DRAWING
@@ -113,6 +118,8 @@ void EventDump::ParseCommand(int32_t fd, const std::vector<std::string> &args)
         { "tripleFingerSnapshot", no_argument, 0, 'n' },
         { "frozenPid", no_argument, 0, 'p' },
         { "pendingBind", no_argument, 0, 'B' },
+        { "tracepoints", no_argument, 0, 'T' },
+        { "latency", no_argument, 0, 'L' },
         { nullptr, 0, 0, 0 }
     };
     if (args.empty()) {
@@ -144,7 +151,7 @@ void EventDump::ParseCommand(int32_t fd, const std::vector<std::string> &args)
         std::lock_guard<std::mutex> lock(getoptMtx_);
         optind = 1;
         int32_t c;
-        while ((c = getopt_long (args.size(), argv, "hdlwusoifmckKetbnpB", dumpOptions, &optionIndex)) != -1) {
+        while ((c = getopt_long (args.size(), argv, "hdlwusoifmckKetbnpBTL", dumpOptions, &optionIndex)) != -1) {
             getoptResults.push_back(c);
         }
     }
@@ -282,6 +289,7 @@ void EventDump::ParseCommand(int32_t fd, const std::vector<std::string> &args)
             }
             case 'e': {
                 EventStatistic::Dump(fd, args);
+                InputPipelineStatistic::Dump(fd);
                 break;
             }
             case 't': {
@@ -328,6 +336,16 @@ void EventDump::ParseCommand(int32_t fd, const std::vector<std::string> &args)
                 WIN_MGR->DumpPendingBindState(fd);
                 break;
             }
+            case 'T': {
+                BytraceAdapter::DumpTracePoints(fd);
+                break;
+            }
+            case 'L': {
+                InputLatencyStatistic::Dump(fd);
+                InputPluginManager::GetInstance()->Dump(fd);
+                NOTIFY_OUTBOX.Dump(fd);
+                break;
+            }
             default: {
                 mprintf(fd, "cmd param is error\n");
                 DumpHelp(fd);
@@ -371,6 +389,8 @@ void EventDump::DumpHelp(int32_t fd)
     mprintf(fd, "      -n, --triple finger snapshot: dump the triple finger snapshot information\t");
     mprintf(fd, "      -p, --frozen pid: dump frozen pid list\t");
     mprintf(fd, "      -B, --pendingBind: dump the deferred bind (active sequence/pending/timer) state\t");
+    mprintf(fd, "      -T, --tracepoints: dump the binary trace points for offline expansion\t");
+    mprintf(fd, "      -L, --latency: dump the latency of event handling stages, plugins and notifications\t");
 }
 
 void EventDump::AttachTouchGestureMgr(std::shared_ptr<ITouchGestureManager> touchGestureMgr)
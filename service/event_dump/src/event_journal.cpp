@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "event_journal.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include "error_multimodal.h"
+#include "mmi_log.h"
+#include "securec.h"
+
+#undef MMI_LOG_DOMAIN
+#define MMI_LOG_DOMAIN MMI_LOG_HANDLER
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "EventJournal"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr char JOURNAL_MAGIC[] { 'M', 'M', 'E', 'J' };
+constexpr uint16_t JOURNAL_VERSION { 1 };
+constexpr size_t RECORD_SIZE { sizeof(EventJournalRecord) };
+// A whole number of records and of pages, so that no record straddles two windows.
+constexpr size_t WINDOW_SIZE { RECORD_SIZE * 4096 };
+constexpr size_t READ_BATCH { 256 };
+constexpr mode_t JOURNAL_FILE_MODE { 0640 };
+} // namespace
+
+EventJournal::EventJournal(const std::string &fileName, const std::string &historyName, size_t maxSize)
+    : fileName_(fileName), historyName_(historyName),
+      maxSize_(std::max(maxSize / WINDOW_SIZE, static_cast<size_t>(1)) * WINDOW_SIZE)
+{}
+
+EventJournal::~EventJournal()
+{
+    Close();
+}
+
+bool EventJournal::Append(const EventJournalRecord &record)
+{
+    if ((fd_ < 0) && !Open()) {
+        return false;
+    }
+    if ((window_ == nullptr) || (writeOffset_ >= windowOffset_ + WINDOW_SIZE)) {
+        if (writeOffset_ + WINDOW_SIZE > maxSize_) {
+            Rotate();
+            // A failed rename reopens the same full file, whose window has no room left.
+            if ((fd_ < 0) || (writeOffset_ >= windowOffset_ + WINDOW_SIZE)) {
+                return false;
+            }
+        } else {
+            if (ftruncate(fd_, static_cast<off_t>(writeOffset_ + WINDOW_SIZE)) != 0) {
+                MMI_HILOGE("Grow journal failed, errno:%{public}d", errno);
+                return false;
+            }
+            if (!MapWindow(writeOffset_)) {
+                return false;
+            }
+        }
+    }
+    errno_t ret = memcpy_s(window_ + (writeOffset_ - windowOffset_), RECORD_SIZE, &record, RECORD_SIZE);
+    if (ret != EOK) {
+        MMI_HILOGE("Copy record failed, ret:%{public}d", ret);
+        return false;
+    }
+    writeOffset_ += RECORD_SIZE;
+    return true;
+}
+
+void EventJournal::Close()
+{
+    UnmapWindow();
+    if (fd_ >= 0) {
+        fdsan_close_with_tag(fd_, TAG);
+        fd_ = -1;
+    }
+    writeOffset_ = 0;
+}
+
+int32_t EventJournal::Read(const std::string &fileName, std::function<void(const EventJournalRecord &)> visitor)
+{
+    int32_t fd = open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        MMI_HILOGE("Open journal failed, errno:%{public}d", errno);
+        return RET_ERR;
+    }
+    fdsan_exchange_owner_tag(fd, 0, TAG);
+    std::vector<EventJournalRecord> records(READ_BATCH);
+    Header header {};
+    int32_t count = RET_ERR;
+    if ((pread(fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header))) &&
+        (memcmp(header.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) == 0) && (header.recordSize == RECORD_SIZE)) {
+        count = 0;
+        off_t offset = static_cast<off_t>(RECORD_SIZE);
+        ssize_t bytes = pread(fd, records.data(), READ_BATCH * RECORD_SIZE, offset);
+        while (bytes >= static_cast<ssize_t>(RECORD_SIZE)) {
+            size_t n = static_cast<size_t>(bytes) / RECORD_SIZE;
+            size_t i = 0;
+            for (; (i < n) && (records[i].kind != EventJournalRecord::KIND_NONE); ++i) {
+                visitor(records[i]);
+            }
+            count += static_cast<int32_t>(i);
+            if (i < n) {
+                break;
+            }
+            offset += static_cast<off_t>(n * RECORD_SIZE);
+            bytes = pread(fd, records.data(), READ_BATCH * RECORD_SIZE, offset);
+        }
+    } else {
+        MMI_HILOGE("Not an event journal:%{private}s", fileName.c_str());
+    }
+    fdsan_close_with_tag(fd, TAG);
+    return count;
+}
+
+bool EventJournal::Open()
+{
+    fd_ = open(fileName_.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, JOURNAL_FILE_MODE);
+    if (fd_ < 0) {
+        MMI_HILOGE("Open journal failed, errno:%{public}d", errno);
+        return false;
+    }
+    fdsan_exchange_owner_tag(fd_, 0, TAG);
+    struct stat statbuf;
+    size_t fileSize = 0;
+    if (fstat(fd_, &statbuf) == 0) {
+        fileSize = static_cast<size_t>(statbuf.st_size);
+    }
+    Header header {};
+    if ((fileSize < RECORD_SIZE) ||
+        (pread(fd_, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))) ||
+        (memcmp(header.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0) ||
+        (header.version != JOURNAL_VERSION) || (header.recordSize != RECORD_SIZE)) {
+        // The text log of earlier versions or a foreign file is kept as the history, the new journal starts empty.
+        if ((fileSize > 0) && MoveToHistory()) {
+            fdsan_close_with_tag(fd_, TAG);
+            fd_ = -1;
+            return Open();
+        }
+        fileSize = 0;
+    }
+    size_t windowOffset = (fileSize == 0) ? 0 : ((fileSize - 1) / WINDOW_SIZE * WINDOW_SIZE);
+    if (((fileSize == 0) && (ftruncate(fd_, 0) != 0)) ||
+        (ftruncate(fd_, static_cast<off_t>(windowOffset + WINDOW_SIZE)) != 0) || !MapWindow(windowOffset)) {
+        MMI_HILOGE("Prepare journal failed, errno:%{public}d", errno);
+        Close();
+        return false;
+    }
+    if (fileSize == 0) {
+        header = { { JOURNAL_MAGIC[0], JOURNAL_MAGIC[1], JOURNAL_MAGIC[2], JOURNAL_MAGIC[3] },
+            JOURNAL_VERSION, static_cast<uint16_t>(RECORD_SIZE) };
+        if (memcpy_s(window_, RECORD_SIZE, &header, sizeof(header)) != EOK) {
+            Close();
+            return false;
+        }
+        writeOffset_ = RECORD_SIZE;
+    } else {
+        writeOffset_ = FindEnd();
+    }
+    return true;
+}
+
+bool EventJournal::MapWindow(size_t offset)
+{
+    UnmapWindow();
+    void *window = mmap(nullptr, WINDOW_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, static_cast<off_t>(offset));
+    if (window == MAP_FAILED) {
+        MMI_HILOGE("Map journal failed, errno:%{public}d", errno);
+        return false;
+    }
+    window_ = static_cast<uint8_t *>(window);
+    windowOffset_ = offset;
+    return true;
+}
+
+void EventJournal::UnmapWindow()
+{
+    if (window_ != nullptr) {
+        munmap(window_, WINDOW_SIZE);
+        window_ = nullptr;
+    }
+}
+
+void EventJournal::Rotate()
+{
+    Close();
+    MoveToHistory();
+    Open();
+}
+
+bool EventJournal::MoveToHistory()
+{
+    if ((access(historyName_.c_str(), F_OK) == 0) && (remove(historyName_.c_str()) != 0)) {
+        MMI_HILOGE("Remove history file failed");
+    }
+    if (rename(fileName_.c_str(), historyName_.c_str()) != 0) {
+        MMI_HILOGE("Rename file failed, errno:%{public}d", errno);
+        return false;
+    }
+    return true;
+}
+
+size_t EventJournal::FindEnd()
+{
+    // Resumes after the last record of the mapped window, skipping the header slot of the first one.
+    size_t slot = (windowOffset_ == 0) ? RECORD_SIZE : 0;
+    for (; slot < WINDOW_SIZE; slot += RECORD_SIZE) {
+        auto record = reinterpret_cast<const EventJournalRecord *>(window_ + slot);
+        if (record->kind == EventJournalRecord::KIND_NONE) {
+            break;
+        }
+    }
+    return windowOffset_ + slot;
+}
+} // namespace MMI
+} // namespace OHOS
@@ -14,6 +14,11 @@
  */
 
 #include "event_statistic.h"
+
+#include <cinttypes>
+#include <iomanip>
+#include <sstream>
+
 #include "util_ex.h"
 
 #undef MMI_LOG_DOMAIN
@@ -26,14 +31,19 @@ namespace MMI {
 namespace {
 const char* EVENT_FILE_NAME = "/data/service/el1/public/multimodalinput/multimodal_event.dmp";
 const char* EVENT_FILE_NAME_HISTORY = "/data/service/el1/public/multimodalinput/multimodal_event_history.dmp";
-constexpr int32_t FILE_MAX_SIZE = 100 * 1024 * 1024;
-constexpr int32_t EVENT_OUT_SIZE = 30;
-constexpr int32_t FUNC_EXE_OK = 0;
+constexpr size_t FILE_MAX_SIZE = 100 * 1024 * 1024;
 constexpr int32_t STRING_WIDTH = 3;
+constexpr int64_t MS_PER_SECOND = 1000;
+const char* MASKED_VALUE = "***";
 }
 
-std::queue<std::string> EventStatistic::eventQueue_;
-std::list<std::string> EventStatistic::dumperEventList_;
+std::array<EventJournalRecord, EventStatistic::EVENT_OUT_SIZE> EventStatistic::dumperRecords_ = {};
+size_t EventStatistic::dumperHead_ = 0;
+size_t EventStatistic::dumperSize_ = 0;
+std::array<EventJournalRecord, EventStatistic::JOURNAL_QUEUE_SIZE> EventStatistic::journalQueue_ = {};
+size_t EventStatistic::journalHead_ = 0;
+size_t EventStatistic::journalSize_ = 0;
+uint64_t EventStatistic::journalDropped_ = 0;
 std::mutex EventStatistic::queueMutex_;
 std::condition_variable EventStatistic::queueCondition_;
 std::array<EventStatistic::PointerEventRecord, EventStatistic::RING_BUFFER_SIZE>
@@ -41,7 +51,7 @@ std::array<EventStatistic::PointerEventRecord, EventStatistic::RING_BUFFER_SIZE>
 int32_t EventStatistic::ringHead_ = 0;
 int32_t EventStatistic::ringTail_ = 0;
 int32_t EventStatistic::ringSize_ = 0;
-bool EventStatistic::writeFileEnabled_ = false;
+std::atomic_bool EventStatistic::writeFileEnabled_ { false };
 static const std::unordered_map<int32_t, std::string> pointerActionMap = {
     { PointerEvent::POINTER_ACTION_CANCEL, "cancel" },
     { PointerEvent::POINTER_ACTION_DOWN, "down" },
@@ -96,25 +106,35 @@ static const std::unordered_map<int32_t, std::string> keyActionMap = {
 
 std::string EventStatistic::ConvertInputEventToStr(const std::shared_ptr<InputEvent> eventPtr)
 {
-    auto nowTime = std::chrono::system_clock::now();
-    std::time_t timeT = std::chrono::system_clock::to_time_t(nowTime);
-    auto milsecsCount = std::chrono::duration_cast<std::chrono::milliseconds>(nowTime.time_since_epoch()).count();
-    std::string handleTime = ConvertTimeToStr(static_cast<int64_t>(timeT));
-    int32_t milsec = milsecsCount % 1000;
-    std::stringstream strStream;
-    strStream << std::left << std::setw(STRING_WIDTH) << milsec;
-    std::string milsecStr(strStream.str());
-    handleTime += "." + milsecStr;
-    std::string eventStr = "{";
-    eventStr += handleTime;
-    eventStr += ",eventType:";
-    eventStr += ConvertEventTypeToString(eventPtr->GetEventType());
-    eventStr += ",actionTime:";
-    eventStr += std::to_string(eventPtr->GetActionTime());
-    eventStr += ",deviceId:";
-    eventStr += std::to_string(eventPtr->GetDeviceId());
-    eventStr += ",sourceType:";
-    eventStr += ConvertSourceTypeToString(eventPtr->GetSourceType());
+    EventJournalRecord record {};
+    FillRecordHeader(*eventPtr, EventJournalRecord::KIND_NONE, record);
+    std::string eventStr;
+    AppendHeaderStr(record, eventStr);
+    return eventStr;
+}
+
+std::string EventStatistic::ConvertRecordToStr(const EventJournalRecord &record)
+{
+    std::string eventStr;
+    AppendHeaderStr(record, eventStr);
+    switch (record.kind) {
+        case EventJournalRecord::KIND_POINTER: {
+            AppendPointerStr(record, eventStr);
+            break;
+        }
+        case EventJournalRecord::KIND_KEY: {
+            AppendKeyStr(record, eventStr);
+            break;
+        }
+        case EventJournalRecord::KIND_SWITCH: {
+            AppendSwitchStr(record, eventStr);
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    eventStr += "}";
     return eventStr;
 }
 
@@ -131,128 +151,209 @@ std::string EventStatistic::ConvertTimeToStr(int64_t timestamp)
     return timeStr;
 }
 
-void EventStatistic::PushPointerEvent(std::shared_ptr<PointerEvent> eventPtr)
+void EventStatistic::FillRecordHeader(InputEvent &event, uint16_t kind, EventJournalRecord &record)
 {
-    CHKPV(eventPtr);
-    if (eventPtr->GetSourceType() == InputEvent::SOURCE_TYPE_TOUCHSCREEN) {
-        PushPointerRecord(eventPtr);
-    }
-    int32_t pointerAction = eventPtr->GetPointerAction();
-    if (pointerAction == PointerEvent::POINTER_ACTION_MOVE || pointerAction == PointerEvent::POINTER_ACTION_PULL_MOVE ||
-        pointerAction == PointerEvent::POINTER_ACTION_HOVER_MOVE ||
-        pointerAction == PointerEvent::POINTER_ACTION_AXIS_UPDATE ||
-        pointerAction == PointerEvent::POINTER_ACTION_SWIPE_UPDATE ||
-        pointerAction == PointerEvent::POINTER_ACTION_ROTATE_UPDATE) {
-        MMI_HILOGD("PointEvent is filtered");
-        return;
-    }
-    std::string eventStr = ConvertInputEventToStr(eventPtr);
+    record.kind = kind;
+    record.flags = event.HasFlag(InputEvent::EVENT_FLAG_PRIVACY_MODE) ? EventJournalRecord::FLAG_PRIVACY : 0;
+    record.eventType = event.GetEventType();
+    record.handleTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    record.actionTime = event.GetActionTime();
+    record.deviceId = event.GetDeviceId();
+    record.sourceType = event.GetSourceType();
+}
+
+void EventStatistic::AppendHeaderStr(const EventJournalRecord &record, std::string &eventStr)
+{
+    std::stringstream strStream;
+    strStream << std::left << std::setw(STRING_WIDTH) << (record.handleTime % MS_PER_SECOND);
+    eventStr += "{";
+    eventStr += ConvertTimeToStr(record.handleTime / MS_PER_SECOND);
+    eventStr += ".";
+    eventStr += strStream.str();
+    eventStr += ",eventType:";
+    eventStr += ConvertEventTypeToString(record.eventType);
+    eventStr += ",actionTime:";
+    eventStr += std::to_string(record.actionTime);
+    eventStr += ",deviceId:";
+    eventStr += std::to_string(record.deviceId);
+    eventStr += ",sourceType:";
+    eventStr += ConvertSourceTypeToString(record.sourceType);
+}
+
+void EventStatistic::AppendPointerStr(const EventJournalRecord &record, std::string &eventStr)
+{
+    const auto &pointer = record.pointer;
+    bool isPrivacy = ((record.flags & EventJournalRecord::FLAG_PRIVACY) != 0);
     eventStr += ",pointerId:";
-    eventStr += std::to_string(eventPtr->GetPointerId());
+    eventStr += std::to_string(pointer.pointerId);
     eventStr += ",pointerAction:";
-    eventStr += ConvertPointerActionToString(eventPtr);
+    eventStr += ConvertPointerActionToString(pointer.pointerAction, pointer.axes);
     eventStr += ",buttonId:";
-    eventStr += std::to_string(eventPtr->GetButtonId());
+    eventStr += std::to_string(pointer.buttonId);
     eventStr += ",pointers:[";
-    size_t pointerSize = 0;
-    std::list<PointerEvent::PointerItem> pointerItems = eventPtr->GetAllPointerItems();
-    for (auto it = pointerItems.begin(); it != pointerItems.end(); it++) {
-        std::string displayX = "***";
-        std::string displayY = "***";
-        pointerSize++;
-        if (!eventPtr->HasFlag(InputEvent::EVENT_FLAG_PRIVACY_MODE)) {
-            displayX = std::to_string((*it).GetDisplayX());
-            displayY = std::to_string((*it).GetDisplayY());
-        }
+    size_t pointerCount = std::min<size_t>(pointer.pointerCount, EventJournalRecord::MAX_POINTERS);
+    for (size_t i = 0; i < pointerCount; ++i) {
+        const auto &item = pointer.pointers[i];
         eventStr += "{";
         eventStr += "displayX:";
-        eventStr += displayX;
+        eventStr += isPrivacy ? MASKED_VALUE : std::to_string(item.displayX);
         eventStr += ",displayY:";
-        eventStr += displayY;
+        eventStr += isPrivacy ? MASKED_VALUE : std::to_string(item.displayY);
         eventStr += ",pressure:";
-        eventStr += std::to_string((*it).GetPressure());
+        eventStr += std::to_string(item.pressure);
         eventStr += "}";
-        if (pointerSize != pointerItems.size()) {
+        if (i != pointerCount - 1) {
             eventStr += ",";
         }
     }
     eventStr += "],pressedButtons:[";
-    size_t buttonsSize = 0;
-    std::set<int32_t> pressedButtons = eventPtr->GetPressedButtons();
-    for (auto it = pressedButtons.begin(); it != pressedButtons.end(); it++) {
-        buttonsSize++;
-        eventStr += std::to_string(*it);
-        if (buttonsSize != pressedButtons.size()) {
+    size_t buttonCount = std::min<size_t>(pointer.buttonCount, EventJournalRecord::MAX_BUTTONS);
+    for (size_t i = 0; i < buttonCount; ++i) {
+        eventStr += std::to_string(pointer.pressedButtons[i]);
+        if (i != buttonCount - 1) {
             eventStr += ",";
         }
     }
     eventStr += "]";
-    eventStr += "}";
-    PushEventStr(eventStr);
 }
 
-void EventStatistic::PushKeyEvent(std::shared_ptr<KeyEvent> eventPtr)
+void EventStatistic::AppendKeyStr(const EventJournalRecord &record, std::string &eventStr)
 {
-    CHKPV(eventPtr);
-    std::string eventStr = ConvertInputEventToStr(eventPtr);
-    std::string keyCode = "***";
-    if (!eventPtr->HasFlag(InputEvent::EVENT_FLAG_PRIVACY_MODE)) {
-        keyCode = std::to_string(eventPtr->GetKeyCode());
-    }
-    eventStr += ",keyCode:" + keyCode;
+    const auto &key = record.key;
+    bool isPrivacy = ((record.flags & EventJournalRecord::FLAG_PRIVACY) != 0);
+    eventStr += ",keyCode:";
+    eventStr += isPrivacy ? MASKED_VALUE : std::to_string(key.keyCode);
     eventStr += ",keyAction:";
-    eventStr += ConvertKeyActionToString(eventPtr->GetKeyAction());
-    auto keyItems = eventPtr->GetKeyItems();
+    eventStr += ConvertKeyActionToString(key.keyAction);
     eventStr += ",keyItems:[";
-    for (size_t i = 0; i < keyItems.size(); i++) {
-        std::string keyItemCode = "***";
-        std::string unicode = "***";
-        int32_t pressed = keyItems[i].IsPressed() ? 1 : 0;
-        if (!eventPtr->HasFlag(InputEvent::EVENT_FLAG_PRIVACY_MODE)) {
-            keyItemCode = std::to_string(keyItems[i].GetKeyCode());
-            unicode = std::to_string(keyItems[i].GetUnicode());
-        }
+    size_t itemCount = std::min<size_t>(key.itemCount, EventJournalRecord::MAX_KEY_ITEMS);
+    for (size_t i = 0; i < itemCount; ++i) {
+        const auto &item = key.items[i];
         eventStr += "{pressed:";
-        eventStr += std::to_string(pressed);
+        eventStr += std::to_string(item.pressed);
         eventStr += ",deviceId:";
-        eventStr += std::to_string(keyItems[i].GetDeviceId());
+        eventStr += std::to_string(item.deviceId);
         eventStr += ",keyCode:";
-        eventStr += keyItemCode;
+        eventStr += isPrivacy ? MASKED_VALUE : std::to_string(item.keyCode);
         eventStr += ",downTime:";
-        eventStr += std::to_string(keyItems[i].GetDownTime());
+        eventStr += std::to_string(item.downTime);
         eventStr += ",unicode:";
-        eventStr += unicode;
+        eventStr += isPrivacy ? MASKED_VALUE : std::to_string(item.unicode);
         eventStr += "}";
-        if (i != keyItems.size() - 1) {
+        if (i != itemCount - 1) {
             eventStr += ",";
         }
     }
     eventStr += "]";
-    eventStr += "}";
-    PushEventStr(eventStr);
 }
 
-void EventStatistic::PushSwitchEvent(std::shared_ptr<SwitchEvent> eventPtr)
+void EventStatistic::AppendSwitchStr(const EventJournalRecord &record, std::string &eventStr)
 {
-    CHKPV(eventPtr);
-    std::string eventStr = ConvertInputEventToStr(eventPtr);
     eventStr += ",switchValue:";
-    eventStr += std::to_string(eventPtr->GetSwitchValue());
+    eventStr += std::to_string(record.switchEvent.switchValue);
     eventStr += ",switchType:";
-    eventStr += ConvertSwitchTypeToString(eventPtr->GetSwitchType());
-    eventStr += "}";
-    PushEventStr(eventStr);
+    eventStr += ConvertSwitchTypeToString(record.switchEvent.switchType);
 }
 
-void EventStatistic::PushEventStr(std::string eventStr)
+void EventStatistic::PushPointerEvent(std::shared_ptr<PointerEvent> eventPtr)
+{
+    CHKPV(eventPtr);
+    if (eventPtr->GetSourceType() == InputEvent::SOURCE_TYPE_TOUCHSCREEN) {
+        PushPointerRecord(eventPtr);
+    }
+    int32_t pointerAction = eventPtr->GetPointerAction();
+    if (pointerAction == PointerEvent::POINTER_ACTION_MOVE || pointerAction == PointerEvent::POINTER_ACTION_PULL_MOVE ||
+        pointerAction == PointerEvent::POINTER_ACTION_HOVER_MOVE ||
+        pointerAction == PointerEvent::POINTER_ACTION_AXIS_UPDATE ||
+        pointerAction == PointerEvent::POINTER_ACTION_SWIPE_UPDATE ||
+        pointerAction == PointerEvent::POINTER_ACTION_ROTATE_UPDATE) {
+        MMI_HILOGD("PointEvent is filtered");
+        return;
+    }
+    EventJournalRecord record {};
+    FillRecordHeader(*eventPtr, EventJournalRecord::KIND_POINTER, record);
+    auto &pointer = record.pointer;
+    pointer.pointerId = eventPtr->GetPointerId();
+    pointer.pointerAction = pointerAction;
+    pointer.buttonId = eventPtr->GetButtonId();
+    pointer.axes = eventPtr->GetAxes();
+    bool isPrivacy = ((record.flags & EventJournalRecord::FLAG_PRIVACY) != 0);
+    for (const auto &item : eventPtr->GetPointerItems()) {
+        if (pointer.pointerCount == EventJournalRecord::MAX_POINTERS) {
+            break;
+        }
+        auto &journalItem = pointer.pointers[pointer.pointerCount++];
+        if (!isPrivacy) {
+            journalItem.displayX = item.GetDisplayX();
+            journalItem.displayY = item.GetDisplayY();
+        }
+        journalItem.pressure = item.GetPressure();
+    }
+    for (int32_t buttonId : eventPtr->GetPressedButtons()) {
+        if (pointer.buttonCount == EventJournalRecord::MAX_BUTTONS) {
+            break;
+        }
+        pointer.pressedButtons[pointer.buttonCount++] = buttonId;
+    }
+    PushRecord(record);
+}
+
+void EventStatistic::PushKeyEvent(std::shared_ptr<KeyEvent> eventPtr)
+{
+    CHKPV(eventPtr);
+    EventJournalRecord record {};
+    FillRecordHeader(*eventPtr, EventJournalRecord::KIND_KEY, record);
+    auto &key = record.key;
+    bool isPrivacy = ((record.flags & EventJournalRecord::FLAG_PRIVACY) != 0);
+    if (!isPrivacy) {
+        key.keyCode = eventPtr->GetKeyCode();
+    }
+    key.keyAction = eventPtr->GetKeyAction();
+    for (const auto &item : eventPtr->GetKeyItems()) {
+        if (key.itemCount == EventJournalRecord::MAX_KEY_ITEMS) {
+            break;
+        }
+        auto &journalItem = key.items[key.itemCount++];
+        journalItem.pressed = item.IsPressed() ? 1 : 0;
+        journalItem.deviceId = item.GetDeviceId();
+        journalItem.downTime = item.GetDownTime();
+        if (!isPrivacy) {
+            journalItem.keyCode = item.GetKeyCode();
+            journalItem.unicode = item.GetUnicode();
+        }
+    }
+    PushRecord(record);
+}
+
+void EventStatistic::PushSwitchEvent(std::shared_ptr<SwitchEvent> eventPtr)
+{
+    CHKPV(eventPtr);
+    EventJournalRecord record {};
+    FillRecordHeader(*eventPtr, EventJournalRecord::KIND_SWITCH, record);
+    record.switchEvent.switchValue = eventPtr->GetSwitchValue();
+    record.switchEvent.switchType = eventPtr->GetSwitchType();
+    PushRecord(record);
+}
+
+void EventStatistic::PushRecord(const EventJournalRecord &record)
 {
     std::lock_guard<std::mutex> lock(queueMutex_);
-    dumperEventList_.push_back(eventStr);
-    if (dumperEventList_.size() > EVENT_OUT_SIZE) {
-        dumperEventList_.pop_front();
+    dumperRecords_[(dumperHead_ + dumperSize_) % EVENT_OUT_SIZE] = record;
+    if (dumperSize_ < EVENT_OUT_SIZE) {
+        ++dumperSize_;
+    } else {
+        dumperHead_ = (dumperHead_ + 1) % EVENT_OUT_SIZE;
     }
-    if (writeFileEnabled_) {
-        eventQueue_.push(eventStr);
+    if (!writeFileEnabled_) {
+        return;
+    }
+    if (journalSize_ == JOURNAL_QUEUE_SIZE) {
+        ++journalDropped_;
+        return;
+    }
+    journalQueue_[(journalHead_ + journalSize_) % JOURNAL_QUEUE_SIZE] = record;
+    if (journalSize_++ == 0) {
         queueCondition_.notify_all();
     }
 }
@@ -271,7 +372,7 @@ void EventStatistic::PushPointerRecord(std::shared_ptr<PointerEvent> eventPtr)
         default:
             return;
     }
-    std::list<PointerEvent::PointerItem> pointerItems = eventPtr->GetAllPointerItems();
+    const auto &pointerItems = eventPtr->GetPointerItems();
     auto& record = pointerRecordRingBuffer_[ringTail_];
     record.actionTime = eventPtr->GetActionTime();
     record.actionType = eventPtr->GetPointerAction();
@@ -343,53 +444,67 @@ int32_t EventStatistic::QueryPointerRecord(int32_t count, std::vector<std::share
     return RET_OK;
 }
 
-std::string EventStatistic::PopEvent()
+bool EventStatistic::PopRecords(std::vector<EventJournalRecord> &records)
 {
+    records.clear();
     std::unique_lock<std::mutex> lock(queueMutex_);
-    if (eventQueue_.empty()) {
-        queueCondition_.wait(lock, []() { return !eventQueue_.empty(); });
+    queueCondition_.wait(lock, []() { return (journalSize_ != 0) || !writeFileEnabled_; });
+    for (; journalSize_ > 0; --journalSize_) {
+        records.push_back(journalQueue_[journalHead_]);
+        journalHead_ = (journalHead_ + 1) % JOURNAL_QUEUE_SIZE;
     }
-    std::string eventStr = eventQueue_.front();
-    eventQueue_.pop();
-    return eventStr;
+    return !records.empty();
+}
+
+void EventStatistic::SetWriteFileEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    writeFileEnabled_ = enabled;
+    queueCondition_.notify_all();
 }
 
 void EventStatistic::WriteEventFile()
 {
-    while (writeFileEnabled_) {
-        std::string eventStr = PopEvent();
-        struct stat statbuf;
-        int32_t fileSize = 0;
-        if (stat(EVENT_FILE_NAME, &statbuf) == FUNC_EXE_OK) {
-            fileSize = static_cast<int32_t>(statbuf.st_size);
-        }
-        if (fileSize >= FILE_MAX_SIZE) {
-            if (access(EVENT_FILE_NAME_HISTORY, F_OK) == FUNC_EXE_OK &&
-                remove(EVENT_FILE_NAME_HISTORY) != FUNC_EXE_OK) {
-                MMI_HILOGE("Remove history file failed");
-            }
-            if (rename(EVENT_FILE_NAME, EVENT_FILE_NAME_HISTORY) != FUNC_EXE_OK) {
-                MMI_HILOGE("Rename file failed");
+    EventJournal journal(EVENT_FILE_NAME, EVENT_FILE_NAME_HISTORY, FILE_MAX_SIZE);
+    std::vector<EventJournalRecord> records;
+    records.reserve(JOURNAL_QUEUE_SIZE);
+    // Records queued before the writing is turned off are still written.
+    while (PopRecords(records) || writeFileEnabled_) {
+        for (const auto &record : records) {
+            if (!journal.Append(record)) {
+                MMI_HILOGE("Append record failed");
+                break;
             }
         }
-        std::ofstream file(EVENT_FILE_NAME, std::ios::app);
-        if (file.is_open()) {
-            file << eventStr << std::endl;
-            file.close();
-        } else {
-            MMI_HILOGE("Open file failed");
-        }
     }
 }
 
 void EventStatistic::Dump(int32_t fd, const std::vector<std::string> &args)
 {
-    std::lock_guard<std::mutex> lock(queueMutex_);
-    for (auto it = dumperEventList_.begin(); it != dumperEventList_.end(); ++it) {
-        mprintf(fd, (*it).c_str());
+    std::vector<EventJournalRecord> records;
+    uint64_t journalDropped = 0;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        for (size_t i = 0; i < dumperSize_; ++i) {
+            records.push_back(dumperRecords_[(dumperHead_ + i) % EVENT_OUT_SIZE]);
+        }
+        journalDropped = journalDropped_;
+    }
+    for (const auto &record : records) {
+        mprintf(fd, "%s", ConvertRecordToStr(record).c_str());
+    }
+    if (journalDropped != 0) {
+        mprintf(fd, "Journal records dropped:%" PRIu64, journalDropped);
     }
 }
 
+int32_t EventStatistic::DumpJournal(int32_t fd, const std::string &fileName)
+{
+    return EventJournal::Read(fileName, [fd](const EventJournalRecord &record) {
+        mprintf(fd, "%s", ConvertRecordToStr(record).c_str());
+    });
+}
+
 const char* EventStatistic::ConvertEventTypeToString(int32_t eventType)
 {
     switch (eventType) {
@@ -445,8 +560,11 @@ const char* EventStatistic::ConvertSourceTypeToString(int32_t sourceType)
 
 const char* EventStatistic::ConvertPointerActionToString(std::shared_ptr<PointerEvent> eventPtr)
 {
-    int32_t pointerAction = eventPtr->GetPointerAction();
-    int32_t axes = eventPtr->GetAxes();
+    return ConvertPointerActionToString(eventPtr->GetPointerAction(), eventPtr->GetAxes());
+}
+
+const char* EventStatistic::ConvertPointerActionToString(int32_t pointerAction, uint32_t axes)
+{
     if (pointerAction == PointerEvent::POINTER_ACTION_AXIS_BEGIN) {
         if (PointerEvent::HasAxis(axes, PointerEvent::AXIS_TYPE_SCROLL_VERTICAL) ||
             PointerEvent::HasAxis(axes, PointerEvent::AXIS_TYPE_SCROLL_HORIZONTAL)) {
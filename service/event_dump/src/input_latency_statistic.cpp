@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "input_latency_statistic.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "util.h"
+#include "util_ex.h"
+
+#undef MMI_LOG_DOMAIN
+#define MMI_LOG_DOMAIN MMI_LOG_SERVER
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "InputLatencyStatistic"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr uint32_t PER_MILLE_50 { 500 };
+constexpr uint32_t PER_MILLE_90 { 900 };
+constexpr uint32_t PER_MILLE_99 { 990 };
+constexpr uint32_t PER_MILLE_999 { 999 };
+constexpr uint32_t PER_MILLE { 1000 };
+constexpr int32_t UINT64_BITS { 64 };
+
+// Where the event being handled on this thread currently is, only valid between BeginEvent and EndEvent.
+struct StageCursor {
+    bool isActive { false };
+    bool hasSource { false };
+    int32_t stage { InputLatencyStatistic::STAGE_NORMALIZE };
+    int32_t source { InputLatencyStatistic::SOURCE_OTHER };
+    int64_t mark { 0 };
+    int64_t sensorLatency { -1 };
+};
+thread_local StageCursor g_cursor;
+} // namespace
+
+InputLatencyStatistic::Histogram InputLatencyStatistic::histograms_[STAGE_COUNT][SOURCE_COUNT];
+
+void InputLatencyStatistic::BeginEvent(int64_t beginTime, int64_t sensorTime)
+{
+    g_cursor.isActive = true;
+    g_cursor.hasSource = false;
+    g_cursor.stage = STAGE_NORMALIZE;
+    g_cursor.source = SOURCE_OTHER;
+    g_cursor.mark = beginTime;
+    g_cursor.sensorLatency = ((sensorTime > 0) && (sensorTime <= beginTime)) ? (beginTime - sensorTime) : -1;
+}
+
+void InputLatencyStatistic::EnterStage(Stage stage, std::shared_ptr<KeyEvent> keyEvent)
+{
+    EnterStage(stage, SOURCE_KEY);
+}
+
+void InputLatencyStatistic::EnterStage(Stage stage, std::shared_ptr<PointerEvent> pointerEvent)
+{
+    if (g_cursor.isActive) {
+        EnterStage(stage, GetSource(pointerEvent));
+    }
+}
+
+void InputLatencyStatistic::EnterStage(Stage stage, Source source)
+{
+    if (!g_cursor.isActive) {
+        return;
+    }
+    // The source is only known once normalize has made an event of the libinput one.
+    if (!g_cursor.hasSource) {
+        g_cursor.hasSource = true;
+        g_cursor.source = source;
+        if (g_cursor.sensorLatency >= 0) {
+            Record(STAGE_SENSOR_TO_READ, source, g_cursor.sensorLatency);
+        }
+    }
+    int64_t now = GetSysClockTime();
+    Record(static_cast<Stage>(g_cursor.stage), static_cast<Source>(g_cursor.source), now - g_cursor.mark);
+    g_cursor.stage = stage;
+    g_cursor.source = source;
+    g_cursor.mark = now;
+}
+
+void InputLatencyStatistic::EndEvent()
+{
+    if (!g_cursor.isActive) {
+        return;
+    }
+    Record(static_cast<Stage>(g_cursor.stage), static_cast<Source>(g_cursor.source),
+        GetSysClockTime() - g_cursor.mark);
+    g_cursor.isActive = false;
+}
+
+void InputLatencyStatistic::Record(Stage stage, Source source, int64_t latencyUs)
+{
+    if ((stage < STAGE_SENSOR_TO_READ) || (stage >= STAGE_COUNT) || (source < SOURCE_KEY) ||
+        (source >= SOURCE_COUNT)) {
+        return;
+    }
+    uint64_t latency = (latencyUs > 0) ? static_cast<uint64_t>(latencyUs) : 0;
+    Histogram &histogram = histograms_[stage][source];
+    histogram.buckets[GetBucket(latency)].fetch_add(1, std::memory_order_relaxed);
+    histogram.count.fetch_add(1, std::memory_order_relaxed);
+    uint64_t maxUs = histogram.maxUs.load(std::memory_order_relaxed);
+    while ((latency > maxUs) && !histogram.maxUs.compare_exchange_weak(maxUs, latency, std::memory_order_relaxed)) {}
+}
+
+uint64_t InputLatencyStatistic::GetPercentile(Stage stage, Source source, uint32_t perMille)
+{
+    if ((stage < STAGE_SENSOR_TO_READ) || (stage >= STAGE_COUNT) || (source < SOURCE_KEY) ||
+        (source >= SOURCE_COUNT)) {
+        return 0;
+    }
+    const Histogram &histogram = histograms_[stage][source];
+    uint64_t counts[BUCKET_COUNT];
+    uint64_t total = 0;
+    for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+        counts[bucket] = histogram.buckets[bucket].load(std::memory_order_relaxed);
+        total += counts[bucket];
+    }
+    if (total == 0) {
+        return 0;
+    }
+    uint64_t rank = std::max((total * std::min(perMille, PER_MILLE) + PER_MILLE - 1) / PER_MILLE,
+        static_cast<uint64_t>(1));
+    uint64_t maxUs = histogram.maxUs.load(std::memory_order_relaxed);
+    uint64_t seen = 0;
+    for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+        seen += counts[bucket];
+        if (seen >= rank) {
+            return std::min(GetBucketUpperBound(bucket), maxUs);
+        }
+    }
+    return maxUs;
+}
+
+uint64_t InputLatencyStatistic::GetCount(Stage stage, Source source)
+{
+    if ((stage < STAGE_SENSOR_TO_READ) || (stage >= STAGE_COUNT) || (source < SOURCE_KEY) ||
+        (source >= SOURCE_COUNT)) {
+        return 0;
+    }
+    return histograms_[stage][source].count.load(std::memory_order_relaxed);
+}
+
+void InputLatencyStatistic::Reset()
+{
+    for (auto &histograms : histograms_) {
+        for (auto &histogram : histograms) {
+            histogram.count.store(0, std::memory_order_relaxed);
+            histogram.maxUs.store(0, std::memory_order_relaxed);
+            for (auto &bucket : histogram.buckets) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+void InputLatencyStatistic::Dump(int32_t fd)
+{
+    mprintf(fd, "Input latency(us):");
+    for (int32_t stage = STAGE_SENSOR_TO_READ; stage < STAGE_COUNT; ++stage) {
+        for (int32_t source = SOURCE_KEY; source < SOURCE_COUNT; ++source) {
+            uint64_t count = GetCount(static_cast<Stage>(stage), static_cast<Source>(source));
+            if (count == 0) {
+                continue;
+            }
+            auto percentile = [stage, source](uint32_t perMille) {
+                return GetPercentile(static_cast<Stage>(stage), static_cast<Source>(source), perMille);
+            };
+            mprintf(fd, "\tstage:%s source:%s count:%" PRIu64 " p50:%" PRIu64 " p90:%" PRIu64 " p99:%" PRIu64
+                " p99.9:%" PRIu64 " max:%" PRIu64, GetStageName(stage), GetSourceName(source), count,
+                percentile(PER_MILLE_50), percentile(PER_MILLE_90), percentile(PER_MILLE_99),
+                percentile(PER_MILLE_999), histograms_[stage][source].maxUs.load(std::memory_order_relaxed));
+        }
+    }
+}
+
+InputLatencyStatistic::Source InputLatencyStatistic::GetSource(std::shared_ptr<PointerEvent> pointerEvent)
+{
+    if (pointerEvent == nullptr) {
+        return SOURCE_OTHER;
+    }
+    switch (pointerEvent->GetSourceType()) {
+        case PointerEvent::SOURCE_TYPE_MOUSE: {
+            return SOURCE_MOUSE;
+        }
+        case PointerEvent::SOURCE_TYPE_TOUCHSCREEN: {
+            return SOURCE_TOUCHSCREEN;
+        }
+        case PointerEvent::SOURCE_TYPE_TOUCHPAD: {
+            return SOURCE_TOUCHPAD;
+        }
+        default: {
+            return SOURCE_OTHER;
+        }
+    }
+}
+
+// Values below SUB_BUCKETS get a bucket each, larger ones share one per quarter of their power of two.
+size_t InputLatencyStatistic::GetBucket(uint64_t latencyUs)
+{
+    if (latencyUs < static_cast<uint64_t>(SUB_BUCKETS)) {
+        return static_cast<size_t>(latencyUs);
+    }
+    int32_t exponent = UINT64_BITS - 1 - __builtin_clzll(latencyUs);
+    if (exponent > MAX_EXPONENT) {
+        return BUCKET_COUNT - 1;
+    }
+    size_t subBucket = static_cast<size_t>(latencyUs >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+    return static_cast<size_t>(exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + subBucket;
+}
+
+uint64_t InputLatencyStatistic::GetBucketUpperBound(size_t bucket)
+{
+    if (bucket < static_cast<size_t>(SUB_BUCKETS)) {
+        return static_cast<uint64_t>(bucket);
+    }
+    if (bucket >= BUCKET_COUNT - 1) {
+        return UINT64_MAX;
+    }
+    int32_t exponent = static_cast<int32_t>(bucket / SUB_BUCKETS) + SUB_BUCKET_BITS - 1;
+    uint64_t width = static_cast<uint64_t>(1) << (exponent - SUB_BUCKET_BITS);
+    uint64_t lower = (static_cast<uint64_t>(SUB_BUCKETS) + (bucket % SUB_BUCKETS)) * width;
+    return lower + width - 1;
+}
+
+const char* InputLatencyStatistic::GetStageName(int32_t stage)
+{
+    switch (stage) {
+        case STAGE_SENSOR_TO_READ: {
+            return "sensor_to_read";
+        }
+        case STAGE_NORMALIZE: {
+            return "normalize";
+        }
+        case STAGE_FILTER: {
+            return "filter";
+        }
+        case STAGE_INTERCEPTOR: {
+            return "interceptor";
+        }
+        case STAGE_KEY_COMMAND: {
+            return "key_command";
+        }
+        case STAGE_SUBSCRIBER: {
+            return "subscriber";
+        }
+        case STAGE_MONITOR: {
+            return "monitor";
+        }
+        case STAGE_WINDOW_TARGET: {
+            return "window_target";
+        }
+        case STAGE_SERIALIZE: {
+            return "serialize";
+        }
+        case STAGE_SEND: {
+            return "send";
+        }
+        case STAGE_CLIENT_ROUND_TRIP: {
+            return "client_round_trip";
+        }
+        default: {
+            return "unknown";
+        }
+    }
+}
+
+const char* InputLatencyStatistic::GetSourceName(int32_t source)
+{
+    switch (source) {
+        case SOURCE_KEY: {
+            return "key";
+        }
+        case SOURCE_MOUSE: {
+            return "mouse";
+        }
+        case SOURCE_TOUCHSCREEN: {
+            return "touchscreen";
+        }
+        case SOURCE_TOUCHPAD: {
+            return "touchpad";
+        }
+        default: {
+            return "other";
+        }
+    }
+}
+} // namespace MMI
+} // namespace OHOS
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "input_pipeline_statistic.h"
+
+#include <cinttypes>
+
+#include "util_ex.h"
+
+#undef MMI_LOG_DOMAIN
+#define MMI_LOG_DOMAIN MMI_LOG_SERVER
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "InputPipelineStatistic"
+
+namespace OHOS {
+namespace MMI {
+std::atomic<size_t> InputPipelineStatistic::ringCapacity_ { 0 };
+std::atomic<size_t> InputPipelineStatistic::queueDepth_ { 0 };
+std::atomic<size_t> InputPipelineStatistic::maxQueueDepth_ { 0 };
+std::atomic<uint64_t> InputPipelineStatistic::ringFullCount_ { 0 };
+InputPipelineStatistic::StageCounter InputPipelineStatistic::stages_[STAGE_COUNT];
+
+void InputPipelineStatistic::SetEnabled(size_t ringCapacity)
+{
+    ringCapacity_.store(ringCapacity, std::memory_order_relaxed);
+}
+
+bool InputPipelineStatistic::IsEnabled()
+{
+    return (ringCapacity_.load(std::memory_order_relaxed) != 0);
+}
+
+void InputPipelineStatistic::RecordLatency(Stage stage, int64_t latencyUs)
+{
+    if ((stage < STAGE_READ) || (stage >= STAGE_COUNT)) {
+        return;
+    }
+    uint64_t latency = (latencyUs > 0) ? static_cast<uint64_t>(latencyUs) : 0;
+    StageCounter &counter = stages_[stage];
+    counter.count.fetch_add(1, std::memory_order_relaxed);
+    counter.totalUs.fetch_add(latency, std::memory_order_relaxed);
+    uint64_t maxUs = counter.maxUs.load(std::memory_order_relaxed);
+    while ((latency > maxUs) && !counter.maxUs.compare_exchange_weak(maxUs, latency, std::memory_order_relaxed)) {}
+}
+
+void InputPipelineStatistic::RecordQueueDepth(size_t depth)
+{
+    queueDepth_.store(depth, std::memory_order_relaxed);
+    size_t maxDepth = maxQueueDepth_.load(std::memory_order_relaxed);
+    while ((depth > maxDepth) && !maxQueueDepth_.compare_exchange_weak(maxDepth, depth, std::memory_order_relaxed)) {}
+}
+
+void InputPipelineStatistic::RecordRingFull()
+{
+    ringFullCount_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void InputPipelineStatistic::Reset()
+{
+    queueDepth_.store(0, std::memory_order_relaxed);
+    maxQueueDepth_.store(0, std::memory_order_relaxed);
+    ringFullCount_.store(0, std::memory_order_relaxed);
+    for (auto &counter : stages_) {
+        counter.count.store(0, std::memory_order_relaxed);
+        counter.totalUs.store(0, std::memory_order_relaxed);
+        counter.maxUs.store(0, std::memory_order_relaxed);
+    }
+}
+
+void InputPipelineStatistic::Dump(int32_t fd)
+{
+    if (!IsEnabled()) {
+        return;
+    }
+    mprintf(fd, "Input pipeline:\n");
+    mprintf(fd, "\tqueue depth:%zu max depth:%zu capacity:%zu ring full:%" PRIu64 "\n",
+        queueDepth_.load(std::memory_order_relaxed), maxQueueDepth_.load(std::memory_order_relaxed),
+        ringCapacity_.load(std::memory_order_relaxed), ringFullCount_.load(std::memory_order_relaxed));
+    for (int32_t stage = STAGE_READ; stage < STAGE_COUNT; ++stage) {
+        const StageCounter &counter = stages_[stage];
+        uint64_t count = counter.count.load(std::memory_order_relaxed);
+        uint64_t totalUs = counter.totalUs.load(std::memory_order_relaxed);
+        mprintf(fd, "\tstage:%s count:%" PRIu64 " avg:%" PRIu64 "us max:%" PRIu64 "us\n", GetStageName(stage),
+            count, (count == 0) ? 0 : (totalUs / count), counter.maxUs.load(std::memory_order_relaxed));
+    }
+}
+
+const char* InputPipelineStatistic::GetStageName(int32_t stage)
+{
+    switch (stage) {
+        case STAGE_READ: {
+            return "read";
+        }
+        case STAGE_QUEUE: {
+            return "queue";
+        }
+        case STAGE_DISPATCH: {
+            return "dispatch";
+        }
+        default: {
+            return "unknown";
+        }
+    }
+}
+} // namespace MMI
+} // namespace OHOS
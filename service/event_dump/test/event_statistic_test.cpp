@@ -12,6 +12,11 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+
+#include <fcntl.h>
+#include <fstream>
+#include <sys/stat.h>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -29,7 +34,13 @@ constexpr int32_t EVENT_OUT_SIZE { 30 };
 constexpr int32_t RING_BUFFER_SIZE { 60 };
 const char* EVENT_FILE_NAME = "/data/service/el1/public/multimodalinput/multimodal_event.dmp";
 const char* EVENT_FILE_NAME_HISTORY = "/data/service/el1/public/multimodalinput/multimodal_event_history.dmp";
-constexpr int32_t FILE_MAX_SIZE = 100 * 1024 * 1024;
+constexpr size_t JOURNAL_WINDOW_RECORDS { 4096 };
+
+const EventJournalRecord &GetLastRecord()
+{
+    size_t last = EventStatistic::dumperHead_ + EventStatistic::dumperSize_ + EVENT_OUT_SIZE - 1;
+    return EventStatistic::dumperRecords_[last % EVENT_OUT_SIZE];
+}
 } // namespace
 
 class EventStatisticTest : public testing::Test {
@@ -145,25 +156,29 @@ HWTEST_F(EventStatisticTest, EventStatisticTest_PushSwitchEvent, TestSize.Level1
 }
 
 /**
- * @tc.name: EventDumpTest_PushEventStr
- * @tc.desc: Event dump PushEventStr
+ * @tc.name: EventDumpTest_PushRecord
+ * @tc.desc: Event dump PushRecord queues records for the journal only while writing is enabled
  * @tc.type: FUNC
  * @tc.require:
  */
-HWTEST_F(EventStatisticTest, EventStatisticTest_PushEventStr, TestSize.Level1)
+HWTEST_F(EventStatisticTest, EventStatisticTest_PushRecord, TestSize.Level1)
 {
     CALL_TEST_DEBUG;
     EventStatistic eventStatistic;
+    eventStatistic.journalSize_ = 0;
+    eventStatistic.dumperSize_ = 0;
+    EventJournalRecord record {};
+    record.kind = EventJournalRecord::KIND_SWITCH;
     eventStatistic.writeFileEnabled_ = true;
-    std::string str = "test_push_event_str";
-    ASSERT_NO_FATAL_FAILURE(eventStatistic.PushEventStr(str));
+    ASSERT_NO_FATAL_FAILURE(eventStatistic.PushRecord(record));
+    EXPECT_EQ(eventStatistic.journalSize_, 1);
+    EXPECT_EQ(eventStatistic.dumperSize_, 1);
 
-    for (auto i = 0; i < EVENT_OUT_SIZE - 1; i++) {
-        auto inputEvent1 = std::make_shared<InputEvent>(2);
-        eventStatistic.dumperEventList_.push_back(EventStatistic::ConvertInputEventToStr(inputEvent1));
-    }
     eventStatistic.writeFileEnabled_ = false;
-    ASSERT_NO_FATAL_FAILURE(eventStatistic.PushEventStr(str));
+    ASSERT_NO_FATAL_FAILURE(eventStatistic.PushRecord(record));
+    EXPECT_EQ(eventStatistic.journalSize_, 1);
+    EXPECT_EQ(eventStatistic.dumperSize_, 2);
+    eventStatistic.journalSize_ = 0;
 }
 
 /**
@@ -179,9 +194,9 @@ HWTEST_F(EventStatisticTest, EventStatisticTest_Dump, TestSize.Level1)
     int32_t fd = 0;
     std::vector<std::string> dumpStr;
     for (auto i = 0; i < 5; i++) {
-        std::string str = "EventStatistic Test Dump ";
-        eventStatistic.dumperEventList_.push_back(str);
-        dumpStr.push_back(str);
+        auto switchEvent = std::make_shared<SwitchEvent>(i);
+        eventStatistic.PushSwitchEvent(switchEvent);
+        dumpStr.push_back("EventStatistic Test Dump ");
     }
     ASSERT_NO_FATAL_FAILURE(eventStatistic.Dump(fd, dumpStr));
 }
@@ -653,7 +668,7 @@ HWTEST_F(EventStatisticTest, EventStatisticTest_PushKeyEvent_PrivacyUnicode_001,
 {
     CALL_TEST_DEBUG;
     EventStatistic eventStatistic;
-    eventStatistic.dumperEventList_.clear();
+    eventStatistic.dumperSize_ = 0;
     auto keyEvent = KeyEvent::Create();
     keyEvent->SetAction(KeyEvent::KEY_ACTION_DOWN);
     keyEvent->SetKeyCode(7777);
@@ -665,8 +680,8 @@ HWTEST_F(EventStatisticTest, EventStatisticTest_PushKeyEvent_PrivacyUnicode_001,
 
     eventStatistic.PushKeyEvent(keyEvent);
 
-    ASSERT_EQ(eventStatistic.dumperEventList_.size(), 1);
-    const std::string &eventStr = eventStatistic.dumperEventList_.back();
+    ASSERT_EQ(eventStatistic.dumperSize_, 1);
+    std::string eventStr = eventStatistic.ConvertRecordToStr(GetLastRecord());
     EXPECT_NE(eventStr.find("keyCode:***"), std::string::npos);
     EXPECT_NE(eventStr.find("unicode:***"), std::string::npos);
     EXPECT_EQ(eventStr.find("7777"), std::string::npos);
@@ -683,7 +698,7 @@ HWTEST_F(EventStatisticTest, EventStatisticTest_PushKeyEvent_NonPrivacyUnicode_0
 {
     CALL_TEST_DEBUG;
     EventStatistic eventStatistic;
-    eventStatistic.dumperEventList_.clear();
+    eventStatistic.dumperSize_ = 0;
     auto keyEvent = KeyEvent::Create();
     keyEvent->SetAction(KeyEvent::KEY_ACTION_DOWN);
     keyEvent->SetKeyCode(7777);
@@ -694,8 +709,8 @@ HWTEST_F(EventStatisticTest, EventStatisticTest_PushKeyEvent_NonPrivacyUnicode_0
 
     eventStatistic.PushKeyEvent(keyEvent);
 
-    ASSERT_EQ(eventStatistic.dumperEventList_.size(), 1);
-    const std::string &eventStr = eventStatistic.dumperEventList_.back();
+    ASSERT_EQ(eventStatistic.dumperSize_, 1);
+    std::string eventStr = eventStatistic.ConvertRecordToStr(GetLastRecord());
     EXPECT_NE(eventStr.find("keyCode:7777"), std::string::npos);
     EXPECT_NE(eventStr.find("unicode:9731"), std::string::npos);
 }
@@ -1014,57 +1029,62 @@ HWTEST_F(EventStatisticTest, EventStatisticTest_PushPointerRecord_MaxCapacity, T
 }
 
 /**
- * @tc.name: EventStatisticTest_PopEvent_001
- * @tc.desc: Verify PopEvent returns the correct event string when queue is not empty.
+ * @tc.name: EventStatisticTest_PopRecords_001
+ * @tc.desc: Verify PopRecords takes every queued record in order.
  * @tc.type: FUNC
  * @tc.require:
  */
-HWTEST_F(EventStatisticTest, EventStatisticTest_PopEvent_001, TestSize.Level1)
+HWTEST_F(EventStatisticTest, EventStatisticTest_PopRecords_001, TestSize.Level1)
 {
     CALL_TEST_DEBUG;
     EventStatistic eventStatistic;
-    {
-        std::lock_guard<std::mutex> lock(eventStatistic.queueMutex_);
-        while (!eventStatistic.eventQueue_.empty()) {
-            eventStatistic.eventQueue_.pop();
-        }
-        eventStatistic.eventQueue_.push("TestEvent1");
-        eventStatistic.queueCondition_.notify_one();
+    eventStatistic.journalSize_ = 0;
+    eventStatistic.SetWriteFileEnabled(true);
+    EventJournalRecord record {};
+    record.kind = EventJournalRecord::KIND_SWITCH;
+    for (int32_t i = 0; i < 3; i++) {
+        record.switchEvent.switchValue = i;
+        eventStatistic.PushRecord(record);
     }
-    std::string eventStr = eventStatistic.PopEvent();
-    EXPECT_EQ(eventStr, "TestEvent1");
+    std::vector<EventJournalRecord> records;
+    EXPECT_TRUE(eventStatistic.PopRecords(records));
+    ASSERT_EQ(records.size(), 3);
+    EXPECT_EQ(records[0].switchEvent.switchValue, 0);
+    EXPECT_EQ(records[2].switchEvent.switchValue, 2);
+    EXPECT_EQ(eventStatistic.journalSize_, 0);
+    eventStatistic.SetWriteFileEnabled(false);
+    EXPECT_FALSE(eventStatistic.PopRecords(records));
 }
 
 /**
- * @tc.name: EventStatisticTest_PopEvent_002
- * @tc.desc: Verify PopEvent blocks until eventQueue_ is filled (using thread).
+ * @tc.name: EventStatisticTest_PopRecords_002
+ * @tc.desc: Verify PopRecords blocks until a record is pushed (using thread).
  * @tc.type: FUNC
  * @tc.require:
  */
-HWTEST_F(EventStatisticTest, EventStatisticTest_PopEvent_002, TestSize.Level1)
+HWTEST_F(EventStatisticTest, EventStatisticTest_PopRecords_002, TestSize.Level1)
 {
     CALL_TEST_DEBUG;
     EventStatistic eventStatistic;
-    {
-        std::lock_guard<std::mutex> lock(eventStatistic.queueMutex_);
-        while (!eventStatistic.eventQueue_.empty()) {
-            eventStatistic.eventQueue_.pop();
-        }
-    }
+    eventStatistic.journalSize_ = 0;
+    eventStatistic.SetWriteFileEnabled(true);
     std::thread producer([&eventStatistic]() {
         std::this_thread::sleep_for(std::chrono::milliseconds(50));
-        std::lock_guard<std::mutex> lock(eventStatistic.queueMutex_);
-        eventStatistic.eventQueue_.push("DelayedEvent");
-        eventStatistic.queueCondition_.notify_one();
+        EventJournalRecord record {};
+        record.kind = EventJournalRecord::KIND_KEY;
+        eventStatistic.PushRecord(record);
     });
-    std::string result = eventStatistic.PopEvent();
+    std::vector<EventJournalRecord> records;
+    EXPECT_TRUE(eventStatistic.PopRecords(records));
     producer.join();
-    EXPECT_EQ(result, "DelayedEvent");
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_EQ(records[0].kind, EventJournalRecord::KIND_KEY);
+    eventStatistic.SetWriteFileEnabled(false);
 }
 
 /**
  * @tc.name: EventStatisticTest_WriteEventFile_001
- * @tc.desc: Verify WriteEventFile writes event string into the file
+ * @tc.desc: Verify WriteEventFile writes the queued records into the journal
  * @tc.type: FUNC
  * @tc.require:
  */
@@ -1072,74 +1092,132 @@ HWTEST_F(EventStatisticTest, EventStatisticTest_WriteEventFile_001, TestSize.Lev
 {
     CALL_TEST_DEBUG;
     EventStatistic eventStatistic;
-    {
-        std::lock_guard<std::mutex> lock(eventStatistic.queueMutex_);
-        while (!eventStatistic.eventQueue_.empty()) {
-            eventStatistic.eventQueue_.pop();
-        }
-    }
+    eventStatistic.journalSize_ = 0;
     unlink(EVENT_FILE_NAME);
     unlink(EVENT_FILE_NAME_HISTORY);
-    {
-        std::lock_guard<std::mutex> lock(eventStatistic.queueMutex_);
-        eventStatistic.eventQueue_.push("TestEventFile");
-        eventStatistic.queueCondition_.notify_one();
-    }
-    eventStatistic.writeFileEnabled_ = true;
+    eventStatistic.SetWriteFileEnabled(true);
     std::thread writer([&eventStatistic]() {
         eventStatistic.WriteEventFile();
     });
+    auto switchEvent = std::make_shared<SwitchEvent>(1);
+    switchEvent->SetSwitchType(SwitchEvent::SWITCH_LID);
+    eventStatistic.PushSwitchEvent(switchEvent);
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    eventStatistic.writeFileEnabled_ = false;
-    {
-        std::lock_guard<std::mutex> lock(eventStatistic.queueMutex_);
-        eventStatistic.eventQueue_.push("Exit");
-        eventStatistic.queueCondition_.notify_one();
-    }
+    eventStatistic.SetWriteFileEnabled(false);
     writer.join();
-    std::ifstream file(EVENT_FILE_NAME);
-    ASSERT_TRUE(file.is_open());
-    std::string content;
-    std::getline(file, content);
-    file.close();
-    EXPECT_EQ(content, "TestEventFile");
+    std::vector<std::string> events;
+    int32_t count = EventJournal::Read(EVENT_FILE_NAME, [&events](const EventJournalRecord &record) {
+        events.push_back(EventStatistic::ConvertRecordToStr(record));
+    });
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_NE(events[0].find("switchValue:1,switchType:switch_lid}"), std::string::npos);
     unlink(EVENT_FILE_NAME);
     unlink(EVENT_FILE_NAME_HISTORY);
 }
 
 /**
  * @tc.name: EventStatisticTest_WriteEventFile_002
- * @tc.desc: Verify WriteEventFile rotates file when file exceeds FILE_MAX_SIZE
+ * @tc.desc: Verify the journal resumes after the records of an existing file and rotates once full
  * @tc.type: FUNC
  * @tc.require:
  */
 HWTEST_F(EventStatisticTest, EventStatisticTest_WriteEventFile_002, TestSize.Level1)
 {
     CALL_TEST_DEBUG;
-    EventStatistic eventStatistic;
+    unlink(EVENT_FILE_NAME);
+    unlink(EVENT_FILE_NAME_HISTORY);
+    EventJournalRecord record {};
+    record.kind = EventJournalRecord::KIND_SWITCH;
     {
-        std::ofstream bigFile(EVENT_FILE_NAME);
-        bigFile << std::string(FILE_MAX_SIZE + 10, 'X');
-        bigFile.close();
+        EventJournal journal(EVENT_FILE_NAME, EVENT_FILE_NAME_HISTORY, 0);
+        ASSERT_TRUE(journal.Append(record));
     }
-    {
-        std::lock_guard<std::mutex> lock(eventStatistic.queueMutex_);
-        eventStatistic.eventQueue_.push("RotateEvent");
-        eventStatistic.queueCondition_.notify_one();
+    EventJournal journal(EVENT_FILE_NAME, EVENT_FILE_NAME_HISTORY, 0);
+    ASSERT_TRUE(journal.Append(record));
+    journal.Close();
+    auto ignore = [](const EventJournalRecord &) {};
+    EXPECT_EQ(EventJournal::Read(EVENT_FILE_NAME, ignore), 2);
+
+    // The smallest journal holds one window, the header slot included.
+    int32_t windowRecords = static_cast<int32_t>(JOURNAL_WINDOW_RECORDS);
+    for (int32_t i = 0; i < windowRecords; i++) {
+        ASSERT_TRUE(journal.Append(record));
     }
-    eventStatistic.writeFileEnabled_ = true;
-    std::thread writer([&eventStatistic]() {
-        eventStatistic.WriteEventFile();
-    });
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    eventStatistic.writeFileEnabled_ = false;
+    journal.Close();
+    EXPECT_EQ(access(EVENT_FILE_NAME_HISTORY, F_OK), 0);
+    EXPECT_EQ(EventJournal::Read(EVENT_FILE_NAME_HISTORY, ignore), windowRecords - 1);
+    EXPECT_EQ(EventJournal::Read(EVENT_FILE_NAME, ignore), 3);
+    unlink(EVENT_FILE_NAME);
+    unlink(EVENT_FILE_NAME_HISTORY);
+}
+
+/**
+ * @tc.name: EventStatisticTest_WriteEventFile_003
+ * @tc.desc: Verify a full journal refuses records when it can not be renamed to the history file
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventStatisticTest, EventStatisticTest_WriteEventFile_003, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    unlink(EVENT_FILE_NAME);
+    unlink(EVENT_FILE_NAME_HISTORY);
+    // A directory that is not empty can neither be removed nor replaced by the rename.
+    std::string historyFile = std::string(EVENT_FILE_NAME_HISTORY) + "/history";
+    ASSERT_EQ(mkdir(EVENT_FILE_NAME_HISTORY, S_IRWXU), 0);
+    int32_t fd = open(historyFile.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    ASSERT_GE(fd, 0);
+    close(fd);
+
+    EventJournalRecord record {};
+    record.kind = EventJournalRecord::KIND_SWITCH;
+    EventJournal journal(EVENT_FILE_NAME, EVENT_FILE_NAME_HISTORY, 0);
+    int32_t windowRecords = static_cast<int32_t>(JOURNAL_WINDOW_RECORDS);
+    for (int32_t i = 1; i < windowRecords; i++) {
+        ASSERT_TRUE(journal.Append(record));
+    }
+    EXPECT_FALSE(journal.Append(record));
+    EXPECT_FALSE(journal.Append(record));
+    journal.Close();
+    auto ignore = [](const EventJournalRecord &) {};
+    EXPECT_EQ(EventJournal::Read(EVENT_FILE_NAME, ignore), windowRecords - 1);
+    struct stat statbuf {};
+    ASSERT_EQ(stat(EVENT_FILE_NAME, &statbuf), 0);
+    EXPECT_EQ(static_cast<size_t>(statbuf.st_size), JOURNAL_WINDOW_RECORDS * sizeof(EventJournalRecord));
+    unlink(historyFile.c_str());
+    rmdir(EVENT_FILE_NAME_HISTORY);
+    unlink(EVENT_FILE_NAME);
+}
+
+/**
+ * @tc.name: EventStatisticTest_WriteEventFile_004
+ * @tc.desc: Verify the text log of earlier versions is kept as the history file when the journal starts
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventStatisticTest, EventStatisticTest_WriteEventFile_004, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    unlink(EVENT_FILE_NAME);
+    unlink(EVENT_FILE_NAME_HISTORY);
+    const std::string textLog = "{\"eventType\":\"switch\"}\n";
     {
-        std::lock_guard<std::mutex> lock(eventStatistic.queueMutex_);
-        eventStatistic.eventQueue_.push("Exit");
-        eventStatistic.queueCondition_.notify_one();
+        std::ofstream file(EVENT_FILE_NAME);
+        ASSERT_TRUE(file.is_open());
+        file << textLog;
     }
-    writer.join();
-    EXPECT_EQ(access(EVENT_FILE_NAME_HISTORY, F_OK), 0);
+    EventJournalRecord record {};
+    record.kind = EventJournalRecord::KIND_SWITCH;
+    EventJournal journal(EVENT_FILE_NAME, EVENT_FILE_NAME_HISTORY, 0);
+    ASSERT_TRUE(journal.Append(record));
+    journal.Close();
+    auto ignore = [](const EventJournalRecord &) {};
+    EXPECT_EQ(EventJournal::Read(EVENT_FILE_NAME, ignore), 1);
+    std::ifstream history(EVENT_FILE_NAME_HISTORY);
+    ASSERT_TRUE(history.is_open());
+    std::string content((std::istreambuf_iterator<char>(history)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(content, textLog);
     unlink(EVENT_FILE_NAME);
     unlink(EVENT_FILE_NAME_HISTORY);
 }
@@ -1238,37 +1316,41 @@ HWTEST_F(EventStatisticTest, EventStatisticTest_PushSwitchEvent_Nullptr, TestSiz
 {
     CALL_TEST_DEBUG;
     EventStatistic eventStatistic;
-    eventStatistic.dumperEventList_.clear();
+    eventStatistic.dumperSize_ = 0;
     std::shared_ptr<SwitchEvent> nullEvent = nullptr;
     eventStatistic.PushSwitchEvent(nullEvent);
-    EXPECT_TRUE(eventStatistic.dumperEventList_.empty());
+    EXPECT_EQ(eventStatistic.dumperSize_, 0);
     std::shared_ptr<SwitchEvent> switchEvent = std::make_shared<SwitchEvent>(0);
     switchEvent->SetSwitchType(SwitchEvent::SWITCH_LID);
     eventStatistic.PushSwitchEvent(switchEvent);
-    EXPECT_FALSE(eventStatistic.dumperEventList_.empty());
+    EXPECT_EQ(eventStatistic.dumperSize_, 1);
 }
 
 /**
- * @tc.name: EventStatisticTest_PushEventStr_Overflow
- * @tc.desc: Verify PushEventStr pops front when dumperEventList_ exceeds EVENT_OUT_SIZE
+ * @tc.name: EventStatisticTest_PushRecord_Overflow
+ * @tc.desc: Verify PushRecord drops the oldest dumped record once EVENT_OUT_SIZE records are kept
  * @tc.type: FUNC
  * @tc.require:
  */
-HWTEST_F(EventStatisticTest, EventStatisticTest_PushEventStr_Overflow, TestSize.Level1)
+HWTEST_F(EventStatisticTest, EventStatisticTest_PushRecord_Overflow, TestSize.Level1)
 {
     CALL_TEST_DEBUG;
     EventStatistic eventStatistic;
     eventStatistic.writeFileEnabled_ = false;
-    eventStatistic.dumperEventList_.clear();
+    eventStatistic.dumperHead_ = 0;
+    eventStatistic.dumperSize_ = 0;
+    EventJournalRecord record {};
+    record.kind = EventJournalRecord::KIND_SWITCH;
     for (int32_t i = 0; i < EVENT_OUT_SIZE; i++) {
-        eventStatistic.dumperEventList_.push_back("fill_" + std::to_string(i));
+        record.switchEvent.switchValue = i;
+        eventStatistic.PushRecord(record);
     }
-    EXPECT_EQ(eventStatistic.dumperEventList_.size(), static_cast<size_t>(EVENT_OUT_SIZE));
-    std::string firstItem = eventStatistic.dumperEventList_.front();
-    eventStatistic.PushEventStr("overflow_item");
-    EXPECT_EQ(eventStatistic.dumperEventList_.size(), static_cast<size_t>(EVENT_OUT_SIZE));
-    EXPECT_EQ(eventStatistic.dumperEventList_.back(), "overflow_item");
-    EXPECT_NE(eventStatistic.dumperEventList_.front(), firstItem);
+    EXPECT_EQ(eventStatistic.dumperSize_, static_cast<size_t>(EVENT_OUT_SIZE));
+    record.switchEvent.switchValue = EVENT_OUT_SIZE;
+    eventStatistic.PushRecord(record);
+    EXPECT_EQ(eventStatistic.dumperSize_, static_cast<size_t>(EVENT_OUT_SIZE));
+    EXPECT_EQ(GetLastRecord().switchEvent.switchValue, EVENT_OUT_SIZE);
+    EXPECT_EQ(eventStatistic.dumperRecords_[eventStatistic.dumperHead_].switchEvent.switchValue, 1);
 }
 
 /**
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "input_latency_statistic.h"
+#include "mmi_log.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "InputLatencyStatisticTest"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+constexpr uint32_t PER_MILLE_50 { 500 };
+constexpr uint32_t PER_MILLE_99 { 990 };
+constexpr uint32_t PER_MILLE_999 { 999 };
+constexpr int64_t SLOW_LATENCY_US { 10000 };
+constexpr int32_t FAST_COUNT { 99 };
+constexpr int64_t BEGIN_TIME_US { 1000000 };
+constexpr int64_t SENSOR_LATENCY_US { 300 };
+} // namespace
+
+class InputLatencyStatisticTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        InputLatencyStatistic::Reset();
+    }
+
+    void TearDown() override
+    {
+        InputLatencyStatistic::EndEvent();
+        InputLatencyStatistic::Reset();
+    }
+};
+
+/**
+ * @tc.name: InputLatencyStatisticTest_GetBucket_001
+ * @tc.desc: Each latency falls in a bucket whose upper bound is at least the latency and within a quarter of it
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputLatencyStatisticTest, InputLatencyStatisticTest_GetBucket_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    size_t lastBucket = 0;
+    for (uint64_t latency = 0; latency < (1U << 20); latency = latency * 2 + 1) {
+        size_t bucket = InputLatencyStatistic::GetBucket(latency);
+        uint64_t upperBound = InputLatencyStatistic::GetBucketUpperBound(bucket);
+        EXPECT_GE(bucket, lastBucket);
+        EXPECT_GE(upperBound, latency);
+        EXPECT_LE(upperBound, latency + latency / 4 + 1);
+        lastBucket = bucket;
+    }
+    EXPECT_EQ(InputLatencyStatistic::GetBucket(UINT64_MAX), InputLatencyStatistic::BUCKET_COUNT - 1);
+}
+
+/**
+ * @tc.name: InputLatencyStatisticTest_GetPercentile_001
+ * @tc.desc: Percentiles separate the slow tail from the bulk of the samples
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputLatencyStatisticTest, InputLatencyStatisticTest_GetPercentile_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    for (int32_t i = 0; i < FAST_COUNT; ++i) {
+        InputLatencyStatistic::Record(InputLatencyStatistic::STAGE_SEND, InputLatencyStatistic::SOURCE_KEY, 1);
+    }
+    InputLatencyStatistic::Record(InputLatencyStatistic::STAGE_SEND, InputLatencyStatistic::SOURCE_KEY,
+        SLOW_LATENCY_US);
+    EXPECT_EQ(InputLatencyStatistic::GetCount(InputLatencyStatistic::STAGE_SEND, InputLatencyStatistic::SOURCE_KEY),
+        FAST_COUNT + 1);
+    EXPECT_EQ(InputLatencyStatistic::GetPercentile(InputLatencyStatistic::STAGE_SEND,
+        InputLatencyStatistic::SOURCE_KEY, PER_MILLE_50), 1);
+    EXPECT_EQ(InputLatencyStatistic::GetPercentile(InputLatencyStatistic::STAGE_SEND,
+        InputLatencyStatistic::SOURCE_KEY, PER_MILLE_99), 1);
+    EXPECT_EQ(InputLatencyStatistic::GetPercentile(InputLatencyStatistic::STAGE_SEND,
+        InputLatencyStatistic::SOURCE_KEY, PER_MILLE_999), SLOW_LATENCY_US);
+    EXPECT_EQ(InputLatencyStatistic::GetPercentile(InputLatencyStatistic::STAGE_SEND,
+        InputLatencyStatistic::SOURCE_MOUSE, PER_MILLE_50), 0);
+}
+
+/**
+ * @tc.name: InputLatencyStatisticTest_EnterStage_001
+ * @tc.desc: Moving the cursor records the stage left under the source of the event
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputLatencyStatisticTest, InputLatencyStatisticTest_EnterStage_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto pointerEvent = PointerEvent::Create();
+    ASSERT_NE(pointerEvent, nullptr);
+    pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+    InputLatencyStatistic::BeginEvent(BEGIN_TIME_US, BEGIN_TIME_US - SENSOR_LATENCY_US);
+    InputLatencyStatistic::EnterStage(InputLatencyStatistic::STAGE_FILTER, pointerEvent);
+    InputLatencyStatistic::EnterStage(InputLatencyStatistic::STAGE_WINDOW_TARGET, pointerEvent);
+    InputLatencyStatistic::EndEvent();
+
+    auto source = InputLatencyStatistic::SOURCE_TOUCHSCREEN;
+    EXPECT_EQ(InputLatencyStatistic::GetCount(InputLatencyStatistic::STAGE_SENSOR_TO_READ, source), 1);
+    EXPECT_EQ(InputLatencyStatistic::GetPercentile(InputLatencyStatistic::STAGE_SENSOR_TO_READ, source,
+        PER_MILLE_50), SENSOR_LATENCY_US);
+    EXPECT_EQ(InputLatencyStatistic::GetCount(InputLatencyStatistic::STAGE_NORMALIZE, source), 1);
+    EXPECT_EQ(InputLatencyStatistic::GetCount(InputLatencyStatistic::STAGE_FILTER, source), 1);
+    EXPECT_EQ(InputLatencyStatistic::GetCount(InputLatencyStatistic::STAGE_WINDOW_TARGET, source), 1);
+    EXPECT_EQ(InputLatencyStatistic::GetCount(InputLatencyStatistic::STAGE_MONITOR, source), 0);
+}
+
+/**
+ * @tc.name: InputLatencyStatisticTest_EnterStage_002
+ * @tc.desc: Events handled outside BeginEvent and EndEvent, such as injected ones, are not recorded
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputLatencyStatisticTest, InputLatencyStatisticTest_EnterStage_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto keyEvent = KeyEvent::Create();
+    ASSERT_NE(keyEvent, nullptr);
+    InputLatencyStatistic::EnterStage(InputLatencyStatistic::STAGE_SUBSCRIBER, keyEvent);
+    InputLatencyStatistic::EndEvent();
+    for (int32_t stage = InputLatencyStatistic::STAGE_SENSOR_TO_READ; stage < InputLatencyStatistic::STAGE_COUNT;
+        ++stage) {
+        EXPECT_EQ(InputLatencyStatistic::GetCount(static_cast<InputLatencyStatistic::Stage>(stage),
+            InputLatencyStatistic::SOURCE_KEY), 0);
+    }
+}
+
+/**
+ * @tc.name: InputLatencyStatisticTest_Dump_001
+ * @tc.desc: Dump the recorded stages
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputLatencyStatisticTest, InputLatencyStatisticTest_Dump_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    InputLatencyStatistic::Record(InputLatencyStatistic::STAGE_CLIENT_ROUND_TRIP,
+        InputLatencyStatistic::SOURCE_OTHER, SLOW_LATENCY_US);
+    InputLatencyStatistic::Record(static_cast<InputLatencyStatistic::Stage>(InputLatencyStatistic::STAGE_COUNT),
+        InputLatencyStatistic::SOURCE_OTHER, SLOW_LATENCY_US);
+    EXPECT_NO_FATAL_FAILURE(InputLatencyStatistic::Dump(-1));
+}
+} // namespace MMI
+} // namespace OHOS
@@ -16,6 +16,9 @@
 #ifndef ANR_MANAGER_H
 #define ANR_MANAGER_H
 
+#include <map>
+#include <utility>
+
 #include "singleton.h"
 
 #include "uds_server.h"
@@ -36,12 +39,28 @@ public:
     void RemoveTimersByType(SessionPtr sess, int32_t type);
     void HandleAnrState(SessionPtr sess, int32_t type, int64_t currentTime);
 private:
+    // The oldest unacknowledged event of one session for one anr type, and when it times out.
+    struct AnrDeadline {
+        std::weak_ptr<UDSSession> sess;
+        int32_t eventId { -1 };
+        int64_t deadline { 0 };
+    };
+    using DeadlineKey = std::pair<int32_t, int32_t>;
+
     int32_t anrNoticedPid_ { -1 };
     UDSServer *udsServer_ { nullptr };
-    int32_t anrTimerCount_ { 0 };
     int32_t pid_ { -1 };
     int32_t anrEventId_ { -1 };
+    std::map<DeadlineKey, AnrDeadline> deadlines_;
+    int32_t checkTimerId_ { -1 };
+    int64_t checkTime_ { 0 };
     float getRatioValue();
+    int64_t GetAnrTimeout();
+    void UpdateDeadline(SessionPtr sess, int32_t type, int64_t currentTime);
+    void RemoveDeadline(SessionPtr sess, int32_t type);
+    void ScheduleDeadlineCheck();
+    void OnDeadlineCheck();
+    bool NotifyAnr(SessionPtr sess, int32_t type, int32_t eventId);
 };
 
 #define ANRMgr ::OHOS::DelayedSingleton<ANRManager>::GetInstance()
@@ -25,7 +25,7 @@ namespace OHOS {
 namespace MMI {
 class EventNormalizeHandler : public IInputEventHandler {
 public:
-    EventNormalizeHandler() = default;
+    EventNormalizeHandler();
     ~EventNormalizeHandler() = default;
     void HandleEvent(libinput_event* event, int64_t frameTime);
 #ifdef OHOS_BUILD_ENABLE_KEYBOARD
@@ -49,6 +49,9 @@ public:
     int32_t SetMoveEventFilters(bool flag);
 #endif // OHOS_BUILD_ENABLE_MOVE_EVENT_FILTERS
     void BypassChainAndDispatchDirectly(std::shared_ptr<PointerEvent> pointerEvent);
+#ifdef OHOS_BUILD_ENABLE_TOUCH
+    void SetTouchFrameAggregation(bool enable);
+#endif // OHOS_BUILD_ENABLE_TOUCH
 
 private:
     bool ShouldDispatchOnDeviceDisabled(struct libinput_event *event) const;
@@ -82,6 +85,12 @@ private:
     int32_t HandleMouseEvent(libinput_event* event);
     bool AfterInputEventNormalized(const std::shared_ptr<PointerEvent> pointerEvent);
     int32_t HandleTouchEvent(libinput_event* event, int64_t frameTime);
+#ifdef OHOS_BUILD_ENABLE_TOUCH
+    int32_t DispatchTouchEvent(libinput_event* event, std::shared_ptr<PointerEvent> pointerEvent, int64_t frameTime,
+        uint64_t changedSlots);
+    bool DeferTouchMotion(std::shared_ptr<PointerEvent> pointerEvent, int64_t frameTime);
+    void FlushTouchFrame(int64_t frameTime);
+#endif // OHOS_BUILD_ENABLE_TOUCH
     int32_t HandleSwitchInputEvent(libinput_event* event);
 #ifdef OHOS_BUILD_ENABLE_JOYSTICK
     int32_t HandleJoystickButtonEvent(libinput_event *event);
@@ -108,6 +117,12 @@ private:
     double currentPointDownPosX_ { 0.0 };
     double currentPointDownPosY_ { 0.0 };
     int64_t currentPointDownTime_ { 0 };
+    bool pluginCallbackInstalled_ { false };
+#ifdef OHOS_BUILD_ENABLE_TOUCH
+    bool aggregateTouchFrames_ { false };
+    std::shared_ptr<PointerEvent> pendingTouchEvent_ { nullptr };
+    uint64_t pendingTouchSlots_ { 0 };
+#endif // OHOS_BUILD_ENABLE_TOUCH
 #ifdef OHOS_BUILD_ENABLE_MOVE_EVENT_FILTERS
     bool moveEventFilterFlag_ { false };
     std::list<PointerEvent::PointerItem> lastTouchDownItems_;
@@ -13,12 +13,15 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <charconv>
+#include <cinttypes>
 #include "account_manager.h"
 #include "anr_manager.h"
 
 #include "dfx_hisysevent.h"
 #include "i_input_windows_manager.h"
+#include "input_latency_statistic.h"
 #include "parameters.h"
 #include "timer_manager.h"
 #include "uds_session.h"
@@ -33,8 +36,9 @@ namespace OHOS {
 namespace MMI {
 namespace {
 const char* FOUNDATION { "foundation" };
-constexpr int32_t MAX_TIMER_COUNT { 50 };
-constexpr int32_t TIME_CONVERT_RATIO { 1000 };
+constexpr int64_t TIME_CONVERT_RATIO { 1000 };
+// TimerManager clamps longer intervals, a deadline further away is reached by re-arming.
+constexpr int64_t MAX_CHECK_INTERVAL_MS { 10000 };
 static float g_inputUITimeoutRatio = 0.0f;
 constexpr float FLOAT_EPSILON = 0.01f;
 constexpr int32_t MAX_RATIO_SIZE = 4;
@@ -98,15 +102,16 @@ int32_t ANRManager::MarkProcessed(int32_t pid, int32_t eventType, int32_t eventI
         }
         return RET_ERR;
     }
-    std::list<int32_t> timerIds = sess->DelEvents(eventType, eventId);
-    for (int32_t item : timerIds) {
-        if (item != -1) {
-            TimerMgr->RemoveTimer(item);
-            anrTimerCount_--;
-            MMI_HILOGD("Remove anr timer, anr type:%{public}d, eventId:%{public}d, timer id:%{public}d,"
-                "count:%{public}d", eventType, eventId, item, anrTimerCount_);
-        }
+    // Clients acknowledge each event in order, so the oldest pending one is the event being acknowledged.
+    int64_t eventTime = sess->GetEarliestEventTime(eventType);
+    int64_t currentTime = GetSysClockTime();
+    if ((eventType == ANR_DISPATCH) && (eventTime > 0) && (eventTime <= currentTime)) {
+        InputLatencyStatistic::Record(InputLatencyStatistic::STAGE_CLIENT_ROUND_TRIP,
+            InputLatencyStatistic::SOURCE_OTHER, currentTime - eventTime);
     }
+    sess->DelEvents(eventType, eventId);
+    UpdateDeadline(sess, eventType, currentTime);
+    ScheduleDeadlineCheck();
 
     if (anrEventId_ == eventId) {
         anrEventId_ = -1;
@@ -118,20 +123,9 @@ int32_t ANRManager::MarkProcessed(int32_t pid, int32_t eventType, int32_t eventI
 void ANRManager::RemoveTimers(SessionPtr sess)
 {
     CHKPV(sess);
-    std::vector<int32_t> DispatchTimerIds = sess->GetTimerIds(ANR_DISPATCH);
-    for (int32_t item : DispatchTimerIds) {
-        if (item != -1) {
-            TimerMgr->RemoveTimer(item);
-            anrTimerCount_--;
-        }
-    }
-    std::vector<int32_t> MonitorTimerIds = sess->GetTimerIds(ANR_MONITOR);
-    for (int32_t item : MonitorTimerIds) {
-        if (item != -1) {
-            TimerMgr->RemoveTimer(item);
-            anrTimerCount_--;
-        }
-    }
+    RemoveDeadline(sess, ANR_DISPATCH);
+    RemoveDeadline(sess, ANR_MONITOR);
+    ScheduleDeadlineCheck();
 }
 
 void ANRManager::RemoveTimersByType(SessionPtr sess, int32_t type)
@@ -141,13 +135,8 @@ void ANRManager::RemoveTimersByType(SessionPtr sess, int32_t type)
         MMI_HILOGE("Remove times failed, your input parm is %{public}d, which is not legal", type);
         return;
     }
-    std::vector<int32_t> timerIds = sess->GetTimerIds(ANR_MONITOR);
-    for (int32_t item : timerIds) {
-        if (item != -1) {
-            TimerMgr->RemoveTimer(item);
-            anrTimerCount_--;
-        }
-    }
+    RemoveDeadline(sess, type);
+    ScheduleDeadlineCheck();
 }
 
 void ANRManager::AddTimer(int32_t type, int32_t id, int64_t currentTime, SessionPtr sess)
@@ -161,40 +150,136 @@ void ANRManager::AddTimer(int32_t type, int32_t id, int64_t currentTime, Session
         MMI_HILOGD("Not application event, skip. pid:%{public}d, anr type:%{public}d", sess->GetPid(), type);
         return;
     }
-    if (anrTimerCount_ >= MAX_TIMER_COUNT) {
-        MMI_HILOGD("Add timer failed, timer count reached the maximum number:%{public}d", MAX_TIMER_COUNT);
+    sess->SaveANREvent(type, id, currentTime, -1);
+    // An older unacknowledged event already holds the deadline of this session, it expires first.
+    if (deadlines_.find(std::make_pair(sess->GetFd(), type)) != deadlines_.end()) {
         return;
     }
-    int32_t timerId = TimerMgr->AddTimer(INPUT_UI_TIMEOUT_TIME * getRatioValue() / TIME_CONVERT_RATIO, 1,
-        [this, id, type, sess]() {
-        CHKPV(sess);
-        int32_t userId = ACCOUNT_MGR->GetAccountIdFromUid(sess->GetUid());
-        if (type == ANR_MONITOR || WIN_MGR->IsWindowVisible(sess->GetPid(), userId)) {
-            sess->SetAnrStatus(type, true);
-            anrEventId_ = id;
-            DfxHisysevent::ApplicationBlockInput(sess);
-            MMI_HILOG_FREEZEE("Application not responding. pid:%{public}d, anr type:%{public}d, eventId:%{public}d, "
-                "uid:%{private}d, userId:%{public}d", sess->GetPid(), type, id, sess->GetUid(), userId);
-            CHK_INVALID_RV(anrNoticedPid_, "Add anr timer failed, timer count reached the maximum number");
-            NetPacket pkt(MmiMessageId::NOTICE_ANR);
-            pkt << sess->GetPid();
-            pkt << id;
-            if (pkt.ChkRWError()) {
-                MMI_HILOGE("Packet write failed");
-                return;
-            }
-            auto fd = udsServer_->GetClientFd(anrNoticedPid_);
-            if (!udsServer_->SendMsg(fd, pkt)) {
-                MMI_HILOGE("Send message failed, errCode:%{public}d", MSG_SEND_FAIL);
-                return;
-            }
+    UpdateDeadline(sess, type, currentTime);
+    ScheduleDeadlineCheck();
+}
+
+int64_t ANRManager::GetAnrTimeout()
+{
+    return static_cast<int64_t>(INPUT_UI_TIMEOUT_TIME * getRatioValue());
+}
+
+void ANRManager::UpdateDeadline(SessionPtr sess, int32_t type, int64_t currentTime)
+{
+    CHKPV(sess);
+    DeadlineKey key = std::make_pair(sess->GetFd(), type);
+    int64_t timeout = GetAnrTimeout();
+    int64_t since = 0;
+    UDSSession::EventTime event;
+    // Events that already timed out were judged when their deadline expired, track the first one still pending.
+    if (sess->CheckAnrStatus(type) || !AddInt64(currentTime, 1 - timeout, since) ||
+        !sess->GetFirstEventSince(type, since, event)) {
+        deadlines_.erase(key);
+        return;
+    }
+    AnrDeadline &deadline = deadlines_[key];
+    deadline.sess = sess;
+    deadline.eventId = event.id;
+    if (!AddInt64(event.eventTime, timeout, deadline.deadline)) {
+        deadline.deadline = INT64_MAX;
+    }
+    MMI_HILOGD("Anr deadline, pid:%{public}d, anr type:%{public}d, eventId:%{public}d",
+        sess->GetPid(), type, event.id);
+}
+
+void ANRManager::RemoveDeadline(SessionPtr sess, int32_t type)
+{
+    CHKPV(sess);
+    deadlines_.erase(std::make_pair(sess->GetFd(), type));
+}
+
+void ANRManager::ScheduleDeadlineCheck()
+{
+    if (deadlines_.empty()) {
+        if (checkTimerId_ != -1) {
+            TimerMgr->RemoveTimer(checkTimerId_);
+            checkTimerId_ = -1;
         }
+        return;
+    }
+    int64_t earliest = INT64_MAX;
+    for (const auto &[key, deadline] : deadlines_) {
+        earliest = std::min(earliest, deadline.deadline);
+    }
+    if (checkTimerId_ != -1) {
+        if (earliest >= checkTime_) {
+            return;
+        }
+        TimerMgr->RemoveTimer(checkTimerId_);
+        checkTimerId_ = -1;
+    }
+    int64_t currentTime = GetSysClockTime();
+    int64_t delayMs = (earliest > currentTime) ?
+        std::min((earliest - currentTime + TIME_CONVERT_RATIO - 1) / TIME_CONVERT_RATIO, MAX_CHECK_INTERVAL_MS) : 0;
+    checkTimerId_ = TimerMgr->AddTimer(static_cast<int32_t>(delayMs), 1, [this]() {
+        checkTimerId_ = -1;
+        OnDeadlineCheck();
     }, "ANRManager");
-    CHK_INVALID_RV(timerId, "Add anr timer failed, timer count reached the maximum number");
-    anrTimerCount_++;
-    MMI_HILOGD("Add anr timer success, anr type:%{public}d, eventId:%{public}d, timer id:%{public}d, count:%{public}d",
-        type, id, timerId, anrTimerCount_);
-    sess->SaveANREvent(type, id, currentTime, timerId);
+    CHK_INVALID_RV(checkTimerId_, "Add anr timer failed");
+    checkTime_ = std::min(earliest, currentTime + delayMs * TIME_CONVERT_RATIO);
+    MMI_HILOGD("Add anr timer success, timer id:%{public}d, delay:%{public}" PRId64 "ms, deadlines:%{public}zu",
+        checkTimerId_, delayMs, deadlines_.size());
+}
+
+void ANRManager::OnDeadlineCheck()
+{
+    int64_t currentTime = GetSysClockTime();
+    std::vector<DeadlineKey> expiredKeys;
+    for (const auto &[key, deadline] : deadlines_) {
+        if (deadline.deadline <= currentTime) {
+            expiredKeys.push_back(key);
+        }
+    }
+    for (const auto &key : expiredKeys) {
+        auto iter = deadlines_.find(key);
+        if (iter == deadlines_.end()) {
+            continue;
+        }
+        SessionPtr sess = iter->second.sess.lock();
+        int32_t type = key.second;
+        if ((sess == nullptr) || NotifyAnr(sess, type, iter->second.eventId)) {
+            // Stay silent until the application acknowledges, MarkProcessed arms the next deadline.
+            deadlines_.erase(iter);
+            continue;
+        }
+        UpdateDeadline(sess, type, currentTime);
+    }
+    ScheduleDeadlineCheck();
+}
+
+bool ANRManager::NotifyAnr(SessionPtr sess, int32_t type, int32_t eventId)
+{
+    CHKPF(sess);
+    int32_t userId = ACCOUNT_MGR->GetAccountIdFromUid(sess->GetUid());
+    if (type != ANR_MONITOR && !WIN_MGR->IsWindowVisible(sess->GetPid(), userId)) {
+        return false;
+    }
+    sess->SetAnrStatus(type, true);
+    anrEventId_ = eventId;
+    DfxHisysevent::ApplicationBlockInput(sess);
+    MMI_HILOG_FREEZEE("Application not responding. pid:%{public}d, anr type:%{public}d, eventId:%{public}d, "
+        "uid:%{private}d, userId:%{public}d", sess->GetPid(), type, eventId, sess->GetUid(), userId);
+    if (anrNoticedPid_ < 0) {
+        MMI_HILOGE("Anr noticed pid is invalid");
+        return true;
+    }
+    NetPacket pkt(MmiMessageId::NOTICE_ANR);
+    pkt << sess->GetPid();
+    pkt << eventId;
+    if (pkt.ChkRWError()) {
+        MMI_HILOGE("Packet write failed");
+        return true;
+    }
+    auto fd = udsServer_->GetClientFd(anrNoticedPid_);
+    if (!udsServer_->SendMsg(fd, pkt)) {
+        MMI_HILOGE("Send message failed, errCode:%{public}d", MSG_SEND_FAIL);
+    }
+    return true;
 }
 
 bool ANRManager::TriggerANR(int32_t type, int64_t time, SessionPtr sess)
@@ -256,15 +341,11 @@ void ANRManager::HandleAnrState(SessionPtr sess, int32_t type, int64_t currentTi
         const auto &lastEvent = timeoutEvents.back();
         for (const auto &event : timeoutEvents) {
             if (event.id != lastEvent.id) {
-                auto timerIds = sess->DelEvents(type, event.id);
-                for (auto timerId : timerIds) {
-                    if (timerId != -1) {
-                        TimerMgr->RemoveTimer(timerId);
-                        anrTimerCount_--;
-                    }
-                }
+                sess->DelEvents(type, event.id);
             }
         }
+        UpdateDeadline(sess, type, currentTime);
+        ScheduleDeadlineCheck();
         MMI_HILOGD("Keep anr state. Last timeout event. Type:%{public}d, PID:%{public}d",
             type, sess->GetPid());
     }
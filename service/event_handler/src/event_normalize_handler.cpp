@@ -15,6 +15,7 @@
 
 #include "event_normalize_handler.h"
 
+#include <cstring>
 #include <unordered_set>
 
 #include "bytrace_adapter.h"
@@ -42,6 +43,7 @@
 #include "libinput_adapter.h"
 #include "mmi_log.h"
 #include "multimodal_input_preferences_manager.h"
+#include "notification_outbox.h"
 #include "time_cost_chk.h"
 #include "timer_manager.h"
 #include "touch_event_normalize.h"
@@ -145,6 +147,58 @@ const std::vector<int32_t> ALL_EVENT_TYPES = {
 constexpr int32_t MAX_N_PRESSED_KEYS { 10 };
 constexpr int32_t POINTER_MOVEFLAG = { 7 };
 constexpr int32_t INVALID_KEY_CODE { -1 };
+#ifdef OHOS_RSS_CLIENT
+void ReportTouchDownToResSched(const NotificationOutbox::Notification &notification)
+{
+    std::unordered_map<std::string, std::string> mapPayload;
+    auto begin = std::chrono::high_resolution_clock::now();
+    OHOS::ResourceSchedule::ResSchedClient::GetInstance().ReportData(
+        OHOS::ResourceSchedule::ResType::RES_TYPE_CLICK_RECOGNIZE,
+        OHOS::ResourceSchedule::ResType::ClickEventType::TOUCH_EVENT_DOWN_MMI,
+        mapPayload);
+    [[ maybe_unused ]] auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::high_resolution_clock::now() - begin).count();
+#ifdef OHOS_BUILD_ENABLE_DFX_RADAR
+    DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::RS_NOTIFY_TOUCH_EVENT, durationMS);
+#endif // OHOS_BUILD_ENABLE_DFX_RADAR
+}
+#endif // OHOS_RSS_CLIENT
+#ifdef OHOS_BUILD_ENABLE_TOUCH
+const char *TOUCH_FRAME_AGGREGATION_PARAM { "const.multimodalinput.touch_frame_aggregation" };
+constexpr int32_t MAX_TOUCH_SLOTS { 64 };
+
+uint64_t TouchSlotBit(int32_t slot)
+{
+    if ((slot < 0) || (slot >= MAX_TOUCH_SLOTS)) {
+        return 0;
+    }
+    return (uint64_t { 1 } << slot);
+}
+
+// Marks the pointers that changed in the frame, the pointer of the action always being one of them.
+void MarkChangedItems(PointerEvent &pointerEvent, uint64_t changedSlots)
+{
+    int32_t pointerId = pointerEvent.GetPointerId();
+    for (const auto &item : pointerEvent.GetPointerItems()) {
+        int32_t id = item.GetPointerId();
+        PointerEvent::PointerItem *target = pointerEvent.FindPointerItem(id);
+        if (target != nullptr) {
+            target->SetChanged((id == pointerId) || ((changedSlots & TouchSlotBit(id)) != 0));
+        }
+    }
+}
+#endif // OHOS_BUILD_ENABLE_TOUCH
+}
+
+EventNormalizeHandler::EventNormalizeHandler()
+{
+#ifdef OHOS_RSS_CLIENT
+    // Fingers landing in the same frame make one report.
+    NOTIFY_OUTBOX.SetSink(NotificationOutbox::CHANNEL_RES_SCHED_TOUCH, ReportTouchDownToResSched, true);
+#endif // OHOS_RSS_CLIENT
+#ifdef OHOS_BUILD_ENABLE_TOUCH
+    aggregateTouchFrames_ = OHOS::system::GetBoolParameter(TOUCH_FRAME_AGGREGATION_PARAM, false);
+#endif // OHOS_BUILD_ENABLE_TOUCH
 }
 
 #ifdef OHOS_BUILD_ENABLE_POINTER
@@ -181,11 +235,9 @@ void EventNormalizeHandler::HandleEvent(libinput_event* event, int64_t frameTime
         }
     }
     auto manager = InputPluginManager::GetInstance();
-    std::shared_ptr<IPluginData> data = std::make_shared<IPluginData>();
-    data->stage = InputPluginStage::INPUT_AFTER_NORMALIZED_LIBINPUT;
-    std::string name = libinput_device_get_name(device);
-    size_t pos = name.find("hand_status_dev");
-    if ((pos != std::string::npos) && (type == LIBINPUT_EVENT_MSDP)) {
+    auto data = InputPluginManager::AcquirePluginData(InputPluginStage::INPUT_AFTER_NORMALIZED_LIBINPUT);
+    const char *name = libinput_device_get_name(device);
+    if ((type == LIBINPUT_EVENT_MSDP) && (name != nullptr) && (std::strstr(name, "hand_status_dev") != nullptr)) {
         if (manager != nullptr) {
             manager->HandleEvent(event, data);
         }
@@ -197,10 +249,15 @@ void EventNormalizeHandler::HandleEvent(libinput_event* event, int64_t frameTime
             return;
         }
     }
+    // The stage data is done with; handing it back lets the stages below reuse their cached objects.
+    data.reset();
 
     TimeCostChk chk("HandleLibinputEvent", "overtime 1000(us)", MAX_INPUT_EVENT_TIME, type);
     if (type == LIBINPUT_EVENT_TOUCH_FRAME) {
         MMI_HILOGD("This touch event is LIBINPUT_EVENT_TOUCH_FRAME type:%{public}d", type);
+#ifdef OHOS_BUILD_ENABLE_TOUCH
+        FlushTouchFrame(frameTime);
+#endif // OHOS_BUILD_ENABLE_TOUCH
         return;
     }
 #ifdef OHOS_BUILD_ENABLE_TOUCHPAD
@@ -688,8 +745,7 @@ bool EventNormalizeHandler::AfterInputEventNormalized(const std::shared_ptr<Poin
         nextHandler_->HandlePointerEvent(pointerEvent);
         return false;
     }
-    auto pData = std::make_shared<IPluginData>();
-    pData->stage = InputPluginStage::INPUT_AFTER_NORMALIZED;
+    auto pData = InputPluginManager::AcquirePluginData(InputPluginStage::INPUT_AFTER_NORMALIZED);
     int64_t startTime = GetSysClockTime();
     MMI_HILOGD("Plugin processing start, startTime:%{public}" PRId64 "", startTime);
     int32_t result = manager->HandleEvent(pointerEvent, pData);
@@ -848,27 +904,19 @@ int32_t EventNormalizeHandler::HandleTouchEvent(libinput_event* event, int64_t f
     CHKPR(event, ERROR_NULL_POINTER);
 #ifdef OHOS_RSS_CLIENT
     if (libinput_event_get_type(event) == LIBINPUT_EVENT_TOUCH_DOWN) {
-        std::unordered_map<std::string, std::string> mapPayload;
-        auto begin = std::chrono::high_resolution_clock::now();
-        OHOS::ResourceSchedule::ResSchedClient::GetInstance().ReportData(
-            OHOS::ResourceSchedule::ResType::RES_TYPE_CLICK_RECOGNIZE,
-            OHOS::ResourceSchedule::ResType::ClickEventType::TOUCH_EVENT_DOWN_MMI,
-            mapPayload);
-        [[ maybe_unused ]] auto durationMS = std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::high_resolution_clock::now() - begin).count();
-#ifdef OHOS_BUILD_ENABLE_DFX_RADAR
-        DfxHisysevent::ReportApiCallTimes(ApiDurationStatistics::Api::RS_NOTIFY_TOUCH_EVENT, durationMS);
-#endif // OHOS_BUILD_ENABLE_DFX_RADAR
-        mapPayload.clear();
+        NOTIFY_OUTBOX.Post(NotificationOutbox::CHANNEL_RES_SCHED_TOUCH);
     }
 #endif
 #ifdef OHOS_BUILD_ENABLE_TOUCH
-    BytraceAdapter::StartPackageEvent("package touchEvent");
-    std::shared_ptr<PointerEvent> pointerEvent = nullptr;
-    LogTracer lt;
     auto touch = libinput_event_get_touch_event(event);
     CHKPR(touch, ERROR_NULL_POINTER);
     int32_t moveFlag = libinput_event_touch_get_move_flag(touch);
+    bool isMotion = (libinput_event_get_type(event) == LIBINPUT_EVENT_TOUCH_MOTION);
+    if (!isMotion || (moveFlag == POINTER_MOVEFLAG)) {
+        FlushTouchFrame(frameTime);
+    }
+    BytraceAdapter::StartPackageEvent("package touchEvent");
+    std::shared_ptr<PointerEvent> pointerEvent = nullptr;
     if (moveFlag == POINTER_MOVEFLAG) {
         pointerEvent = TOUCH_EVENT_HDR->OnLibInput(event, TouchEventNormalize::DeviceType::REMOTE_CONTROL);
         CHKPR(pointerEvent, ERROR_NULL_POINTER);
@@ -880,7 +928,70 @@ int32_t EventNormalizeHandler::HandleTouchEvent(libinput_event* event, int64_t f
         MMI_HILOGD("Tv Touch event is not Motion");
         return RET_OK;
     }
-    lt = LogTracer(pointerEvent->GetId(), pointerEvent->GetEventType(), pointerEvent->GetPointerAction());
+    if (isMotion && (moveFlag != POINTER_MOVEFLAG) && DeferTouchMotion(pointerEvent, frameTime)) {
+        BytraceAdapter::StopPackageEvent();
+        return RET_OK;
+    }
+    return DispatchTouchEvent(event, pointerEvent, frameTime, TouchSlotBit(pointerEvent->GetPointerId()));
+#else
+    MMI_HILOGW("Touchscreen device does not support");
+    return RET_OK;
+#endif // OHOS_BUILD_ENABLE_TOUCH
+}
+
+#ifdef OHOS_BUILD_ENABLE_TOUCH
+void EventNormalizeHandler::SetTouchFrameAggregation(bool enable)
+{
+    if (!enable) {
+        FlushTouchFrame(GetSysClockTime());
+    }
+    aggregateTouchFrames_ = enable;
+}
+
+/*
+ * The touch event of a device is updated in place for every slot, so a motion held back until the end of the
+ * frame carries the latest position of every finger when it is finally dispatched.
+ */
+bool EventNormalizeHandler::DeferTouchMotion(std::shared_ptr<PointerEvent> pointerEvent, int64_t frameTime)
+{
+    CHKPF(pointerEvent);
+    if (!aggregateTouchFrames_) {
+        return false;
+    }
+    uint64_t slotBit = TouchSlotBit(pointerEvent->GetPointerId());
+    if ((slotBit == 0) || ((pendingTouchEvent_ != nullptr) && (pendingTouchEvent_ != pointerEvent))) {
+        FlushTouchFrame(frameTime);
+    }
+    if (slotBit == 0) {
+        return false;
+    }
+    EndLogTraceId(pointerEvent->GetId());
+    pendingTouchEvent_ = pointerEvent;
+    pendingTouchSlots_ |= slotBit;
+    return true;
+}
+
+void EventNormalizeHandler::FlushTouchFrame(int64_t frameTime)
+{
+    if (pendingTouchEvent_ == nullptr) {
+        return;
+    }
+    std::shared_ptr<PointerEvent> pointerEvent = nullptr;
+    pointerEvent.swap(pendingTouchEvent_);
+    uint64_t changedSlots = 0;
+    std::swap(changedSlots, pendingTouchSlots_);
+    pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
+    BytraceAdapter::StartPackageEvent("package touchEvent");
+    DispatchTouchEvent(nullptr, pointerEvent, frameTime, changedSlots);
+}
+
+int32_t EventNormalizeHandler::DispatchTouchEvent(libinput_event* event, std::shared_ptr<PointerEvent> pointerEvent,
+    int64_t frameTime, uint64_t changedSlots)
+{
+    CHKPR(nextHandler_, ERROR_UNSUPPORT);
+    CHKPR(pointerEvent, ERROR_NULL_POINTER);
+    LogTracer lt(pointerEvent->GetId(), pointerEvent->GetEventType(), pointerEvent->GetPointerAction());
+    MarkChangedItems(*pointerEvent, changedSlots);
 
 #ifdef OHOS_BUILD_ENABLE_MOVE_EVENT_FILTERS
     if (HandleTouchEventWithFlag(pointerEvent)) {
@@ -914,23 +1025,30 @@ int32_t EventNormalizeHandler::HandleTouchEvent(libinput_event* event, int64_t f
         return RET_ERR;
     }
     if (!item.IsCanceled()) {
-        auto callback = [this](PluginEventType pluginEvent, int64_t frameTime) {
-            auto event = std::get_if<std::shared_ptr<PointerEvent>>(&pluginEvent);
-            if (!event) return;
-            this->nextHandler_->HandlePointerEvent(*event);
-        };
-        std::shared_ptr<IPluginData> pData = InputPluginManager::GetInstance()->GetPluginDataFromLibInput(event);
-        pData->stage = InputPluginStage::INPUT_AFTER_NORMALIZED;
         auto manager = InputPluginManager::GetInstance();
-        manager->PluginAssignmentCallBack(callback, InputPluginStage::INPUT_AFTER_NORMALIZED);
-        int32_t result = manager->HandleEvent(pointerEvent, pData);
+        if (!pluginCallbackInstalled_) {
+            auto callback = [this](PluginEventType pluginEvent, int64_t frameTime) {
+                auto event = std::get_if<std::shared_ptr<PointerEvent>>(&pluginEvent);
+                if (!event) return;
+                this->nextHandler_->HandlePointerEvent(*event);
+            };
+            manager->PluginAssignmentCallBack(callback, InputPluginStage::INPUT_AFTER_NORMALIZED);
+            pluginCallbackInstalled_ = true;
+        }
+        int32_t result = RET_NOTDO;
+        if (manager->HasSubscriber(InputPluginStage::INPUT_AFTER_NORMALIZED, pointerEvent)) {
+            // A motion delivered at the end of its frame no longer has a libinput event to take data from.
+            std::shared_ptr<IPluginData> pData = (event != nullptr) ? manager->GetPluginDataFromLibInput(event) :
+                InputPluginManager::AcquirePluginData(InputPluginStage::INPUT_AFTER_NORMALIZED, frameTime);
+            pData->stage = InputPluginStage::INPUT_AFTER_NORMALIZED;
+            result = manager->HandleEvent(pointerEvent, pData);
+        }
         if (result == RET_NOTDO) {
-            callback(pointerEvent, GetSysClockTime());
+            nextHandler_->HandlePointerEvent(pointerEvent);
         }
     }
 #ifdef OHOS_BUILD_ENABLE_VKEYBOARD
-    auto type = libinput_event_get_type(event);
-    if (type == LIBINPUT_EVENT_TOUCH_CANCEL) {
+    if ((event != nullptr) && (libinput_event_get_type(event) == LIBINPUT_EVENT_TOUCH_CANCEL)) {
         item.SetCanceled(true);
         pointerEvent->UpdatePointerItem(pointerEvent->GetPointerId(), item);
     }
@@ -938,11 +1056,9 @@ int32_t EventNormalizeHandler::HandleTouchEvent(libinput_event* event, int64_t f
     if ((pointerEvent != nullptr) && (event != nullptr)) {
         ResetTouchUpEvent(pointerEvent, event);
     }
-#else
-    MMI_HILOGW("Touchscreen device does not support");
-#endif // OHOS_BUILD_ENABLE_TOUCH
     return RET_OK;
 }
+#endif // OHOS_BUILD_ENABLE_TOUCH
 
 void EventNormalizeHandler::PointerEventSetPressedKeys(std::shared_ptr<PointerEvent> pointerEvent)
 {
@@ -1568,8 +1684,7 @@ bool EventNormalizeHandler::HandleTouchpadSyncEvent(libinput_event *event)
         MMI_HILOGI("InputPluginManager is null");
         return false;
     }
-    auto pData = std::make_shared<IPluginData>();
-    pData->stage = InputPluginStage::INPUT_BEFORE_NORMALIZED;
+    auto pData = InputPluginManager::AcquirePluginData(InputPluginStage::INPUT_BEFORE_NORMALIZED);
     int32_t result = manager->HandleEvent(event, pData);
     return result == RET_DO;
 }
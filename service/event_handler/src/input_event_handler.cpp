@@ -24,6 +24,7 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include "input_latency_statistic.h"
 #include "libinput.h"
 #include "key_command_handler.h"
 #include "timer_manager.h"
@@ -56,6 +57,48 @@ constexpr uint32_t KEY_COMPOSE { 127 };
 constexpr uint32_t KEY_RIGHTMETA { 126 };
 constexpr uint32_t KEY_LEFTMETA { 125 };
 #endif // OHOS_BUILD_ENABLE_TOUCHPAD
+
+// Sits in front of a handler of the chain and moves the latency cursor to its stage before passing the event on.
+class LatencyStageHandler final : public IInputEventHandler {
+public:
+    explicit LatencyStageHandler(InputLatencyStatistic::Stage stage) : stage_(stage) {}
+    ~LatencyStageHandler() override = default;
+#ifdef OHOS_BUILD_ENABLE_KEYBOARD
+    void HandleKeyEvent(const std::shared_ptr<KeyEvent> keyEvent) override
+    {
+        InputLatencyStatistic::EnterStage(stage_, keyEvent);
+        CHKPV(nextHandler_);
+        nextHandler_->HandleKeyEvent(keyEvent);
+    }
+#endif // OHOS_BUILD_ENABLE_KEYBOARD
+#ifdef OHOS_BUILD_ENABLE_POINTER
+    void HandlePointerEvent(const std::shared_ptr<PointerEvent> pointerEvent) override
+    {
+        InputLatencyStatistic::EnterStage(stage_, pointerEvent);
+        CHKPV(nextHandler_);
+        nextHandler_->HandlePointerEvent(pointerEvent);
+    }
+#endif // OHOS_BUILD_ENABLE_POINTER
+#ifdef OHOS_BUILD_ENABLE_TOUCH
+    void HandleTouchEvent(const std::shared_ptr<PointerEvent> pointerEvent) override
+    {
+        InputLatencyStatistic::EnterStage(stage_, pointerEvent);
+        CHKPV(nextHandler_);
+        nextHandler_->HandleTouchEvent(pointerEvent);
+    }
+#endif // OHOS_BUILD_ENABLE_TOUCH
+
+private:
+    InputLatencyStatistic::Stage stage_;
+};
+
+std::shared_ptr<IInputEventHandler> WithLatencyStage(InputLatencyStatistic::Stage stage,
+    std::shared_ptr<IInputEventHandler> handler)
+{
+    auto stageHandler = std::make_shared<LatencyStageHandler>(stage);
+    stageHandler->SetNext(handler);
+    return stageHandler;
+}
 } // namespace
 
 InputEventHandler::InputEventHandler()
@@ -101,7 +144,9 @@ void InputEventHandler::OnEvent(void *event, int64_t frameTime)
     }
 #endif // OHOS_BUILD_ENABLE_TOUCHPAD
     ResetLogTrace();
+    InputLatencyStatistic::BeginEvent(beginTime, static_cast<int64_t>(libinput_event_get_sensortime(lpEvent)));
     eventNormalizeHandler_->HandleEvent(lpEvent, frameTime);
+    InputLatencyStatistic::EndEvent();
     int64_t endTime = GetSysClockTime();
     int64_t lostTime = endTime - beginTime;
     if (lostTime >= TIMEOUT_MS) {
@@ -406,13 +451,13 @@ int32_t InputEventHandler::BuildInputHandlerChain()
     }
 #if defined(OHOS_BUILD_ENABLE_POINTER) || defined(OHOS_BUILD_ENABLE_TOUCH)
     eventFilterHandler_ = std::make_shared<EventFilterHandler>();
-    handler->SetNext(eventFilterHandler_);
+    handler->SetNext(WithLatencyStage(InputLatencyStatistic::STAGE_FILTER, eventFilterHandler_));
     handler = eventFilterHandler_;
 #endif // OHOS_BUILD_ENABLE_POINTER || OHOS_BUILD_ENABLE_TOUCH
 
 #ifdef OHOS_BUILD_ENABLE_INTERCEPTOR
     eventInterceptorHandler_ = std::make_shared<EventInterceptorHandler>();
-    handler->SetNext(eventInterceptorHandler_);
+    handler->SetNext(WithLatencyStage(InputLatencyStatistic::STAGE_INTERCEPTOR, eventInterceptorHandler_));
     handler = eventInterceptorHandler_;
 #endif // OHOS_BUILD_ENABLE_INTERCEPTOR
 
@@ -422,11 +467,11 @@ int32_t InputEventHandler::BuildInputHandlerChain()
     handler->SetNext(eventPreMonitorHandler_);
     handler = eventPreMonitorHandler_;
     eventKeyCommandHandler_ = std::make_shared<KeyCommandHandler>();
-    handler->SetNext(eventKeyCommandHandler_);
+    handler->SetNext(WithLatencyStage(InputLatencyStatistic::STAGE_KEY_COMMAND, eventKeyCommandHandler_));
     handler = eventKeyCommandHandler_;
 #endif // OHOS_BUILD_ENABLE_COMBINATION_KEY
     eventSubscriberHandler_ = std::make_shared<KeySubscriberHandler>();
-    handler->SetNext(eventSubscriberHandler_);
+    handler->SetNext(WithLatencyStage(InputLatencyStatistic::STAGE_SUBSCRIBER, eventSubscriberHandler_));
     handler = eventSubscriberHandler_;
 #endif // OHOS_BUILD_ENABLE_KEYBOARD
 #ifdef OHOS_BUILD_ENABLE_SWITCH
@@ -436,7 +481,7 @@ int32_t InputEventHandler::BuildInputHandlerChain()
 #endif // OHOS_BUILD_ENABLE_SWITCH
 #ifdef OHOS_BUILD_ENABLE_MONITOR
     eventMonitorHandler_ = std::make_shared<EventMonitorHandler>();
-    handler->SetNext(eventMonitorHandler_);
+    handler->SetNext(WithLatencyStage(InputLatencyStatistic::STAGE_MONITOR, eventMonitorHandler_));
     handler = eventMonitorHandler_;
 #endif // OHOS_BUILD_ENABLE_MONITOR
 #ifdef OHOS_BUILD_ENABLE_INPUT_EVENT_HOOK
@@ -445,7 +490,7 @@ int32_t InputEventHandler::BuildInputHandlerChain()
     handler = inputEventHookMgr_;
 #endif // OHOS_BUILD_ENABLE_INPUT_EVENT_HOOK
     eventDispatchHandler_ = std::make_shared<EventDispatchHandler>();
-    handler->SetNext(eventDispatchHandler_);
+    handler->SetNext(WithLatencyStage(InputLatencyStatistic::STAGE_WINDOW_TARGET, eventDispatchHandler_));
     return RET_OK;
 }
 
@@ -25,6 +25,7 @@
 #include "parameters.h"
 #include "proto.h"
 #include "timer_manager.h"
+#include "util.h"
 #include "window_manager.h"
 
 namespace OHOS {
@@ -299,7 +300,7 @@ HWTEST_F(AnrManagerTest, AnrManagerTest_AddTimer_003, TestSize.Level1)
 
 /**
  * @tc.name: AnrManagerTest_AddTimer_004
- * @tc.desc:Cover the else branch of the if (anrTimerCount_ >= MAX_TIMER_COUNT)
+ * @tc.desc: Verify only the oldest pending event of a session holds the anr deadline
  * @tc.type: FUNC
  * @tc.require:
  */
@@ -307,15 +308,19 @@ HWTEST_F(AnrManagerTest, AnrManagerTest_AddTimer_004, TestSize.Level1)
 {
     CALL_TEST_DEBUG;
     int32_t type = ANR_MONITOR;
-    int32_t id = 1;
-    int64_t currentTime = 100;
+    int64_t currentTime = GetSysClockTime();
     SessionPtr sess = std::make_shared<UDSSession>(PROGRAM_NAME, MODULE_TYPE, UDS_FD, UDS_UID, UDS_PID);
     sess->SetTokenType(TokenType::TOKEN_HAP);
-    ANRMgr->anrTimerCount_ = 51;
-    ASSERT_NO_FATAL_FAILURE(ANRMgr->AddTimer(type, id, currentTime, sess));
-
-    ANRMgr->anrTimerCount_ = 49;
-    ASSERT_NO_FATAL_FAILURE(ANRMgr->AddTimer(type, id, currentTime, sess));
+    ANRMgr->AddTimer(type, 1, currentTime, sess);
+    ANRMgr->AddTimer(type, 2, currentTime + 1, sess);
+    EXPECT_EQ(sess->GetEventsByType(type).size(), 2U);
+    auto iter = ANRMgr->deadlines_.find(std::make_pair(sess->GetFd(), type));
+    ASSERT_NE(iter, ANRMgr->deadlines_.end());
+    EXPECT_EQ(iter->second.eventId, 1);
+    EXPECT_NE(ANRMgr->checkTimerId_, -1);
+
+    ANRMgr->RemoveTimers(sess);
+    EXPECT_EQ(ANRMgr->deadlines_.find(std::make_pair(sess->GetFd(), type)), ANRMgr->deadlines_.end());
 }
 
 /**
@@ -127,7 +127,7 @@ InputPluginManager *InputPluginManager::GetInstance(const std::string &directory
     return mock_instance_plug;
 }
 
-int32_t InputPluginManager::HandleEvent(PluginEventType event, std::shared_ptr<IPluginData> data)
+int32_t InputPluginManager::HandleEvent(const PluginEventType &event, const std::shared_ptr<IPluginData> &data)
 {
     return mock_ret;
 }
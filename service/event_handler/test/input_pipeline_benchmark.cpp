@@ -0,0 +1,676 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <poll.h>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <linux/input.h>
+
+#include "anr_manager.h"
+#include "event_normalize_handler.h"
+#include "general_keyboard.h"
+#include "general_mouse.h"
+#include "general_touchpad.h"
+#include "general_touchscreen.h"
+#include "i_input_windows_manager.h"
+#include "input_device_manager.h"
+#include "input_event_handler.h"
+#include "libinput_wrapper.h"
+#include "old_display_info.h"
+#include "proto.h"
+#include "uds_server.h"
+#include "util.h"
+#include "virtual_device.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "InputPipelineBenchmark"
+
+namespace {
+std::atomic<int64_t> g_allocCount { 0 };
+} // namespace
+
+void *operator new(size_t size)
+{
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    void *ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr int32_t DISPLAY_ID { 0 };
+constexpr int32_t DISPLAY_WIDTH { 1920 };
+constexpr int32_t DISPLAY_HEIGHT { 1080 };
+constexpr int32_t DISPLAY_DPI { 240 };
+constexpr int32_t WINDOW_ID { 1 };
+constexpr int32_t POLL_TIMEOUT_MS { 100 };
+constexpr size_t DRAIN_BUFFER_SIZE { 64 * 1024 };
+constexpr size_t SAMPLES_PER_STAGE { 64 * 1024 };
+constexpr int32_t PERCENTILE_50 { 50 };
+constexpr int32_t PERCENTILE_99 { 99 };
+constexpr int32_t PERCENT { 100 };
+constexpr double NS_PER_US { 1000.0 };
+constexpr double NS_PER_S { 1000000000.0 };
+constexpr int32_t STROKE_STEPS { 64 };
+constexpr int32_t TOUCH_STEP { 100 };
+constexpr int32_t TOUCH_ORIGIN { 1000 };
+constexpr int32_t TOUCHPAD_STEP { 8 };
+constexpr int32_t TOUCHPAD_ORIGIN { 400 };
+constexpr int32_t MOUSE_STEP { 4 };
+constexpr int32_t N_FINGERS { 10 };
+constexpr int32_t MT_ABS_MAX { 4095 };
+constexpr int32_t FINGER_SPACING { 300 };
+constexpr int32_t FINGER_STEP { 4 };
+
+// Latency of each stage of the chain, from entering one handler to entering the next one.
+class StageClock {
+public:
+    int32_t AddStage(const std::string &name)
+    {
+        stages_.push_back(Stage { name, std::vector<int64_t>(SAMPLES_PER_STAGE), 0 });
+        return static_cast<int32_t>(stages_.size()) - 1;
+    }
+
+    void Reset()
+    {
+        for (auto &stage : stages_) {
+            stage.count = 0;
+        }
+    }
+
+    int64_t Begin()
+    {
+        current_ = NORMALIZE_STAGE;
+        begin_ = Now();
+        mark_ = begin_;
+        return begin_;
+    }
+
+    void Enter(int32_t stage)
+    {
+        int64_t now = Now();
+        AddSample(current_, now - mark_);
+        current_ = stage;
+        mark_ = now;
+    }
+
+    // Closes the last stage reached and returns the whole time spent in the chain.
+    int64_t End()
+    {
+        int64_t now = Now();
+        AddSample(current_, now - mark_);
+        AddSample(TOTAL_STAGE, now - begin_);
+        return now - begin_;
+    }
+
+    size_t GetCount(const std::string &name) const
+    {
+        for (const auto &stage : stages_) {
+            if (stage.name == name) {
+                return stage.count;
+            }
+        }
+        return 0;
+    }
+
+    void Report(benchmark::State &state)
+    {
+        for (auto &stage : stages_) {
+            size_t count = std::min(stage.count, SAMPLES_PER_STAGE);
+            if (count == 0) {
+                continue;
+            }
+            std::vector<int64_t> samples(stage.samples.begin(), stage.samples.begin() + count);
+            state.counters[stage.name + "_p50_us"] = Percentile(samples, PERCENTILE_50);
+            state.counters[stage.name + "_p99_us"] = Percentile(samples, PERCENTILE_99);
+        }
+    }
+
+    static constexpr int32_t TOTAL_STAGE { 0 };
+    static constexpr int32_t NORMALIZE_STAGE { 1 };
+
+private:
+    struct Stage {
+        std::string name;
+        std::vector<int64_t> samples;
+        size_t count { 0 };
+    };
+
+    static int64_t Now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static double Percentile(std::vector<int64_t> &samples, int32_t percent)
+    {
+        size_t index = (samples.size() - 1) * static_cast<size_t>(percent) / PERCENT;
+        std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+        return static_cast<double>(samples[index]) / NS_PER_US;
+    }
+
+    // Keeps the latest samples only, so that recording never allocates while the chain is measured.
+    void AddSample(int32_t stage, int64_t latencyNs)
+    {
+        if ((stage < 0) || (static_cast<size_t>(stage) >= stages_.size())) {
+            return;
+        }
+        Stage &target = stages_[stage];
+        target.samples[target.count % SAMPLES_PER_STAGE] = latencyNs;
+        ++target.count;
+    }
+
+    std::vector<Stage> stages_;
+    int32_t current_ { TOTAL_STAGE };
+    int64_t begin_ { 0 };
+    int64_t mark_ { 0 };
+};
+
+// Placed in front of each handler of the chain, marks the event entering it and passes the event on.
+class StageProbe final : public IInputEventHandler {
+public:
+    StageProbe(StageClock &clock, int32_t stage) : clock_(clock), stage_(stage) {}
+    ~StageProbe() override = default;
+
+#ifdef OHOS_BUILD_ENABLE_KEYBOARD
+    void HandleKeyEvent(const std::shared_ptr<KeyEvent> keyEvent) override
+    {
+        clock_.Enter(stage_);
+        CHKPV(nextHandler_);
+        nextHandler_->HandleKeyEvent(keyEvent);
+    }
+#endif // OHOS_BUILD_ENABLE_KEYBOARD
+#ifdef OHOS_BUILD_ENABLE_POINTER
+    void HandlePointerEvent(const std::shared_ptr<PointerEvent> pointerEvent) override
+    {
+        clock_.Enter(stage_);
+        CHKPV(nextHandler_);
+        nextHandler_->HandlePointerEvent(pointerEvent);
+    }
+#endif // OHOS_BUILD_ENABLE_POINTER
+#ifdef OHOS_BUILD_ENABLE_TOUCH
+    void HandleTouchEvent(const std::shared_ptr<PointerEvent> pointerEvent) override
+    {
+        clock_.Enter(stage_);
+        CHKPV(nextHandler_);
+        nextHandler_->HandleTouchEvent(pointerEvent);
+    }
+#endif // OHOS_BUILD_ENABLE_TOUCH
+
+private:
+    StageClock &clock_;
+    int32_t stage_ { StageClock::TOTAL_STAGE };
+};
+
+// Accepts the session socket without an epoll loop, nothing is read back from the client in this process.
+class BenchmarkUdsServer final : public UDSServer {
+protected:
+    int32_t AddEpoll(EpollEventType type, int32_t fd, bool readOnly = false) override
+    {
+        return RET_OK;
+    }
+};
+
+// A touchscreen with ten slots, the one of the test facility only reports a single contact.
+class VirtualMultiTouchscreen final : public VirtualDevice {
+public:
+    VirtualMultiTouchscreen() : VirtualDevice("Virtual MultiTouchScreen", BUS_USB, 0x6006, 0x6007)
+    {
+        eventTypes_ = { EV_ABS, EV_KEY };
+        properties_ = { INPUT_PROP_DIRECT };
+        keys_ = { BTN_TOUCH };
+        abs_ = { ABS_X, ABS_Y, ABS_MT_SLOT, ABS_MT_POSITION_X, ABS_MT_POSITION_Y, ABS_MT_TRACKING_ID };
+        SetAbsValue(AbsInfo { ABS_X, 0, MT_ABS_MAX, 0, 0 });
+        SetAbsValue(AbsInfo { ABS_Y, 0, MT_ABS_MAX, 0, 0 });
+        SetAbsValue(AbsInfo { ABS_MT_SLOT, 0, N_FINGERS - 1, 0, 0 });
+        SetAbsValue(AbsInfo { ABS_MT_POSITION_X, 0, MT_ABS_MAX, 0, 0 });
+        SetAbsValue(AbsInfo { ABS_MT_POSITION_Y, 0, MT_ABS_MAX, 0, 0 });
+        SetAbsValue(AbsInfo { ABS_MT_TRACKING_ID, 0, UINT16_MAX, 0, 0 });
+    }
+};
+
+class GeneralMultiTouchscreen final : public GeneralDevice {
+public:
+    bool SetUp() override
+    {
+        return (vTouchscreen_.SetUp() && OpenDevice(std::string("Virtual MultiTouchScreen")));
+    }
+
+    void Close() override
+    {
+        GeneralDevice::Close();
+        vTouchscreen_.Close();
+    }
+
+private:
+    VirtualMultiTouchscreen vTouchscreen_;
+};
+
+std::string GetStageName(const std::shared_ptr<IInputEventHandler> &handler)
+{
+    const std::vector<std::pair<std::shared_ptr<IInputEventHandler>, std::string>> names {
+        { InputHandler->GetInputActiveSubscriberHandler(), "active_subscriber" },
+        { InputHandler->GetFilterHandler(), "filter" },
+        { InputHandler->GetInterceptorHandler(), "interceptor" },
+        { InputHandler->GetEventPreMonitorHandler(), "pre_monitor" },
+        { InputHandler->GetKeyCommandHandler(), "key_command" },
+        { InputHandler->GetSubscriberHandler(), "key_subscriber" },
+        { InputHandler->GetSwitchSubscriberHandler(), "switch_subscriber" },
+        { InputHandler->GetMonitorHandler(), "monitor" },
+#ifdef OHOS_BUILD_ENABLE_INPUT_EVENT_HOOK
+        { InputHandler->GetInputEventHook(), "hook" },
+#endif // OHOS_BUILD_ENABLE_INPUT_EVENT_HOOK
+        { InputHandler->GetEventDispatchHandler(), "dispatch" },
+    };
+    for (const auto &[candidate, name] : names) {
+        if ((candidate != nullptr) && (candidate == handler)) {
+            return name;
+        }
+    }
+    return "unknown";
+}
+
+/*
+ * The service side of the pipeline as set up by MMIService: the real handler chain with a probe in front of
+ * each handler, one display with a fullscreen focused window, and the session of its owner, whose socket is
+ * drained by a thread playing the client.
+ */
+class PipelineFixture {
+public:
+    static PipelineFixture &GetInstance()
+    {
+        static PipelineFixture fixture;
+        return fixture;
+    }
+
+    ~PipelineFixture()
+    {
+        isRunning_ = false;
+        if (clientFd_ >= 0) {
+            shutdown(clientFd_, SHUT_RDWR);
+        }
+        if (drainer_.joinable()) {
+            drainer_.join();
+        }
+        for (const auto &path : devicePaths_) {
+            libinput_.RemovePath(path);
+        }
+    }
+
+    bool IsReady() const
+    {
+        return isReady_;
+    }
+
+    bool AddDevice(GeneralDevice &device)
+    {
+        std::string path = device.GetDevPath();
+        if (std::find(devicePaths_.begin(), devicePaths_.end(), path) != devicePaths_.end()) {
+            return true;
+        }
+        if (!device.SetUp()) {
+            return false;
+        }
+        path = device.GetDevPath();
+        if (!libinput_.AddPath(path)) {
+            return false;
+        }
+        devicePaths_.push_back(path);
+        for (libinput_event *event = libinput_.Dispatch(); event != nullptr; event = libinput_.Dispatch()) {
+            if (libinput_event_get_type(event) == LIBINPUT_EVENT_DEVICE_ADDED) {
+                INPUT_DEV_MGR->OnInputDeviceAdded(libinput_event_get_device(event));
+            }
+            libinput_event_destroy(event);
+        }
+        return true;
+    }
+
+    // Runs whatever libinput has queued through the chain, returns the number of events and their time.
+    int64_t Pump(int64_t &events, int64_t &allocs)
+    {
+        int64_t elapsed = 0;
+        for (libinput_event *event = libinput_.Dispatch(); event != nullptr; event = libinput_.Dispatch()) {
+            int64_t allocsBefore = g_allocCount.load(std::memory_order_relaxed);
+            clock_.Begin();
+            InputHandler->OnEvent(event, GetSysClockTime());
+            elapsed += clock_.End();
+            allocs += g_allocCount.load(std::memory_order_relaxed) - allocsBefore;
+            libinput_event_destroy(event);
+            ++events;
+        }
+        return elapsed;
+    }
+
+    StageClock &GetClock()
+    {
+        return clock_;
+    }
+
+private:
+    PipelineFixture()
+    {
+        if (!libinput_.Init()) {
+            return;
+        }
+        ANRMgr->Init(udsServer_);
+        InputHandler->Init(udsServer_);
+        InsertProbes();
+        SetUpWindow();
+        isReady_ = AddSession();
+    }
+
+    void InsertProbes()
+    {
+        clock_.AddStage("total");
+        std::shared_ptr<IInputEventHandler> handler = InputHandler->GetEventNormalizeHandler();
+        if (handler == nullptr) {
+            return;
+        }
+        clock_.AddStage("normalize");
+        while (handler->nextHandler_ != nullptr) {
+            std::shared_ptr<IInputEventHandler> next = handler->nextHandler_;
+            // The latency stage handlers of the service are not stages of their own, they count with the previous one.
+            if (std::string name = GetStageName(next); name != "unknown") {
+                auto probe = std::make_shared<StageProbe>(clock_, clock_.AddStage(name));
+                probe->SetNext(next);
+                handler->SetNext(probe);
+            }
+            handler = next;
+        }
+    }
+
+    void SetUpWindow()
+    {
+        OLD::DisplayGroupInfo displayGroupInfo;
+        displayGroupInfo.groupId = 0;
+        displayGroupInfo.type = GroupType::GROUP_DEFAULT;
+        displayGroupInfo.focusWindowId = WINDOW_ID;
+
+        OLD::DisplayInfo displayInfo;
+        displayInfo.id = DISPLAY_ID;
+        displayInfo.x = 0;
+        displayInfo.y = 0;
+        displayInfo.width = DISPLAY_WIDTH;
+        displayInfo.height = DISPLAY_HEIGHT;
+        displayInfo.dpi = DISPLAY_DPI;
+        displayInfo.name = "display0";
+        displayInfo.uniq = "default0";
+        displayInfo.direction = DIRECTION0;
+        displayGroupInfo.displaysInfo.push_back(displayInfo);
+
+        WindowInfo windowInfo;
+        windowInfo.id = WINDOW_ID;
+        windowInfo.pid = getpid();
+        windowInfo.uid = static_cast<int32_t>(getuid());
+        windowInfo.displayId = DISPLAY_ID;
+        windowInfo.area = { 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT };
+        windowInfo.defaultHotAreas = { windowInfo.area };
+        windowInfo.pointerHotAreas = { windowInfo.area };
+        windowInfo.flags = 0;
+        windowInfo.transform = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+        displayGroupInfo.windowsInfo.push_back(windowInfo);
+        WIN_MGR->UpdateDisplayInfo(displayGroupInfo);
+    }
+
+    // A native session skips ANR tracking, which would otherwise wait for replies this benchmark never sends.
+    bool AddSession()
+    {
+        int32_t serverFd = -1;
+        int32_t tokenType = TokenType::TOKEN_NATIVE;
+        auto closedFlag = std::make_shared<SocketPairFlag>();
+        if (udsServer_.AddSocketPairInfo("input_pipeline_benchmark", 0, static_cast<int32_t>(getuid()), getpid(),
+            serverFd, clientFd_, tokenType, 0, true, closedFlag) != RET_OK) {
+            return false;
+        }
+        drainer_ = std::thread([this] {
+            std::vector<char> buffer(DRAIN_BUFFER_SIZE);
+            while (isRunning_) {
+                struct pollfd pfd = { clientFd_, POLLIN, 0 };
+                if ((poll(&pfd, 1, POLL_TIMEOUT_MS) > 0) && (read(clientFd_, buffer.data(), buffer.size()) <= 0)) {
+                    break;
+                }
+            }
+        });
+        return true;
+    }
+
+    BenchmarkUdsServer udsServer_;
+    LibinputWrapper libinput_;
+    StageClock clock_;
+    std::vector<std::string> devicePaths_;
+    int32_t clientFd_ { -1 };
+    std::atomic_bool isRunning_ { true };
+    std::thread drainer_;
+    bool isReady_ { false };
+};
+
+using FrameWriter = std::function<void(GeneralDevice &device, int64_t frame)>;
+
+int64_t GetThreadCpuTime()
+{
+    struct timespec ts {};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * static_cast<int64_t>(NS_PER_S) + ts.tv_nsec;
+}
+
+/*
+ * Each iteration writes one evdev frame, then times the events libinput makes of it through the chain. Writing
+ * the frame and waiting for libinput stay out of the measured time. Every event handed to the dispatch stage
+ * ends in one send to the client, so dispatches per frame stand for the syscalls a frame costs.
+ */
+void RunPipeline(benchmark::State &state, GeneralDevice &device, const FrameWriter &writeFrame,
+    const FrameWriter &finishStroke)
+{
+    PipelineFixture &fixture = PipelineFixture::GetInstance();
+    if (!fixture.IsReady() || !fixture.AddDevice(device)) {
+        state.SkipWithError("The virtual device or the handler chain is not available");
+        return;
+    }
+    fixture.GetClock().Reset();
+    int64_t events = 0;
+    int64_t allocs = 0;
+    int64_t frame = 0;
+    int64_t cpuTime = 0;
+    for (auto _ : state) {
+        writeFrame(device, frame++);
+        int64_t cpuBefore = GetThreadCpuTime();
+        int64_t elapsed = fixture.Pump(events, allocs);
+        cpuTime += GetThreadCpuTime() - cpuBefore;
+        state.SetIterationTime(static_cast<double>(elapsed) / NS_PER_S);
+    }
+    size_t dispatches = fixture.GetClock().GetCount("dispatch");
+    int64_t unusedEvents = 0;
+    int64_t unusedAllocs = 0;
+    finishStroke(device, frame);
+    fixture.Pump(unusedEvents, unusedAllocs);
+
+    state.SetItemsProcessed(events);
+    state.counters["AllocsPerEvent"] = (events > 0) ? static_cast<double>(allocs) / events : 0.0;
+    if (frame > 0) {
+        state.counters["DispatchesPerFrame"] = static_cast<double>(dispatches) / frame;
+        state.counters["CpuPerFrame_us"] = static_cast<double>(cpuTime) / NS_PER_US / frame;
+    }
+    fixture.GetClock().Report(state);
+}
+
+int32_t StrokeOffset(int64_t frame, int32_t step)
+{
+    return static_cast<int32_t>(frame % STROKE_STEPS) * step;
+}
+
+void BM_TouchscreenMove(benchmark::State &state)
+{
+    static GeneralTouchscreen touchscreen;
+    RunPipeline(state, touchscreen, [](GeneralDevice &device, int64_t frame) {
+        if ((frame % STROKE_STEPS) == 0) {
+            device.SendEvent(EV_ABS, ABS_MT_SLOT, 0);
+            device.SendEvent(EV_ABS, ABS_MT_TRACKING_ID, -1);
+            device.SendEvent(EV_KEY, BTN_TOUCH, 0);
+            device.SendEvent(EV_SYN, SYN_REPORT, 0);
+            device.SendEvent(EV_ABS, ABS_MT_TRACKING_ID, static_cast<int32_t>(frame / STROKE_STEPS));
+            device.SendEvent(EV_KEY, BTN_TOUCH, 1);
+        }
+        device.SendEvent(EV_ABS, ABS_MT_POSITION_X, TOUCH_ORIGIN + StrokeOffset(frame, TOUCH_STEP));
+        device.SendEvent(EV_ABS, ABS_MT_POSITION_Y, TOUCH_ORIGIN + StrokeOffset(frame, TOUCH_STEP));
+        device.SendEvent(EV_SYN, SYN_REPORT, 0);
+    }, [](GeneralDevice &device, int64_t frame) {
+        device.SendEvent(EV_ABS, ABS_MT_TRACKING_ID, -1);
+        device.SendEvent(EV_KEY, BTN_TOUCH, 0);
+        device.SendEvent(EV_SYN, SYN_REPORT, 0);
+    });
+}
+BENCHMARK(BM_TouchscreenMove)->UseManualTime();
+
+// Ten fingers moving together, every frame reporting all of the slots.
+void RunTenFingerMove(benchmark::State &state, bool aggregate)
+{
+    static GeneralMultiTouchscreen touchscreen;
+    auto normalizeHandler = InputHandler->GetEventNormalizeHandler();
+    if (normalizeHandler == nullptr) {
+        state.SkipWithError("The handler chain is not available");
+        return;
+    }
+    normalizeHandler->SetTouchFrameAggregation(aggregate);
+    RunPipeline(state, touchscreen, [](GeneralDevice &device, int64_t frame) {
+        bool isNewStroke = ((frame % STROKE_STEPS) == 0);
+        if (isNewStroke && (frame > 0)) {
+            for (int32_t slot = 0; slot < N_FINGERS; ++slot) {
+                device.SendEvent(EV_ABS, ABS_MT_SLOT, slot);
+                device.SendEvent(EV_ABS, ABS_MT_TRACKING_ID, -1);
+            }
+            device.SendEvent(EV_KEY, BTN_TOUCH, 0);
+            device.SendEvent(EV_SYN, SYN_REPORT, 0);
+        }
+        for (int32_t slot = 0; slot < N_FINGERS; ++slot) {
+            device.SendEvent(EV_ABS, ABS_MT_SLOT, slot);
+            if (isNewStroke) {
+                device.SendEvent(EV_ABS, ABS_MT_TRACKING_ID,
+                    static_cast<int32_t>(((frame / STROKE_STEPS) * N_FINGERS + slot) % UINT16_MAX));
+            }
+            device.SendEvent(EV_ABS, ABS_MT_POSITION_X, slot * FINGER_SPACING + StrokeOffset(frame, FINGER_STEP));
+            device.SendEvent(EV_ABS, ABS_MT_POSITION_Y, TOUCH_ORIGIN + StrokeOffset(frame, FINGER_STEP));
+        }
+        if (isNewStroke) {
+            device.SendEvent(EV_KEY, BTN_TOUCH, 1);
+        }
+        device.SendEvent(EV_SYN, SYN_REPORT, 0);
+    }, [](GeneralDevice &device, int64_t frame) {
+        for (int32_t slot = 0; slot < N_FINGERS; ++slot) {
+            device.SendEvent(EV_ABS, ABS_MT_SLOT, slot);
+            device.SendEvent(EV_ABS, ABS_MT_TRACKING_ID, -1);
+        }
+        device.SendEvent(EV_KEY, BTN_TOUCH, 0);
+        device.SendEvent(EV_SYN, SYN_REPORT, 0);
+    });
+    normalizeHandler->SetTouchFrameAggregation(false);
+}
+
+// Each finger that moved in a frame is dispatched as a MOVE of its own.
+void BM_TenFingerMoveImmediate(benchmark::State &state)
+{
+    RunTenFingerMove(state, false);
+}
+BENCHMARK(BM_TenFingerMoveImmediate)->UseManualTime();
+
+// The moves of a frame are dispatched once, when libinput reports the end of the frame.
+void BM_TenFingerMoveAggregated(benchmark::State &state)
+{
+    RunTenFingerMove(state, true);
+}
+BENCHMARK(BM_TenFingerMoveAggregated)->UseManualTime();
+
+void BM_MouseMove(benchmark::State &state)
+{
+    static GeneralMouse mouse;
+    RunPipeline(state, mouse, [](GeneralDevice &device, int64_t frame) {
+        int32_t direction = (((frame / STROKE_STEPS) % 2) == 0) ? 1 : -1;
+        device.SendEvent(EV_REL, REL_X, direction * MOUSE_STEP);
+        device.SendEvent(EV_REL, REL_Y, direction * MOUSE_STEP);
+        device.SendEvent(EV_SYN, SYN_REPORT, 0);
+    }, [](GeneralDevice &device, int64_t frame) {});
+}
+BENCHMARK(BM_MouseMove)->UseManualTime();
+
+void BM_KeyboardPress(benchmark::State &state)
+{
+    static GeneralKeyboard keyboard;
+    RunPipeline(state, keyboard, [](GeneralDevice &device, int64_t frame) {
+        device.SendEvent(EV_KEY, KEY_A, ((frame % 2) == 0) ? 1 : 0);
+        device.SendEvent(EV_SYN, SYN_REPORT, 0);
+    }, [](GeneralDevice &device, int64_t frame) {
+        if ((frame % 2) == 1) {
+            device.SendEvent(EV_KEY, KEY_A, 0);
+            device.SendEvent(EV_SYN, SYN_REPORT, 0);
+        }
+    });
+}
+BENCHMARK(BM_KeyboardPress)->UseManualTime();
+
+void BM_TouchpadMove(benchmark::State &state)
+{
+    static GeneralTouchpad touchpad;
+    RunPipeline(state, touchpad, [](GeneralDevice &device, int64_t frame) {
+        if ((frame % STROKE_STEPS) == 0) {
+            device.SendEvent(EV_ABS, ABS_MT_SLOT, 0);
+            device.SendEvent(EV_ABS, ABS_MT_TRACKING_ID, -1);
+            device.SendEvent(EV_KEY, BTN_TOUCH, 0);
+            device.SendEvent(EV_KEY, BTN_TOOL_FINGER, 0);
+            device.SendEvent(EV_SYN, SYN_REPORT, 0);
+            device.SendEvent(EV_ABS, ABS_MT_TRACKING_ID, static_cast<int32_t>(frame / STROKE_STEPS));
+            device.SendEvent(EV_KEY, BTN_TOUCH, 1);
+            device.SendEvent(EV_KEY, BTN_TOOL_FINGER, 1);
+        }
+        device.SendEvent(EV_ABS, ABS_MT_POSITION_X, TOUCHPAD_ORIGIN + StrokeOffset(frame, TOUCHPAD_STEP));
+        device.SendEvent(EV_ABS, ABS_MT_POSITION_Y, TOUCHPAD_ORIGIN + StrokeOffset(frame, TOUCHPAD_STEP));
+        device.SendEvent(EV_SYN, SYN_REPORT, 0);
+    }, [](GeneralDevice &device, int64_t frame) {
+        device.SendEvent(EV_ABS, ABS_MT_TRACKING_ID, -1);
+        device.SendEvent(EV_KEY, BTN_TOUCH, 0);
+        device.SendEvent(EV_KEY, BTN_TOOL_FINGER, 0);
+        device.SendEvent(EV_SYN, SYN_REPORT, 0);
+    });
+}
+BENCHMARK(BM_TouchpadMove)->UseManualTime();
+} // namespace
+} // namespace MMI
+} // namespace OHOS
+
+BENCHMARK_MAIN();
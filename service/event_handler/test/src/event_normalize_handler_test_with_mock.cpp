@@ -22,6 +22,8 @@
 #include "input_device_manager.h"
 #include "joystick_event_interface.h"
 #include "libinput_mock.h"
+#include "multimodal_input_plugin_manager.h"
+#include "touch_event_normalize.h"
 
 namespace OHOS {
 namespace MMI {
@@ -49,6 +51,7 @@ void EventNormalizeHandlerTestWithMock::TearDown()
 {
     InputDeviceManagerMock::ReleaseInstance();
     JoystickEventInterface::ReleaseInstance();
+    TouchEventNormalize::ReleaseInstance();
 }
 
 #ifdef OHOS_BUILD_ENABLE_TOUCHPAD
@@ -103,6 +106,218 @@ void InputEventHandlerMock::HandlePointerEvent(const std::shared_ptr<PointerEven
     pointerEvents_.push_back(pointerEvent);
 }
 #endif // OHOS_BUILD_ENABLE_POINTER
+
+#if defined(OHOS_BUILD_ENABLE_TOUCH) && defined(OHOS_BUILD_ENABLE_POINTER)
+namespace {
+constexpr int64_t FRAME_TIME { 10000 };
+constexpr int32_t DISPLAY_X { 100 };
+constexpr int32_t DISPLAY_Y { 200 };
+constexpr int32_t MOVE_STEP { 10 };
+constexpr int32_t SLOTLESS_POINTER_ID { 64 };
+
+std::shared_ptr<PointerEvent> CreateTouchEvent(int32_t nFingers)
+{
+    auto pointerEvent = PointerEvent::Create();
+    CHKPP(pointerEvent);
+    pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+    for (int32_t pointerId = 0; pointerId < nFingers; ++pointerId) {
+        PointerEvent::PointerItem item;
+        item.SetPointerId(pointerId);
+        item.SetDisplayX(DISPLAY_X * (pointerId + 1));
+        item.SetDisplayY(DISPLAY_Y);
+        item.SetPressed(true);
+        pointerEvent->AddPointerItem(item);
+    }
+    pointerEvent->SetPointerId(0);
+    pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_DOWN);
+    return pointerEvent;
+}
+
+// Updates the touch event of the device in place, as the touch normalizer does for the slot of a libinput event.
+void UpdateTouchEvent(std::shared_ptr<PointerEvent> pointerEvent, int32_t action, int32_t pointerId, int32_t displayY)
+{
+    PointerEvent::PointerItem item;
+    if (!pointerEvent->GetPointerItem(pointerId, item)) {
+        item.SetPointerId(pointerId);
+        item.SetDisplayX(DISPLAY_X * (pointerId + 1));
+        item.SetPressed(true);
+        pointerEvent->AddPointerItem(item);
+    }
+    item.SetDisplayY(displayY);
+    pointerEvent->UpdatePointerItem(pointerId, item);
+    pointerEvent->SetPointerId(pointerId);
+    pointerEvent->SetPointerAction(action);
+}
+
+bool IsItemChanged(const std::shared_ptr<PointerEvent> &pointerEvent, int32_t pointerId)
+{
+    PointerEvent::PointerItem item;
+    return (pointerEvent->GetPointerItem(pointerId, item) && item.IsChanged());
+}
+
+int32_t GetDisplayY(const std::shared_ptr<PointerEvent> &pointerEvent, int32_t pointerId)
+{
+    PointerEvent::PointerItem item;
+    return (pointerEvent->GetPointerItem(pointerId, item) ? item.GetDisplayY() : -1);
+}
+} // namespace
+
+/**
+ * @tc.name: DeferTouchMotion_001
+ * @tc.desc: Moves are held back until the end of the frame and then dispatched as one move with every finger.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventNormalizeHandlerTestWithMock, DeferTouchMotion_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto touchEvent = CreateTouchEvent(3);
+    ASSERT_NE(touchEvent, nullptr);
+    EventNormalizeHandler handler;
+    auto nextHandler = std::make_shared<InputEventHandlerMock>();
+    handler.SetNext(nextHandler);
+    handler.SetTouchFrameAggregation(true);
+
+    UpdateTouchEvent(touchEvent, PointerEvent::POINTER_ACTION_MOVE, 0, DISPLAY_Y + MOVE_STEP);
+    EXPECT_TRUE(handler.DeferTouchMotion(touchEvent, FRAME_TIME));
+    UpdateTouchEvent(touchEvent, PointerEvent::POINTER_ACTION_MOVE, 1, DISPLAY_Y + MOVE_STEP);
+    EXPECT_TRUE(handler.DeferTouchMotion(touchEvent, FRAME_TIME));
+    UpdateTouchEvent(touchEvent, PointerEvent::POINTER_ACTION_MOVE, 0, DISPLAY_Y + MOVE_STEP + MOVE_STEP);
+    EXPECT_TRUE(handler.DeferTouchMotion(touchEvent, FRAME_TIME));
+    EXPECT_TRUE(nextHandler->pointerEvents_.empty());
+
+    handler.FlushTouchFrame(FRAME_TIME);
+    ASSERT_EQ(nextHandler->pointerEvents_.size(), 1U);
+    auto frameEvent = nextHandler->pointerEvents_.back();
+    EXPECT_EQ(frameEvent->GetPointerAction(), PointerEvent::POINTER_ACTION_MOVE);
+    EXPECT_EQ(frameEvent->GetPointerId(), 0);
+    EXPECT_EQ(GetDisplayY(frameEvent, 0), DISPLAY_Y + MOVE_STEP + MOVE_STEP);
+    EXPECT_EQ(GetDisplayY(frameEvent, 1), DISPLAY_Y + MOVE_STEP);
+    EXPECT_TRUE(IsItemChanged(frameEvent, 0));
+    EXPECT_TRUE(IsItemChanged(frameEvent, 1));
+    EXPECT_FALSE(IsItemChanged(frameEvent, 2));
+    EXPECT_EQ(handler.pendingTouchEvent_, nullptr);
+    EXPECT_EQ(handler.pendingTouchSlots_, 0U);
+
+    handler.FlushTouchFrame(FRAME_TIME);
+    EXPECT_EQ(nextHandler->pointerEvents_.size(), 1U);
+}
+
+/**
+ * @tc.name: DeferTouchMotion_002
+ * @tc.desc: Nothing is held back with aggregation off or for a pointer without a slot bit, and disabling
+ *           aggregation flushes the pending move.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventNormalizeHandlerTestWithMock, DeferTouchMotion_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto touchEvent = CreateTouchEvent(2);
+    ASSERT_NE(touchEvent, nullptr);
+    EventNormalizeHandler handler;
+    auto nextHandler = std::make_shared<InputEventHandlerMock>();
+    handler.SetNext(nextHandler);
+
+    handler.SetTouchFrameAggregation(false);
+    UpdateTouchEvent(touchEvent, PointerEvent::POINTER_ACTION_MOVE, 0, DISPLAY_Y + MOVE_STEP);
+    EXPECT_FALSE(handler.DeferTouchMotion(touchEvent, FRAME_TIME));
+
+    handler.SetTouchFrameAggregation(true);
+    EXPECT_TRUE(handler.DeferTouchMotion(touchEvent, FRAME_TIME));
+    UpdateTouchEvent(touchEvent, PointerEvent::POINTER_ACTION_MOVE, SLOTLESS_POINTER_ID, DISPLAY_Y);
+    EXPECT_FALSE(handler.DeferTouchMotion(touchEvent, FRAME_TIME));
+    ASSERT_EQ(nextHandler->pointerEvents_.size(), 1U);
+    EXPECT_EQ(handler.pendingTouchEvent_, nullptr);
+
+    UpdateTouchEvent(touchEvent, PointerEvent::POINTER_ACTION_MOVE, 1, DISPLAY_Y + MOVE_STEP);
+    EXPECT_TRUE(handler.DeferTouchMotion(touchEvent, FRAME_TIME));
+    handler.SetTouchFrameAggregation(false);
+    ASSERT_EQ(nextHandler->pointerEvents_.size(), 2U);
+    EXPECT_EQ(nextHandler->pointerEvents_.back()->GetPointerId(), 1);
+    EXPECT_EQ(handler.pendingTouchEvent_, nullptr);
+}
+
+/**
+ * @tc.name: FlushTouchFrame_001
+ * @tc.desc: A pending move goes out before a down or an up of the same frame, and without aggregation only the
+ *           pointer of the action is marked as changed.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventNormalizeHandlerTestWithMock, FlushTouchFrame_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto touchEvent = CreateTouchEvent(1);
+    ASSERT_NE(touchEvent, nullptr);
+    NiceMock<LibinputInterfaceMock> libinputMock;
+    libinput_event_touch touch;
+    libinput_event event;
+    enum libinput_event_type type { LIBINPUT_EVENT_TOUCH_MOTION };
+    EXPECT_CALL(libinputMock, GetEventType).WillRepeatedly(ReturnPointee(&type));
+    EXPECT_CALL(libinputMock, GetTouchEvent).WillRepeatedly(Return(&touch));
+    EXPECT_CALL(libinputMock, TouchEventGetMoveFlag).WillRepeatedly(Return(0));
+    // The normalizer updates the event only once the handler has flushed what is pending.
+    int32_t action { PointerEvent::POINTER_ACTION_MOVE };
+    int32_t pointerId { 0 };
+    int32_t displayY { DISPLAY_Y };
+    EXPECT_CALL(*TOUCH_EVENT_HDR, OnLibInput).WillRepeatedly(Invoke([&](struct libinput_event *,
+        TouchEventNormalize::DeviceType) {
+        UpdateTouchEvent(touchEvent, action, pointerId, displayY);
+        return touchEvent;
+    }));
+    EventNormalizeHandler handler;
+    auto nextHandler = std::make_shared<InputEventHandlerMock>();
+    handler.SetNext(nextHandler);
+    handler.SetTouchFrameAggregation(true);
+
+    displayY = DISPLAY_Y + MOVE_STEP;
+    EXPECT_EQ(handler.HandleTouchEvent(&event, FRAME_TIME), RET_OK);
+    EXPECT_TRUE(nextHandler->pointerEvents_.empty());
+    type = LIBINPUT_EVENT_TOUCH_DOWN;
+    action = PointerEvent::POINTER_ACTION_DOWN;
+    pointerId = 1;
+    displayY = DISPLAY_Y;
+    EXPECT_EQ(handler.HandleTouchEvent(&event, FRAME_TIME), RET_OK);
+    ASSERT_EQ(nextHandler->pointerEvents_.size(), 2U);
+    auto moveEvent = nextHandler->pointerEvents_[0];
+    EXPECT_EQ(moveEvent->GetPointerAction(), PointerEvent::POINTER_ACTION_MOVE);
+    EXPECT_EQ(moveEvent->GetPointerId(), 0);
+    EXPECT_EQ(moveEvent->GetPointerIds().size(), 1U);
+    EXPECT_EQ(GetDisplayY(moveEvent, 0), DISPLAY_Y + MOVE_STEP);
+    auto downEvent = nextHandler->pointerEvents_[1];
+    EXPECT_EQ(downEvent->GetPointerAction(), PointerEvent::POINTER_ACTION_DOWN);
+    EXPECT_EQ(downEvent->GetPointerId(), 1);
+    EXPECT_FALSE(IsItemChanged(downEvent, 0));
+    EXPECT_TRUE(IsItemChanged(downEvent, 1));
+
+    type = LIBINPUT_EVENT_TOUCH_MOTION;
+    action = PointerEvent::POINTER_ACTION_MOVE;
+    displayY = DISPLAY_Y + MOVE_STEP;
+    EXPECT_EQ(handler.HandleTouchEvent(&event, FRAME_TIME), RET_OK);
+    EXPECT_EQ(nextHandler->pointerEvents_.size(), 2U);
+    type = LIBINPUT_EVENT_TOUCH_UP;
+    action = PointerEvent::POINTER_ACTION_UP;
+    pointerId = 0;
+    displayY = DISPLAY_Y + MOVE_STEP;
+    EXPECT_EQ(handler.HandleTouchEvent(&event, FRAME_TIME), RET_OK);
+    ASSERT_EQ(nextHandler->pointerEvents_.size(), 4U);
+    EXPECT_EQ(nextHandler->pointerEvents_[2]->GetPointerAction(), PointerEvent::POINTER_ACTION_MOVE);
+    EXPECT_EQ(nextHandler->pointerEvents_[2]->GetPointerId(), 1);
+    EXPECT_EQ(nextHandler->pointerEvents_[3]->GetPointerAction(), PointerEvent::POINTER_ACTION_UP);
+    EXPECT_EQ(nextHandler->pointerEvents_[3]->GetPointerId(), 0);
+
+    handler.SetTouchFrameAggregation(false);
+    type = LIBINPUT_EVENT_TOUCH_MOTION;
+    action = PointerEvent::POINTER_ACTION_MOVE;
+    pointerId = 1;
+    displayY = DISPLAY_Y + MOVE_STEP + MOVE_STEP;
+    EXPECT_EQ(handler.HandleTouchEvent(&event, FRAME_TIME), RET_OK);
+    ASSERT_EQ(nextHandler->pointerEvents_.size(), 5U);
+    EXPECT_EQ(GetDisplayY(nextHandler->pointerEvents_.back(), 1), DISPLAY_Y + MOVE_STEP + MOVE_STEP);
+    EXPECT_TRUE(IsItemChanged(nextHandler->pointerEvents_.back(), 1));
+}
+#endif // OHOS_BUILD_ENABLE_TOUCH && OHOS_BUILD_ENABLE_POINTER
 #ifdef OHOS_BUILD_ENABLE_JOYSTICK
 
 HWTEST_F(EventNormalizeHandlerTestWithMock, HandleJoystickButtonEvent_001, TestSize.Level1)
@@ -156,6 +371,55 @@ HWTEST_F(EventNormalizeHandlerTestWithMock, HandleJoystickAxisEvent_001, TestSiz
     }
 }
 
+#ifdef OHOS_BUILD_ENABLE_POINTER
+// Takes the plugin data of a stage below the normalizer while it dispatches, as the pointer chain does.
+struct PluginDataHandlerMock : public InputEventHandlerMock {
+    void HandlePointerEvent(const std::shared_ptr<PointerEvent> event) override
+    {
+        auto data = InputPluginManager::AcquirePluginData(InputPluginStage::INPUT_AFTER_NORMALIZED);
+        pluginData_.push_back(data.get());
+        InputEventHandlerMock::HandlePointerEvent(event);
+    }
+
+    std::vector<IPluginData *> pluginData_;
+};
+
+/**
+ * @tc.name: HandleEvent_PluginData_001
+ * @tc.desc: Dispatching events through HandleEvent reuses the plugin data of every stage.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventNormalizeHandlerTestWithMock, HandleEvent_PluginData_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto pointerEvent = PointerEvent::Create();
+    ASSERT_NE(pointerEvent, nullptr);
+    pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_AXIS_UPDATE);
+    EXPECT_CALL(*JOYSTICK_NORMALIZER, OnAxisEvent).WillRepeatedly(Return(pointerEvent));
+    EXPECT_CALL(*INPUT_DEV_MGR, IsInputDeviceEnable).WillRepeatedly(Return(true));
+    EXPECT_CALL(*INPUT_DEV_MGR, GetIsDeviceReportEvent).WillRepeatedly(Return(true));
+
+    NiceMock<LibinputInterfaceMock> libinputMock;
+    libinput_event event {};
+    libinput_device device {};
+    EXPECT_CALL(libinputMock, GetEventType).WillRepeatedly(Return(LIBINPUT_EVENT_JOYSTICK_AXIS));
+    EXPECT_CALL(libinputMock, GetDevice).WillRepeatedly(Return(&device));
+
+    EventNormalizeHandler handler;
+    auto nextHandler = std::make_shared<PluginDataHandlerMock>();
+    handler.SetNext(nextHandler);
+    IPluginData *outer =
+        InputPluginManager::AcquirePluginData(InputPluginStage::INPUT_AFTER_NORMALIZED_LIBINPUT).get();
+
+    handler.HandleEvent(&event, FRAME_TIME);
+    handler.HandleEvent(&event, FRAME_TIME);
+    ASSERT_EQ(nextHandler->pluginData_.size(), 2);
+    EXPECT_EQ(nextHandler->pluginData_[0], nextHandler->pluginData_[1]);
+    EXPECT_EQ(InputPluginManager::AcquirePluginData(InputPluginStage::INPUT_AFTER_NORMALIZED_LIBINPUT).get(), outer);
+}
+#endif // OHOS_BUILD_ENABLE_POINTER
+
 #ifdef OHOS_BUILD_ENABLE_KEYBOARD
 /**
  * @tc.name: UpdateKeyEventHandlerChain_ExtendedFunctionKey_001
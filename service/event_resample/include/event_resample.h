@@ -122,19 +122,15 @@ private:
             pointerAction = event->GetPointerAction();
             eventId = event->GetId();
 
-            std::vector<int32_t> pointerIds = event->GetPointerIds();
             pointerCount = 0;
-            for (auto &it : pointerIds) {
-                PointerEvent::PointerItem item;
-                if (event->GetPointerItem(it, item)) {
-                    Pointer pointer;
-                    pointer.coordX = item.GetDisplayX();
-                    pointer.coordY = item.GetDisplayY();
-                    pointer.toolType = item.GetToolType();
-                    pointer.id = item.GetPointerId();
-                    pointers[pointer.id] = pointer;
-                    pointerCount++;
-                }
+            for (const auto &item : event->GetPointerItems()) {
+                Pointer pointer;
+                pointer.coordX = item.GetDisplayX();
+                pointer.coordY = item.GetDisplayY();
+                pointer.toolType = item.GetToolType();
+                pointer.id = item.GetPointerId();
+                pointers[pointer.id] = pointer;
+                pointerCount++;
             }
         }
     };
@@ -18,6 +18,7 @@
 
 #include "event_filter_death_recipient.h"
 #include "ievent_filter.h"
+#include "input_event_filter_rule.h"
 #include "i_input_event_handler.h"
 
 namespace OHOS {
@@ -37,7 +38,7 @@ public:
     void HandleTouchEvent(const std::shared_ptr<PointerEvent> pointerEvent) override;
 #endif // OHOS_BUILD_ENABLE_TOUCH
     int32_t AddInputEventFilter(sptr<IEventFilter> filter, int32_t filterId, int32_t priority, uint32_t deviceTags,
-        int32_t clientPid);
+        int32_t clientPid, std::shared_ptr<const InputEventFilterRule> rule = nullptr);
     int32_t RemoveInputEventFilter(int32_t filterId, int32_t clientPid);
     void Dump(int32_t fd, const std::vector<std::string> &args);
     bool HandleKeyEventFilter(std::shared_ptr<KeyEvent> event);
@@ -54,6 +55,8 @@ private:
         const int32_t priority;
         const uint32_t deviceTags;
         const int32_t clientPid;
+        // Events the rule rejects are not sent to the filter; every event is sent without a rule.
+        const std::shared_ptr<const InputEventFilterRule> rule { nullptr };
         bool IsSameClient(int32_t id, int32_t pid) const { return ((filterId == id) && (clientPid == pid)); }
     };
     std::list<FilterInfo> filters_;
@@ -68,13 +68,14 @@ void EventFilterHandler::HandleTouchEvent(const std::shared_ptr<PointerEvent> po
 #endif // OHOS_BUILD_ENABLE_TOUCH
 
 int32_t EventFilterHandler::AddInputEventFilter(sptr<IEventFilter> filter,
-    int32_t filterId, int32_t priority, uint32_t deviceTags, int32_t clientPid)
+    int32_t filterId, int32_t priority, uint32_t deviceTags, int32_t clientPid,
+    std::shared_ptr<const InputEventFilterRule> rule)
 {
     CALL_DEBUG_ENTER;
     std::lock_guard<std::mutex> guard(lockFilter_);
     CHKPR(filter, ERROR_NULL_POINTER);
-    MMI_HILOGI("Add filter, filterId:%{public}d, priority:%{public}d, clientPid:%{public}d, filters_ size:%{public}zu",
-        filterId, priority, clientPid, filters_.size());
+    MMI_HILOGI("Add filter, filterId:%{public}d, priority:%{public}d, clientPid:%{public}d, rule:%{public}d,"
+        " filters_ size:%{public}zu", filterId, priority, clientPid, (rule != nullptr), filters_.size());
 
     std::weak_ptr<EventFilterHandler> weakPtr = shared_from_this();
     auto deathCallback = [weakPtr, filterId, clientPid](const wptr<IRemoteObject> &object) {
@@ -95,7 +96,7 @@ int32_t EventFilterHandler::AddInputEventFilter(sptr<IEventFilter> filter,
     filter->AsObject()->AddDeathRecipient(deathRecipient);
 
     FilterInfo info { .filter = filter, .deathRecipient = deathRecipient, .filterId = filterId,
-        .priority = priority, .deviceTags = deviceTags, .clientPid = clientPid };
+        .priority = priority, .deviceTags = deviceTags, .clientPid = clientPid, .rule = rule };
     auto it = filters_.cbegin();
     for (; it != filters_.cend(); ++it) {
         if (info.priority < it->priority) {
@@ -150,7 +151,8 @@ void EventFilterHandler::Dump(int32_t fd, const std::vector<std::string> &args)
     dprintf(fd, "Filter information:\n");
     dprintf(fd, "Filters: count=%d\n", filters_.size());
     for (const auto &item : filters_) {
-        dprintf(fd, "priority:%d | filterId:%d | Pid:%d\n", item.priority, item.filterId, item.clientPid);
+        dprintf(fd, "priority:%d | filterId:%d | Pid:%d | rule:%s\n", item.priority, item.filterId, item.clientPid,
+            (item.rule != nullptr ? "yes" : "no"));
     }
 }
 
@@ -175,6 +177,9 @@ bool EventFilterHandler::HandleKeyEventFilter(std::shared_ptr<KeyEvent> event)
         if (!inputDevice->HasCapability(i.deviceTags)) {
             continue;
         }
+        if ((i.rule != nullptr) && !i.rule->Match(*event)) {
+            continue;
+        }
         bool resultValue = false;
         CHKPF(i.filter);
         i.filter->HandleKeyEvent(event, resultValue);
@@ -202,6 +207,9 @@ bool EventFilterHandler::HandlePointerEventFilter(std::shared_ptr<PointerEvent>
         if (inputDevice == nullptr && !CheckCapability(i.deviceTags, event)) {
             continue;
         }
+        if ((i.rule != nullptr) && !i.rule->Match(*event)) {
+            continue;
+        }
         bool resultValue = false;
         CHKPF(i.filter);
         i.filter->HandlePointerEvent(event, resultValue);
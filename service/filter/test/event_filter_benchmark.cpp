@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "event_filter_handler.h"
+#include "input_device.h"
+#include "mmi_log.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "EventFilterBenchmark"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr int32_t FILTER_ID { 1 };
+constexpr int32_t CLIENT_PID { 100 };
+constexpr int32_t POINTER_ID { 0 };
+constexpr int32_t MOVES_PER_STROKE { 30 };
+constexpr int32_t STEP { 7 };
+// Stands in for the binder round trip of a filter living in another process.
+constexpr std::chrono::microseconds CALL_COST { 20 };
+
+class SlowEventFilter : public IRemoteStub<IEventFilter> {
+public:
+    ErrCode HandleKeyEvent(const std::shared_ptr<KeyEvent>& event, bool &resultValue) override
+    {
+        return HandleEvent(resultValue);
+    }
+
+    ErrCode HandlePointerEvent(const std::shared_ptr<PointerEvent>& event, bool &resultValue) override
+    {
+        return HandleEvent(resultValue);
+    }
+
+    int64_t nCalls_ { 0 };
+
+private:
+    ErrCode HandleEvent(bool &resultValue)
+    {
+        ++nCalls_;
+        auto deadline = std::chrono::steady_clock::now() + CALL_COST;
+        while (std::chrono::steady_clock::now() < deadline) {
+        }
+        resultValue = false;
+        return ERR_OK;
+    }
+};
+
+// A touch stroke: DOWN, a run of MOVEs and UP.
+std::vector<std::shared_ptr<PointerEvent>> CreateStroke()
+{
+    std::vector<std::shared_ptr<PointerEvent>> events;
+    for (int32_t index = 0; index <= MOVES_PER_STROKE + 1; ++index) {
+        auto pointerEvent = PointerEvent::Create();
+        pointerEvent->SetDeviceId(-1);
+        pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+        pointerEvent->SetPointerId(POINTER_ID);
+        if (index == 0) {
+            pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_DOWN);
+        } else if (index > MOVES_PER_STROKE) {
+            pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_UP);
+        } else {
+            pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
+        }
+        PointerEvent::PointerItem item;
+        item.SetPointerId(POINTER_ID);
+        item.SetDisplayX(index * STEP);
+        item.SetDisplayY(index * STEP);
+        pointerEvent->AddPointerItem(item);
+        events.push_back(pointerEvent);
+    }
+    return events;
+}
+
+void RunFilter(benchmark::State &state, std::shared_ptr<const InputEventFilterRule> rule)
+{
+    auto handler = std::make_shared<EventFilterHandler>();
+    sptr<SlowEventFilter> filter = new (std::nothrow) SlowEventFilter();
+    if ((filter == nullptr) ||
+        (handler->AddInputEventFilter(filter, FILTER_ID, 0, CapabilityToTags(INPUT_DEV_CAP_MAX), CLIENT_PID, rule) !=
+        RET_OK)) {
+        state.SkipWithError("Failed to add the filter");
+        return;
+    }
+    auto events = CreateStroke();
+    size_t index = 0;
+    int64_t nEvents = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(handler->HandlePointerEventFilter(events[index]));
+        index = (index + 1) % events.size();
+        ++nEvents;
+    }
+    state.SetItemsProcessed(nEvents);
+    if (nEvents == 0) {
+        return;
+    }
+    state.counters["CallsPerEvent"] = benchmark::Counter(static_cast<double>(filter->nCalls_) / nEvents);
+}
+
+// Every event crosses to the filter, as before filter rules.
+void BM_FilterEveryEvent(benchmark::State &state)
+{
+    RunFilter(state, nullptr);
+}
+
+// The filter only wants the ends of strokes, which is all a rule lets through.
+void BM_FilterMatchingEvents(benchmark::State &state)
+{
+    auto rule = std::make_shared<InputEventFilterRule>();
+    rule->AddSourceType(PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+    rule->AddPointerAction(PointerEvent::POINTER_ACTION_DOWN);
+    rule->AddPointerAction(PointerEvent::POINTER_ACTION_UP);
+    RunFilter(state, rule);
+}
+} // namespace
+
+BENCHMARK(BM_FilterEveryEvent);
+BENCHMARK(BM_FilterMatchingEvents);
+} // namespace MMI
+} // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -29,6 +29,7 @@ namespace OHOS {
 namespace MMI {
 namespace {
 using namespace testing::ext;
+constexpr int32_t REGION_SIZE { 100 };
 } // namespace
 
 class EventFilterHandlerTest : public testing::Test {
@@ -54,6 +55,25 @@ public:
     }
 };
 
+class CountingEventFilter : public IRemoteStub<IEventFilter> {
+public:
+    ErrCode HandleKeyEvent(const std::shared_ptr<KeyEvent>& event, bool &resultValue) override
+    {
+        ++nKeyEvents_;
+        resultValue = false;
+        return ERR_OK;
+    }
+    ErrCode HandlePointerEvent(const std::shared_ptr<PointerEvent>& event, bool &resultValue) override
+    {
+        ++nPointerEvents_;
+        resultValue = false;
+        return ERR_OK;
+    }
+
+    int32_t nKeyEvents_ { 0 };
+    int32_t nPointerEvents_ { 0 };
+};
+
 /**
  * @tc.name: EventFilterHandlerTest_HandleKeyEvent_001
  * @tc.desc: Verify the HandleKeyEvent and HandleKeyEventFilter
@@ -480,5 +500,111 @@ HWTEST_F(EventFilterHandlerTest, EventFilterHandlerTest_RemoveInputEventFilter_0
     filterHandler.filters_.emplace_front(filterInfo);
     EXPECT_EQ(filterHandler.RemoveInputEventFilter(filterId, clientPid), RET_OK);
 }
+
+/**
+ * @tc.name: EventFilterHandlerTest_AddInputEventFilter_Rule_001
+ * @tc.desc: Verify that a filter is registered together with its rule, and without one when none is given
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventFilterHandlerTest, EventFilterHandlerTest_AddInputEventFilter_Rule_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto handler = std::make_shared<EventFilterHandler>();
+    sptr<IEventFilter> filter = new (std::nothrow) CountingEventFilter();
+    ASSERT_NE(filter, nullptr);
+    int32_t filterId = 1;
+    int32_t clientPid = 100;
+    auto rule = std::make_shared<const InputEventFilterRule>();
+    ASSERT_EQ(handler->AddInputEventFilter(filter, filterId, 0, 0, clientPid, rule), RET_OK);
+    ASSERT_EQ(handler->AddInputEventFilter(filter, filterId + 1, 1, 0, clientPid), RET_OK);
+    ASSERT_EQ(handler->filters_.size(), 2);
+    EXPECT_EQ(handler->filters_.front().rule, rule);
+    EXPECT_EQ(handler->filters_.back().rule, nullptr);
+}
+
+/**
+ * @tc.name: EventFilterHandlerTest_HandlePointerEventFilter_005
+ * @tc.desc: Verify that pointer events the rule rejects are not sent to the filter
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventFilterHandlerTest, EventFilterHandlerTest_HandlePointerEventFilter_005, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto handler = std::make_shared<EventFilterHandler>();
+    sptr<CountingEventFilter> filter = new (std::nothrow) CountingEventFilter();
+    ASSERT_NE(filter, nullptr);
+    int32_t filterId = 1;
+    int32_t clientPid = 100;
+    InputEventFilterRule rule;
+    ASSERT_TRUE(rule.AddSourceType(PointerEvent::SOURCE_TYPE_TOUCHSCREEN));
+    ASSERT_TRUE(rule.AddPointerAction(PointerEvent::POINTER_ACTION_DOWN));
+    ASSERT_TRUE(rule.AddRegion({ .displayId = -1, .x = 0, .y = 0, .width = REGION_SIZE, .height = REGION_SIZE }));
+    ASSERT_EQ(handler->AddInputEventFilter(filter, filterId, 0, CapabilityToTags(INPUT_DEV_CAP_MAX), clientPid,
+        std::make_shared<const InputEventFilterRule>(rule)), RET_OK);
+
+    auto pointerEvent = PointerEvent::Create();
+    ASSERT_NE(pointerEvent, nullptr);
+    pointerEvent->SetDeviceId(-1);
+    pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+    pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_DOWN);
+    pointerEvent->SetPointerId(0);
+    PointerEvent::PointerItem item;
+    item.SetPointerId(0);
+    item.SetDisplayX(REGION_SIZE / 2);
+    item.SetDisplayY(REGION_SIZE / 2);
+    pointerEvent->AddPointerItem(item);
+    EXPECT_FALSE(handler->HandlePointerEventFilter(pointerEvent));
+    EXPECT_EQ(filter->nPointerEvents_, 1);
+
+    pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
+    EXPECT_FALSE(handler->HandlePointerEventFilter(pointerEvent));
+    EXPECT_EQ(filter->nPointerEvents_, 1);
+
+    pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_DOWN);
+    item.SetDisplayX(REGION_SIZE);
+    pointerEvent->UpdatePointerItem(0, item);
+    EXPECT_FALSE(handler->HandlePointerEventFilter(pointerEvent));
+    EXPECT_EQ(filter->nPointerEvents_, 1);
+
+    pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_MOUSE);
+    item.SetDisplayX(REGION_SIZE / 2);
+    pointerEvent->UpdatePointerItem(0, item);
+    EXPECT_FALSE(handler->HandlePointerEventFilter(pointerEvent));
+    EXPECT_EQ(filter->nPointerEvents_, 1);
+}
+
+/**
+ * @tc.name: EventFilterHandlerTest_InputEventFilterRule_001
+ * @tc.desc: Verify key event matching of a rule and that it survives a parcel
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(EventFilterHandlerTest, EventFilterHandlerTest_InputEventFilterRule_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    InputEventFilterRule rule;
+    ASSERT_TRUE(rule.AddKeyAction(KeyEvent::KEY_ACTION_DOWN));
+    ASSERT_TRUE(rule.AddKeyCode(KeyEvent::KEYCODE_VOLUME_UP));
+    EXPECT_FALSE(rule.AddPointerAction(-1));
+    EXPECT_FALSE(rule.AddRegion({ .displayId = 0, .x = 0, .y = 0, .width = 0, .height = REGION_SIZE }));
+
+    Parcel parcel;
+    ASSERT_TRUE(rule.Marshalling(parcel));
+    std::unique_ptr<InputEventFilterRule> copy { InputEventFilterRule::Unmarshalling(parcel) };
+    ASSERT_NE(copy, nullptr);
+
+    auto keyEvent = KeyEvent::Create();
+    ASSERT_NE(keyEvent, nullptr);
+    keyEvent->SetKeyCode(KeyEvent::KEYCODE_VOLUME_UP);
+    keyEvent->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
+    EXPECT_TRUE(copy->Match(*keyEvent));
+    keyEvent->SetKeyAction(KeyEvent::KEY_ACTION_UP);
+    EXPECT_FALSE(copy->Match(*keyEvent));
+    keyEvent->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
+    keyEvent->SetKeyCode(KeyEvent::KEYCODE_VOLUME_DOWN);
+    EXPECT_FALSE(copy->Match(*keyEvent));
+}
 } // namespace MMI
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -16,10 +16,14 @@
 #ifndef LIBINPUT_ADAPTER_H
 #define LIBINPUT_ADAPTER_H
 
+#include <atomic>
+#include <mutex>
 #include <shared_mutex>
+#include <thread>
 
 #include "hotplug_detector.h"
 #include "libinput.h"
+#include "spsc_ring.h"
 
 namespace OHOS {
 namespace MMI {
@@ -73,6 +77,8 @@ enum class VKeyboardActivation : int32_t {
 class LibinputAdapter final {
 public:
     static int32_t DeviceLedUpdate(struct libinput_device *device, int32_t funcKey, bool isEnable);
+    // Serializes calls into the libinput context once the reader thread drains it next to the service thread.
+    static std::recursive_mutex &GetContextMutex();
     LibinputAdapter() = default;
     DISALLOW_COPY_AND_MOVE(LibinputAdapter);
     ~LibinputAdapter();
@@ -90,7 +96,7 @@ public:
 
     auto GetInputFds() const
     {
-        return std::array{fd_, hotplugDetector_.GetFd()};
+        return std::array{(readerNotifyFd_ >= 0) ? readerNotifyFd_ : fd_, hotplugDetector_.GetFd()};
     }
 	
     void InitVKeyboard(HandleTouchPoint handleTouchPoint,
@@ -106,9 +112,26 @@ public:
         );
 
 private:
+    struct ReadEvent {
+        libinput_event *event { nullptr };
+        libinput_event_type type { LIBINPUT_EVENT_NONE };
+        int64_t frameTime { 0 };
+    };
+    static constexpr size_t READER_RING_SIZE { 1024 };
+
     void MultiKeyboardSetLedState(bool newCapsLockState);
     void MultiKeyboardSetFuncState(libinput_event* event);
     void OnEventHandler();
+    void HandleLibinputEvent(libinput_event *event, int64_t frameTime);
+    static bool IsContextFreeEvent(libinput_event_type type);
+    static std::unique_lock<std::recursive_mutex> LockContextFor(libinput_event_type type);
+    static void DestroyEvent(libinput_event *event);
+    void OnEventsQueued();
+    bool StartReaderThread();
+    void StopReaderThread();
+    void ReaderLoop();
+    bool ReadEvents();
+    void DrainReaderEvents();
     void OnDeviceAdded(std::string path);
     void OnDeviceRemoved(std::string path);
     void InitRightButtonAreaConfig();
@@ -178,6 +201,14 @@ private:
     HotplugDetector hotplugDetector_;
     std::unordered_map<std::string, libinput_device*> devices_;
     bool hasPendingEvents_ = false;
+
+    // Pipeline mode: the reader thread owns fd_ and feeds the service thread through readerRing_.
+    SpscRing<ReadEvent, READER_RING_SIZE> readerRing_;
+    std::thread readerThread_;
+    std::atomic_bool readerRunning_ { false };
+    int32_t readerEpollFd_ { -1 };
+    int32_t readerWakeFd_ { -1 };
+    int32_t readerNotifyFd_ { -1 };
 };
 } // namespace MMI
 } // namespace OHOS
@@ -16,8 +16,13 @@
 #include "libinput_adapter.h"
 
 #include <regex>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
 
+#include "input_pipeline_statistic.h"
 #include "param_wrapper.h"
+#include "parameters.h"
 #include "property_reader.h"
 #include "input_device_manager.h"
 #include "input_windows_manager.h"
@@ -28,7 +33,6 @@
 #include "timer_manager.h"
 #include "common_event_manager.h"
 #include "common_event_support.h"
-#include "parameters.h"
 #endif // OHOS_BUILD_ENABLE_VKEYBOARD
 #include "multimodal_input_plugin_manager.h"
 
@@ -46,6 +50,10 @@ constexpr int32_t MIN_RIGHT_BTN_AREA_PERCENT { 0 };
 constexpr int32_t MAX_RIGHT_BTN_AREA_PERCENT { 100 };
 constexpr int32_t INVALID_RIGHT_BTN_AREA { -1 };
 constexpr int32_t MAX_EVENT_INTERVAL_TIME { 4000 };
+constexpr int32_t READER_IDLE_TIMEOUT_MS { 1000 };
+constexpr int32_t READER_BACKLOG_DELAY_MS { 1 };
+constexpr int32_t READER_EPOLL_EVENTS { 2 };
+const char* INPUT_PIPELINE_PARAM { "const.multimodalinput.input_pipeline" };
 #ifdef OHOS_BUILD_ENABLE_VKEYBOARD
 constexpr uint32_t VKEY_TP_LB_ID { 272 };
 constexpr uint32_t VKEY_TP_SEAT_BTN_COUNT_NONE { 0 };
@@ -92,10 +100,44 @@ void HiLogFunc(struct libinput* input, libinput_log_priority priority, const cha
     }
     va_end(args);
 }
+
+void WriteEventFd(int32_t fd)
+{
+    uint64_t value = 1;
+    if (write(fd, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value)) && (errno != EAGAIN)) {
+        MMI_HILOGE("Write eventfd failed, errno:%{public}d", errno);
+    }
+}
+
+void ReadEventFd(int32_t fd)
+{
+    uint64_t value = 0;
+    if (read(fd, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value)) && (errno != EAGAIN)) {
+        MMI_HILOGE("Read eventfd failed, errno:%{public}d", errno);
+    }
+}
+
+int32_t CreateEventFd()
+{
+    int32_t fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd >= 0) {
+        fdsan_exchange_owner_tag(fd, 0, TAG);
+    }
+    return fd;
+}
+
+void CloseFd(int32_t &fd)
+{
+    if (fd >= 0) {
+        fdsan_close_with_tag(fd, TAG);
+        fd = -1;
+    }
+}
 } // namespace
 
 LibinputAdapter::~LibinputAdapter()
 {
+    StopReaderThread();
 #ifdef OHOS_BUILD_ENABLE_VKEYBOARD
     if (TimerMgr->IsExist(vkbTimerId_)) {
         TimerMgr->RemoveTimer(vkbTimerId_);
@@ -112,9 +154,70 @@ LibinputAdapter::~LibinputAdapter()
 int32_t LibinputAdapter::DeviceLedUpdate(struct libinput_device *device, int32_t funcKey, bool enable)
 {
     CHKPR(device, RET_ERR);
+    std::lock_guard<std::recursive_mutex> guard(GetContextMutex());
     return libinput_set_led_state(device, funcKey, enable);
 }
 
+std::recursive_mutex &LibinputAdapter::GetContextMutex()
+{
+    static std::recursive_mutex contextMutex;
+    return contextMutex;
+}
+
+bool LibinputAdapter::IsContextFreeEvent(libinput_event_type type)
+{
+    switch (type) {
+        case LIBINPUT_EVENT_TOUCH_DOWN:
+        case LIBINPUT_EVENT_TOUCH_UP:
+        case LIBINPUT_EVENT_TOUCH_MOTION:
+        case LIBINPUT_EVENT_TOUCH_CANCEL:
+        case LIBINPUT_EVENT_TOUCH_FRAME:
+        case LIBINPUT_EVENT_TOUCHPAD_DOWN:
+        case LIBINPUT_EVENT_TOUCHPAD_UP:
+        case LIBINPUT_EVENT_TOUCHPAD_MOTION:
+        case LIBINPUT_EVENT_POINTER_MOTION:
+        case LIBINPUT_EVENT_POINTER_MOTION_ABSOLUTE:
+        case LIBINPUT_EVENT_POINTER_MOTION_TOUCHPAD:
+        case LIBINPUT_EVENT_POINTER_BUTTON:
+        case LIBINPUT_EVENT_POINTER_BUTTON_TOUCHPAD:
+        case LIBINPUT_EVENT_POINTER_AXIS:
+        case LIBINPUT_EVENT_POINTER_TAP:
+        case LIBINPUT_EVENT_GESTURE_SWIPE_BEGIN:
+        case LIBINPUT_EVENT_GESTURE_SWIPE_UPDATE:
+        case LIBINPUT_EVENT_GESTURE_SWIPE_END:
+        case LIBINPUT_EVENT_GESTURE_PINCH_BEGIN:
+        case LIBINPUT_EVENT_GESTURE_PINCH_UPDATE:
+        case LIBINPUT_EVENT_GESTURE_PINCH_END:
+        case LIBINPUT_EVENT_TABLET_TOOL_AXIS:
+        case LIBINPUT_EVENT_TABLET_TOOL_PROXIMITY:
+        case LIBINPUT_EVENT_TABLET_TOOL_TIP:
+        case LIBINPUT_EVENT_TABLET_TOOL_BUTTON:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// The chain of a pointer, touch, gesture or tablet event only reads that event and device data fixed at add time,
+// so it runs next to libinput_dispatch on the reader. Keyboard, device and switch events reach LED, caps and
+// device configuration state, the chain of those keeps the context locked.
+std::unique_lock<std::recursive_mutex> LibinputAdapter::LockContextFor(libinput_event_type type)
+{
+    std::unique_lock<std::recursive_mutex> guard(GetContextMutex(), std::defer_lock);
+    if (!IsContextFreeEvent(type)) {
+        guard.lock();
+    }
+    return guard;
+}
+
+void LibinputAdapter::DestroyEvent(libinput_event *event)
+{
+    CHKPV(event);
+    // Dropping the device reference of the event races with libinput_dispatch on the reader.
+    std::lock_guard<std::recursive_mutex> guard(GetContextMutex());
+    libinput_event_destroy(event);
+}
+
 void LibinputAdapter::InitRightButtonAreaConfig()
 {
     CHKPV(input_);
@@ -253,8 +356,162 @@ bool LibinputAdapter::Init(FunInputEvent funInputEvent)
         return false;
     }
     InitRightButtonAreaConfig();
-    return hotplugDetector_.Init([this](std::string path) { OnDeviceAdded(std::move(path)); },
-        [this](std::string path) { OnDeviceRemoved(std::move(path)); });
+    if (!hotplugDetector_.Init([this](std::string path) { OnDeviceAdded(std::move(path)); },
+        [this](std::string path) { OnDeviceRemoved(std::move(path)); })) {
+        return false;
+    }
+    if (OHOS::system::GetBoolParameter(INPUT_PIPELINE_PARAM, false) && !StartReaderThread()) {
+        MMI_HILOGE("Start input reader thread failed, libinput stays on the service thread");
+    }
+    return true;
+}
+
+bool LibinputAdapter::StartReaderThread()
+{
+    CALL_INFO_TRACE;
+    readerEpollFd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (readerEpollFd_ >= 0) {
+        fdsan_exchange_owner_tag(readerEpollFd_, 0, TAG);
+    }
+    readerWakeFd_ = CreateEventFd();
+    readerNotifyFd_ = CreateEventFd();
+    if ((readerEpollFd_ < 0) || (readerWakeFd_ < 0) || (readerNotifyFd_ < 0)) {
+        MMI_HILOGE("Create reader fds failed, errno:%{public}d", errno);
+        StopReaderThread();
+        return false;
+    }
+    for (int32_t fd : { fd_, readerWakeFd_ }) {
+        struct epoll_event ev = {};
+        ev.events = EPOLLIN;
+        ev.data.fd = fd;
+        if (epoll_ctl(readerEpollFd_, EPOLL_CTL_ADD, fd, &ev) != 0) {
+            MMI_HILOGE("Add fd:%{public}d to reader epoll failed, errno:%{public}d", fd, errno);
+            StopReaderThread();
+            return false;
+        }
+    }
+    // Events built by the virtual keyboard and its timers reach the chain without passing DrainReaderEvents.
+    FunInputEvent funInputEvent = funInputEvent_;
+    funInputEvent_ = [funInputEvent](void *event, int64_t frameTime) {
+        std::unique_lock<std::recursive_mutex> guard;
+        if (event != nullptr) {
+            guard = LockContextFor(libinput_event_get_type(static_cast<libinput_event *>(event)));
+        }
+        funInputEvent(event, frameTime);
+    };
+    InputPipelineStatistic::SetEnabled(READER_RING_SIZE);
+    readerRunning_ = true;
+    readerThread_ = std::thread([this] { ReaderLoop(); });
+    return true;
+}
+
+void LibinputAdapter::StopReaderThread()
+{
+    if (readerRunning_.exchange(false) && (readerWakeFd_ >= 0)) {
+        WriteEventFd(readerWakeFd_);
+    }
+    if (readerThread_.joinable()) {
+        readerThread_.join();
+    }
+    ReadEvent readEvent;
+    while (readerRing_.TryPop(readEvent)) {
+        DestroyEvent(readEvent.event);
+    }
+    CloseFd(readerEpollFd_);
+    CloseFd(readerWakeFd_);
+    CloseFd(readerNotifyFd_);
+}
+
+void LibinputAdapter::ReaderLoop()
+{
+    SetThreadName(std::string("mmi_reader"));
+    MMI_HILOGI("Input reader thread start");
+    bool hasBacklog = false;
+    while (readerRunning_) {
+        epoll_event ev[READER_EPOLL_EVENTS] = {};
+        int32_t timeout = hasBacklog ? READER_BACKLOG_DELAY_MS : READER_IDLE_TIMEOUT_MS;
+        int32_t count = epoll_wait(readerEpollFd_, ev, READER_EPOLL_EVENTS, timeout);
+        if ((count < 0) && (errno != EINTR)) {
+            MMI_HILOGE("Reader epoll_wait failed, errno:%{public}d", errno);
+        }
+        for (int32_t i = 0; i < count; ++i) {
+            if (ev[i].data.fd == readerWakeFd_) {
+                ReadEventFd(readerWakeFd_);
+            }
+        }
+        if (!readerRunning_) {
+            break;
+        }
+        hasBacklog = ReadEvents();
+    }
+    MMI_HILOGI("Input reader thread stop");
+}
+
+bool LibinputAdapter::ReadEvents()
+{
+    int64_t beginTime = GetSysClockTime();
+    size_t count = 0;
+    bool isFull = false;
+    {
+        std::lock_guard<std::recursive_mutex> guard(GetContextMutex());
+        if (libinput_dispatch(input_) != 0) {
+            MMI_HILOGE("Failed to dispatch libinput");
+        }
+        int64_t frameTime = GetSysClockTime();
+        while (libinput_next_event_type(input_) != LIBINPUT_EVENT_NONE) {
+            // Leave the rest queued inside libinput, the order of events is kept across the backlog.
+            if (readerRing_.Size() == READER_RING_SIZE) {
+                isFull = true;
+                break;
+            }
+            libinput_event *event = libinput_get_event(input_);
+            readerRing_.TryPush(ReadEvent { event, libinput_event_get_type(event), frameTime });
+            ++count;
+        }
+    }
+    if (isFull) {
+        InputPipelineStatistic::RecordRingFull();
+    }
+    if (count > 0) {
+        InputPipelineStatistic::RecordLatency(InputPipelineStatistic::STAGE_READ, GetSysClockTime() - beginTime);
+        InputPipelineStatistic::RecordQueueDepth(readerRing_.Size());
+        WriteEventFd(readerNotifyFd_);
+    }
+    return isFull;
+}
+
+void LibinputAdapter::DrainReaderEvents()
+{
+    ReadEventFd(readerNotifyFd_);
+    // Events pushed while draining wait for the next loop turn, timers and clients are served in between.
+    size_t count = readerRing_.Size();
+    ReadEvent readEvent;
+    for (size_t i = 0; (i < count) && readerRing_.TryPop(readEvent); ++i) {
+        int64_t beginTime = GetSysClockTime();
+        InputPipelineStatistic::RecordLatency(InputPipelineStatistic::STAGE_QUEUE, beginTime - readEvent.frameTime);
+        {
+            auto guard = LockContextFor(readEvent.type);
+            HandleLibinputEvent(readEvent.event, readEvent.frameTime);
+        }
+        InputPipelineStatistic::RecordLatency(InputPipelineStatistic::STAGE_DISPATCH,
+            GetSysClockTime() - beginTime);
+    }
+    InputPipelineStatistic::RecordQueueDepth(readerRing_.Size());
+    if (!readerRing_.Empty()) {
+        WriteEventFd(readerNotifyFd_);
+        return;
+    }
+    CHKPV(funInputEvent_);
+    funInputEvent_(nullptr, 0);
+}
+
+void LibinputAdapter::OnEventsQueued()
+{
+    if (readerRunning_) {
+        WriteEventFd(readerWakeFd_);
+        return;
+    }
+    OnEventHandler();
 }
 
 void LibinputAdapter::EventDispatch(int32_t fd)
@@ -268,6 +525,8 @@ void LibinputAdapter::EventDispatch(int32_t fd)
         }
         OnEventHandler();
         MMI_HILOGD("End to OnEventHandler");
+    } else if ((readerNotifyFd_ >= 0) && (fd == readerNotifyFd_)) {
+        DrainReaderEvents();
     } else if (fd == hotplugDetector_.GetFd()) {
         hotplugDetector_.OnEvent();
     } else {
@@ -278,6 +537,7 @@ void LibinputAdapter::EventDispatch(int32_t fd)
 void LibinputAdapter::Stop()
 {
     CALL_DEBUG_ENTER;
+    StopReaderThread();
     hotplugDetector_.Stop();
     if (input_ != nullptr) {
         libinput_unref(input_);
@@ -287,6 +547,10 @@ void LibinputAdapter::Stop()
 
 void LibinputAdapter::ProcessPendingEvents()
 {
+    if (readerRunning_) {
+        DrainReaderEvents();
+        return;
+    }
     OnEventHandler();
 }
 
@@ -355,6 +619,7 @@ void LibinputAdapter::SafeDestroyVTrackPadDelayedEvent()
     vtpTimerId_ = EXPIRED_TIMER_ID;
     stopVTrackpadTimer_();
     CHKPV(vtpDelayedEvent_);
+    std::lock_guard<std::recursive_mutex> contextGuard(GetContextMutex());
     libinput_event_destroy(vtpDelayedEvent_);
     vtpDelayedEvent_ = nullptr;
 }
@@ -401,6 +666,8 @@ bool LibinputAdapter::GetIsCaptureMode()
 void LibinputAdapter::HandleVFullKeyboardMessages(
     libinput_event *event, int64_t frameTime, libinput_event_type eventType, libinput_event_touch *touch)
 {
+    // The virtual keyboard builds its events from the touch and syncs the caps state of the context.
+    std::lock_guard<std::recursive_mutex> contextGuard(GetContextMutex());
     // delay the event destroy.
     bool delayvtpDestroy = false;
 
@@ -442,7 +709,7 @@ void LibinputAdapter::HandleVFullKeyboardMessages(
         funInputEvent_(event, frameTime);
     }
     if (!delayvtpDestroy) {
-        libinput_event_destroy(event);
+        DestroyEvent(event);
     }
 }
 
@@ -864,7 +1131,7 @@ void LibinputAdapter::ProcessTouchEventAsVKeyboardEvent(
     if (IsPhoneTouchThpEventOnFullKbd(touch, eventType, x, y)) {
         MMI_HILOGI("Discard when phone touch event on full kbd, type=%{public}d",
             static_cast<int32_t>(eventType));
-        libinput_event_destroy(event);
+        DestroyEvent(event);
         return;
     }
     
@@ -881,7 +1148,7 @@ void LibinputAdapter::ProcessTouchEventAsVKeyboardEvent(
                 funInputEvent_(event, frameTime);
             }
         }
-        libinput_event_destroy(event);
+        DestroyEvent(event);
     }
 }
 
@@ -957,18 +1224,9 @@ void LibinputAdapter::OnEventHandler()
     hasPendingEvents_ = false;
     while ((event = libinput_get_event(input_))) {
         libinput_event_type eventType = libinput_event_get_type(event);
-        std::string msg = "OnEventHandler, eventType is: ";
-        msg += std::to_string(eventType);
-        BytraceAdapter::MMIServiceTraceStart(BytraceAdapter::MMI_THREAD_LOOP_DEPTH_THREE, msg);
-#ifdef OHOS_BUILD_ENABLE_VKEYBOARD
-        ProcessEventAsVKeyboardEvent(event, frameTime);
-#else // OHOS_BUILD_ENABLE_VKEYBOARD
-        MultiKeyboardSetFuncState(event);
-        if (!ProcessEventBeforeLibinputStage(event, frameTime)) {
-            funInputEvent_(event, frameTime);
-        }
-        libinput_event_destroy(event);
-#endif // OHOS_BUILD_ENABLE_VKEYBOARD
+        BytraceAdapter::MMIServiceTraceStartFormat(BytraceAdapter::MMI_THREAD_LOOP_DEPTH_THREE,
+            "OnEventHandler, eventType is: %d", eventType);
+        HandleLibinputEvent(event, frameTime);
         if (libinput_next_event_type(input_) == LIBINPUT_EVENT_KEYBOARD_KEY) {
             int64_t currentTime = GetSysClockTime();
             if (currentTime - frameTime > MAX_EVENT_INTERVAL_TIME) {
@@ -985,6 +1243,19 @@ void LibinputAdapter::OnEventHandler()
     }
 }
 
+void LibinputAdapter::HandleLibinputEvent(libinput_event *event, int64_t frameTime)
+{
+#ifdef OHOS_BUILD_ENABLE_VKEYBOARD
+    ProcessEventAsVKeyboardEvent(event, frameTime);
+#else // OHOS_BUILD_ENABLE_VKEYBOARD
+    MultiKeyboardSetFuncState(event);
+    if (!ProcessEventBeforeLibinputStage(event, frameTime)) {
+        funInputEvent_(event, frameTime);
+    }
+    DestroyEvent(event);
+#endif // OHOS_BUILD_ENABLE_VKEYBOARD
+}
+
 #ifdef OHOS_BUILD_ENABLE_VKEYBOARD
 void LibinputAdapter::ProcessEventAsVKeyboardEvent(libinput_event *event, int64_t frameTime)
 {
@@ -1011,7 +1282,7 @@ void LibinputAdapter::ProcessEventAsVKeyboardEvent(libinput_event *event, int64_
             if (!ProcessEventBeforeLibinputStage(event, frameTime)) {
                 funInputEvent_(event, frameTime);
             }
-            libinput_event_destroy(event);
+            DestroyEvent(event);
             MultiKeyboardSetLedState(!oldCapsLockOn);
             keyEvent->SetFunctionKey(MMI::KeyEvent::CAPS_LOCK_FUNCTION_KEY, !oldCapsLockOn);
             libinput_toggle_caps_key();
@@ -1020,13 +1291,13 @@ void LibinputAdapter::ProcessEventAsVKeyboardEvent(libinput_event *event, int64_
             if (!ProcessEventBeforeLibinputStage(event, frameTime)) {
                 funInputEvent_(event, frameTime);
             }
-            libinput_event_destroy(event);
+            DestroyEvent(event);
         }
     } else {
         if (!ProcessEventBeforeLibinputStage(event, frameTime)) {
             funInputEvent_(event, frameTime);
         }
-        libinput_event_destroy(event);
+        DestroyEvent(event);
     }
 }
 #endif // OHOS_BUILD_ENABLE_VKEYBOARD
@@ -1043,9 +1314,8 @@ bool LibinputAdapter::ProcessEventBeforeLibinputStage(libinput_event *event, int
         return false;
     }
 
-    auto pData = std::make_shared<IPluginData>();
-    pData->frameTime = frameTime;
-    pData->stage = InputPluginStage::INPUT_BEFORE_LIBINPUT_ADAPTER_ON_EVENT;
+    auto pData = InputPluginManager::AcquirePluginData(
+        InputPluginStage::INPUT_BEFORE_LIBINPUT_ADAPTER_ON_EVENT, frameTime);
     int32_t res = manager->HandleEvent(event, pData);
     if (res == RET_DO) {
         return true;
@@ -1057,6 +1327,7 @@ void LibinputAdapter::ReloadDevice()
 {
     CALL_DEBUG_ENTER;
     CHKPV(input_);
+    std::lock_guard<std::recursive_mutex> guard(GetContextMutex());
     libinput_suspend(input_);
     libinput_resume(input_);
 }
@@ -1093,11 +1364,13 @@ void LibinputAdapter::OnDeviceAdded(std::string path)
     DTaskCallback cb = [this, path] {
         MMI_HILOGI("OnDeviceAdded, path:%{public}s", path.c_str());
         udev_device_record_devnode(path.c_str());
+        std::unique_lock<std::recursive_mutex> guard(GetContextMutex());
         libinput_device* device = libinput_path_add_device(input_, path.c_str());
         if (device != nullptr) {
             devices_[std::move(path)] = libinput_device_ref(device);
+            guard.unlock();
             // Libinput doesn't signal device adding event in path mode. Process manually.
-            OnEventHandler();
+            OnEventsQueued();
         }
         udev_device_property_remove(path.c_str());
         return 0;
@@ -1120,11 +1393,14 @@ void LibinputAdapter::OnDeviceRemoved(std::string path)
     MMI_HILOGI("OnDeviceRemoved id:%{public}d", id);
     auto pos = devices_.find(path);
     if (pos != devices_.end()) {
-        libinput_path_remove_device(pos->second);
-        libinput_device_unref(pos->second);
+        {
+            std::lock_guard<std::recursive_mutex> guard(GetContextMutex());
+            libinput_path_remove_device(pos->second);
+            libinput_device_unref(pos->second);
+        }
         devices_.erase(pos);
         // Libinput doesn't signal device removing event in path mode. Process manually.
-        OnEventHandler();
+        OnEventsQueued();
     }
 }
 } // namespace MMI
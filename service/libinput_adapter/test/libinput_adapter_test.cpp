@@ -14,6 +14,8 @@
  */
 
 #include <fcntl.h>
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include "libinput_adapter.h"
@@ -29,6 +31,7 @@ using namespace testing;
 using namespace testing::ext;
 constexpr int32_t WAIT_TIME_FOR_INPUT { 10 };
 constexpr int32_t MAX_RETRY_COUNT { 5 };
+constexpr int32_t MAX_LOCK_ATTEMPTS { 100 };
 
 constexpr static libinput_interface LIBINPUT_INTERFACE = {
     .open_restricted = [](const char *path, int32_t flags, void *user_data)->int32_t {
@@ -148,6 +151,76 @@ HWTEST_F(LibinputAdapterTest, LibinputAdapterTest_Stop_001, TestSize.Level1)
     libinputAdapter.input_ = libinput_path_create_context(&LIBINPUT_INTERFACE, nullptr);
     ASSERT_NO_FATAL_FAILURE(libinputAdapter.Stop());
 }
+
+/**
+ * @tc.name: LibinputAdapterTest_LockContextFor_001
+ * @tc.desc: Verify only the chain of pointer, touch, gesture and tablet events runs without the context lock
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(LibinputAdapterTest, LibinputAdapterTest_LockContextFor_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    EXPECT_TRUE(LibinputAdapter::IsContextFreeEvent(LIBINPUT_EVENT_TOUCH_MOTION));
+    EXPECT_TRUE(LibinputAdapter::IsContextFreeEvent(LIBINPUT_EVENT_POINTER_MOTION));
+    EXPECT_TRUE(LibinputAdapter::IsContextFreeEvent(LIBINPUT_EVENT_GESTURE_PINCH_UPDATE));
+    EXPECT_TRUE(LibinputAdapter::IsContextFreeEvent(LIBINPUT_EVENT_TABLET_TOOL_AXIS));
+    EXPECT_FALSE(LibinputAdapter::IsContextFreeEvent(LIBINPUT_EVENT_KEYBOARD_KEY));
+    EXPECT_FALSE(LibinputAdapter::IsContextFreeEvent(LIBINPUT_EVENT_DEVICE_ADDED));
+    EXPECT_FALSE(LibinputAdapter::IsContextFreeEvent(LIBINPUT_EVENT_SWITCH_TOGGLE));
+
+    auto guard = LibinputAdapter::LockContextFor(LIBINPUT_EVENT_TOUCH_MOTION);
+    EXPECT_FALSE(guard.owns_lock());
+    guard = LibinputAdapter::LockContextFor(LIBINPUT_EVENT_KEYBOARD_KEY);
+    EXPECT_TRUE(guard.owns_lock());
+}
+
+/**
+ * @tc.name: LibinputAdapterTest_ReaderPipeline_001
+ * @tc.desc: Verify the service thread drains the reader thread and runs the chain without the context lock
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(LibinputAdapterTest, LibinputAdapterTest_ReaderPipeline_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    LibinputAdapter libinputAdapter;
+    libinputAdapter.input_ = libinput_path_create_context(&LIBINPUT_INTERFACE, nullptr);
+    ASSERT_NE(libinputAdapter.input_, nullptr);
+    libinputAdapter.fd_ = libinput_get_fd(libinputAdapter.input_);
+    int32_t flushCount = 0;
+    bool isContextFree = false;
+    libinputAdapter.funInputEvent_ = [&flushCount, &isContextFree](void *event, int64_t frameTime) {
+        if (event != nullptr) {
+            return;
+        }
+        ++flushCount;
+        // Another thread, like the reader running libinput_dispatch, gets the context while the chain runs.
+        std::thread reader([&isContextFree] {
+            for (int32_t i = 0; (i < MAX_LOCK_ATTEMPTS) && !isContextFree; ++i) {
+                std::unique_lock<std::recursive_mutex> guard(LibinputAdapter::GetContextMutex(), std::try_to_lock);
+                isContextFree = guard.owns_lock();
+                if (!isContextFree) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+        });
+        reader.join();
+    };
+    ASSERT_TRUE(libinputAdapter.StartReaderThread());
+    EXPECT_TRUE(libinputAdapter.readerRunning_);
+    EXPECT_EQ(libinputAdapter.GetInputFds()[0], libinputAdapter.readerNotifyFd_);
+
+    libinputAdapter.ProcessPendingEvents();
+    EXPECT_EQ(flushCount, 1);
+    EXPECT_TRUE(isContextFree);
+    EXPECT_TRUE(libinputAdapter.readerRing_.Empty());
+
+    libinputAdapter.Stop();
+    EXPECT_FALSE(libinputAdapter.readerRunning_);
+    EXPECT_FALSE(libinputAdapter.readerThread_.joinable());
+    EXPECT_EQ(libinputAdapter.readerNotifyFd_, -1);
+}
 #ifdef OHOS_BUILD_ENABLE_VKEYBOARD
 /**
  * @tc.name: LibinputAdapterTest_Swipe_001
@@ -20,6 +20,7 @@
 #include "event_dispatch_handler.h"
 #include "ievent_filter.h"
 #include "inject_notice_manager.h"
+#include "input_event_filter_rule.h"
 #include "key_option.h"
 #include "long_press_event.h"
 #include "mouse_event_interface.h"
@@ -130,7 +131,7 @@ public:
 #endif // OHOS_BUILD_ENABLE_POINTER || OHOS_BUILD_ENABLE_TOUCH
 #if defined(OHOS_BUILD_ENABLE_POINTER) || defined(OHOS_BUILD_ENABLE_TOUCH) || defined(OHOS_BUILD_ENABLE_KEYBOARD)
     int32_t AddInputEventFilter(sptr<IEventFilter> filter, int32_t filterId, int32_t priority, uint32_t deviceTags,
-        int32_t clientPid);
+        int32_t clientPid, std::shared_ptr<const InputEventFilterRule> rule = nullptr);
     int32_t RemoveInputEventFilter(int32_t clientPid, int32_t filterId);
 #endif // OHOS_BUILD_ENABLE_POINTER || OHOS_BUILD_ENABLE_TOUCH || OHOS_BUILD_ENABLE_KEYBOARD
 #ifdef OHOS_BUILD_ENABLE_KEYBOARD
@@ -228,6 +228,7 @@ int32_t ServerMsgHandler::OnSetFunctionKeyState(int32_t pid, int32_t funcKey, bo
     if (checkState == enable) {
         return RET_OK;
     }
+    std::lock_guard<std::recursive_mutex> guard(LibinputAdapter::GetContextMutex());
 #ifdef OHOS_BUILD_ENABLE_VKEYBOARD
     if (funcKey == KeyEvent::CAPS_LOCK_FUNCTION_KEY) {
         // set vkeyboard caps state with separate API.
@@ -1505,11 +1506,12 @@ int32_t ServerMsgHandler::OnUnsubscribeLongPressEvent(IUdsServer *server, int32_
 
 #if defined(OHOS_BUILD_ENABLE_POINTER) || defined(OHOS_BUILD_ENABLE_TOUCH) || defined(OHOS_BUILD_ENABLE_KEYBOARD)
 int32_t ServerMsgHandler::AddInputEventFilter(sptr<IEventFilter> filter,
-    int32_t filterId, int32_t priority, uint32_t deviceTags, int32_t clientPid)
+    int32_t filterId, int32_t priority, uint32_t deviceTags, int32_t clientPid,
+    std::shared_ptr<const InputEventFilterRule> rule)
 {
     auto filterHandler = InputHandler->GetFilterHandler();
     CHKPR(filterHandler, ERROR_NULL_POINTER);
-    return filterHandler->AddInputEventFilter(filter, filterId, priority, deviceTags, clientPid);
+    return filterHandler->AddInputEventFilter(filter, filterId, priority, deviceTags, clientPid, rule);
 }
 
 int32_t ServerMsgHandler::RemoveInputEventFilter(int32_t clientPid, int32_t filterId)
@@ -60,6 +60,8 @@ public:
         std::shared_ptr<SocketPairFlag> socketPairClosedFlag);
     ErrCode AddInputEventFilter(const sptr<IEventFilter>& filter, int32_t filterId, int32_t priority,
         uint32_t deviceTags) override;
+    ErrCode AddInputEventFilterWithRule(const sptr<IEventFilter>& filter, int32_t filterId, int32_t priority,
+        uint32_t deviceTags, const InputEventFilterRule &rule) override;
     ErrCode RemoveInputEventFilter(int32_t filterId) override;
     ErrCode SetPointerSize(int32_t size) override;
     ErrCode GetPointerSize(int32_t &size) override;
@@ -267,6 +269,7 @@ protected:
     void OnDisconnected(SessionPtr s) override;
     int32_t AddEpoll(EpollEventType type, int32_t fd, bool readOnly = false) override;
     int32_t DelEpoll(EpollEventType type, int32_t fd);
+    int32_t ModEpoll(EpollEventType type, int32_t fd, uint32_t events) override;
     bool IsRunning() const;
 #if defined(OHOS_BUILD_ENABLE_POINTER) && defined(OHOS_BUILD_ENABLE_POINTER_DRAWING)
     int32_t CheckPointerVisible(bool &visible);
@@ -351,6 +354,8 @@ protected:
     ErrCode DispatchToNextHandler(int32_t eventId) override;
     ErrCode InitCustomConfig();
     int32_t IsPointerInit(bool &status) override;
+    int32_t AddInputEventFilterInner(const sptr<IEventFilter>& filter, int32_t filterId, int32_t priority,
+        uint32_t deviceTags, std::shared_ptr<const InputEventFilterRule> rule);
     int32_t SetCustomCursorPixelMapInner(int32_t windowId, int32_t focusX, int32_t focusY,
         const CursorPixelMap& curPixelMap);
     int32_t SetCustomCursorInner(int32_t windowId, const CustomCursorParcel& curParcel,
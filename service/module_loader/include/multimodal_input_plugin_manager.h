@@ -47,6 +47,13 @@ typedef int32_t (*InitPlugin)(std::shared_ptr<IPluginContext> ctx, std::shared_p
   *        !=0: error
  */
 typedef int32_t (*UnintPlugin)(std::shared_ptr<IInputPlugin> &plugin);
+/*  框架获取plugin在各阶段订阅的事件，可选符号，plugin未导出时订阅全部事件
+  * stage: plugin所在的阶段
+  * subscription：plugin在该阶段订阅的事件
+  * return：= 0: success
+  *        !=0: error，该阶段订阅全部事件
+ */
+typedef int32_t (*GetPluginSubscription)(InputPluginStage stage, PluginSubscription &subscription);
 
 const int32_t RET_NOTDO = 0;
 const int32_t RET_DO = 1;
@@ -69,6 +76,7 @@ public:
     int32_t GetPriority() override;
     std::shared_ptr<IInputPlugin> GetPlugin() override;
     void SetCallback(std::function<void(PluginEventType, int64_t)> callback) override;
+    void SetCallback(InputPluginStage stage, std::function<void(PluginEventType, int64_t)> callback) override;
     PluginResult HandleEvent(libinput_event *event, std::shared_ptr<IPluginData> data) override;
     PluginResult HandleEvent(std::shared_ptr<PointerEvent> pointerEvent, std::shared_ptr<IPluginData> data) override;
     PluginResult HandleEvent(std::shared_ptr<KeyEvent> keyEvent, std::shared_ptr<IPluginData> data) override;
@@ -116,6 +124,7 @@ public:
     int32_t EnableInputDeviceForPlugin(int32_t deviceId) override;
     int32_t DisableInputDeviceForPlugin(int32_t deviceId) override;
     double ConvertVPToPX(double vp) const override;
+    bool IsSubscribed(InputPluginStage stage, const PluginEventType &event) const override;
 
     int32_t prio_ = 200;
     std::function<void(PluginEventType, int64_t)> callback_;
@@ -125,11 +134,16 @@ public:
 
 private:
     bool IsDataShareReady();
+    void InitSubscriptions(GetPluginSubscription getSubscription);
+    void OnHandleEvent(const std::shared_ptr<IPluginData> &data);
 
 private:
     void* handle_ { nullptr };
+    // The stage of the event handed to the plugin last; events the plugin dispatches continue from there.
     InputPluginStage stage_ { InputPluginStage::INPUT_GLOBAL_INIT };
     std::vector<InputPluginStage> stages_;
+    std::map<InputPluginStage, std::function<void(PluginEventType, int64_t)>> callbacks_;
+    std::map<InputPluginStage, PluginSubscription> subscriptions_;
     int32_t timerCnt_ = 0;
     struct ObserverEntry {
         sptr<SettingObserver> observer;
@@ -151,6 +165,15 @@ private:
         bool IsValid() const;
     };
 
+    // Time spent in one plugin, kept instead of a trace point per event.
+    struct PluginLatency {
+        std::string name_;
+        std::atomic<uint64_t> nEvents_ { 0 };
+        std::atomic<uint64_t> nOverBudget_ { 0 };
+        std::atomic<int64_t> totalUs_ { 0 };
+        std::atomic<int64_t> maxUs_ { 0 };
+    };
+
 public:
     InputPluginManager(const InputPluginManager &) = delete;
     InputPluginManager &operator=(const InputPluginManager &) = delete;
@@ -163,11 +186,14 @@ public:
     void Dump(int fd);
     void PluginAssignmentCallBack(std::function<void(PluginEventType, int64_t)> callback, InputPluginStage stage);
     void PrintPlugins();
+    static std::shared_ptr<IPluginData> AcquirePluginData(InputPluginStage stage, int64_t frameTime = 0);
     std::shared_ptr<IPluginData> GetPluginDataFromLibInput(libinput_event *event);
-    PluginResult ProcessEvent(
-        PluginEventType event, std::shared_ptr<IPluginContext> iplugin, std::shared_ptr<IPluginData> data);
-    int32_t HandleEvent(PluginEventType event, std::shared_ptr<IPluginData> data);
-    int32_t DoHandleEvent(PluginEventType event, std::shared_ptr<IPluginData> data, IPluginContext *iplugin);
+    bool HasSubscriber(InputPluginStage stage, const PluginEventType &event) const;
+    PluginResult ProcessEvent(const PluginEventType &event, const std::shared_ptr<IPluginContext> &iplugin,
+        const std::shared_ptr<IPluginData> &data);
+    int32_t HandleEvent(const PluginEventType &event, const std::shared_ptr<IPluginData> &data);
+    int32_t DoHandleEvent(
+        const PluginEventType &event, const std::shared_ptr<IPluginData> &data, IPluginContext *iplugin);
     int32_t GetExternalObject(const std::string &pluginName, sptr<IRemoteObject> &pluginRemoteStub);
     UDSServer *GetUdsServer();
     void HandleMonitorStatus(bool monitorStatus, const std::string &monitorType);
@@ -201,6 +227,7 @@ private:
     void OnPluginLoaded(const std::string &uuid, std::shared_ptr<InputPlugin> plugin);
     void AddCallbackToPlugin(const std::shared_ptr<IPluginContext> &cPin);
     void CheckAndLoadEdmPluginAtStartup();
+    void RecordLatency(const std::shared_ptr<IPluginContext> &iplugin, int64_t lostTime, int32_t timeout);
 
     std::weak_ptr<IDelegateInterface> delegate_;
     UDSServer* udsServer_ {nullptr};
@@ -208,6 +235,9 @@ private:
     std::map<InputPluginStage, std::list<std::shared_ptr<IPluginContext>>> plugins_;
     std::map<std::string, std::shared_ptr<InputPlugin>> dynamicPlugins_;
     std::map<std::string, PluginConfig> pluginConfigs_;
+    std::map<InputPluginStage, std::function<void(PluginEventType, int64_t)>> stageCallbacks_;
+    std::map<const IPluginContext*, std::shared_ptr<PluginLatency>> latencies_;
+    mutable std::mutex latenciesMutex_;
     std::atomic_bool loading_ { false };
     inline static InputPluginManager* instance_ { nullptr };
     inline static std::once_flag init_flag_;
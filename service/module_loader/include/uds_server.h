@@ -18,6 +18,7 @@
 
 #include <list>
 #include <map>
+#include <set>
 
 #include "uds_socket.h"
 
@@ -47,6 +48,7 @@ public:
     virtual ~UDSServer();
     void UdsStop();
     bool SendMsg(int32_t fd, NetPacket& pkt);
+    bool SendMsg(int32_t fd, NetPacket& pkt, const UDSSession::CoalesceKey& key);
     void Multicast(const std::vector<int32_t>& fdList, NetPacket& pkt);
     void Dump(int32_t fd, const std::vector<std::string> &args);
     int32_t GetClientFd(int32_t pid) const;
@@ -62,16 +64,20 @@ public:
 
     void AddEpollEvent(int32_t fd, std::shared_ptr<mmi_epoll_event> epollEvent);
     void RemoveEpollEvent(int32_t fd);
+    void FlushPendingMsgs();
 
 protected:
     virtual void OnConnected(SessionPtr s);
     virtual void OnDisconnected(SessionPtr s);
     virtual int32_t AddEpoll(EpollEventType type, int32_t fd, bool readOnly = false);
+    virtual int32_t ModEpoll(EpollEventType type, int32_t fd, uint32_t events);
 
     void SetRecvFun(MsgServerFunCallback fun);
     void ReleaseSession(int32_t fd, epoll_event& ev);
     void OnPacket(int32_t fd, NetPacket& pkt);
     void OnEpollRecv(int32_t fd, epoll_event& ev);
+    void OnSessionPending(int32_t fd);
+    void FlushPendingMsg(int32_t fd);
     void OnEpollEvent(epoll_event& ev);
     bool AddSession(SessionPtr ses);
     void DelSession(int32_t fd);
@@ -94,6 +100,9 @@ protected:
     std::map<int32_t, CircleStreamBuffer> circleBufMap_;
     std::list<std::function<void(SessionPtr)>> callbacks_;
     std::map<int32_t, std::shared_ptr<mmi_epoll_event>> epollEventMap_;
+    std::set<int32_t> pendingFds_;
+    std::set<int32_t> epollOutFds_;
+    std::mutex pendingFdsMutex_;
     mutable int32_t pid_ { -1 };
 };
 } // namespace MMI
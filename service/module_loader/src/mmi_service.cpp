@@ -89,6 +89,7 @@
 #include "touchpad_settings_handler.h"
 #endif // OHOS_BUILD_ENABLE_TOUCHPAD
 #include "multimodal_input_plugin_manager.h"
+#include "notification_outbox.h"
 
 #ifdef OHOS_RSS_CLIENT
 #include "res_sched_client.h"
@@ -169,6 +170,7 @@ constexpr int32_t TOUCHPAD_SCROLL_ROWS { 3 };
 constexpr int32_t UID_TRANSFORM_DIVISOR { 200000 };
 const std::string PRODUCT_DEVICE_TYPE = system::GetParameter("const.product.devicetype", "unknown");
 const std::string PRODUCT_TYPE_PC = "2in1";
+const char* BINARY_TRACE_PARAM { "const.multimodalinput.binary_trace" };
 const int32_t ERROR_WINDOW_ID_PERMISSION_DENIED = 26500001;
 const std::string SCENEBOARD_NAME { "com.ohos.sceneboard" };
 const std::string FOUNDATION_NAME { "foundation" };
@@ -366,6 +368,31 @@ int32_t MMIService::DelEpoll(EpollEventType type, int32_t fd)
     return RET_OK;
 }
 
+int32_t MMIService::ModEpoll(EpollEventType type, int32_t fd, uint32_t events)
+{
+    if (type < EPOLL_EVENT_BEGIN || type >= EPOLL_EVENT_END) {
+        MMI_HILOGE("Invalid param type");
+        return RET_ERR;
+    }
+    if (fd < 0) {
+        MMI_HILOGE("Invalid param fd_");
+        return RET_ERR;
+    }
+    if (mmiFd_ < 0) {
+        MMI_HILOGE("Invalid param mmiFd_");
+        return RET_ERR;
+    }
+    struct epoll_event ev = {};
+    ev.events = events;
+    ev.data.fd = fd;
+    auto ret = EpollCtl(fd, EPOLL_CTL_MOD, ev, mmiFd_);
+    if (ret < 0) {
+        MMI_HILOGE("ModEpoll failed");
+        return ret;
+    }
+    return RET_OK;
+}
+
 bool MMIService::IsRunning() const
 {
     return (state_ == ServiceRunningState::STATE_RUNNING);
@@ -461,6 +488,9 @@ int32_t MMIService::Init()
 {
     // LCOV_EXCL_START
     CheckDefine();
+    if (OHOS::system::GetBoolParameter(BINARY_TRACE_PARAM, false)) {
+        BytraceAdapter::SetTraceMode(BytraceAdapter::TRACE_MODE_BINARY);
+    }
     MMI_HILOGD("WindowsManager Init");
     WIN_MGR->Init(*this);
     MMI_HILOGD("NapProcess Init");
@@ -475,6 +505,7 @@ int32_t MMIService::Init()
     }
     MMI_HILOGD("Input msg handler init");
     InputHandler->Init(*this);
+    NOTIFY_OUTBOX.Start();
     MMI_HILOGD("Init DelegateTasks init");
     if (!InitDelegateTasks()) {
         MMI_HILOGE("Delegate tasks init failed");
@@ -573,6 +604,7 @@ void MMIService::OnStop()
     CHK_PID_AND_TID();
     UdsStop();
     libinputAdapter_.Stop();
+    NOTIFY_OUTBOX.Stop();
     state_ = ServiceRunningState::STATE_NOT_START;
 #ifdef OHOS_RSS_CLIENT
     MMI_HILOGI("Remove system ability listener start");
@@ -707,6 +739,20 @@ ErrCode MMIService::AddInputEventFilter(const sptr<IEventFilter>& filter, int32_
     uint32_t deviceTags)
 {
     CALL_DEBUG_ENTER;
+    return AddInputEventFilterInner(filter, filterId, priority, deviceTags, nullptr);
+}
+
+ErrCode MMIService::AddInputEventFilterWithRule(const sptr<IEventFilter>& filter, int32_t filterId, int32_t priority,
+    uint32_t deviceTags, const InputEventFilterRule &rule)
+{
+    CALL_DEBUG_ENTER;
+    return AddInputEventFilterInner(filter, filterId, priority, deviceTags,
+        std::make_shared<const InputEventFilterRule>(rule));
+}
+
+int32_t MMIService::AddInputEventFilterInner(const sptr<IEventFilter>& filter, int32_t filterId, int32_t priority,
+    uint32_t deviceTags, std::shared_ptr<const InputEventFilterRule> rule)
+{
     if (!PER_HELPER->VerifySystemApp()) {
         MMI_HILOGE("Verify system APP failed");
         return ERROR_NOT_SYSAPI;
@@ -720,8 +766,8 @@ ErrCode MMIService::AddInputEventFilter(const sptr<IEventFilter>& filter, int32_
     CHKPR(filterPtr, ERROR_NULL_POINTER);
     int32_t clientPid = GetCallingPid();
     int32_t ret = delegateTasks_.PostSyncTask(
-        [this, filterPtr, filterId, priority, deviceTags, clientPid] {
-            return sMsgHandler_.AddInputEventFilter(filterPtr, filterId, priority, deviceTags, clientPid);
+        [this, filterPtr, filterId, priority, deviceTags, clientPid, rule] {
+            return sMsgHandler_.AddInputEventFilter(filterPtr, filterId, priority, deviceTags, clientPid, rule);
         }
         );
     if (ret != RET_OK) {
@@ -1271,11 +1317,8 @@ ErrCode MMIService::MarkProcessed(int32_t eventType, int32_t eventId)
         return MMISERVICE_NOT_RUNNING;
     }
     CHKPR(ANRMgr, RET_ERR);
-    std::string msg = "MarkProcessed,eventType:";
-    msg += std::to_string(eventType);
-    msg += ",eventId:";
-    msg += std::to_string(eventId);
-    BytraceAdapter::MMIServiceTraceStart(BytraceAdapter::MMI_THREAD_LOOP_DEPTH_THREE, msg);
+    BytraceAdapter::MMIServiceTraceStartFormat(BytraceAdapter::MMI_THREAD_LOOP_DEPTH_THREE,
+        "MarkProcessed,eventType:%d,eventId:%d", eventType, eventId);
     int32_t clientPid = GetCallingPid();
     int32_t ret = delegateTasks_.PostSyncTask(
         [clientPid, eventType, eventId] {
@@ -3475,6 +3518,7 @@ void MMIService::OnThread()
         }
         MMI_HILOGD("timeout:%{public}d", timeout);
         int32_t count = EpollWait(ev[0], MAX_EVENT_SIZE, timeout, mmiFd_);
+        UDSSession::SetSendBatching(true);
         for (int32_t i = 0; i < count && state_ == ServiceRunningState::STATE_RUNNING; i++) {
             auto mmiEdIter = epollEventMap_.find(ev[i].data.fd);
             if (mmiEdIter == epollEventMap_.end()) {
@@ -3501,6 +3545,8 @@ void MMIService::OnThread()
         if (count == 0 && libinputAdapter_.HasPendingEvents()) {
             libinputAdapter_.HandlePendingEvents();
         }
+        UDSSession::SetSendBatching(false);
+        FlushPendingMsgs();
         if (state_ != ServiceRunningState::STATE_RUNNING) {
             break;
         }
@@ -5275,9 +5321,8 @@ ErrCode MMIService::TransferBinderClientSrv(const sptr<IRemoteObject> &binderCli
 
 void MMIService::CalculateFuntionRunningTime(std::function<void()> func, const std::string &flag)
 {
-    std::string msg = "Epoll_event_input, event type is: ";
-    msg += flag;
-    BytraceAdapter::MMIServiceTraceStart(BytraceAdapter::MMI_THREAD_LOOP_DEPTH_THREE, msg);
+    BytraceAdapter::MMIServiceTraceStartFormat(BytraceAdapter::MMI_THREAD_LOOP_DEPTH_THREE,
+        "Epoll_event_input, event type is: %s", flag.c_str());
     std::function<void (void *)> printLog = std::bind(&MMIService::PrintLog, this, flag, THREAD_BLOCK_TIMER_SPAN_S,
         getpid(), gettid());
     int32_t id = HiviewDFX::XCollie::GetInstance().SetTimer(flag, THREAD_BLOCK_TIMER_SPAN_S, printLog, nullptr,
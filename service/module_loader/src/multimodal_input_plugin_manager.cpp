@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <array>
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <filesystem>
@@ -36,6 +38,7 @@
 #include "bytrace_adapter.h"
 #include "i_setting_manager.h"
 #include "util.h"
+#include "util_ex.h"
 #include "setting_datashare.h"
 #include "system_ability_definition.h"
 #include "cursor_drawing_component.h"
@@ -246,6 +249,10 @@ void InputPluginManager::AddPluginToStages(const std::shared_ptr<IPluginContext>
             result.first->second.insert(it, cPin);
         }
     }
+    auto latency = std::make_shared<PluginLatency>();
+    latency->name_ = cPin->GetName();
+    std::lock_guard<std::mutex> guard(latenciesMutex_);
+    latencies_[cPin.get()] = latency;
 }
 
 void InputPluginManager::PrintPlugins()
@@ -265,45 +272,82 @@ void InputPluginManager::PluginAssignmentCallBack(
     std::function<void(PluginEventType, int64_t)> callback, InputPluginStage stage)
 {
     CALL_DEBUG_ENTER;
+    // Kept for plugins loaded later, so callers install their callback once instead of per event.
+    stageCallbacks_[stage] = callback;
     auto it = plugins_.find(stage);
     if (it == plugins_.end()) {
         MMI_HILOGI("plugins_ not stage:%{public}d.", stage);
         return;
     }
     for (auto &plugin : it->second) {
-        plugin->SetCallback(callback);
+        plugin->SetCallback(stage, callback);
     }
 }
 
-PluginResult InputPluginManager::ProcessEvent(
-    PluginEventType event, std::shared_ptr<IPluginContext> iplugin, std::shared_ptr<IPluginData> data)
+PluginResult InputPluginManager::ProcessEvent(const PluginEventType &event,
+    const std::shared_ptr<IPluginContext> &iplugin, const std::shared_ptr<IPluginData> &data)
 {
-    int64_t beginTime = GetSysClockTime();
-    std::string msg = "PluginManager::ProcessEvent, plugin Name is: ";
-    msg += iplugin->GetName();
-    BytraceAdapter::MMIServiceTraceStart(BytraceAdapter::MMI_THREAD_LOOP_DEPTH_THREE, msg);
+    auto beginTime = std::chrono::steady_clock::now();
     PluginResult result = std::visit(
         overloaded{
-            [data, iplugin](libinput_event* evt) { return iplugin->HandleEvent(evt, data); },
-            [data, iplugin](std::shared_ptr<PointerEvent> evt) { return iplugin->HandleEvent(evt, data); },
-            [data, iplugin](std::shared_ptr<AxisEvent> evt) { return iplugin->HandleEvent(evt, data); },
-            [data, iplugin](std::shared_ptr<KeyEvent> evt) { return iplugin->HandleEvent(evt, data); }
+            [&data, &iplugin](libinput_event* evt) { return iplugin->HandleEvent(evt, data); },
+            [&data, &iplugin](const std::shared_ptr<PointerEvent> &evt) { return iplugin->HandleEvent(evt, data); },
+            [&data, &iplugin](const std::shared_ptr<AxisEvent> &evt) { return iplugin->HandleEvent(evt, data); },
+            [&data, &iplugin](const std::shared_ptr<KeyEvent> &evt) { return iplugin->HandleEvent(evt, data); }
         }, event);
-    BytraceAdapter::MMIServiceTraceStop();
-    int64_t endTime = GetSysClockTime();
-    int64_t lostTime = endTime - beginTime;
+    int64_t lostTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - beginTime).count();
     int32_t timeout = result == PluginResult::UseNoNeedReissue ? TIMEOUT_USE_EVENT_US : TIMEOUT_US;
-    if (lostTime >= timeout) {
-        MMI_HILOGW("iplugin timeout name:%{public}s ,endTime:%{public}" PRId64 ",lostTime:%{public}" PRId64,
-            iplugin->GetName().c_str(), endTime, lostTime);
-        auto session = std::make_shared<UDSSession>(iplugin->GetName(), -1, -1, -1, ::getpid());
-        DfxHisysevent::ApplicationBlockInput(session);
-    }
+    RecordLatency(iplugin, lostTime, timeout);
     return result;
 }
 
+void InputPluginManager::RecordLatency(
+    const std::shared_ptr<IPluginContext> &iplugin, int64_t lostTime, int32_t timeout)
+{
+    std::shared_ptr<PluginLatency> latency = nullptr;
+    {
+        std::lock_guard<std::mutex> guard(latenciesMutex_);
+        if (auto iter = latencies_.find(iplugin.get()); iter != latencies_.end()) {
+            latency = iter->second;
+        }
+    }
+    if (latency != nullptr) {
+        latency->nEvents_.fetch_add(1, std::memory_order_relaxed);
+        latency->totalUs_.fetch_add(lostTime, std::memory_order_relaxed);
+        if (lostTime > latency->maxUs_.load(std::memory_order_relaxed)) {
+            latency->maxUs_.store(lostTime, std::memory_order_relaxed);
+        }
+    }
+    if (lostTime < timeout) {
+        return;
+    }
+    if (latency != nullptr) {
+        latency->nOverBudget_.fetch_add(1, std::memory_order_relaxed);
+    }
+    std::string name = (latency != nullptr ? latency->name_ : iplugin->GetName());
+    MMI_HILOGW("iplugin timeout name:%{public}s, lostTime:%{public}" PRId64 ", budget:%{public}d",
+        name.c_str(), lostTime, timeout);
+    auto session = std::make_shared<UDSSession>(name, -1, -1, -1, ::getpid());
+    DfxHisysevent::ApplicationBlockInput(session);
+}
+
+void InputPluginManager::Dump(int fd)
+{
+    std::lock_guard<std::mutex> guard(latenciesMutex_);
+    mprintf(fd, "Plugin latency(us): budget:%d, %d when the event is consumed", TIMEOUT_US, TIMEOUT_USE_EVENT_US);
+    for (const auto &[plugin, latency] : latencies_) {
+        uint64_t nEvents = latency->nEvents_.load(std::memory_order_relaxed);
+        int64_t totalUs = latency->totalUs_.load(std::memory_order_relaxed);
+        mprintf(fd, "\tplugin:%s events:%" PRIu64 " overBudget:%" PRIu64 " avg:%" PRId64 " max:%" PRId64,
+            latency->name_.c_str(), nEvents, latency->nOverBudget_.load(std::memory_order_relaxed),
+            (nEvents != 0 ? totalUs / static_cast<int64_t>(nEvents) : 0),
+            latency->maxUs_.load(std::memory_order_relaxed));
+    }
+}
+
 int32_t InputPluginManager::DoHandleEvent(
-    PluginEventType event, std::shared_ptr<IPluginData> data, IPluginContext* iplugin)
+    const PluginEventType &event, const std::shared_ptr<IPluginData> &data, IPluginContext* iplugin)
 {
     CALL_DEBUG_ENTER;
     InputPluginStage stage = data->stage;
@@ -327,7 +371,7 @@ int32_t InputPluginManager::DoHandleEvent(
     }
     PluginResult result;
     for (auto pluginIt = start_plugin; pluginIt != plugins.end(); ++pluginIt) {
-        if ((*pluginIt) == nullptr) {
+        if (((*pluginIt) == nullptr) || !(*pluginIt)->IsSubscribed(stage, event)) {
             continue;
         }
         result = ProcessEvent(event, *pluginIt, data);
@@ -346,7 +390,7 @@ int32_t InputPluginManager::DoHandleEvent(
     return RET_NOTDO;
 }
 
-int32_t InputPluginManager::HandleEvent(PluginEventType event, std::shared_ptr<IPluginData> data)
+int32_t InputPluginManager::HandleEvent(const PluginEventType &event, const std::shared_ptr<IPluginData> &data)
 {
     return DoHandleEvent(event, data, nullptr);
 }
@@ -603,16 +647,19 @@ void InputPluginManager::AddCallbackToPlugin(const std::shared_ptr<IPluginContex
         return;
     }
     for (const auto& stage : iPin->GetStages()) {
-        if (stage != InputPluginStage::INPUT_BEFORE_LIBINPUT_ADAPTER_ON_EVENT) {
+        if (stage == InputPluginStage::INPUT_BEFORE_LIBINPUT_ADAPTER_ON_EVENT) {
+            auto callback = [](PluginEventType pluginEvent, int64_t frameTime) {
+                auto event = std::get_if<libinput_event*>(&pluginEvent);
+                if (!event) return;
+                InputHandler->OnEvent(static_cast<void *>(*event), frameTime);
+            };
+            cPin->SetCallback(stage, callback);
             continue;
         }
-        auto callback = [](PluginEventType pluginEvent, int64_t frameTime) {
-            auto event = std::get_if<libinput_event*>(&pluginEvent);
-            if (!event) return;
-            InputHandler->OnEvent(static_cast<void *>(*event), frameTime);
-        };
-        cPin->SetCallback(callback);
-        return;
+        auto it = stageCallbacks_.find(stage);
+        if (it != stageCallbacks_.end()) {
+            cPin->SetCallback(stage, it->second);
+        }
     }
 }
 
@@ -658,6 +705,8 @@ void InputPluginManager::RemovePluginFromStages(const std::shared_ptr<IPluginCon
         });
     }
     RemoveDisplayCallbacksOf(plugin.get());
+    std::lock_guard<std::mutex> guard(latenciesMutex_);
+    latencies_.erase(plugin.get());
 }
 
 int32_t InputPluginManager::GetExternalObject(const std::string &pluginName, sptr<IRemoteObject> &pluginRemoteStub)
@@ -685,9 +734,47 @@ int32_t InputPluginManager::GetExternalObject(const std::string &pluginName, spt
     return RET_OK;
 }
 
+std::shared_ptr<IPluginData> InputPluginManager::AcquirePluginData(InputPluginStage stage, int64_t frameTime)
+{
+    // Each stage keeps one object per thread, reused for as long as no plugin holds on to it, which is the usual
+    // case, so dispatching an event does not allocate even when a stage is entered while another one is running.
+    // Only an object still in use is left alone for a fresh one. The device name keeps its buffer between events.
+    thread_local std::array<std::shared_ptr<IPluginData>, static_cast<size_t>(InputPluginStage::INPUT_STAGE_BUTT)>
+        cache;
+    size_t index = static_cast<size_t>(stage);
+    std::shared_ptr<IPluginData> data;
+    if (index >= cache.size()) {
+        data = std::make_shared<IPluginData>();
+    } else if (cache[index] == nullptr) {
+        data = cache[index] = std::make_shared<IPluginData>();
+    } else if (cache[index].use_count() == 1) {
+        data = cache[index];
+        data->libInputEventData.orientation = 0;
+        data->libInputEventData.toolType = 0;
+        data->libInputEventData.deviceName.clear();
+    } else {
+        data = std::make_shared<IPluginData>();
+    }
+    data->frameTime = frameTime;
+    data->stage = stage;
+    return data;
+}
+
+bool InputPluginManager::HasSubscriber(InputPluginStage stage, const PluginEventType &event) const
+{
+    auto it = plugins_.find(stage);
+    if (it == plugins_.end()) {
+        return false;
+    }
+    return std::any_of(it->second.cbegin(), it->second.cend(),
+        [stage, &event](const std::shared_ptr<IPluginContext> &plugin) {
+            return ((plugin != nullptr) && plugin->IsSubscribed(stage, event));
+        });
+}
+
 std::shared_ptr<IPluginData> InputPluginManager::GetPluginDataFromLibInput(libinput_event* event)
 {
-    std::shared_ptr<IPluginData> data = std::make_shared<IPluginData>();
+    std::shared_ptr<IPluginData> data = AcquirePluginData(InputPluginStage::INPUT_GLOBAL_INIT);
     auto touch = libinput_event_get_touch_event(event);
     if (!touch) {
         return data;
@@ -699,7 +786,10 @@ std::shared_ptr<IPluginData> InputPluginManager::GetPluginDataFromLibInput(libin
     if (!device) {
         return data;
     }
-    libInputData.deviceName = libinput_device_get_name(device);
+    const char *name = libinput_device_get_name(device);
+    if (name != nullptr) {
+        libInputData.deviceName.assign(name);
+    }
     return data;
 }
 
@@ -823,10 +913,39 @@ int32_t InputPlugin::Init(std::shared_ptr<IInputPlugin> pin)
         return RET_ERR;
     }
     stage_ = stages_[0];
+    if (handle_ != nullptr) {
+        InitSubscriptions(reinterpret_cast<GetPluginSubscription>(dlsym(handle_, "GetPluginSubscription")));
+    }
     plugin_ = pin;
     return RET_OK;
 }
 
+void InputPlugin::InitSubscriptions(GetPluginSubscription getSubscription)
+{
+    subscriptions_.clear();
+    if (getSubscription == nullptr) {
+        MMI_HILOGD("Plugin %{public}s subscribes to every event", name_.c_str());
+        return;
+    }
+    for (const auto stage : stages_) {
+        PluginSubscription subscription;
+        if (getSubscription(stage, subscription) != 0) {
+            MMI_HILOGW("Plugin %{public}s has no subscription at stage:%{public}d", name_.c_str(), stage);
+            continue;
+        }
+        subscriptions_[stage] = subscription;
+    }
+}
+
+bool InputPlugin::IsSubscribed(InputPluginStage stage, const PluginEventType &event) const
+{
+    auto it = subscriptions_.find(stage);
+    if (it == subscriptions_.end()) {
+        return true;
+    }
+    return it->second.Match(event);
+}
+
 void InputPlugin::UnInit()
 {
     // LCOV_EXCL_START
@@ -840,13 +959,14 @@ void InputPlugin::UnInit()
 
 void InputPlugin::DispatchEvent(PluginEventType pluginEvent, int64_t frameTime)
 {
-    std::shared_ptr<IPluginData> data = std::make_shared<IPluginData>();
-    data->frameTime = frameTime;
-    data->stage = stage_;
+    InputPluginStage stage = stage_;
+    std::shared_ptr<IPluginData> data = InputPluginManager::AcquirePluginData(stage, frameTime);
     int32_t result = InputPluginManager::GetInstance()->DoHandleEvent(pluginEvent, data, this);
     if (result == RET_NOTDO) {
-        CHKPV(callback_);
-        callback_(pluginEvent, frameTime);
+        auto it = callbacks_.find(stage);
+        const auto &callback = (it != callbacks_.end()) ? it->second : callback_;
+        CHKPV(callback);
+        callback(pluginEvent, frameTime);
     }
 }
 
@@ -941,24 +1061,28 @@ void InputPlugin::NotifyInputActive(std::shared_ptr<PointerEvent> pointerEvent)
 PluginResult InputPlugin::HandleEvent(libinput_event *event, std::shared_ptr<IPluginData> data)
 {
     CHKPR(plugin_, PluginResult::NotUse);
+    OnHandleEvent(data);
     return plugin_->HandleEvent(event, data);
 }
 
 PluginResult InputPlugin::HandleEvent(std::shared_ptr<PointerEvent> pointerEvent, std::shared_ptr<IPluginData> data)
 {
     CHKPR(plugin_, PluginResult::NotUse);
+    OnHandleEvent(data);
     return plugin_->HandleEvent(pointerEvent, data);
 }
 
 PluginResult InputPlugin::HandleEvent(std::shared_ptr<KeyEvent> keyEvent, std::shared_ptr<IPluginData> data)
 {
     CHKPR(plugin_, PluginResult::NotUse);
+    OnHandleEvent(data);
     return plugin_->HandleEvent(keyEvent, data);
 }
 
 PluginResult InputPlugin::HandleEvent(std::shared_ptr<AxisEvent> axisEvent, std::shared_ptr<IPluginData> data)
 {
     CHKPR(plugin_, PluginResult::NotUse);
+    OnHandleEvent(data);
     return plugin_->HandleEvent(axisEvent, data);
 }
 
@@ -998,6 +1122,18 @@ void InputPlugin::SetCallback(std::function<void(PluginEventType, int64_t)> call
     callback_ = callback;
 }
 
+void InputPlugin::SetCallback(InputPluginStage stage, std::function<void(PluginEventType, int64_t)> callback)
+{
+    callbacks_[stage] = callback;
+}
+
+void InputPlugin::OnHandleEvent(const std::shared_ptr<IPluginData> &data)
+{
+    if (data != nullptr) {
+        stage_ = data->stage;
+    }
+}
+
 std::shared_ptr<IInputPlugin> InputPlugin::GetPlugin()
 {
     return plugin_;
@@ -15,6 +15,8 @@
 
 #include "uds_server.h"
 
+#include <cinttypes>
+
 #include "dfx_hisysevent.h"
 #include "imultimodal_input_connect.h"
 #include "multimodal_input_connect_manager.h"
@@ -87,6 +89,21 @@ bool UDSServer::SendMsg(int32_t fd, NetPacket& pkt)
     return ses->SendMsg(pkt);
 }
 
+bool UDSServer::SendMsg(int32_t fd, NetPacket& pkt, const UDSSession::CoalesceKey& key)
+{
+    if (fd < 0) {
+        MMI_HILOGE("The fd is less than 0");
+        return false;
+    }
+    auto ses = GetSession(fd);
+    if (ses == nullptr) {
+        MMI_HILOGE("The fd:%{public}d not found, The message was discarded. errCode:%{public}d",
+                   fd, SESSION_NOT_FOUND);
+        return false;
+    }
+    return ses->SendMsg(pkt, key);
+}
+
 void UDSServer::Multicast(const std::vector<int32_t>& fdList, NetPacket& pkt)
 {
     for (const auto &item : fdList) {
@@ -138,6 +155,7 @@ int32_t UDSServer::AddSocketPairInfo(const std::string& programName,
     sess->SetTokenType(tokenType);
     sess->SetTokenId(tokenId);
     sess->SetIsRealProcessName(isRealProcessName);
+    sess->SetPendingMsgCallback([this](int32_t fd) { OnSessionPending(fd); });
     if (!AddSession(sess)) {
         MMI_HILOGE("AddSession fail errCode:%{public}d, fd:%{public}d", ADD_SESSION_FAIL, serverFd);
         goto CLOSE_SOCK;
@@ -214,6 +232,14 @@ void UDSServer::Dump(int32_t fd, const std::vector<std::string> &args)
                 "Uid:%d | Pid:%d | Fd:%d | TokenType:%d | Descript:%s\t",
                 udsSession->GetUid(), udsSession->GetPid(), udsSession->GetFd(),
                 udsSession->GetTokenType(), udsSession->GetDescript().c_str());
+        auto stats = udsSession->GetSendStatistics();
+        mprintf(fd,
+                "Fd:%d | SentPackets:%" PRIu64 " | SentBytes:%" PRIu64 " | BatchWrites:%" PRIu64 " | "
+                "QueuedPackets:%" PRIu64 " | DroppedPackets:%" PRIu64 " | CoalescedPackets:%" PRIu64 " | "
+                "SocketFull:%" PRIu64 " | PendingBytes:%zu | PeakPendingBytes:%zu\t",
+                udsSession->GetFd(), stats.sentPackets, stats.sentBytes, stats.batchWrites,
+                stats.queuedPackets, stats.droppedPackets, stats.coalescedPackets, stats.socketFullCount,
+                stats.pendingBytes, stats.peakPendingBytes);
     }
 }
 
@@ -235,6 +261,12 @@ int32_t UDSServer::AddEpoll(EpollEventType type, int32_t fd, bool readOnly)
     return RET_ERR;
 }
 
+int32_t UDSServer::ModEpoll(EpollEventType type, int32_t fd, uint32_t events)
+{
+    MMI_HILOGE("This information should not exist. Subclasses should implement this function");
+    return RET_ERR;
+}
+
 void UDSServer::SetRecvFun(MsgServerFunCallback fun)
 {
     recvFun_ = fun;
@@ -255,6 +287,11 @@ void UDSServer::ReleaseSession(int32_t fd, epoll_event& ev)
         RemoveEpollEvent(fd);
         ev.data.ptr = nullptr;
     }
+    {
+        std::lock_guard<std::mutex> lock(pendingFdsMutex_);
+        pendingFds_.erase(fd);
+        epollOutFds_.erase(fd);
+    }
     if (auto it = circleBufMap_.find(fd); it != circleBufMap_.end()) {
         circleBufMap_.erase(it);
     } else {
@@ -319,11 +356,62 @@ void UDSServer::OnEpollEvent(epoll_event& ev)
     if ((ev.events & EPOLLERR) || (ev.events & EPOLLHUP)) {
         MMI_HILOGI("EPOLLERR or EPOLLHUP fd:%{public}d, ev.events:0x%{public}x", fd, ev.events);
         ReleaseSession(fd, ev);
-    } else if (ev.events & EPOLLIN) {
+        return;
+    }
+    if (ev.events & EPOLLOUT) {
+        FlushPendingMsg(fd);
+    }
+    if (ev.events & EPOLLIN) {
         OnEpollRecv(fd, ev);
     }
 }
 
+void UDSServer::OnSessionPending(int32_t fd)
+{
+    std::lock_guard<std::mutex> lock(pendingFdsMutex_);
+    pendingFds_.insert(fd);
+    if (UDSSession::IsSendBatching()) {
+        return;
+    }
+    // Queued outside the event loop because the socket is full, wait until it becomes writable.
+    if (epollOutFds_.insert(fd).second) {
+        ModEpoll(EPOLL_EVENT_SOCKET, fd, EPOLLIN | EPOLLOUT);
+    }
+}
+
+void UDSServer::FlushPendingMsg(int32_t fd)
+{
+    auto sess = GetSession(fd);
+    bool drained = ((sess == nullptr) || sess->FlushPendingMsg());
+    std::lock_guard<std::mutex> lock(pendingFdsMutex_);
+    if (!drained) {
+        if (epollOutFds_.insert(fd).second) {
+            ModEpoll(EPOLL_EVENT_SOCKET, fd, EPOLLIN | EPOLLOUT);
+        }
+        return;
+    }
+    // Another thread may have queued a packet since the flush; it stays pending then.
+    if ((sess != nullptr) && sess->HasPendingMsg()) {
+        return;
+    }
+    pendingFds_.erase(fd);
+    if ((epollOutFds_.erase(fd) != 0) && (sess != nullptr)) {
+        ModEpoll(EPOLL_EVENT_SOCKET, fd, EPOLLIN);
+    }
+}
+
+void UDSServer::FlushPendingMsgs()
+{
+    std::vector<int32_t> pendingFds;
+    {
+        std::lock_guard<std::mutex> lock(pendingFdsMutex_);
+        pendingFds.assign(pendingFds_.begin(), pendingFds_.end());
+    }
+    for (int32_t fd : pendingFds) {
+        FlushPendingMsg(fd);
+    }
+}
+
 void UDSServer::AddEpollEvent(int32_t fd, std::shared_ptr<mmi_epoll_event> epollEvent)
 {
     MMI_HILOGI("Add %{public}d in epollEvent map", fd);
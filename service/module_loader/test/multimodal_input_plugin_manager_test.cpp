@@ -36,6 +36,19 @@ namespace MMI {
 namespace {
 using namespace testing;
 using namespace testing::ext;
+
+int32_t SubscribeKeyDown(InputPluginStage stage, PluginSubscription &subscription)
+{
+    subscription.eventKinds = PLUGIN_EVENT_KEY;
+    subscription.keyActions = (uint64_t { 1 } << KeyEvent::KEY_ACTION_DOWN);
+    return 0;
+}
+
+int32_t FailSubscription(InputPluginStage stage, PluginSubscription &subscription)
+{
+    subscription.eventKinds = 0;
+    return -1;
+}
 } // namespace
 
 const std::string PATH { "/system/lib64/multimodalinput/autorun" };
@@ -1489,6 +1502,47 @@ HWTEST_F(
     EXPECT_NE(inputPluginContext->callback_, nullptr);
 }
 
+/**
+ * @tc.name: MultimodalInputPluginManagerTest_SetCallback_002
+ * @tc.desc: Test events a plugin dispatches go to the callback of the stage it handled the event at
+ * @tc.type: FUNC
+ * @tc.require: test SetCallback
+ */
+HWTEST_F(
+    MultimodalInputPluginManagerTest, MultimodalInputPluginManagerTest_InputPlugin_SetCallback_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto mockInputPlugin = std::make_shared<NiceMock<MockInputPlugin>>();
+    EXPECT_CALL(*mockInputPlugin, GetStages()).WillRepeatedly(Return(std::vector<InputPluginStage> {
+        InputPluginStage::INPUT_AFTER_NORMALIZED, InputPluginStage::INPUT_BEFORE_KEYCOMMAND }));
+    std::shared_ptr<InputPlugin> inputPluginContext = std::make_shared<InputPlugin>(nullptr);
+    ASSERT_EQ(inputPluginContext->Init(mockInputPlugin), RET_OK);
+    int32_t nNormalized = 0;
+    int32_t nBeforeKeyCommand = 0;
+    inputPluginContext->SetCallback(InputPluginStage::INPUT_AFTER_NORMALIZED,
+        [&nNormalized](PluginEventType, int64_t) { ++nNormalized; });
+    inputPluginContext->SetCallback(InputPluginStage::INPUT_BEFORE_KEYCOMMAND,
+        [&nBeforeKeyCommand](PluginEventType, int64_t) { ++nBeforeKeyCommand; });
+    auto keyEvent = KeyEvent::Create();
+    ASSERT_NE(keyEvent, nullptr);
+
+    auto data = InputPluginManager::AcquirePluginData(InputPluginStage::INPUT_BEFORE_KEYCOMMAND);
+    inputPluginContext->HandleEvent(keyEvent, data);
+    data.reset();
+    inputPluginContext->DispatchEvent(keyEvent, 0);
+    EXPECT_EQ(nNormalized, 0);
+    EXPECT_EQ(nBeforeKeyCommand, 1);
+
+    auto pointerEvent = PointerEvent::Create();
+    ASSERT_NE(pointerEvent, nullptr);
+    data = InputPluginManager::AcquirePluginData(InputPluginStage::INPUT_AFTER_NORMALIZED);
+    inputPluginContext->HandleEvent(pointerEvent, data);
+    data.reset();
+    inputPluginContext->DispatchEvent(pointerEvent, 0);
+    EXPECT_EQ(nNormalized, 1);
+    EXPECT_EQ(nBeforeKeyCommand, 1);
+}
+
 /**
  * @tc.name: MultimodalInputPluginManagerTest_IsFingerPressed_001
  * @tc.desc: test TOUCH_EVENT_HDR == nullptr
@@ -3336,5 +3390,130 @@ HWTEST_F(MultimodalInputPluginManagerTest,
     PluginResult result = inputPluginContext->HandleEvent(axisEvent, data);
     EXPECT_EQ(result, PluginResult::NotUse);
 }
+
+/**
+ * @tc.name: MultimodalInputPluginManagerTest_InputPlugin_IsSubscribed_001
+ * @tc.desc: Test InputPlugin IsSubscribed with the subscription the plugin declared
+ * @tc.type: FUNC
+ * @tc.require: test IsSubscribed
+ */
+HWTEST_F(MultimodalInputPluginManagerTest,
+    MultimodalInputPluginManagerTest_InputPlugin_IsSubscribed_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto mockInputPlugin = std::make_shared<NiceMock<MockInputPlugin>>();
+    EXPECT_CALL(*mockInputPlugin, GetStages())
+        .WillRepeatedly(Return(std::vector<InputPluginStage> { InputPluginStage::INPUT_BEFORE_KEYCOMMAND }));
+    std::shared_ptr<InputPlugin> inputPluginContext = std::make_shared<InputPlugin>(nullptr);
+    ASSERT_EQ(inputPluginContext->Init(mockInputPlugin), RET_OK);
+    inputPluginContext->InitSubscriptions(SubscribeKeyDown);
+
+    auto keyEvent = KeyEvent::Create();
+    ASSERT_NE(keyEvent, nullptr);
+    keyEvent->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
+    EXPECT_TRUE(inputPluginContext->IsSubscribed(InputPluginStage::INPUT_BEFORE_KEYCOMMAND, keyEvent));
+    keyEvent->SetKeyAction(KeyEvent::KEY_ACTION_UP);
+    EXPECT_FALSE(inputPluginContext->IsSubscribed(InputPluginStage::INPUT_BEFORE_KEYCOMMAND, keyEvent));
+    auto pointerEvent = PointerEvent::Create();
+    EXPECT_FALSE(inputPluginContext->IsSubscribed(InputPluginStage::INPUT_BEFORE_KEYCOMMAND, pointerEvent));
+}
+
+/**
+ * @tc.name: MultimodalInputPluginManagerTest_InputPlugin_IsSubscribed_002
+ * @tc.desc: Test a plugin without a subscription, or whose subscription fails, gets every event
+ * @tc.type: FUNC
+ * @tc.require: test IsSubscribed
+ */
+HWTEST_F(MultimodalInputPluginManagerTest,
+    MultimodalInputPluginManagerTest_InputPlugin_IsSubscribed_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto mockInputPlugin = std::make_shared<NiceMock<MockInputPlugin>>();
+    EXPECT_CALL(*mockInputPlugin, GetStages())
+        .WillRepeatedly(Return(std::vector<InputPluginStage> { InputPluginStage::INPUT_BEFORE_KEYCOMMAND }));
+    std::shared_ptr<InputPlugin> inputPluginContext = std::make_shared<InputPlugin>(nullptr);
+    ASSERT_EQ(inputPluginContext->Init(mockInputPlugin), RET_OK);
+    auto keyEvent = KeyEvent::Create();
+    ASSERT_NE(keyEvent, nullptr);
+    keyEvent->SetKeyAction(KeyEvent::KEY_ACTION_UP);
+    auto pointerEvent = PointerEvent::Create();
+    ASSERT_NE(pointerEvent, nullptr);
+
+    inputPluginContext->InitSubscriptions(nullptr);
+    EXPECT_TRUE(inputPluginContext->IsSubscribed(InputPluginStage::INPUT_BEFORE_KEYCOMMAND, keyEvent));
+    EXPECT_TRUE(inputPluginContext->IsSubscribed(InputPluginStage::INPUT_BEFORE_KEYCOMMAND, pointerEvent));
+
+    inputPluginContext->InitSubscriptions(FailSubscription);
+    EXPECT_TRUE(inputPluginContext->IsSubscribed(InputPluginStage::INPUT_BEFORE_KEYCOMMAND, keyEvent));
+    EXPECT_TRUE(inputPluginContext->IsSubscribed(InputPluginStage::INPUT_BEFORE_KEYCOMMAND, pointerEvent));
+
+    inputPluginContext->InitSubscriptions(SubscribeKeyDown);
+    EXPECT_FALSE(inputPluginContext->IsSubscribed(InputPluginStage::INPUT_BEFORE_KEYCOMMAND, keyEvent));
+    inputPluginContext->InitSubscriptions(nullptr);
+    EXPECT_TRUE(inputPluginContext->IsSubscribed(InputPluginStage::INPUT_BEFORE_KEYCOMMAND, keyEvent));
+}
+
+/**
+ * @tc.name: MultimodalInputPluginManagerTest_InputPluginManager_DoHandleEvent_003
+ * @tc.desc: DoHandleEvent should not hand a plugin events outside its subscription
+ * @tc.type: FUNC
+ * @tc.require: test DoHandleEvent
+ */
+HWTEST_F(MultimodalInputPluginManagerTest, MultimodalInputPluginManagerTest_InputPluginManager_DoHandleEvent_003,
+    TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto mockInputPlugin = std::make_shared<NiceMock<MockInputPlugin>>();
+    EXPECT_CALL(*mockInputPlugin, GetStages())
+        .WillRepeatedly(Return(std::vector<InputPluginStage> { InputPluginStage::INPUT_AFTER_KEYCOMMAND }));
+    std::shared_ptr<InputPlugin> inputPluginContext = std::make_shared<InputPlugin>(nullptr);
+    ASSERT_EQ(inputPluginContext->Init(mockInputPlugin), RET_OK);
+    inputPluginContext->InitSubscriptions(SubscribeKeyDown);
+
+    InputPluginManager* manager = InputPluginManager::GetInstance();
+    ASSERT_NE(manager, nullptr);
+    manager->plugins_[InputPluginStage::INPUT_AFTER_KEYCOMMAND] = { inputPluginContext };
+    auto keyEvent = KeyEvent::Create();
+    ASSERT_NE(keyEvent, nullptr);
+    EXPECT_CALL(*mockInputPlugin, HandleEvent(Matcher<std::shared_ptr<KeyEvent>>(_), _))
+        .Times(1)
+        .WillOnce(Return(PluginResult::UseNoNeedReissue));
+    auto data = InputPluginManager::AcquirePluginData(InputPluginStage::INPUT_AFTER_KEYCOMMAND);
+    keyEvent->SetKeyAction(KeyEvent::KEY_ACTION_UP);
+    EXPECT_FALSE(manager->HasSubscriber(InputPluginStage::INPUT_AFTER_KEYCOMMAND, keyEvent));
+    EXPECT_EQ(manager->DoHandleEvent(keyEvent, data, nullptr), RET_NOTDO);
+    keyEvent->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
+    EXPECT_TRUE(manager->HasSubscriber(InputPluginStage::INPUT_AFTER_KEYCOMMAND, keyEvent));
+    EXPECT_EQ(manager->DoHandleEvent(keyEvent, data, nullptr), RET_DO);
+    manager->plugins_.erase(InputPluginStage::INPUT_AFTER_KEYCOMMAND);
+}
+
+/**
+ * @tc.name: MultimodalInputPluginManagerTest_InputPluginManager_AcquirePluginData_001
+ * @tc.desc: AcquirePluginData should reuse the data nobody holds and leave held data alone
+ * @tc.type: FUNC
+ * @tc.require: test AcquirePluginData
+ */
+HWTEST_F(MultimodalInputPluginManagerTest,
+    MultimodalInputPluginManagerTest_InputPluginManager_AcquirePluginData_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto data = InputPluginManager::AcquirePluginData(InputPluginStage::INPUT_AFTER_NORMALIZED, 1);
+    ASSERT_NE(data, nullptr);
+    data->libInputEventData.deviceName = "touchscreen";
+    IPluginData *first = data.get();
+    data.reset();
+
+    data = InputPluginManager::AcquirePluginData(InputPluginStage::INPUT_BEFORE_KEYCOMMAND, 2);
+    EXPECT_EQ(data.get(), first);
+    EXPECT_EQ(data->stage, InputPluginStage::INPUT_BEFORE_KEYCOMMAND);
+    EXPECT_EQ(data->frameTime, 2);
+    EXPECT_TRUE(data->libInputEventData.deviceName.empty());
+
+    auto nested = InputPluginManager::AcquirePluginData(InputPluginStage::INPUT_AFTER_NORMALIZED, 3);
+    EXPECT_NE(nested.get(), data.get());
+    EXPECT_EQ(data->stage, InputPluginStage::INPUT_BEFORE_KEYCOMMAND);
+    EXPECT_EQ(data->frameTime, 2);
+}
 } // namespace MMI
 } // namespace OHOS
@@ -100,6 +100,7 @@ private:
 
 private:
     bool sessionLostCallbackInitialized_ { false };
+    bool pluginCallbackInstalled_ { false };
     MonitorCollection monitors_;
 };
 } // namespace MMI
@@ -33,23 +33,25 @@ void EventPreMonitorHandler::HandleKeyEvent(const std::shared_ptr<KeyEvent> keyE
     CHKPV(keyEvent);
     OnHandleEvent(keyEvent);
     CHKPV(nextHandler_);
-    auto callback = [this](PluginEventType pluginEvent, int64_t frameTime) {
-        auto keyEvent = std::get_if<std::shared_ptr<KeyEvent>>(&pluginEvent);
-        if (!keyEvent) return;
-        this->nextHandler_->HandleKeyEvent(*keyEvent);
-    };
     auto manager = InputPluginManager::GetInstance();
     if (manager != nullptr) {
-        std::shared_ptr<IPluginData> data = std::make_shared<IPluginData>();
-        data->frameTime = keyEvent->GetActionTime();
-        data->stage = InputPluginStage::INPUT_BEFORE_KEYCOMMAND;
-        manager->PluginAssignmentCallBack(callback, InputPluginStage::INPUT_BEFORE_KEYCOMMAND);
+        if (!pluginCallbackInstalled_) {
+            auto callback = [this](PluginEventType pluginEvent, int64_t frameTime) {
+                auto keyEvent = std::get_if<std::shared_ptr<KeyEvent>>(&pluginEvent);
+                if (!keyEvent) return;
+                this->nextHandler_->HandleKeyEvent(*keyEvent);
+            };
+            manager->PluginAssignmentCallBack(callback, InputPluginStage::INPUT_BEFORE_KEYCOMMAND);
+            pluginCallbackInstalled_ = true;
+        }
+        auto data = InputPluginManager::AcquirePluginData(
+            InputPluginStage::INPUT_BEFORE_KEYCOMMAND, keyEvent->GetActionTime());
         int32_t result = manager->HandleEvent(keyEvent, data);
         if (result != 0) {
             return;
         }
     }
-    callback(keyEvent, keyEvent->GetActionTime());
+    nextHandler_->HandleKeyEvent(keyEvent);
 }
 #endif // OHOS_BUILD_ENABLE_KEYBOARD
 
@@ -18,6 +18,7 @@
 
 #include "i_input_event_handler.h"
 #include "key_gesture_manager.h"
+#include "key_subscription_index.h"
 #include "nap_process.h"
 #include "shortcut_user_resolver.h"
 
@@ -112,7 +113,8 @@ private:
 #endif // SHORTCUT_KEY_MANAGER_ENABLED
     int32_t AddSubscriber(std::shared_ptr<Subscriber> subscriber, std::shared_ptr<KeyOption> option, bool isSystem);
     int32_t RemoveSubscriber(SessionPtr sess, int32_t subscribeId, bool isSystem);
-    bool IsMatchForegroundPid(std::list<std::shared_ptr<Subscriber>> subs, std::set<int32_t> foregroundPids);
+    bool IsMatchForegroundPid(const std::list<std::shared_ptr<Subscriber>> &subs,
+        const std::set<int32_t> &foregroundPids);
     // Returns true if `subscriber` should participate for an event whose owning user is
     // `eventUserId`. Global subscribers (USER_ID_ALL) and the fallback (eventUserId < 0) pass.
     bool IsMatchEventUser(const std::shared_ptr<Subscriber> &subscriber, int32_t eventUserId) const;
@@ -128,7 +130,7 @@ private:
     void PrintKeyOption(const std::shared_ptr<KeyOption> keyOption);
     void PrintCriticalKeySubscribeInfo(int32_t subscribeId,
         SessionPtr sess, const std::shared_ptr<KeyOption> keyOption);
-    void ClearSubscriberTimer(std::list<std::shared_ptr<Subscriber>> subscribers);
+    void ClearSubscriberTimer(const std::list<std::shared_ptr<Subscriber>> &subscribers);
     void GetForegroundPids(std::set<int32_t> &pidList);
     void PublishKeyPressCommonEvent(std::shared_ptr<KeyEvent> keyEvent);
     void RemoveSubscriberTimer(std::shared_ptr<KeyEvent> keyEvent);
@@ -150,6 +152,10 @@ private:
         int32_t keyCode, const std::vector<int32_t> &pressedKeys,
         const std::shared_ptr<KeyOption> &keyOption,
         std::list<std::shared_ptr<Subscriber>> &subscribers, bool &handled);
+    void HandleKeyDownForOption(const std::shared_ptr<KeyEvent> &keyEvent,
+        const std::vector<int32_t> &pressedKeys, const std::shared_ptr<KeyOption> &keyOption,
+        std::list<std::shared_ptr<Subscriber>> &subscribers, bool &handled);
+    void RefreshSubscriptionIndex();
     void HandleKeyUpForPressedType(const std::shared_ptr<KeyEvent> &keyEvent,
         int32_t keyCode, const std::shared_ptr<KeyOption> &keyOption,
         std::list<std::shared_ptr<Subscriber>> &subscribers, bool &handled);
@@ -175,6 +181,8 @@ private:
     std::map<Subscriber*, AllReleasedState> allReleasedStates_;
     SubscriberCollection subscriberMap_;
     std::mutex subscriberMapMutex_;
+    // Key down lookup over the options of subscriberMap_, guarded by subscriberMapMutex_.
+    KeySubscriptionIndex subscriptionIndex_;
     SubscriberCollection keyGestures_;
     KeyGestureManager keyGestureMgr_;
     bool callbackInitialized_ { false };
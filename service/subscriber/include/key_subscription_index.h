@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef KEY_SUBSCRIPTION_INDEX_H
+#define KEY_SUBSCRIPTION_INDEX_H
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "key_option.h"
+
+namespace OHOS {
+namespace MMI {
+/*
+ * Key options of the key subscriptions, bucketed by the key codes whose key down they react to, so that a
+ * key down only visits the options of its own key instead of every subscription. Each entry carries a
+ * folded bitset of its pre-keys that rejects most pressed-key combinations before the exact set compare.
+ */
+class KeySubscriptionIndex final {
+public:
+    struct Entry {
+        std::shared_ptr<KeyOption> keyOption { nullptr };
+        uint64_t preKeyMask { 0 };
+        size_t preKeyCount { 0 };
+    };
+
+    void Add(const std::shared_ptr<KeyOption> &keyOption);
+    void Clear();
+    size_t GetSize() const;
+    const std::vector<Entry> &GetKeyDownEntries(int32_t keyCode) const;
+    // Options whose subscribers may hold a long-press timer, to be cancelled by a key down of another key.
+    const std::vector<std::shared_ptr<KeyOption>> &GetLongPressOptions() const;
+
+    static uint64_t GetKeyMask(const std::vector<int32_t> &keyCodes);
+    static bool MayMatchPreKeys(const Entry &entry, uint64_t pressedMask, size_t pressedCount);
+
+private:
+    std::unordered_map<int32_t, std::vector<Entry>> keyDownEntries_;
+    std::vector<std::shared_ptr<KeyOption>> longPressOptions_;
+    size_t optionCount_ { 0 };
+};
+} // namespace MMI
+} // namespace OHOS
+
+#endif // KEY_SUBSCRIPTION_INDEX_H
@@ -426,6 +426,7 @@ int32_t KeySubscriberHandler::AddSubscriber(std::shared_ptr<Subscriber> subscrib
     }
     MMI_HILOGD("Add subscriber Id:%{public}d", subscriber->id_);
     subscriberMap_[option] = {subscriber};
+    subscriptionIndex_.Add(option);
     return RET_OK;
 }
 
@@ -838,8 +839,8 @@ bool KeySubscriberHandler::IsEqualPreKeys(const std::set<int32_t> &preKeys, cons
     return true;
 }
 
-bool KeySubscriberHandler::IsMatchForegroundPid(std::list<std::shared_ptr<Subscriber>> subs,
-    std::set<int32_t> foregroundPids)
+bool KeySubscriberHandler::IsMatchForegroundPid(const std::list<std::shared_ptr<Subscriber>> &subs,
+    const std::set<int32_t> &foregroundPids)
 {
     isForegroundExits_ = false;
     foregroundPids_.clear();
@@ -1082,9 +1083,9 @@ bool KeySubscriberHandler::AddTimer(const std::shared_ptr<Subscriber> &subscribe
     return true;
 }
 
-void KeySubscriberHandler::ClearSubscriberTimer(std::list<std::shared_ptr<Subscriber>> subscribers)
+void KeySubscriberHandler::ClearSubscriberTimer(const std::list<std::shared_ptr<Subscriber>> &subscribers)
 {
-    for (auto &subscriber : subscribers) {
+    for (const auto &subscriber : subscribers) {
         CHKPC(subscriber);
         ClearTimer(subscriber);
     }
@@ -1178,37 +1179,78 @@ bool KeySubscriberHandler::HandleKeyDown(const std::shared_ptr<KeyEvent> &keyEve
     std::set<int32_t> pids;
     GetForegroundPids(pids);
     std::lock_guard<std::mutex> lock(subscriberMapMutex_);
-    for (auto &iter : subscriberMap_) {
-        auto keyOption = iter.first;
-        auto subscribers = iter.second;
-        IsMatchForegroundPid(subscribers, pids);
-        CHKPC(keyOption);
-        if (keyOption->GetTriggerType() == KeyCommandTriggerType::ALL_RELEASED) {
-            HandleKeyForAllReleased(keyEvent, keyOption, subscribers, handled);
-            continue;
-        }
-        if (keyOption->GetTriggerType() == KeyCommandTriggerType::PRESSED ||
-            keyOption->GetTriggerType() == KeyCommandTriggerType::REPEAT_PRESSED) {
-            HandleKeyDownForPressedType(keyEvent, keyCode, pressedKeys, keyOption, subscribers, handled);
-            continue;
-        }
-        if (!keyOption->IsFinalKeyDown()) {
+    RefreshSubscriptionIndex();
+    uint64_t pressedMask = KeySubscriptionIndex::GetKeyMask(pressedKeys);
+    for (const auto &entry : subscriptionIndex_.GetKeyDownEntries(keyCode)) {
+        auto iter = subscriberMap_.find(entry.keyOption);
+        if (iter == subscriberMap_.end()) {
             continue;
         }
-        if (keyCode != keyOption->GetFinalKey()) {
+        auto &subscribers = iter->second;
+        if ((entry.keyOption->GetTriggerType() != KeyCommandTriggerType::ALL_RELEASED) &&
+            !KeySubscriptionIndex::MayMatchPreKeys(entry, pressedMask, pressedKeys.size())) {
+            // The exact pre-key check would fail as well, which cancels a pending long press.
             ClearSubscriberTimer(subscribers);
             continue;
         }
-        if (!IsPreKeysMatch(keyOption->GetPreKeys(), pressedKeys)) {
-            ClearSubscriberTimer(subscribers);
+        IsMatchForegroundPid(subscribers, pids);
+        HandleKeyDownForOption(keyEvent, pressedKeys, iter->first, subscribers, handled);
+    }
+    // A key down of any other key interrupts the pending long presses.
+    for (const auto &keyOption : subscriptionIndex_.GetLongPressOptions()) {
+        if (keyOption->GetFinalKey() == keyCode) {
             continue;
         }
-        NotifyKeyDownSubscriber(keyEvent, keyOption, subscribers, handled);
+        auto iter = subscriberMap_.find(keyOption);
+        if (iter != subscriberMap_.end()) {
+            ClearSubscriberTimer(iter->second);
+        }
     }
     MMI_HILOGD("Handle key down:%{public}s", handled ? "true" : "false");
     return handled;
 }
 
+void KeySubscriberHandler::HandleKeyDownForOption(const std::shared_ptr<KeyEvent> &keyEvent,
+    const std::vector<int32_t> &pressedKeys, const std::shared_ptr<KeyOption> &keyOption,
+    std::list<std::shared_ptr<Subscriber>> &subscribers, bool &handled)
+{
+    CHKPV(keyOption);
+    auto keyCode = keyEvent->GetKeyCode();
+    if (keyOption->GetTriggerType() == KeyCommandTriggerType::ALL_RELEASED) {
+        HandleKeyForAllReleased(keyEvent, keyOption, subscribers, handled);
+        return;
+    }
+    if (keyOption->GetTriggerType() == KeyCommandTriggerType::PRESSED ||
+        keyOption->GetTriggerType() == KeyCommandTriggerType::REPEAT_PRESSED) {
+        HandleKeyDownForPressedType(keyEvent, keyCode, pressedKeys, keyOption, subscribers, handled);
+        return;
+    }
+    if (!keyOption->IsFinalKeyDown()) {
+        return;
+    }
+    if (keyCode != keyOption->GetFinalKey()) {
+        ClearSubscriberTimer(subscribers);
+        return;
+    }
+    if (!IsPreKeysMatch(keyOption->GetPreKeys(), pressedKeys)) {
+        ClearSubscriberTimer(subscribers);
+        return;
+    }
+    NotifyKeyDownSubscriber(keyEvent, keyOption, subscribers, handled);
+}
+
+void KeySubscriberHandler::RefreshSubscriptionIndex()
+{
+    // Options are never removed from subscriberMap_, a size change means options were inserted behind the index.
+    if (subscriptionIndex_.GetSize() == subscriberMap_.size()) {
+        return;
+    }
+    subscriptionIndex_.Clear();
+    for (const auto &item : subscriberMap_) {
+        subscriptionIndex_.Add(item.first);
+    }
+}
+
 void KeySubscriberHandler::SubscriberNotifyNap(const std::shared_ptr<Subscriber> subscriber)
 {
     CHKPV(subscriber);
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "key_subscription_index.h"
+
+#include <set>
+
+#include "mmi_log.h"
+#include "trigger_event_dispatcher.h"
+
+#undef MMI_LOG_DOMAIN
+#define MMI_LOG_DOMAIN MMI_LOG_HANDLER
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "KeySubscriptionIndex"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr uint32_t KEY_MASK_BITS { 64 };
+
+uint64_t GetKeyBit(int32_t keyCode)
+{
+    return uint64_t { 1 } << (static_cast<uint32_t>(keyCode) % KEY_MASK_BITS);
+}
+
+bool IsPressedType(int32_t triggerType)
+{
+    return (triggerType == KeyCommandTriggerType::PRESSED) || (triggerType == KeyCommandTriggerType::REPEAT_PRESSED);
+}
+} // namespace
+
+void KeySubscriptionIndex::Add(const std::shared_ptr<KeyOption> &keyOption)
+{
+    ++optionCount_;
+    CHKPV(keyOption);
+    int32_t triggerType = keyOption->GetTriggerType();
+    bool isAllReleased = (triggerType == KeyCommandTriggerType::ALL_RELEASED);
+    if (!isAllReleased && !IsPressedType(triggerType) && !keyOption->IsFinalKeyDown()) {
+        // Subscriptions of the final key up are never matched on key down.
+        return;
+    }
+    std::set<int32_t> preKeys = keyOption->GetPreKeys();
+    Entry entry { keyOption, 0, preKeys.size() };
+    for (int32_t preKey : preKeys) {
+        entry.preKeyMask |= GetKeyBit(preKey);
+    }
+    keyDownEntries_[keyOption->GetFinalKey()].push_back(entry);
+    if (isAllReleased) {
+        // A pressed pre-key may have to be forwarded to a combination that is already activated.
+        for (int32_t preKey : preKeys) {
+            if (preKey != keyOption->GetFinalKey()) {
+                keyDownEntries_[preKey].push_back(entry);
+            }
+        }
+        return;
+    }
+    if (!IsPressedType(triggerType) && (keyOption->GetFinalKeyDownDuration() > 0)) {
+        longPressOptions_.push_back(keyOption);
+    }
+}
+
+void KeySubscriptionIndex::Clear()
+{
+    keyDownEntries_.clear();
+    longPressOptions_.clear();
+    optionCount_ = 0;
+}
+
+size_t KeySubscriptionIndex::GetSize() const
+{
+    return optionCount_;
+}
+
+const std::vector<KeySubscriptionIndex::Entry> &KeySubscriptionIndex::GetKeyDownEntries(int32_t keyCode) const
+{
+    static const std::vector<Entry> emptyEntries;
+    auto iter = keyDownEntries_.find(keyCode);
+    if (iter == keyDownEntries_.end()) {
+        return emptyEntries;
+    }
+    return iter->second;
+}
+
+const std::vector<std::shared_ptr<KeyOption>> &KeySubscriptionIndex::GetLongPressOptions() const
+{
+    return longPressOptions_;
+}
+
+uint64_t KeySubscriptionIndex::GetKeyMask(const std::vector<int32_t> &keyCodes)
+{
+    uint64_t mask = 0;
+    for (int32_t keyCode : keyCodes) {
+        mask |= GetKeyBit(keyCode);
+    }
+    return mask;
+}
+
+bool KeySubscriptionIndex::MayMatchPreKeys(const Entry &entry, uint64_t pressedMask, size_t pressedCount)
+{
+    if (entry.preKeyCount == 0) {
+        return true;
+    }
+    // Same contract as KeySubscriberHandler::IsPreKeysMatch: as many keys, each of them a pre-key.
+    return (entry.preKeyCount == pressedCount) && ((pressedMask & ~entry.preKeyMask) == 0);
+}
+} // namespace MMI
+} // namespace OHOS
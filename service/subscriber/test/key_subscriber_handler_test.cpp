@@ -6924,5 +6924,77 @@ HWTEST_F(KeySubscriberHandlerTest, KeySubscriberHandlerTest_ResetAllReleasedStat
     handler.ResetAllReleasedState(nullptr);
     EXPECT_TRUE(handler.allReleasedStates_.empty());
 }
+
+/**
+ * @tc.name: KeySubscriberHandlerTest_HandleKeyDown_012
+ * @tc.desc: Verify a key down only reaches the options indexed under its key code
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(KeySubscriberHandlerTest, KeySubscriberHandlerTest_HandleKeyDown_012, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    KeySubscriberHandler handler;
+    SessionPtr sess = std::make_shared<UDSSession>(PROGRAM_NAME, MODULE_TYPE, UDS_FD, UDS_UID, UDS_PID);
+    auto keyOptionA = std::make_shared<KeyOption>();
+    keyOptionA->SetFinalKeyDown(true);
+    keyOptionA->SetFinalKey(KeyEvent::KEYCODE_A);
+    auto keyOptionB = std::make_shared<KeyOption>();
+    keyOptionB->SetFinalKeyDown(true);
+    keyOptionB->SetFinalKey(KeyEvent::KEYCODE_B);
+    keyOptionB->SetPreKeys({ KeyEvent::KEYCODE_CTRL_LEFT });
+    auto keyOptionUp = std::make_shared<KeyOption>();
+    keyOptionUp->SetFinalKeyDown(false);
+    keyOptionUp->SetFinalKey(KeyEvent::KEYCODE_A);
+    handler.subscriberMap_[keyOptionA] = { std::make_shared<KeySubscriberHandler::Subscriber>(1, sess, keyOptionA) };
+    handler.subscriberMap_[keyOptionB] = { std::make_shared<KeySubscriberHandler::Subscriber>(2, sess, keyOptionB) };
+    handler.subscriberMap_[keyOptionUp] = { std::make_shared<KeySubscriberHandler::Subscriber>(3, sess, keyOptionUp) };
+
+    std::shared_ptr<KeyEvent> keyEvent = KeyEvent::Create();
+    ASSERT_NE(keyEvent, nullptr);
+    keyEvent->SetKeyCode(KeyEvent::KEYCODE_A);
+    EXPECT_TRUE(handler.HandleKeyDown(keyEvent));
+    EXPECT_EQ(handler.subscriptionIndex_.GetSize(), 3U);
+    EXPECT_EQ(handler.subscriptionIndex_.GetKeyDownEntries(KeyEvent::KEYCODE_A).size(), 1U);
+    EXPECT_EQ(handler.subscriptionIndex_.GetKeyDownEntries(KeyEvent::KEYCODE_B).size(), 1U);
+
+    keyEvent->SetKeyCode(KeyEvent::KEYCODE_B);
+    EXPECT_FALSE(handler.HandleKeyDown(keyEvent));
+    KeyEvent::KeyItem item;
+    item.SetKeyCode(KeyEvent::KEYCODE_CTRL_LEFT);
+    item.SetPressed(true);
+    keyEvent->AddKeyItem(item);
+    EXPECT_TRUE(handler.HandleKeyDown(keyEvent));
+
+    keyEvent->SetKeyCode(KeyEvent::KEYCODE_C);
+    EXPECT_FALSE(handler.HandleKeyDown(keyEvent));
+}
+
+/**
+ * @tc.name: KeySubscriberHandlerTest_HandleKeyDown_013
+ * @tc.desc: Verify a key down of another key cancels the pending long press
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(KeySubscriberHandlerTest, KeySubscriberHandlerTest_HandleKeyDown_013, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    KeySubscriberHandler handler;
+    SessionPtr sess = std::make_shared<UDSSession>(PROGRAM_NAME, MODULE_TYPE, UDS_FD, UDS_UID, UDS_PID);
+    auto keyOption = std::make_shared<KeyOption>();
+    keyOption->SetFinalKeyDown(true);
+    keyOption->SetFinalKey(KeyEvent::KEYCODE_POWER);
+    keyOption->SetFinalKeyDownDuration(3000);
+    auto subscriber = std::make_shared<KeySubscriberHandler::Subscriber>(1, sess, keyOption);
+    subscriber->timerId_ = 1;
+    handler.subscriberMap_[keyOption] = { subscriber };
+
+    std::shared_ptr<KeyEvent> keyEvent = KeyEvent::Create();
+    ASSERT_NE(keyEvent, nullptr);
+    keyEvent->SetKeyCode(KeyEvent::KEYCODE_VOLUME_DOWN);
+    EXPECT_FALSE(handler.HandleKeyDown(keyEvent));
+    EXPECT_EQ(handler.subscriptionIndex_.GetLongPressOptions().size(), 1U);
+    EXPECT_EQ(subscriber->timerId_, -1);
+}
 } // namespace MMI
 } // namespace OHOS
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "key_event.h"
+#include "key_subscription_index.h"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr int32_t FINAL_KEY_SPREAD { 64 };
+constexpr int32_t SUBSCRIBERS_PER_OPTION { 2 };
+const int32_t KEY_CODE { KeyEvent::KEYCODE_A + 1 };
+const std::vector<int32_t> PRESSED_KEYS { KeyEvent::KEYCODE_CTRL_LEFT };
+const std::vector<std::set<int32_t>> PRE_KEY_SETS {
+    {},
+    { KeyEvent::KEYCODE_CTRL_LEFT },
+    { KeyEvent::KEYCODE_SHIFT_LEFT },
+    { KeyEvent::KEYCODE_CTRL_LEFT, KeyEvent::KEYCODE_SHIFT_LEFT },
+    { KeyEvent::KEYCODE_ALT_LEFT },
+};
+
+// Stands in for the subscriber lists of KeySubscriberHandler, only their traversal matters here.
+using SubscriberMap = std::map<std::shared_ptr<KeyOption>, std::list<std::shared_ptr<int32_t>>>;
+
+SubscriberMap CreateSubscriptions(int32_t count)
+{
+    SubscriberMap subscriptions;
+    for (int32_t i = 0; i < count; ++i) {
+        auto keyOption = std::make_shared<KeyOption>();
+        keyOption->SetFinalKeyDown(true);
+        keyOption->SetFinalKey(KeyEvent::KEYCODE_A + i % FINAL_KEY_SPREAD);
+        keyOption->SetPreKeys(PRE_KEY_SETS[(i / FINAL_KEY_SPREAD) % PRE_KEY_SETS.size()]);
+        auto &subscribers = subscriptions[keyOption];
+        for (int32_t j = 0; j < SUBSCRIBERS_PER_OPTION; ++j) {
+            subscribers.push_back(std::make_shared<int32_t>(i));
+        }
+    }
+    return subscriptions;
+}
+
+// Same contract as KeySubscriberHandler::IsPreKeysMatch.
+bool IsPreKeysMatch(const std::set<int32_t> &preKeys, const std::vector<int32_t> &pressedKeys)
+{
+    if (preKeys.empty()) {
+        return true;
+    }
+    if (preKeys.size() != pressedKeys.size()) {
+        return false;
+    }
+    return std::all_of(pressedKeys.begin(), pressedKeys.end(),
+        [&preKeys](int32_t pressedKey) { return preKeys.find(pressedKey) != preKeys.end(); });
+}
+
+size_t CountSubscribers(const std::list<std::shared_ptr<int32_t>> &subscribers)
+{
+    size_t count = 0;
+    for (const auto &subscriber : subscribers) {
+        count += (subscriber != nullptr) ? 1 : 0;
+    }
+    return count;
+}
+
+// The key down loop before the index: every option, with a copy of its subscriber list.
+void BM_KeyDownLinearScan(benchmark::State &state)
+{
+    SubscriberMap subscriptions = CreateSubscriptions(static_cast<int32_t>(state.range(0)));
+    for (auto _ : state) {
+        size_t notified = 0;
+        for (auto &iter : subscriptions) {
+            auto keyOption = iter.first;
+            auto subscribers = iter.second;
+            if (!keyOption->IsFinalKeyDown() || (KEY_CODE != keyOption->GetFinalKey())) {
+                continue;
+            }
+            if (IsPreKeysMatch(keyOption->GetPreKeys(), PRESSED_KEYS)) {
+                notified += CountSubscribers(subscribers);
+            }
+        }
+        benchmark::DoNotOptimize(notified);
+    }
+    state.counters["Subscriptions"] = state.range(0);
+}
+BENCHMARK(BM_KeyDownLinearScan)->Arg(10)->Arg(100)->Arg(1000);
+
+void BM_KeyDownIndexed(benchmark::State &state)
+{
+    SubscriberMap subscriptions = CreateSubscriptions(static_cast<int32_t>(state.range(0)));
+    KeySubscriptionIndex index;
+    for (const auto &iter : subscriptions) {
+        index.Add(iter.first);
+    }
+    for (auto _ : state) {
+        size_t notified = 0;
+        uint64_t pressedMask = KeySubscriptionIndex::GetKeyMask(PRESSED_KEYS);
+        for (const auto &entry : index.GetKeyDownEntries(KEY_CODE)) {
+            if (!KeySubscriptionIndex::MayMatchPreKeys(entry, pressedMask, PRESSED_KEYS.size())) {
+                continue;
+            }
+            auto iter = subscriptions.find(entry.keyOption);
+            if ((iter != subscriptions.end()) && IsPreKeysMatch(iter->first->GetPreKeys(), PRESSED_KEYS)) {
+                notified += CountSubscribers(iter->second);
+            }
+        }
+        benchmark::DoNotOptimize(notified);
+    }
+    state.counters["Subscriptions"] = state.range(0);
+}
+BENCHMARK(BM_KeyDownIndexed)->Arg(10)->Arg(100)->Arg(1000);
+
+void BM_KeySubscriptionIndexBuild(benchmark::State &state)
+{
+    SubscriberMap subscriptions = CreateSubscriptions(static_cast<int32_t>(state.range(0)));
+    for (auto _ : state) {
+        KeySubscriptionIndex index;
+        for (const auto &iter : subscriptions) {
+            index.Add(iter.first);
+        }
+        benchmark::DoNotOptimize(index.GetSize());
+    }
+    state.counters["Subscriptions"] = state.range(0);
+}
+BENCHMARK(BM_KeySubscriptionIndexBuild)->Arg(10)->Arg(100)->Arg(1000);
+} // namespace
+} // namespace MMI
+} // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -0,0 +1,626 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TOUCH_FINGER_TABLE_H
+#define TOUCH_FINGER_TABLE_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define TOUCH_FINGER_LANES_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define TOUCH_FINGER_LANES_SSE2
+#endif
+
+namespace OHOS {
+namespace MMI {
+struct Point {
+    Point() {}
+    Point(float px, float py) : x(px), y(py) {}
+    Point(float px, float py, int64_t pt)
+        : x(px), y(py), time(pt) {}
+    float x { 0.0f };
+    float y { 0.0f };
+    int64_t time { 0 };
+};
+
+namespace FingerLanes {
+constexpr int32_t WIDTH { 4 };
+
+#if defined(TOUCH_FINGER_LANES_NEON)
+using Floats = float32x4_t;
+using Masks = uint32x4_t;
+
+inline Floats Load(const float *data) { return vld1q_f32(data); }
+inline Masks LoadMask(const uint32_t *data) { return vld1q_u32(data); }
+inline void Store(float *data, Floats value) { vst1q_f32(data, value); }
+inline Floats Splat(float value) { return vdupq_n_f32(value); }
+inline Floats Add(Floats a, Floats b) { return vaddq_f32(a, b); }
+inline Floats Sub(Floats a, Floats b) { return vsubq_f32(a, b); }
+inline Floats Mul(Floats a, Floats b) { return vmulq_f32(a, b); }
+inline Floats Max(Floats a, Floats b) { return vmaxq_f32(a, b); }
+inline Floats Neg(Floats a) { return vnegq_f32(a); }
+inline Floats Select(Masks mask, Floats value)
+{
+    return vreinterpretq_f32_u32(vandq_u32(mask, vreinterpretq_u32_f32(value)));
+}
+inline Masks Gt(Floats a, Floats b) { return vcgtq_f32(a, b); }
+inline Masks Ge(Floats a, Floats b) { return vcgeq_f32(a, b); }
+inline Masks Lt(Floats a, Floats b) { return vcltq_f32(a, b); }
+inline Masks Le(Floats a, Floats b) { return vcleq_f32(a, b); }
+inline Masks And(Masks a, Masks b) { return vandq_u32(a, b); }
+inline Masks Or(Masks a, Masks b) { return vorrq_u32(a, b); }
+inline Masks AndNot(Masks a, Masks b) { return vbicq_u32(b, a); }
+
+inline Floats Sqrt(Floats value)
+{
+#if defined(__aarch64__)
+    return vsqrtq_f32(value);
+#else
+    alignas(16) float lanes[WIDTH];
+    vst1q_f32(lanes, value);
+    for (float &lane : lanes) {
+        lane = std::sqrt(lane);
+    }
+    return vld1q_f32(lanes);
+#endif
+}
+
+inline float Sum(Floats value)
+{
+    float32x2_t sum = vadd_f32(vget_low_f32(value), vget_high_f32(value));
+    return vget_lane_f32(vpadd_f32(sum, sum), 0);
+}
+
+inline float MaxOf(Floats value)
+{
+    float32x2_t max = vmax_f32(vget_low_f32(value), vget_high_f32(value));
+    return vget_lane_f32(vpmax_f32(max, max), 0);
+}
+
+// One bit per lane, lane 0 in bit 0.
+inline uint32_t Bits(Masks mask)
+{
+    const uint32_t weights[WIDTH] { 1, 2, 4, 8 };
+    uint32x4_t bits = vandq_u32(mask, vld1q_u32(weights));
+    uint32x2_t sum = vadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+    return vget_lane_u32(vpadd_u32(sum, sum), 0);
+}
+#elif defined(TOUCH_FINGER_LANES_SSE2)
+using Floats = __m128;
+using Masks = __m128;
+
+inline Floats Load(const float *data) { return _mm_load_ps(data); }
+inline Masks LoadMask(const uint32_t *data)
+{
+    return _mm_castsi128_ps(_mm_load_si128(reinterpret_cast<const __m128i *>(data)));
+}
+inline void Store(float *data, Floats value) { _mm_store_ps(data, value); }
+inline Floats Splat(float value) { return _mm_set1_ps(value); }
+inline Floats Add(Floats a, Floats b) { return _mm_add_ps(a, b); }
+inline Floats Sub(Floats a, Floats b) { return _mm_sub_ps(a, b); }
+inline Floats Mul(Floats a, Floats b) { return _mm_mul_ps(a, b); }
+inline Floats Max(Floats a, Floats b) { return _mm_max_ps(a, b); }
+inline Floats Neg(Floats a) { return _mm_sub_ps(_mm_setzero_ps(), a); }
+inline Floats Select(Masks mask, Floats value) { return _mm_and_ps(mask, value); }
+inline Masks Gt(Floats a, Floats b) { return _mm_cmpgt_ps(a, b); }
+inline Masks Ge(Floats a, Floats b) { return _mm_cmpge_ps(a, b); }
+inline Masks Lt(Floats a, Floats b) { return _mm_cmplt_ps(a, b); }
+inline Masks Le(Floats a, Floats b) { return _mm_cmple_ps(a, b); }
+inline Masks And(Masks a, Masks b) { return _mm_and_ps(a, b); }
+inline Masks Or(Masks a, Masks b) { return _mm_or_ps(a, b); }
+inline Masks AndNot(Masks a, Masks b) { return _mm_andnot_ps(a, b); }
+inline Floats Sqrt(Floats value) { return _mm_sqrt_ps(value); }
+
+inline float Sum(Floats value)
+{
+    __m128 sum = _mm_add_ps(value, _mm_movehl_ps(value, value));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+    return _mm_cvtss_f32(sum);
+}
+
+inline float MaxOf(Floats value)
+{
+    __m128 max = _mm_max_ps(value, _mm_movehl_ps(value, value));
+    max = _mm_max_ss(max, _mm_shuffle_ps(max, max, _MM_SHUFFLE(1, 1, 1, 1)));
+    return _mm_cvtss_f32(max);
+}
+
+inline uint32_t Bits(Masks mask) { return static_cast<uint32_t>(_mm_movemask_ps(mask)); }
+#else
+struct Floats {
+    float lane[WIDTH];
+};
+struct Masks {
+    uint32_t lane[WIDTH];
+};
+
+template<typename Func>
+inline Floats Map(Floats a, Floats b, Func func)
+{
+    Floats result;
+    for (int32_t i = 0; i < WIDTH; ++i) {
+        result.lane[i] = func(a.lane[i], b.lane[i]);
+    }
+    return result;
+}
+
+template<typename Func>
+inline Masks Compare(Floats a, Floats b, Func func)
+{
+    Masks result;
+    for (int32_t i = 0; i < WIDTH; ++i) {
+        result.lane[i] = func(a.lane[i], b.lane[i]) ? UINT32_MAX : 0U;
+    }
+    return result;
+}
+
+template<typename Func>
+inline Masks Combine(Masks a, Masks b, Func func)
+{
+    Masks result;
+    for (int32_t i = 0; i < WIDTH; ++i) {
+        result.lane[i] = func(a.lane[i], b.lane[i]);
+    }
+    return result;
+}
+
+inline Floats Load(const float *data) { return Floats { { data[0], data[1], data[2], data[3] } }; }
+inline Masks LoadMask(const uint32_t *data) { return Masks { { data[0], data[1], data[2], data[3] } }; }
+inline void Store(float *data, Floats value) { std::copy(value.lane, value.lane + WIDTH, data); }
+inline Floats Splat(float value) { return Floats { { value, value, value, value } }; }
+inline Floats Add(Floats a, Floats b) { return Map(a, b, [](float x, float y) { return x + y; }); }
+inline Floats Sub(Floats a, Floats b) { return Map(a, b, [](float x, float y) { return x - y; }); }
+inline Floats Mul(Floats a, Floats b) { return Map(a, b, [](float x, float y) { return x * y; }); }
+inline Floats Max(Floats a, Floats b) { return Map(a, b, [](float x, float y) { return std::max(x, y); }); }
+inline Floats Neg(Floats a) { return Map(a, a, [](float x, float) { return -x; }); }
+inline Floats Select(Masks mask, Floats value)
+{
+    Floats result;
+    for (int32_t i = 0; i < WIDTH; ++i) {
+        result.lane[i] = (mask.lane[i] != 0) ? value.lane[i] : 0.0f;
+    }
+    return result;
+}
+inline Masks Gt(Floats a, Floats b) { return Compare(a, b, [](float x, float y) { return x > y; }); }
+inline Masks Ge(Floats a, Floats b) { return Compare(a, b, [](float x, float y) { return x >= y; }); }
+inline Masks Lt(Floats a, Floats b) { return Compare(a, b, [](float x, float y) { return x < y; }); }
+inline Masks Le(Floats a, Floats b) { return Compare(a, b, [](float x, float y) { return x <= y; }); }
+inline Masks And(Masks a, Masks b) { return Combine(a, b, [](uint32_t x, uint32_t y) { return x & y; }); }
+inline Masks Or(Masks a, Masks b) { return Combine(a, b, [](uint32_t x, uint32_t y) { return x | y; }); }
+inline Masks AndNot(Masks a, Masks b) { return Combine(a, b, [](uint32_t x, uint32_t y) { return ~x & y; }); }
+inline Floats Sqrt(Floats value) { return Map(value, value, [](float x, float) { return std::sqrt(x); }); }
+
+inline float Sum(Floats value)
+{
+    return (value.lane[0] + value.lane[2]) + (value.lane[1] + value.lane[3]);
+}
+
+inline float MaxOf(Floats value)
+{
+    return std::max(std::max(value.lane[0], value.lane[1]), std::max(value.lane[2], value.lane[3]));
+}
+
+inline uint32_t Bits(Masks mask)
+{
+    uint32_t bits = 0;
+    for (int32_t i = 0; i < WIDTH; ++i) {
+        bits |= ((mask.lane[i] >> 31U) << i);
+    }
+    return bits;
+}
+#endif
+} // namespace FingerLanes
+
+/*
+ * Slots of the fingers of a table. A pointer id below CAPACITY takes the slot of the same index while it is
+ * free, so that masks of slots read as masks of pointer ids. Any other id, such as those of touchscreens that
+ * number pointers beyond CAPACITY, takes the first free slot and is looked up among the remapped slots.
+ */
+class FingerSlots final {
+public:
+    // Touchscreens report at most ten physical pointers, rounded up to whole vectors.
+    static constexpr int32_t CAPACITY { 16 };
+
+    // Returns the slot of |id|, -1 if it has none.
+    int32_t Find(int32_t id) const
+    {
+        if ((id >= 0) && (id < CAPACITY) && ((mask_ & ~remapped_ & (1U << id)) != 0)) {
+            return id;
+        }
+        for (uint32_t bits = remapped_; bits != 0; bits &= (bits - 1)) {
+            int32_t slot = __builtin_ctz(bits);
+            if (ids_[slot] == id) {
+                return slot;
+            }
+        }
+        return -1;
+    }
+
+    // Returns the slot of |id|, taking a free one if it has none, -1 if |id| is invalid or all slots are taken.
+    int32_t Insert(int32_t id)
+    {
+        if (id < 0) {
+            return -1;
+        }
+        int32_t slot = Find(id);
+        if (slot >= 0) {
+            return slot;
+        }
+        if ((id < CAPACITY) && ((mask_ & (1U << id)) == 0)) {
+            slot = id;
+        } else if (mask_ != FULL_MASK) {
+            slot = __builtin_ctz(~mask_ & FULL_MASK);
+            remapped_ |= (1U << slot);
+        } else {
+            return -1;
+        }
+        ids_[slot] = id;
+        mask_ |= (1U << slot);
+        return slot;
+    }
+
+    // Returns the slot |id| had, -1 if it had none.
+    int32_t Erase(int32_t id)
+    {
+        int32_t slot = Find(id);
+        if (slot >= 0) {
+            ids_[slot] = 0;
+            mask_ &= ~(1U << slot);
+            remapped_ &= ~(1U << slot);
+        }
+        return slot;
+    }
+
+    void Clear()
+    {
+        ids_.fill(0);
+        mask_ = 0;
+        remapped_ = 0;
+    }
+
+    int32_t GetId(int32_t slot) const
+    {
+        return ids_[slot];
+    }
+
+    uint32_t Mask() const
+    {
+        return mask_;
+    }
+
+    // Whether some id is not in the slot of its own index.
+    bool IsRemapped() const
+    {
+        return (remapped_ != 0);
+    }
+
+    // Visits the taken slots in the order of their pointer ids, as iterating a map would.
+    template<typename Func>
+    void ForEach(Func &&func) const
+    {
+        if (remapped_ == 0) {
+            for (uint32_t bits = mask_; bits != 0; bits &= (bits - 1)) {
+                int32_t slot = __builtin_ctz(bits);
+                func(ids_[slot], slot);
+            }
+            return;
+        }
+        std::array<int32_t, CAPACITY> slots {};
+        size_t count = 0;
+        for (uint32_t bits = mask_; bits != 0; bits &= (bits - 1)) {
+            slots[count++] = __builtin_ctz(bits);
+        }
+        std::sort(slots.begin(), slots.begin() + count, [this](int32_t left, int32_t right) {
+            return ids_[left] < ids_[right];
+        });
+        for (size_t index = 0; index < count; ++index) {
+            func(ids_[slots[index]], slots[index]);
+        }
+    }
+
+private:
+    static constexpr uint32_t FULL_MASK { (1ULL << CAPACITY) - 1 };
+
+    std::array<int32_t, CAPACITY> ids_ {};
+    uint32_t mask_ { 0 };
+    // Slots whose id differs from their index.
+    uint32_t remapped_ { 0 };
+};
+
+/*
+ * Per finger values, such as the distances to the center of a pinch, in the slots of a finger table.
+ */
+class FingerDistances final {
+public:
+    static constexpr int32_t CAPACITY { FingerSlots::CAPACITY };
+
+    bool Set(int32_t id, float distance)
+    {
+        int32_t slot = slots_.Insert(id);
+        if (slot < 0) {
+            return false;
+        }
+        distance_[slot] = distance;
+        return true;
+    }
+
+    bool Get(int32_t id, float &distance) const
+    {
+        int32_t slot = slots_.Find(id);
+        if (slot < 0) {
+            return false;
+        }
+        distance = distance_[slot];
+        return true;
+    }
+
+    bool Contains(int32_t id) const
+    {
+        return (slots_.Find(id) >= 0);
+    }
+
+    void Clear()
+    {
+        distance_.fill(0.0f);
+        slots_.Clear();
+    }
+
+    bool Empty() const
+    {
+        return (slots_.Mask() == 0);
+    }
+
+    // Taken slots, see FingerSlots.
+    uint32_t Mask() const
+    {
+        return slots_.Mask();
+    }
+
+private:
+    friend class FingerTable;
+
+    alignas(16) std::array<float, CAPACITY> distance_ {};
+    FingerSlots slots_;
+};
+
+/*
+ * Touches of a gesture, kept as columns of fixed slots instead of a map, see FingerSlots for how pointer ids map
+ * to slots. Free slots hold zeros and the lane mask of a slot is all ones while it is taken, so that the kernels
+ * below run over every slot four at a time with SIMD, NEON or SSE2 where available, and drop free slots with
+ * masks, not branches. Set() fails once all slots are taken.
+ */
+class FingerTable final {
+public:
+    static constexpr int32_t CAPACITY { FingerSlots::CAPACITY };
+
+    // Fingers whose motion between two tables is beyond a threshold, as masks of the slots of the first table.
+    struct Motion {
+        // Moved farther than the threshold.
+        uint32_t moved { 0 };
+        // Moved at least as far as the threshold.
+        uint32_t reached { 0 };
+        // Fingers in |moved| by direction, with the bounds of GetSlidingDirection() on the angle of the motion.
+        uint32_t down { 0 };
+        uint32_t up { 0 };
+        uint32_t left { 0 };
+        uint32_t right { 0 };
+    };
+
+    bool Set(int32_t id, const Point &point)
+    {
+        int32_t slot = slots_.Insert(id);
+        if (slot < 0) {
+            return false;
+        }
+        x_[slot] = point.x;
+        y_[slot] = point.y;
+        time_[slot] = point.time;
+        lanes_[slot] = UINT32_MAX;
+        return true;
+    }
+
+    bool Erase(int32_t id)
+    {
+        int32_t slot = slots_.Erase(id);
+        if (slot < 0) {
+            return false;
+        }
+        x_[slot] = 0.0f;
+        y_[slot] = 0.0f;
+        time_[slot] = 0;
+        lanes_[slot] = 0;
+        return true;
+    }
+
+    void Clear()
+    {
+        x_.fill(0.0f);
+        y_.fill(0.0f);
+        time_.fill(0);
+        lanes_.fill(0);
+        slots_.Clear();
+    }
+
+    bool Contains(int32_t id) const
+    {
+        return (slots_.Find(id) >= 0);
+    }
+
+    Point Get(int32_t id) const
+    {
+        int32_t slot = slots_.Find(id);
+        if (slot < 0) {
+            return Point {};
+        }
+        return Point { x_[slot], y_[slot], time_[slot] };
+    }
+
+    size_t Size() const
+    {
+        return static_cast<size_t>(__builtin_popcount(slots_.Mask()));
+    }
+
+    bool Empty() const
+    {
+        return (slots_.Mask() == 0);
+    }
+
+    // Taken slots, see FingerSlots.
+    uint32_t Mask() const
+    {
+        return slots_.Mask();
+    }
+
+    // Visits the fingers in the order of pointer ids, as iterating a map would.
+    template<typename Func>
+    void ForEach(Func &&func) const
+    {
+        slots_.ForEach([this, &func](int32_t id, int32_t slot) {
+            func(id, Point { x_[slot], y_[slot], time_[slot] });
+        });
+    }
+
+    Point CalcCenter() const
+    {
+        if (Empty()) {
+            return Point {};
+        }
+        FingerLanes::Floats sumX = FingerLanes::Splat(0.0f);
+        FingerLanes::Floats sumY = FingerLanes::Splat(0.0f);
+
+        for (int32_t slot = 0; slot < CAPACITY; slot += FingerLanes::WIDTH) {
+            sumX = FingerLanes::Add(sumX, FingerLanes::Load(&x_[slot]));
+            sumY = FingerLanes::Add(sumY, FingerLanes::Load(&y_[slot]));
+        }
+        float count = static_cast<float>(Size());
+        return Point { FingerLanes::Sum(sumX) / count, FingerLanes::Sum(sumY) / count };
+    }
+
+    // Distances of the fingers to |center|, in place of what |distances| held before.
+    void CalcDistances(const Point &center, FingerDistances &distances) const
+    {
+        FingerLanes::Floats centerX = FingerLanes::Splat(center.x);
+        FingerLanes::Floats centerY = FingerLanes::Splat(center.y);
+
+        for (int32_t slot = 0; slot < CAPACITY; slot += FingerLanes::WIDTH) {
+            FingerLanes::Floats dx = FingerLanes::Sub(FingerLanes::Load(&x_[slot]), centerX);
+            FingerLanes::Floats dy = FingerLanes::Sub(FingerLanes::Load(&y_[slot]), centerY);
+            FingerLanes::Floats distance = FingerLanes::Sqrt(
+                FingerLanes::Add(FingerLanes::Mul(dx, dx), FingerLanes::Mul(dy, dy)));
+            FingerLanes::Store(&distances.distance_[slot],
+                FingerLanes::Select(FingerLanes::LoadMask(&lanes_[slot]), distance));
+        }
+        distances.slots_ = slots_;
+    }
+
+    // The largest distance between two fingers.
+    float CalcMaxSpacing() const
+    {
+        FingerLanes::Floats maxSquare = FingerLanes::Splat(0.0f);
+
+        for (uint32_t bits = slots_.Mask(); bits != 0; bits &= (bits - 1)) {
+            int32_t slot = __builtin_ctz(bits);
+            FingerLanes::Floats pX = FingerLanes::Splat(x_[slot]);
+            FingerLanes::Floats pY = FingerLanes::Splat(y_[slot]);
+
+            for (int32_t lane = 0; lane < CAPACITY; lane += FingerLanes::WIDTH) {
+                FingerLanes::Floats dx = FingerLanes::Sub(FingerLanes::Load(&x_[lane]), pX);
+                FingerLanes::Floats dy = FingerLanes::Sub(FingerLanes::Load(&y_[lane]), pY);
+                FingerLanes::Floats square = FingerLanes::Add(FingerLanes::Mul(dx, dx), FingerLanes::Mul(dy, dy));
+                maxSquare = FingerLanes::Max(maxSquare,
+                    FingerLanes::Select(FingerLanes::LoadMask(&lanes_[lane]), square));
+            }
+        }
+        return std::sqrt(FingerLanes::MaxOf(maxSquare));
+    }
+
+    /*
+     * Motion of the fingers present in both |from| and |to|. Directions come from comparing the offsets instead
+     * of atan2(), the diagonals go the way the float angle rounds: (1, 1) DOWN, (1, -1) UP, (-1, ±1) LEFT.
+     */
+    static Motion CalcMotion(const FingerTable &from, const FingerTable &to, float threshold)
+    {
+        if (!from.slots_.IsRemapped() && !to.slots_.IsRemapped()) {
+            return CalcAlignedMotion(from, to, threshold);
+        }
+        // Some finger may sit in different slots of the two tables, line |to| up with the slots of |from| first.
+        FingerTable aligned;
+        from.slots_.ForEach([&to, &aligned](int32_t id, int32_t slot) {
+            int32_t toSlot = to.slots_.Find(id);
+            if (toSlot >= 0) {
+                aligned.x_[slot] = to.x_[toSlot];
+                aligned.y_[slot] = to.y_[toSlot];
+                aligned.lanes_[slot] = UINT32_MAX;
+            }
+        });
+        return CalcAlignedMotion(from, aligned, threshold);
+    }
+
+private:
+    // Motion of the fingers in the same slots of |from| and |to|, ignoring their ids.
+    static Motion CalcAlignedMotion(const FingerTable &from, const FingerTable &to, float threshold)
+    {
+        Motion motion {};
+        float bound = std::max(threshold, 0.0f);
+        FingerLanes::Floats square = FingerLanes::Splat(bound * bound);
+        FingerLanes::Floats zero = FingerLanes::Splat(0.0f);
+
+        for (int32_t slot = 0; slot < CAPACITY; slot += FingerLanes::WIDTH) {
+            FingerLanes::Masks lanes = FingerLanes::And(
+                FingerLanes::LoadMask(&from.lanes_[slot]), FingerLanes::LoadMask(&to.lanes_[slot]));
+            FingerLanes::Floats dx = FingerLanes::Sub(
+                FingerLanes::Load(&to.x_[slot]), FingerLanes::Load(&from.x_[slot]));
+            FingerLanes::Floats dy = FingerLanes::Sub(
+                FingerLanes::Load(&to.y_[slot]), FingerLanes::Load(&from.y_[slot]));
+            FingerLanes::Floats distance = FingerLanes::Add(FingerLanes::Mul(dx, dx), FingerLanes::Mul(dy, dy));
+            FingerLanes::Masks moved = FingerLanes::And(lanes, FingerLanes::Gt(distance, square));
+            FingerLanes::Masks reached = FingerLanes::And(lanes, FingerLanes::Ge(distance, square));
+            FingerLanes::Floats negDx = FingerLanes::Neg(dx);
+
+            FingerLanes::Masks right = FingerLanes::And(FingerLanes::Gt(dx, zero),
+                FingerLanes::And(FingerLanes::Lt(dy, dx), FingerLanes::Gt(dy, negDx)));
+            FingerLanes::Masks down = FingerLanes::And(FingerLanes::Gt(dy, zero),
+                FingerLanes::And(FingerLanes::Ge(dy, dx), FingerLanes::Gt(dy, negDx)));
+            FingerLanes::Masks up = FingerLanes::And(FingerLanes::Lt(dy, zero),
+                FingerLanes::And(FingerLanes::Lt(dy, dx), FingerLanes::Le(dy, negDx)));
+            FingerLanes::Masks left = FingerLanes::AndNot(FingerLanes::Or(right, FingerLanes::Or(down, up)), moved);
+
+            uint32_t shift = static_cast<uint32_t>(slot);
+            motion.moved |= (FingerLanes::Bits(moved) << shift);
+            motion.reached |= (FingerLanes::Bits(reached) << shift);
+            motion.right |= (FingerLanes::Bits(FingerLanes::And(moved, right)) << shift);
+            motion.down |= (FingerLanes::Bits(FingerLanes::And(moved, down)) << shift);
+            motion.up |= (FingerLanes::Bits(FingerLanes::And(moved, up)) << shift);
+            motion.left |= (FingerLanes::Bits(left) << shift);
+        }
+        return motion;
+    }
+
+    alignas(16) std::array<float, CAPACITY> x_ {};
+    alignas(16) std::array<float, CAPACITY> y_ {};
+    alignas(16) std::array<uint32_t, CAPACITY> lanes_ {};
+    std::array<int64_t, CAPACITY> time_ {};
+    FingerSlots slots_;
+};
+} // namespace MMI
+} // namespace OHOS
+#endif // TOUCH_FINGER_TABLE_H
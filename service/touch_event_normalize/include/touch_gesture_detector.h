@@ -16,11 +16,9 @@
 #ifndef TOUCH_GESTURE_DETECTOR_H
 #define TOUCH_GESTURE_DETECTOR_H
 
-#include <map>
-#include <unordered_set>
-
 #include "i_input_service_context.h"
 #include "pointer_event.h"
+#include "touch_finger_table.h"
 
 namespace OHOS {
 namespace MMI {
@@ -35,16 +33,6 @@ enum class GestureMode {
     ACTION_GESTURE_END
 };
 
-struct Point {
-    Point() {}
-    Point(float px, float py) : x(px), y(py) {}
-    Point(float px, float py, int64_t pt)
-        : x(px), y(py), time(pt) {}
-    float x { 0.0f };
-    float y { 0.0f };
-    int64_t time { 0 };
-};
-
 class TouchGestureDetector final {
 public:
     class GestureListener {
@@ -82,15 +70,15 @@ private:
     bool NotifyGestureEvent(std::shared_ptr<PointerEvent> event, GestureMode mode);
     bool WhetherDiscardTouchEvent(std::shared_ptr<PointerEvent> event);
 
-    Point CalcClusterCenter(const std::map<int32_t, Point> &points) const;
+    Point CalcClusterCenter(const FingerTable &points) const;
     float CalcTwoPointsDistance(const Point &p1, const Point &p2) const;
     void CalcAndStoreDistance();
-    int32_t CalcMultiFingerMovement(std::map<int32_t, Point> &map);
+    int32_t CalcMultiFingerMovement(const FingerTable &points);
     void HandlePinchMoveEvent(std::shared_ptr<PointerEvent> event);
-    bool InOppositeDirections(const std::unordered_set<SlideState> &directions) const;
-    GestureMode JudgeOperationMode(std::map<int32_t, Point> &movePoint);
+    bool InOppositeDirections(const FingerTable::Motion &motion) const;
+    GestureMode JudgeOperationMode(const FingerTable &movePoints);
     bool AntiJitter(std::shared_ptr<PointerEvent> event, GestureMode mode);
-    std::vector<std::pair<int32_t, Point>> SortPoints(std::map<int32_t, Point> &points);
+    size_t SortPoints(const FingerTable &points, std::array<int32_t, FingerTable::CAPACITY> &order) const;
 
     bool HandleFingerDown();
     int64_t GetMaxDownInterval() const;
@@ -101,6 +89,7 @@ private:
     bool IsFingerMove(const Point &downPt, const Point &movePt) const;
     double GetAngle(float startX, float startY, float endX, float endY) const;
     SlideState ClacFingerMoveDirection(std::shared_ptr<PointerEvent> event);
+    bool GetMovePoints(std::shared_ptr<PointerEvent> event, FingerTable &movePoints) const;
     void CheckGestureTrend(std::shared_ptr<PointerEvent> event) const;
     bool IsLastTouchUp(std::shared_ptr<PointerEvent> event) const;
     void OnGestureSendEvent(std::shared_ptr<PointerEvent> event) const;
@@ -118,9 +107,9 @@ private:
     int32_t continuousCloseCount_ { 0 };
     int32_t continuousOpenCount_ { 0 };
     int32_t gestureTimer_ { -1 };
-    std::map<int32_t, Point> downPoint_;
-    std::map<int32_t, Point> movePoint_;
-    std::map<int32_t, float> lastDistance_;
+    FingerTable downPoint_;
+    FingerTable movePoint_;
+    FingerDistances lastDistance_;
     std::shared_ptr<GestureListener> listener_ { nullptr };
     std::shared_ptr<PointerEvent> lastTouchEvent_ { nullptr };
 };
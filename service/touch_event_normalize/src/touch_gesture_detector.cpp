@@ -14,7 +14,6 @@
  */
 
 #include "touch_gesture_detector.h"
-#include <numeric>
 
 #include "define_multimodal.h"
 #include "touch_gesture_adapter.h"
@@ -93,11 +92,13 @@ void TouchGestureDetector::HandleDownEvent(std::shared_ptr<PointerEvent> event)
         MMI_HILOGE("Get pointer item:%{public}d fail", pointerId);
         return;
     }
-    auto [_, isNew] = downPoint_.insert_or_assign(
-        pointerId, Point { item.GetDisplayX(), item.GetDisplayY(), item.GetDownTime() });
-    if (!isNew) {
+    if (downPoint_.Contains(pointerId)) {
         MMI_HILOGE("Insert value failed, duplicated pointerId:%{public}d", pointerId);
     }
+    if (!downPoint_.Set(pointerId, Point { item.GetDisplayX(), item.GetDisplayY(), item.GetDownTime() })) {
+        MMI_HILOGE("Invalid pointerId:%{public}d or too many fingers", pointerId);
+        return;
+    }
     if (gestureTimer_ >= 0) {
         auto timerMgr = TouchGestureAdapter::GetTimerManager(env_);
         if (timerMgr == nullptr) {
@@ -122,7 +123,7 @@ void TouchGestureDetector::HandleMoveEvent(std::shared_ptr<PointerEvent> event)
     if (isRecognized_ || (gestureTimer_ >= 0)) {
         return;
     }
-    if (!TouchGestureParameter::Load().DoesSupportGesture(gestureType_, static_cast<int32_t>(downPoint_.size()))) {
+    if (!TouchGestureParameter::Load().DoesSupportGesture(gestureType_, static_cast<int32_t>(downPoint_.Size()))) {
         return;
     }
     if (!IsMatchGesture(event->GetPointerCount()) && !IsMatchGesture(ALL_FINGER_COUNT)) {
@@ -178,52 +179,37 @@ void TouchGestureDetector::HandleSwipeMoveEvent(std::shared_ptr<PointerEvent> ev
 
 void TouchGestureDetector::HandlePinchMoveEvent(std::shared_ptr<PointerEvent> event)
 {
-    std::map<int32_t, Point> movePoints;
-    std::unordered_set<SlideState> directions;
-
-    for (const auto &[pointerId, downPt] : downPoint_) {
-        PointerEvent::PointerItem item {};
-        if (!event->GetPointerItem(pointerId, item)) {
-            MMI_HILOGE("Get pointer item:%{public}d fail", pointerId);
-            return;
-        }
-        Point movePt { item.GetDisplayX(), item.GetDisplayY(), item.GetDownTime() };
-
-        if (IsFingerMove(downPt, movePt)) {
-            double angle = GetAngle(downPt.x, downPt.y, movePt.x, movePt.y);
-            auto direction = GetSlidingDirection(angle);
-            directions.insert(direction);
-        }
-        auto [_, isNew] = movePoints.insert_or_assign(pointerId, movePt);
-        if (!isNew) {
-            MMI_HILOGE("Insert value failed, duplicated pointerId:%{public}d", pointerId);
-        }
+    FingerTable movePoints;
+    if (!GetMovePoints(event, movePoints)) {
+        return;
     }
-    if (!InOppositeDirections(directions)) {
+    auto motion = FingerTable::CalcMotion(downPoint_, movePoints,
+        TouchGestureParameter::Load().GetFingerMovementThreshold());
+    if (!InOppositeDirections(motion)) {
         return;
     }
     if (CalcMultiFingerMovement(movePoints) >=
-        static_cast<int32_t>(downPoint_.size() - TouchGestureParameter::Load().GetFingerCountOffsetForPinch())) {
+        static_cast<int32_t>(downPoint_.Size() - TouchGestureParameter::Load().GetFingerCountOffsetForPinch())) {
         movePoint_ = movePoints;
         GestureMode type = JudgeOperationMode(movePoints);
         isRecognized_ = AntiJitter(event, type);
     }
 }
 
-bool TouchGestureDetector::InOppositeDirections(const std::unordered_set<SlideState> &directions) const
+bool TouchGestureDetector::InOppositeDirections(const FingerTable::Motion &motion) const
 {
-    bool down = directions.find(SlideState::DIRECTION_DOWN) != directions.cend();
-    bool up = directions.find(SlideState::DIRECTION_UP) != directions.cend();
-    bool left = directions.find(SlideState::DIRECTION_LEFT) != directions.cend();
-    bool right = directions.find(SlideState::DIRECTION_RIGHT) != directions.cend();
+    bool down = (motion.down != 0);
+    bool up = (motion.up != 0);
+    bool left = (motion.left != 0);
+    bool right = (motion.right != 0);
     return (up && down) || (up && left) || (up && right) || (down && left) || (down && right) || (left && right);
 }
 
 void TouchGestureDetector::HandleUpEvent(std::shared_ptr<PointerEvent> event)
 {
     CALL_DEBUG_ENTER;
-    downPoint_.erase(event->GetPointerId());
-    movePoint_.erase(event->GetPointerId());
+    downPoint_.Erase(event->GetPointerId());
+    movePoint_.Erase(event->GetPointerId());
     MMI_HILOGI("The gestureType:%{public}d, touches:%{public}s, isFingerReady:%{public}d, pointerId:%{public}d",
         gestureType_, DumpTouches().c_str(), isFingerReady_, event->GetPointerId());
     if (gestureTimer_ >= 0) {
@@ -291,9 +277,9 @@ void TouchGestureDetector::ReleaseData()
     lastTouchEvent_ = nullptr;
     continuousCloseCount_ = 0;
     continuousOpenCount_ = 0;
-    lastDistance_.clear();
-    downPoint_.clear();
-    movePoint_.clear();
+    lastDistance_.Clear();
+    downPoint_.Clear();
+    movePoint_.Clear();
 }
 
 bool TouchGestureDetector::WhetherDiscardTouchEvent(std::shared_ptr<PointerEvent> event)
@@ -325,7 +311,7 @@ bool TouchGestureDetector::WhetherDiscardTouchEvent(std::shared_ptr<PointerEvent
 
 bool TouchGestureDetector::HandleFingerDown()
 {
-    if (!TouchGestureParameter::Load().DoesSupportGesture(gestureType_, static_cast<int32_t>(downPoint_.size()))) {
+    if (!TouchGestureParameter::Load().DoesSupportGesture(gestureType_, static_cast<int32_t>(downPoint_.Size()))) {
         return false;
     }
     float maxDistance = GetMaxFingerSpacing();
@@ -346,34 +332,21 @@ int64_t TouchGestureDetector::GetMaxDownInterval() const
     int64_t earliestTime = std::numeric_limits<int64_t>::max();
     int64_t latestTime = std::numeric_limits<int64_t>::min();
 
-    for (const auto &point : downPoint_) {
-        int64_t touchTime = point.second.time;
-        if (touchTime > latestTime) {
-            latestTime = touchTime;
+    downPoint_.ForEach([&earliestTime, &latestTime](int32_t, const Point &point) {
+        if (point.time > latestTime) {
+            latestTime = point.time;
         }
-        if (touchTime < earliestTime) {
-            earliestTime = touchTime;
+        if (point.time < earliestTime) {
+            earliestTime = point.time;
         }
-    }
+    });
     MMI_HILOGI("Down interval:%{public}" PRId64, (latestTime - earliestTime));
     return latestTime - earliestTime;
 }
 
 float TouchGestureDetector::GetMaxFingerSpacing() const
 {
-    float maxSpacing = 0.0f;
-
-    for (auto iter = downPoint_.cbegin(); iter != downPoint_.cend(); ++iter) {
-        auto innerIter = iter;
-        float pX = iter->second.x;
-        float pY = iter->second.y;
-
-        for (++innerIter; innerIter != downPoint_.cend(); ++innerIter) {
-            float nX = innerIter->second.x;
-            float nY = innerIter->second.y;
-            maxSpacing = std::max<float>(maxSpacing, std::hypot(pX - nX, pY - nY));
-        }
-    }
+    float maxSpacing = downPoint_.CalcMaxSpacing();
     MMI_HILOGI("Down max spacing:%{public}.2f", maxSpacing);
     return maxSpacing;
 }
@@ -428,35 +401,55 @@ TouchGestureDetector::SlideState TouchGestureDetector::ClacFingerMoveDirection(s
     if (event->GetPointerAction() != PointerEvent::POINTER_ACTION_MOVE) {
         return SlideState::DIRECTION_UNKNOW;
     }
-    if (downPoint_.size() < THREE_FINGER_COUNT) {
+    if (downPoint_.Size() < THREE_FINGER_COUNT) {
+        return SlideState::DIRECTION_UNKNOW;
+    }
+    FingerTable movePoints;
+    if (!GetMovePoints(event, movePoints)) {
+        return SlideState::DIRECTION_UNKNOW;
+    }
+    auto motion = FingerTable::CalcMotion(downPoint_, movePoints,
+        TouchGestureParameter::Load().GetFingerMovementThreshold());
+    const std::pair<uint32_t, SlideState> directions[] {
+        { motion.down, SlideState::DIRECTION_DOWN },
+        { motion.up, SlideState::DIRECTION_UP },
+        { motion.left, SlideState::DIRECTION_LEFT },
+        { motion.right, SlideState::DIRECTION_RIGHT },
+    };
+    int32_t nDirections { 0 };
+    SlideState state { SlideState::DIRECTION_UNKNOW };
+
+    for (const auto &[fingers, direction] : directions) {
+        if (fingers != 0) {
+            ++nDirections;
+            state = direction;
+        }
+    }
+    MMI_HILOGI("The moved:%{public}#x,down:%{public}#x,up:%{public}#x,left:%{public}#x,right:%{public}#x",
+        motion.moved, motion.down, motion.up, motion.left, motion.right);
+    if ((motion.moved != downPoint_.Mask()) || (nDirections > MAXIMUM_SAME_DIRECTION_OFFSET)) {
         return SlideState::DIRECTION_UNKNOW;
     }
-    size_t recognizedCount { 0 };
-    std::unordered_set<SlideState> directions;
+    return state;
+}
 
-    for (const auto &[pointerId, downPt] : downPoint_) {
+bool TouchGestureDetector::GetMovePoints(std::shared_ptr<PointerEvent> event, FingerTable &movePoints) const
+{
+    bool isComplete { true };
+
+    downPoint_.ForEach([&event, &movePoints, &isComplete](int32_t pointerId, const Point &) {
+        if (!isComplete) {
+            return;
+        }
         PointerEvent::PointerItem item {};
         if (!event->GetPointerItem(pointerId, item)) {
             MMI_HILOGE("Get pointer item:%{public}d fail", pointerId);
-            return SlideState::DIRECTION_UNKNOW;
-        }
-        Point movePt { item.GetDisplayX(), item.GetDisplayY() };
-
-        if (!IsFingerMove(downPt, movePt)) {
-            continue;
-        }
-        double angle = GetAngle(downPt.x, downPt.y, movePt.x, movePt.y);
-        auto direction = GetSlidingDirection(angle);
-        if (direction != SlideState::DIRECTION_UNKNOW) {
-            directions.insert(direction);
-            ++recognizedCount;
+            isComplete = false;
+            return;
         }
-        MMI_HILOGI("The pointerId:%{public}d,angle:%{public}.2f,direction:%{public}d", pointerId, angle, direction);
-    }
-    if ((recognizedCount < downPoint_.size()) || (directions.size() > MAXIMUM_SAME_DIRECTION_OFFSET)) {
-        return SlideState::DIRECTION_UNKNOW;
-    }
-    return *(directions.begin());
+        movePoints.Set(pointerId, Point { item.GetDisplayX(), item.GetDisplayY(), item.GetDownTime() });
+    });
+    return isComplete;
 }
 
 float TouchGestureDetector::CalcTwoPointsDistance(const Point &p1, const Point &p2) const
@@ -464,112 +457,94 @@ float TouchGestureDetector::CalcTwoPointsDistance(const Point &p1, const Point &
     return std::hypotf(p1.x - p2.x, p1.y - p2.y);
 }
 
-std::vector<std::pair<int32_t, Point>> TouchGestureDetector::SortPoints(std::map<int32_t, Point> &points)
+size_t TouchGestureDetector::SortPoints(const FingerTable &points,
+    std::array<int32_t, FingerTable::CAPACITY> &order) const
 {
-    if (points.empty()) {
+    if (points.Empty()) {
         MMI_HILOGW("Points are empty");
-        return {};
+        return 0;
     }
-    std::vector<std::pair<int32_t, Point>> sequence(points.begin(), points.end());
-    std::sort(sequence.begin(), sequence.end(),
-        [](std::pair<int32_t, Point> right, std::pair<int32_t, Point> left) {
-        return right.second.x < left.second.x;
+    size_t count { 0 };
+    points.ForEach([&order, &count](int32_t pointerId, const Point &) {
+        order[count++] = pointerId;
     });
-    auto iter = std::max_element(sequence.begin(), sequence.end(),
-        [](std::pair<int32_t, Point> right, std::pair<int32_t, Point> left) {
-        return right.second.y < left.second.y;
+    auto begin = order.begin();
+    auto end = order.begin() + count;
+    std::sort(begin, end, [&points](int32_t right, int32_t left) {
+        return points.Get(right).x < points.Get(left).x;
     });
-    std::pair<int32_t, Point> temp = *iter;
-    sequence.erase(iter);
-    sequence.push_back(temp);
-    return sequence;
+    auto iter = std::max_element(begin, end, [&points](int32_t right, int32_t left) {
+        return points.Get(right).y < points.Get(left).y;
+    });
+    std::rotate(iter, iter + 1, end);
+    return count;
 }
 
-Point TouchGestureDetector::CalcClusterCenter(const std::map<int32_t, Point> &points) const
+Point TouchGestureDetector::CalcClusterCenter(const FingerTable &points) const
 {
-    if (points.empty()) {
-        return Point {};
-    }
-    Point acc = std::accumulate(points.cbegin(), points.cend(), Point{},
-        [](const auto &init, const auto &item) {
-            return Point { init.x + item.second.x, init.y + item.second.y };
-        });
-    return Point { acc.x / points.size(), acc.y / points.size() };
+    return points.CalcCenter();
 }
 
 void TouchGestureDetector::CalcAndStoreDistance()
 {
-    if (!TouchGestureParameter::Load().DoesSupportGesture(gestureType_, static_cast<int32_t>(downPoint_.size()))) {
+    if (!TouchGestureParameter::Load().DoesSupportGesture(gestureType_, static_cast<int32_t>(downPoint_.Size()))) {
         return;
     }
-    lastDistance_.clear();
+    lastDistance_.Clear();
     int64_t interval = GetMaxDownInterval();
     if (interval > TouchGestureParameter::Load().GetMaxDownInterval()) {
         MMI_HILOGE("The pointers down time interval is too long");
         return;
     }
-    Point center = CalcClusterCenter(downPoint_);
-
-    for (const auto &[pointerId, downPt] : downPoint_) {
-        float distance = CalcTwoPointsDistance(center, downPt);
-        lastDistance_.emplace(pointerId, distance);
-    }
+    downPoint_.CalcDistances(CalcClusterCenter(downPoint_), lastDistance_);
 }
 
-int32_t TouchGestureDetector::CalcMultiFingerMovement(std::map<int32_t, Point> &points)
+int32_t TouchGestureDetector::CalcMultiFingerMovement(const FingerTable &points)
 {
-    int32_t movementCount = 0;
-    for (const auto &[id, point] : movePoint_) {
-        auto movePoints = points.find(id);
-        if (movePoints == points.end()) {
-            continue;
-        }
-        const auto distance = CalcTwoPointsDistance(point, movePoints->second);
-        if (distance >= TouchGestureParameter::Load().GetFingerMovementThreshold()) {
-            ++movementCount;
-        }
-    }
-    return movementCount;
+    auto motion = FingerTable::CalcMotion(movePoint_, points,
+        TouchGestureParameter::Load().GetFingerMovementThreshold());
+    return __builtin_popcount(motion.reached);
 }
 
-GestureMode TouchGestureDetector::JudgeOperationMode(std::map<int32_t, Point> &movePoints)
+GestureMode TouchGestureDetector::JudgeOperationMode(const FingerTable &movePoints)
 {
-    Point center = CalcClusterCenter(movePoints);
-    std::map<int32_t, float> tempDistance;
+    bool isComplete { true };
+    downPoint_.ForEach([this, &movePoints, &isComplete](int32_t pointerId, const Point &) {
+        isComplete = isComplete && movePoints.Contains(pointerId) && lastDistance_.Contains(pointerId);
+    });
+    if (!isComplete) {
+        return GestureMode::ACTION_UNKNOWN;
+    }
+    FingerDistances distances;
+    movePoints.CalcDistances(CalcClusterCenter(movePoints), distances);
+    const float minOffset = TouchGestureParameter::Load().GetMinGravityOffsetForPinch();
+    FingerDistances tempDistance;
     int32_t closeCount = 0;
     int32_t openCount = 0;
 
-    for (const auto &[pointerId, _] : downPoint_) {
-        auto movePointIter = movePoints.find(pointerId);
-        if (movePointIter == movePoints.end()) {
-            return GestureMode::ACTION_UNKNOWN;
-        }
-        float currentDistance = CalcTwoPointsDistance(center, movePointIter->second);
-        auto distanceIter = lastDistance_.find(pointerId);
-        if (distanceIter == lastDistance_.end()) {
-            return GestureMode::ACTION_UNKNOWN;
-        }
-        auto lastDistance = distanceIter->second;
-        if (currentDistance < lastDistance &&
-            lastDistance - currentDistance >= TouchGestureParameter::Load().GetMinGravityOffsetForPinch()) {
+    downPoint_.ForEach([&](int32_t pointerId, const Point &) {
+        float lastDistance = 0.0f;
+        float currentDistance = 0.0f;
+        lastDistance_.Get(pointerId, lastDistance);
+        distances.Get(pointerId, currentDistance);
+        if (currentDistance < lastDistance && lastDistance - currentDistance >= minOffset) {
             ++closeCount;
-        } else if (currentDistance > lastDistance &&
-            currentDistance - lastDistance >= TouchGestureParameter::Load().GetMinGravityOffsetForPinch()) {
+        } else if (currentDistance > lastDistance && currentDistance - lastDistance >= minOffset) {
             ++openCount;
         }
-        tempDistance.emplace(pointerId, currentDistance);
+        tempDistance.Set(pointerId, currentDistance);
         MMI_HILOGI("The pointerId:%{public}d,lastDistance:%{public}.2f,"
             "currentDistance:%{public}.2f,closeCount:%{public}d,openCount:%{public}d",
             pointerId, lastDistance, currentDistance, closeCount, openCount);
-    }
+    });
 
-    lastDistance_.swap(tempDistance);
+    lastDistance_ = tempDistance;
     const auto fingerCountOffset = TouchGestureParameter::Load().GetFingerCountOffsetForPinch();
     GestureMode type = GestureMode::ACTION_UNKNOWN;
 
-    if (closeCount >= static_cast<int32_t>(downPoint_.size() - fingerCountOffset)) {
+    if (closeCount >= static_cast<int32_t>(downPoint_.Size() - fingerCountOffset)) {
         type = GestureMode::ACTION_PINCH_CLOSED;
-    } else if (openCount >= static_cast<int32_t>(downPoint_.size() - fingerCountOffset)) {
+    } else if (openCount >= static_cast<int32_t>(downPoint_.Size() - fingerCountOffset)) {
         type = GestureMode::ACTION_PINCH_OPENED;
     }
     return type;
@@ -685,22 +660,16 @@ bool TouchGestureDetector::NotifyGestureEvent(std::shared_ptr<PointerEvent> even
 void TouchGestureDetector::CheckGestureTrend(std::shared_ptr<PointerEvent> event) const
 {
     CHKPV(listener_);
-    int32_t nMovements { 0 };
-
-    for (const auto &[pointerId, downPt] : downPoint_) {
-        PointerEvent::PointerItem item {};
-        CHKPC(event);
-        if (!event->GetPointerItem(pointerId, item)) {
-            MMI_HILOGW("No touch(%{public}d) record", pointerId);
+    FingerTable movePoints;
+    if (!downPoint_.Empty()) {
+        CHKPV(event);
+        if (!GetMovePoints(event, movePoints)) {
             return;
         }
-        Point movePt { item.GetDisplayX(), item.GetDisplayY() };
-
-        if (IsFingerMove(downPt, movePt)) {
-            ++nMovements;
-        }
     }
-    if (nMovements >= THREE_FINGER_COUNT) {
+    auto motion = FingerTable::CalcMotion(downPoint_, movePoints,
+        TouchGestureParameter::Load().GetFingerMovementThreshold());
+    if (__builtin_popcount(motion.moved) >= THREE_FINGER_COUNT) {
         listener_->OnGestureTrend(event);
     }
 }
@@ -746,13 +715,13 @@ void TouchGestureDetector::OnGestureSendEvent(std::shared_ptr<PointerEvent> even
 std::string TouchGestureDetector::DumpTouches() const
 {
     std::ostringstream output;
+    const char *separator = "(";
 
-    if (auto iter = downPoint_.cbegin(); iter != downPoint_.cend()) {
-        output << "(" << iter->first;
-
-        for (++iter; iter != downPoint_.cend(); ++iter) {
-            output << "," << iter->first;
-        }
+    downPoint_.ForEach([&output, &separator](int32_t pointerId, const Point &) {
+        output << separator << pointerId;
+        separator = ",";
+    });
+    if (!downPoint_.Empty()) {
         output << ")";
     }
     return std::move(output).str();
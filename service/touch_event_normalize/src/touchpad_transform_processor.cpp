@@ -24,6 +24,7 @@
 #include "i_input_windows_manager.h"
 #include "i_preference_manager.h"
 #include "input_event_handler.h"
+#include "libinput_adapter.h"
 #include "mouse_event_interface.h"
 #include "i_setting_manager.h"
 
@@ -752,6 +753,7 @@ void TouchPadTransformProcessor::NotifyLibinputDragState(bool switchFlag)
         if (originDevice == nullptr) {
             continue;
         }
+        std::lock_guard<std::recursive_mutex> guard(LibinputAdapter::GetContextMutex());
         auto ret = libinput_device_config_tap_set_drag_enabled(originDevice, state);
         MMI_HILOGI("Touchpad set double tap and drag state successfully, "
             "state:%{public}d, ret:%{public}d", state, ret);
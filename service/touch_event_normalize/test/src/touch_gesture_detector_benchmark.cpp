@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <map>
+#include <unordered_set>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "touch_finger_table.h"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr int32_t FRAMES_PER_STROKE { 60 };
+constexpr float CENTER_X { 1200.0f };
+constexpr float CENTER_Y { 1300.0f };
+constexpr float RADIUS { 400.0f };
+constexpr float SWIPE_STEP { 12.0f };
+constexpr float PINCH_STEP { 5.0f };
+constexpr float MOVEMENT_THRESHOLD { 3.0f };
+constexpr float MIN_GRAVITY_OFFSET { 0.5f };
+constexpr int32_t FINGER_COUNT_OFFSET { 1 };
+constexpr double ANGLE_PI { 180.0 };
+constexpr double ANGLE_RIGHT_DOWN { -45.0 };
+constexpr double ANGLE_RIGHT_UP { 45.0 };
+constexpr double ANGLE_LEFT_DOWN { -135.0 };
+constexpr double ANGLE_LEFT_UP { 135.0 };
+
+enum Direction : int32_t {
+    DIRECTION_UNKNOWN,
+    DIRECTION_DOWN,
+    DIRECTION_UP,
+    DIRECTION_LEFT,
+    DIRECTION_RIGHT,
+};
+
+using Frame = std::vector<Point>;
+
+// The fingers start on a circle, then all move up, or all move toward the center.
+std::vector<Frame> CreateStroke(int32_t nFingers, bool isPinch)
+{
+    std::vector<Frame> frames;
+    for (int32_t index = 0; index < FRAMES_PER_STROKE; ++index) {
+        Frame frame;
+        float radius = isPinch ? (RADIUS - index * PINCH_STEP) : RADIUS;
+        float offsetY = isPinch ? 0.0f : (-index * SWIPE_STEP);
+        for (int32_t finger = 0; finger < nFingers; ++finger) {
+            double angle = (2.0 * M_PI * finger) / nFingers;
+            frame.emplace_back(CENTER_X + radius * static_cast<float>(std::cos(angle)),
+                CENTER_Y + radius * static_cast<float>(std::sin(angle)) + offsetY);
+        }
+        frames.push_back(frame);
+    }
+    return frames;
+}
+
+Direction GetSlidingDirection(double angle)
+{
+    if (angle >= ANGLE_RIGHT_DOWN && angle < ANGLE_RIGHT_UP) {
+        return DIRECTION_RIGHT;
+    } else if (angle >= ANGLE_RIGHT_UP && angle < ANGLE_LEFT_UP) {
+        return DIRECTION_DOWN;
+    } else if (angle >= ANGLE_LEFT_DOWN && angle < ANGLE_RIGHT_DOWN) {
+        return DIRECTION_UP;
+    }
+    return DIRECTION_LEFT;
+}
+
+// The per-finger math of TouchGestureDetector as it was with std::map.
+class MapFingers {
+public:
+    void Down(const Frame &frame)
+    {
+        downPoint_.clear();
+        for (size_t id = 0; id < frame.size(); ++id) {
+            downPoint_.emplace(static_cast<int32_t>(id), frame[id]);
+        }
+        movePoint_ = downPoint_;
+        Point center = CalcClusterCenter(downPoint_);
+        lastDistance_.clear();
+        for (const auto &[pointerId, downPt] : downPoint_) {
+            lastDistance_.emplace(pointerId, std::hypotf(center.x - downPt.x, center.y - downPt.y));
+        }
+    }
+
+    Direction Swipe(const Frame &frame)
+    {
+        size_t recognizedCount { 0 };
+        std::unordered_set<Direction> directions;
+
+        for (const auto &[pointerId, downPt] : downPoint_) {
+            const Point &movePt = frame[pointerId];
+            if (std::hypotf(downPt.x - movePt.x, downPt.y - movePt.y) <= MOVEMENT_THRESHOLD) {
+                continue;
+            }
+            double angle = std::atan2((movePt.y - downPt.y), (movePt.x - downPt.x)) * (ANGLE_PI / M_PI);
+            directions.insert(GetSlidingDirection(angle));
+            ++recognizedCount;
+        }
+        if ((recognizedCount < downPoint_.size()) || (directions.size() != 1)) {
+            return DIRECTION_UNKNOWN;
+        }
+        return *(directions.begin());
+    }
+
+    int32_t Pinch(const Frame &frame)
+    {
+        std::map<int32_t, Point> movePoints;
+        std::unordered_set<Direction> directions;
+
+        for (const auto &[pointerId, downPt] : downPoint_) {
+            const Point &movePt = frame[pointerId];
+            if (std::hypotf(downPt.x - movePt.x, downPt.y - movePt.y) > MOVEMENT_THRESHOLD) {
+                double angle = std::atan2((movePt.y - downPt.y), (movePt.x - downPt.x)) * (ANGLE_PI / M_PI);
+                directions.insert(GetSlidingDirection(angle));
+            }
+            movePoints.insert_or_assign(pointerId, movePt);
+        }
+        if (directions.size() < 2) {
+            return 0;
+        }
+        int32_t movementCount = 0;
+        for (const auto &[id, point] : movePoint_) {
+            auto iter = movePoints.find(id);
+            if ((iter != movePoints.end()) &&
+                (std::hypotf(point.x - iter->second.x, point.y - iter->second.y) >= MOVEMENT_THRESHOLD)) {
+                ++movementCount;
+            }
+        }
+        if (movementCount < static_cast<int32_t>(downPoint_.size() - FINGER_COUNT_OFFSET)) {
+            return 0;
+        }
+        movePoint_ = movePoints;
+        Point center = CalcClusterCenter(movePoints);
+        std::map<int32_t, float> tempDistance;
+        int32_t closeCount = 0;
+
+        for (const auto &[pointerId, _] : downPoint_) {
+            const Point &movePt = movePoints[pointerId];
+            float currentDistance = std::hypotf(center.x - movePt.x, center.y - movePt.y);
+            if (lastDistance_[pointerId] - currentDistance >= MIN_GRAVITY_OFFSET) {
+                ++closeCount;
+            }
+            tempDistance.emplace(pointerId, currentDistance);
+        }
+        lastDistance_.swap(tempDistance);
+        return closeCount;
+    }
+
+private:
+    static Point CalcClusterCenter(const std::map<int32_t, Point> &points)
+    {
+        Point acc {};
+        for (const auto &[_, point] : points) {
+            acc.x += point.x;
+            acc.y += point.y;
+        }
+        return Point { acc.x / points.size(), acc.y / points.size() };
+    }
+
+    std::map<int32_t, Point> downPoint_;
+    std::map<int32_t, Point> movePoint_;
+    std::map<int32_t, float> lastDistance_;
+};
+
+// The same math on the finger table.
+class TableFingers {
+public:
+    void Down(const Frame &frame)
+    {
+        downPoint_.Clear();
+        for (size_t id = 0; id < frame.size(); ++id) {
+            downPoint_.Set(static_cast<int32_t>(id), frame[id]);
+        }
+        movePoint_ = downPoint_;
+        downPoint_.CalcDistances(downPoint_.CalcCenter(), lastDistance_);
+    }
+
+    Direction Swipe(const Frame &frame)
+    {
+        FingerTable movePoints = CreateMovePoints(frame);
+        auto motion = FingerTable::CalcMotion(downPoint_, movePoints, MOVEMENT_THRESHOLD);
+        if (motion.moved != downPoint_.Mask()) {
+            return DIRECTION_UNKNOWN;
+        }
+        const std::pair<uint32_t, Direction> directions[] {
+            { motion.down, DIRECTION_DOWN },
+            { motion.up, DIRECTION_UP },
+            { motion.left, DIRECTION_LEFT },
+            { motion.right, DIRECTION_RIGHT },
+        };
+        int32_t nDirections { 0 };
+        Direction result { DIRECTION_UNKNOWN };
+        for (const auto &[fingers, direction] : directions) {
+            if (fingers != 0) {
+                ++nDirections;
+                result = direction;
+            }
+        }
+        return (nDirections == 1) ? result : DIRECTION_UNKNOWN;
+    }
+
+    int32_t Pinch(const Frame &frame)
+    {
+        FingerTable movePoints = CreateMovePoints(frame);
+        auto motion = FingerTable::CalcMotion(downPoint_, movePoints, MOVEMENT_THRESHOLD);
+        int32_t nDirections = (motion.down != 0) + (motion.up != 0) + (motion.left != 0) + (motion.right != 0);
+        if (nDirections < 2) {
+            return 0;
+        }
+        auto movement = FingerTable::CalcMotion(movePoint_, movePoints, MOVEMENT_THRESHOLD);
+        if (__builtin_popcount(movement.reached) < static_cast<int32_t>(downPoint_.Size() - FINGER_COUNT_OFFSET)) {
+            return 0;
+        }
+        movePoint_ = movePoints;
+        FingerDistances distances;
+        movePoints.CalcDistances(movePoints.CalcCenter(), distances);
+        int32_t closeCount = 0;
+
+        downPoint_.ForEach([this, &distances, &closeCount](int32_t pointerId, const Point &) {
+            float lastDistance = 0.0f;
+            float currentDistance = 0.0f;
+            lastDistance_.Get(pointerId, lastDistance);
+            distances.Get(pointerId, currentDistance);
+            if (lastDistance - currentDistance >= MIN_GRAVITY_OFFSET) {
+                ++closeCount;
+            }
+        });
+        lastDistance_ = distances;
+        return closeCount;
+    }
+
+private:
+    FingerTable CreateMovePoints(const Frame &frame) const
+    {
+        FingerTable movePoints;
+        downPoint_.ForEach([&frame, &movePoints](int32_t pointerId, const Point &) {
+            movePoints.Set(pointerId, frame[pointerId]);
+        });
+        return movePoints;
+    }
+
+    FingerTable downPoint_;
+    FingerTable movePoint_;
+    FingerDistances lastDistance_;
+};
+
+template<typename Fingers>
+void RunSwipe(benchmark::State &state)
+{
+    auto frames = CreateStroke(static_cast<int32_t>(state.range(0)), false);
+    Fingers fingers;
+    size_t index = 0;
+    int64_t nRecognized = 0;
+    int64_t nEvents = 0;
+
+    for (auto _ : state) {
+        if (index == 0) {
+            fingers.Down(frames[index]);
+        } else if (fingers.Swipe(frames[index]) == DIRECTION_UP) {
+            ++nRecognized;
+        }
+        index = (index + 1) % frames.size();
+        ++nEvents;
+    }
+    state.SetItemsProcessed(nEvents);
+    state.counters["Recognized"] = benchmark::Counter(static_cast<double>(nRecognized) / nEvents);
+}
+
+template<typename Fingers>
+void RunPinch(benchmark::State &state)
+{
+    auto frames = CreateStroke(static_cast<int32_t>(state.range(0)), true);
+    Fingers fingers;
+    size_t index = 0;
+    int64_t nClosed = 0;
+    int64_t nEvents = 0;
+
+    for (auto _ : state) {
+        if (index == 0) {
+            fingers.Down(frames[index]);
+        } else {
+            nClosed += fingers.Pinch(frames[index]);
+        }
+        index = (index + 1) % frames.size();
+        ++nEvents;
+    }
+    state.SetItemsProcessed(nEvents);
+    state.counters["ClosedFingers"] = benchmark::Counter(static_cast<double>(nClosed) / nEvents);
+}
+
+// Fingers in std::map, atan2() for directions, as before the finger table.
+void BM_SwipeMap(benchmark::State &state)
+{
+    RunSwipe<MapFingers>(state);
+}
+
+void BM_SwipeFingerTable(benchmark::State &state)
+{
+    RunSwipe<TableFingers>(state);
+}
+
+void BM_PinchMap(benchmark::State &state)
+{
+    RunPinch<MapFingers>(state);
+}
+
+void BM_PinchFingerTable(benchmark::State &state)
+{
+    RunPinch<TableFingers>(state);
+}
+} // namespace
+
+BENCHMARK(BM_SwipeMap)->Arg(3)->Arg(4)->Arg(10);
+BENCHMARK(BM_SwipeFingerTable)->Arg(3)->Arg(4)->Arg(10);
+BENCHMARK(BM_PinchMap)->Arg(3)->Arg(4)->Arg(10);
+BENCHMARK(BM_PinchFingerTable)->Arg(3)->Arg(4)->Arg(10);
+} // namespace MMI
+} // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -14,6 +14,8 @@
  */
 
 #include <cstdio>
+#include <unordered_set>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "input_service_context.h"
@@ -305,10 +307,10 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandleDownEvent_01,
     detector.HandleDownEvent(pointerEvent);
     EXPECT_EQ(detector.gestureTimer_, -1);
     EXPECT_FALSE(detector.isFingerReady_);
-    EXPECT_EQ(detector.downPoint_.size(), SINGLE_TOUCH);
+    EXPECT_EQ(detector.downPoint_.Size(), SINGLE_TOUCH);
 
     detector.HandleDownEvent(pointerEvent);
-    EXPECT_EQ(detector.downPoint_.size(), SINGLE_TOUCH);
+    EXPECT_EQ(detector.downPoint_.Size(), SINGLE_TOUCH);
 }
 
 /**
@@ -335,8 +337,8 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandleDownEvent_02,
 
     detector.HandleDownEvent(pointerEvent);
     EXPECT_EQ(detector.gestureTimer_, -1);
-    EXPECT_EQ(detector.downPoint_.size(), SINGLE_TOUCH);
-    EXPECT_EQ(detector.movePoint_.size(), SINGLE_TOUCH);
+    EXPECT_EQ(detector.downPoint_.Size(), SINGLE_TOUCH);
+    EXPECT_EQ(detector.movePoint_.Size(), SINGLE_TOUCH);
 }
 
 /**
@@ -354,11 +356,11 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandleMoveEvent_01,
     int32_t nFingers { 4 };
     detector.AddGestureFingers(nFingers);
     int32_t pointerId { 0 };
-    detector.downPoint_.emplace(pointerId, Point());
+    detector.downPoint_.Set(pointerId, Point());
     int32_t pointerId1 { 1 };
-    detector.downPoint_.emplace(pointerId1, Point());
+    detector.downPoint_.Set(pointerId1, Point());
     int32_t pointerId2 { 2 };
-    detector.downPoint_.emplace(pointerId2, Point());
+    detector.downPoint_.Set(pointerId2, Point());
 
     PointerEvent::PointerItem item1 {};
     item1.SetPointerId(pointerId1);
@@ -387,9 +389,9 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandleMoveEvent_02,
     TouchGestureDetector detector(&env_, type, listener);
     std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
     ASSERT_NE(pointerEvent, nullptr);
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f);
-    detector.downPoint_[3] = Point(5.0f, 6.0f);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f));
+    detector.downPoint_.Set(3, Point(5.0f, 6.0f));
 
     detector.fingers_.insert(1);
     detector.fingers_.insert(0);
@@ -413,13 +415,13 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandleMoveEvent_03,
     int32_t nFingers { 4 };
     detector.AddGestureFingers(nFingers);
     int32_t pointerId { 0 };
-    detector.downPoint_.emplace(pointerId, Point());
+    detector.downPoint_.Set(pointerId, Point());
     int32_t pointerId1 { 1 };
-    detector.downPoint_.emplace(pointerId1, Point());
+    detector.downPoint_.Set(pointerId1, Point());
     int32_t pointerId2 { 2 };
-    detector.downPoint_.emplace(pointerId2, Point());
+    detector.downPoint_.Set(pointerId2, Point());
     int32_t pointerId3 { 3 };
-    detector.downPoint_.emplace(pointerId3, Point());
+    detector.downPoint_.Set(pointerId3, Point());
 
     PointerEvent::PointerItem item1 {};
     item1.SetPointerId(pointerId1);
@@ -448,8 +450,8 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandleSwipeMoveEvent
     std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
     ASSERT_NE(pointerEvent, nullptr);
 
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f, 150000);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f, 150000));
     detector.isFingerReady_ = false;
     ASSERT_NO_FATAL_FAILURE(detector.HandleSwipeMoveEvent(pointerEvent));
 }
@@ -469,9 +471,9 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandleSwipeMoveEvent
     std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
     ASSERT_NE(pointerEvent, nullptr);
 
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f, 150000);
-    detector.downPoint_[3] = Point(5.0f, 6.0f, 200000);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f, 150000));
+    detector.downPoint_.Set(3, Point(5.0f, 6.0f, 200000));
     detector.isFingerReady_ = true;
 
     auto state = detector.ClacFingerMoveDirection(pointerEvent);
@@ -499,9 +501,9 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandlePinchMoveEvent
     std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
     ASSERT_NE(pointerEvent, nullptr);
 
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f);
-    EXPECT_TRUE(detector.lastDistance_.empty());
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f));
+    EXPECT_TRUE(detector.lastDistance_.Empty());
     ASSERT_NO_FATAL_FAILURE(detector.HandlePinchMoveEvent(pointerEvent));
 }
 
@@ -520,15 +522,15 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandlePinchMoveEvent
     std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
     ASSERT_NE(pointerEvent, nullptr);
 
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f);
-    detector.downPoint_[3] = Point(5.0f, 6.0f);
-    detector.downPoint_[4] = Point(7.0f, 8.0f);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f));
+    detector.downPoint_.Set(3, Point(5.0f, 6.0f));
+    detector.downPoint_.Set(4, Point(7.0f, 8.0f));
 
-    detector.lastDistance_[1] = 1.0;
-    detector.lastDistance_[2] = 2.0;
-    detector.lastDistance_[3] = 3.0;
-    EXPECT_FALSE(detector.lastDistance_.empty());
+    detector.lastDistance_.Set(1, 1.0f);
+    detector.lastDistance_.Set(2, 2.0f);
+    detector.lastDistance_.Set(3, 3.0f);
+    EXPECT_FALSE(detector.lastDistance_.Empty());
     ASSERT_NO_FATAL_FAILURE(detector.HandlePinchMoveEvent(pointerEvent));
 }
 
@@ -547,8 +549,8 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandleUpEvent_01, Te
     std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
     ASSERT_NE(pointerEvent, nullptr);
     pointerEvent->pointerId_ = 1;
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f));
     ASSERT_NO_FATAL_FAILURE(detector.HandleUpEvent(pointerEvent));
 
     pointerEvent->pointerId_ = 3;
@@ -570,7 +572,7 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandleUpEvent_02, Te
     std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
     ASSERT_NE(pointerEvent, nullptr);
     pointerEvent->pointerId_ = 1;
-    EXPECT_TRUE(detector.downPoint_.empty());
+    EXPECT_TRUE(detector.downPoint_.Empty());
     ASSERT_NO_FATAL_FAILURE(detector.HandleUpEvent(pointerEvent));
 }
 
@@ -632,9 +634,9 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandleFingerDown_01,
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f);
-    auto fingersCount = detector.downPoint_.size();
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f));
+    auto fingersCount = detector.downPoint_.Size();
     EXPECT_TRUE(fingersCount < 3);
     EXPECT_FALSE(detector.HandleFingerDown());
 }
@@ -651,11 +653,11 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandleFingerDown_02,
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    detector.downPoint_[1] = Point(0.0f, 0.0f);
-    detector.downPoint_[2] = Point(1000.0f, 1000.0f);
-    detector.downPoint_[3] = Point(-1000.0f, -1000.0f);
-    detector.downPoint_[4] = Point(500.0f, -500.0f);
-    detector.downPoint_[5] = Point(-500.0f, 500.0f);
+    detector.downPoint_.Set(1, Point(0.0f, 0.0f));
+    detector.downPoint_.Set(2, Point(1000.0f, 1000.0f));
+    detector.downPoint_.Set(3, Point(-1000.0f, -1000.0f));
+    detector.downPoint_.Set(4, Point(500.0f, -500.0f));
+    detector.downPoint_.Set(5, Point(-500.0f, 500.0f));
     EXPECT_FALSE(detector.HandleFingerDown());
 }
 
@@ -671,11 +673,11 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandleFingerDown_03,
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    detector.downPoint_[1] = Point(0.0f, 0.0f);
-    detector.downPoint_[2] = Point(100.0f, 100.0f);
-    detector.downPoint_[3] = Point(200.0f, 200.0f);
-    detector.downPoint_[4] = Point(300.0f, 300.0f);
-    detector.downPoint_[5] = Point(400.0f, 400.0f);
+    detector.downPoint_.Set(1, Point(0.0f, 0.0f));
+    detector.downPoint_.Set(2, Point(100.0f, 100.0f));
+    detector.downPoint_.Set(3, Point(200.0f, 200.0f));
+    detector.downPoint_.Set(4, Point(300.0f, 300.0f));
+    detector.downPoint_.Set(5, Point(400.0f, 400.0f));
     EXPECT_TRUE(detector.HandleFingerDown());
 }
 
@@ -691,9 +693,9 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandleFingerDown_04,
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    detector.downPoint_[1] = Point(0.0f, 0.0f, 50000);
-    detector.downPoint_[2] = Point(100.0f, 100.0f, 150000);
-    detector.downPoint_[3] = Point(200.0f, 200.0f, 250000);
+    detector.downPoint_.Set(1, Point(0.0f, 0.0f, 50000));
+    detector.downPoint_.Set(2, Point(100.0f, 100.0f, 150000));
+    detector.downPoint_.Set(3, Point(200.0f, 200.0f, 250000));
     EXPECT_FALSE(detector.HandleFingerDown());
 }
 
@@ -709,8 +711,8 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_GetMaxFingerSpacing_
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f));
     ASSERT_NO_FATAL_FAILURE(detector.GetMaxFingerSpacing());
 }
 
@@ -726,9 +728,9 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_GetMaxFingerSpacing_
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f);
-    detector.downPoint_[3] = Point(5.0f, 6.0f);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f));
+    detector.downPoint_.Set(3, Point(5.0f, 6.0f));
     ASSERT_NO_FATAL_FAILURE(detector.GetMaxFingerSpacing());
 }
 
@@ -759,9 +761,9 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_GetMaxFingerSpacing_
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    detector.downPoint_[1] = Point(1.0f, 1.0f);
-    detector.downPoint_[2] = Point(2.0f, 2.0f);
-    detector.downPoint_[3] = Point(3.0f, 3.0f);
+    detector.downPoint_.Set(1, Point(1.0f, 1.0f));
+    detector.downPoint_.Set(2, Point(2.0f, 2.0f));
+    detector.downPoint_.Set(3, Point(3.0f, 3.0f));
     EXPECT_FLOAT_EQ(detector.GetMaxFingerSpacing(), std::hypot(2.0f, 2.0f));
 }
 
@@ -777,10 +779,10 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_GetMaxFingerSpacing_
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    detector.downPoint_[1] = Point(1.0f, 1.0f);
-    detector.downPoint_[2] = Point(2.0f, 2.0f);
-    detector.downPoint_[3] = Point(3.0f, 3.0f);
-    detector.downPoint_[4] = Point(4.0f, 4.0f);
+    detector.downPoint_.Set(1, Point(1.0f, 1.0f));
+    detector.downPoint_.Set(2, Point(2.0f, 2.0f));
+    detector.downPoint_.Set(3, Point(3.0f, 3.0f));
+    detector.downPoint_.Set(4, Point(4.0f, 4.0f));
     EXPECT_FLOAT_EQ(detector.GetMaxFingerSpacing(), std::hypot(3.0f, 3.0f));
 }
 
@@ -796,8 +798,8 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_GetMaxDownInterval_0
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f));
     ASSERT_NO_FATAL_FAILURE(detector.GetMaxDownInterval());
 }
 
@@ -813,9 +815,9 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_GetMaxDownInterval_0
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f);
-    detector.downPoint_[3] = Point(5.0f, 6.0f);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f));
+    detector.downPoint_.Set(3, Point(5.0f, 6.0f));
     ASSERT_NO_FATAL_FAILURE(detector.GetMaxDownInterval());
 }
 
@@ -889,8 +891,8 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_ClacFingerMoveDirect
     ASSERT_NO_FATAL_FAILURE(detector.ClacFingerMoveDirection(pointerEvent));
 
     pointerEvent->pointerAction_ = PointerEvent::POINTER_ACTION_MOVE;
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f));
     ASSERT_NO_FATAL_FAILURE(detector.ClacFingerMoveDirection(pointerEvent));
 }
 
@@ -909,9 +911,9 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_ClacFingerMoveDirect
     std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
     ASSERT_NE(pointerEvent, nullptr);
     pointerEvent->pointerAction_ = PointerEvent::POINTER_ACTION_MOVE;
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f);
-    detector.downPoint_[3] = Point(5.0f, 6.0f);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f));
+    detector.downPoint_.Set(3, Point(5.0f, 6.0f));
     ASSERT_NO_FATAL_FAILURE(detector.ClacFingerMoveDirection(pointerEvent));
 }
 
@@ -951,7 +953,7 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_CalcClusterCenter_01
 {
     CALL_TEST_DEBUG;
     TouchGestureDetector detector(&env_, TOUCH_GESTURE_TYPE_SWIPE, nullptr);
-    std::map<int32_t, Point> points;
+    FingerTable points;
     ASSERT_NO_FATAL_FAILURE(detector.CalcClusterCenter(points));
 }
 
@@ -965,10 +967,10 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_CalcClusterCenter_02
 {
     CALL_TEST_DEBUG;
     TouchGestureDetector detector(&env_, TOUCH_GESTURE_TYPE_SWIPE, nullptr);
-    std::map<int32_t, Point> points;
-    points[1] = Point(1.0f, 2.0f);
-    points[2] = Point(3.0f, 4.0f);
-    points[3] = Point(5.0f, 6.0f);
+    FingerTable points;
+    points.Set(1, Point(1.0f, 2.0f));
+    points.Set(2, Point(3.0f, 4.0f));
+    points.Set(3, Point(5.0f, 6.0f));
     ASSERT_NO_FATAL_FAILURE(detector.CalcClusterCenter(points));
 }
 
@@ -984,12 +986,12 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_CalcAndStoreDistance
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    std::map<int32_t, Point> points;
-    points[1] = Point(1.0f, 2.0f);
-    points[2] = Point(3.0f, 4.0f);
+    FingerTable points;
+    points.Set(1, Point(1.0f, 2.0f));
+    points.Set(2, Point(3.0f, 4.0f));
 
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f));
     ASSERT_NO_FATAL_FAILURE(detector.CalcAndStoreDistance());
 }
 
@@ -1005,14 +1007,14 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_CalcAndStoreDistance
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    std::map<int32_t, Point> points;
-    points[1] = Point(1.0f, 2.0f);
-    points[2] = Point(3.0f, 4.0f);
+    FingerTable points;
+    points.Set(1, Point(1.0f, 2.0f));
+    points.Set(2, Point(3.0f, 4.0f));
 
-    detector.downPoint_[1] = Point(1.0f, 2.0f, 50000);
-    detector.downPoint_[2] = Point(3.0f, 4.0f, 150000);
-    detector.downPoint_[3] = Point(5.0f, 6.0f, 250000);
-    detector.downPoint_[4] = Point(7.0f, 8.0f, 350000);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f, 50000));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f, 150000));
+    detector.downPoint_.Set(3, Point(5.0f, 6.0f, 250000));
+    detector.downPoint_.Set(4, Point(7.0f, 8.0f, 350000));
     ASSERT_NO_FATAL_FAILURE(detector.CalcAndStoreDistance());
 }
 
@@ -1028,18 +1030,18 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_CalcAndStoreDistance
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    std::map<int32_t, Point> points;
-    points[1] = Point(1.0f, 2.0f);
-    points[2] = Point(3.0f, 4.0f);
+    FingerTable points;
+    points.Set(1, Point(1.0f, 2.0f));
+    points.Set(2, Point(3.0f, 4.0f));
 
-    detector.downPoint_[1] = Point(1.0f, 2.0f, 5000);
-    detector.downPoint_[2] = Point(3.0f, 4.0f, 6000);
-    detector.downPoint_[3] = Point(5.0f, 6.0f, 7000);
-    detector.downPoint_[4] = Point(7.0f, 8.0f, 8000);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f, 5000));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f, 6000));
+    detector.downPoint_.Set(3, Point(5.0f, 6.0f, 7000));
+    detector.downPoint_.Set(4, Point(7.0f, 8.0f, 8000));
 
-    detector.lastDistance_[1] = 10.5;
-    detector.lastDistance_[2] = 20.5;
-    detector.lastDistance_[3] = 30.5;
+    detector.lastDistance_.Set(1, 10.5f);
+    detector.lastDistance_.Set(2, 20.5f);
+    detector.lastDistance_.Set(3, 30.5f);
     ASSERT_NO_FATAL_FAILURE(detector.CalcAndStoreDistance());
 }
 
@@ -1055,14 +1057,14 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_CalcMultiFingerMovem
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    std::map<int32_t, Point> points;
-    points[1] = Point(1.0f, 2.0f);
-    points[2] = Point(3.0f, 4.0f);
-    points[3] = Point(5.0f, 6.0f);
+    FingerTable points;
+    points.Set(1, Point(1.0f, 2.0f));
+    points.Set(2, Point(3.0f, 4.0f));
+    points.Set(3, Point(5.0f, 6.0f));
 
-    detector.downPoint_[1] = Point(1.0f, 2.0f, 50000);
-    detector.downPoint_[2] = Point(3.0f, 4.0f, 150000);
-    detector.downPoint_[3] = Point(5.0f, 6.0f, 250000);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f, 50000));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f, 150000));
+    detector.downPoint_.Set(3, Point(5.0f, 6.0f, 250000));
     ASSERT_NO_FATAL_FAILURE(detector.CalcMultiFingerMovement(points));
 }
 
@@ -1078,14 +1080,14 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_CalcMultiFingerMovem
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    std::map<int32_t, Point> points;
-    points[1] = Point(1.0f, 2.0f);
-    points[2] = Point(3.0f, 4.0f);
-    points[3] = Point(5.0f, 6.0f);
+    FingerTable points;
+    points.Set(1, Point(1.0f, 2.0f));
+    points.Set(2, Point(3.0f, 4.0f));
+    points.Set(3, Point(5.0f, 6.0f));
 
-    detector.downPoint_[4] = Point(1.0f, 2.0f, 5000);
-    detector.downPoint_[5] = Point(3.0f, 4.0f, 6000);
-    detector.downPoint_[6] = Point(5.0f, 6.0f, 7000);
+    detector.downPoint_.Set(4, Point(1.0f, 2.0f, 5000));
+    detector.downPoint_.Set(5, Point(3.0f, 4.0f, 6000));
+    detector.downPoint_.Set(6, Point(5.0f, 6.0f, 7000));
     ASSERT_NO_FATAL_FAILURE(detector.CalcMultiFingerMovement(points));
 }
 
@@ -1101,14 +1103,14 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_JudgeOperationMode_0
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    std::map<int32_t, Point> movePoints;
-    movePoints[1] = Point(1.0f, 2.0f);
-    movePoints[2] = Point(3.0f, 4.0f);
-    movePoints[3] = Point(5.0f, 6.0f);
+    FingerTable movePoints;
+    movePoints.Set(1, Point(1.0f, 2.0f));
+    movePoints.Set(2, Point(3.0f, 4.0f));
+    movePoints.Set(3, Point(5.0f, 6.0f));
 
-    detector.downPoint_[4] = Point(1.0f, 2.0f, 5000);
-    detector.downPoint_[5] = Point(3.0f, 4.0f, 6000);
-    detector.downPoint_[6] = Point(5.0f, 6.0f, 7000);
+    detector.downPoint_.Set(4, Point(1.0f, 2.0f, 5000));
+    detector.downPoint_.Set(5, Point(3.0f, 4.0f, 6000));
+    detector.downPoint_.Set(6, Point(5.0f, 6.0f, 7000));
 
     ASSERT_NO_FATAL_FAILURE(detector.JudgeOperationMode(movePoints));
 }
@@ -1125,15 +1127,15 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_JudgeOperationMode_0
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    std::map<int32_t, Point> movePoints;
-    movePoints[1] = Point(1.0f, 2.0f);
-    movePoints[2] = Point(3.0f, 4.0f);
-    movePoints[3] = Point(5.0f, 6.0f);
+    FingerTable movePoints;
+    movePoints.Set(1, Point(1.0f, 2.0f));
+    movePoints.Set(2, Point(3.0f, 4.0f));
+    movePoints.Set(3, Point(5.0f, 6.0f));
 
-    detector.downPoint_[4] = Point(1.0f, 2.0f, 5000);
-    detector.downPoint_[5] = Point(3.0f, 4.0f, 6000);
-    detector.downPoint_[6] = Point(5.0f, 6.0f, 7000);
-    detector.downPoint_[7] = Point(7.0f, 8.0f, 8000);
+    detector.downPoint_.Set(4, Point(1.0f, 2.0f, 5000));
+    detector.downPoint_.Set(5, Point(3.0f, 4.0f, 6000));
+    detector.downPoint_.Set(6, Point(5.0f, 6.0f, 7000));
+    detector.downPoint_.Set(7, Point(7.0f, 8.0f, 8000));
 
     ASSERT_NO_FATAL_FAILURE(detector.JudgeOperationMode(movePoints));
 }
@@ -1150,19 +1152,19 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_JudgeOperationMode_0
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    std::map<int32_t, Point> movePoints;
-    movePoints[1] = Point(1.0f, 2.0f);
-    movePoints[2] = Point(3.0f, 4.0f);
-    movePoints[3] = Point(5.0f, 6.0f);
+    FingerTable movePoints;
+    movePoints.Set(1, Point(1.0f, 2.0f));
+    movePoints.Set(2, Point(3.0f, 4.0f));
+    movePoints.Set(3, Point(5.0f, 6.0f));
 
-    detector.downPoint_[1] = Point(1.0f, 2.0f, 5000);
-    detector.downPoint_[2] = Point(3.0f, 4.0f, 6000);
-    detector.downPoint_[3] = Point(5.0f, 6.0f, 7000);
-    detector.downPoint_[4] = Point(7.0f, 8.0f, 8000);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f, 5000));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f, 6000));
+    detector.downPoint_.Set(3, Point(5.0f, 6.0f, 7000));
+    detector.downPoint_.Set(4, Point(7.0f, 8.0f, 8000));
 
-    detector.lastDistance_[4] = 1.0;
-    detector.lastDistance_[5] = 2.0;
-    detector.lastDistance_[6] = 3.0;
+    detector.lastDistance_.Set(4, 1.0f);
+    detector.lastDistance_.Set(5, 2.0f);
+    detector.lastDistance_.Set(6, 3.0f);
     ASSERT_NO_FATAL_FAILURE(detector.JudgeOperationMode(movePoints));
 }
 
@@ -1178,21 +1180,21 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_JudgeOperationMode_0
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    std::map<int32_t, Point> movePoints;
-    movePoints[1] = Point(1.0f, 2.0f);
-    movePoints[2] = Point(3.0f, 4.0f);
-    movePoints[3] = Point(5.0f, 6.0f);
-    movePoints[4] = Point(7.0f, 8.0f);
+    FingerTable movePoints;
+    movePoints.Set(1, Point(1.0f, 2.0f));
+    movePoints.Set(2, Point(3.0f, 4.0f));
+    movePoints.Set(3, Point(5.0f, 6.0f));
+    movePoints.Set(4, Point(7.0f, 8.0f));
 
-    detector.downPoint_[1] = Point(1.0f, 2.0f, 5000);
-    detector.downPoint_[2] = Point(3.0f, 4.0f, 6000);
-    detector.downPoint_[3] = Point(5.0f, 6.0f, 7000);
-    detector.downPoint_[4] = Point(7.0f, 8.0f, 8000);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f, 5000));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f, 6000));
+    detector.downPoint_.Set(3, Point(5.0f, 6.0f, 7000));
+    detector.downPoint_.Set(4, Point(7.0f, 8.0f, 8000));
 
-    detector.lastDistance_[1] = 1.0;
-    detector.lastDistance_[2] = 2.0;
-    detector.lastDistance_[3] = 3.0;
-    detector.lastDistance_[4] = 4.0;
+    detector.lastDistance_.Set(1, 1.0f);
+    detector.lastDistance_.Set(2, 2.0f);
+    detector.lastDistance_.Set(3, 3.0f);
+    detector.lastDistance_.Set(4, 4.0f);
     ASSERT_NO_FATAL_FAILURE(detector.JudgeOperationMode(movePoints));
 }
 
@@ -1562,13 +1564,13 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandlePinchMoveEvent
     TouchGestureDetector detector(&env_, type, listener);
     std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
     ASSERT_NE(pointerEvent, nullptr);
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f);
-    detector.downPoint_[3] = Point(5.0f, 6.0f);
-    detector.downPoint_[4] = Point(7.0f, 8.0f);
-    detector.lastDistance_[1] = 1.0;
-    detector.lastDistance_[2] = 2.0;
-    detector.lastDistance_[3] = 3.0;
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f));
+    detector.downPoint_.Set(3, Point(5.0f, 6.0f));
+    detector.downPoint_.Set(4, Point(7.0f, 8.0f));
+    detector.lastDistance_.Set(1, 1.0f);
+    detector.lastDistance_.Set(2, 2.0f);
+    detector.lastDistance_.Set(3, 3.0f);
     PointerEvent::PointerItem item1;
     item1.SetPointerId(1);
     PointerEvent::PointerItem item2;
@@ -1616,8 +1618,8 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandleUpEvent_003, T
     std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
     ASSERT_NE(pointerEvent, nullptr);
     pointerEvent->pointerId_ = 1;
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f));
     detector.isRecognized_ = true;
     detector.lastTouchEvent_ = pointerEvent;
     ASSERT_NO_FATAL_FAILURE(detector.HandleUpEvent(pointerEvent));
@@ -1715,9 +1717,9 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandleSwipeMoveEvent
     std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
     ASSERT_NE(pointerEvent, nullptr);
 
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f, 150000);
-    detector.downPoint_[3] = Point(5.0f, 6.0f, 200000);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f, 150000));
+    detector.downPoint_.Set(3, Point(5.0f, 6.0f, 200000));
     detector.isFingerReady_ = true;
 
     auto state = detector.ClacFingerMoveDirection(pointerEvent);
@@ -1749,9 +1751,9 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandleSwipeMoveEvent
     std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
     ASSERT_NE(pointerEvent, nullptr);
 
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f, 150000);
-    detector.downPoint_[3] = Point(5.0f, 6.0f, 200000);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f, 150000));
+    detector.downPoint_.Set(3, Point(5.0f, 6.0f, 200000));
     detector.isFingerReady_ = true;
 
     auto state = detector.ClacFingerMoveDirection(pointerEvent);
@@ -1789,13 +1791,13 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandlePinchMoveEvent
     directions.insert(direction2);
     EXPECT_EQ(directions.size(), 2);
     ASSERT_NE(pointerEvent, nullptr);
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f);
-    detector.downPoint_[3] = Point(5.0f, 6.0f);
-    detector.downPoint_[4] = Point(7.0f, 8.0f);
-    detector.lastDistance_[1] = 1.0;
-    detector.lastDistance_[2] = 2.0;
-    detector.lastDistance_[3] = 3.0;
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f));
+    detector.downPoint_.Set(3, Point(5.0f, 6.0f));
+    detector.downPoint_.Set(4, Point(7.0f, 8.0f));
+    detector.lastDistance_.Set(1, 1.0f);
+    detector.lastDistance_.Set(2, 2.0f);
+    detector.lastDistance_.Set(3, 3.0f);
     ASSERT_NO_FATAL_FAILURE(detector.HandlePinchMoveEvent(pointerEvent));
 }
 
@@ -1814,14 +1816,14 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_HandleUpEvent_004, T
     std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
     ASSERT_NE(pointerEvent, nullptr);
     pointerEvent->pointerId_ = 1;
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f);
-    detector.downPoint_[3] = Point(5.0f, 6.0f);
-    detector.downPoint_[4] = Point(7.0f, 8.0f);
-    detector.lastDistance_[1] = 1.0;
-    detector.lastDistance_[2] = 2.0;
-    detector.lastDistance_[3] = 3.0;
-    EXPECT_FALSE(detector.lastDistance_.empty());
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f));
+    detector.downPoint_.Set(3, Point(5.0f, 6.0f));
+    detector.downPoint_.Set(4, Point(7.0f, 8.0f));
+    detector.lastDistance_.Set(1, 1.0f);
+    detector.lastDistance_.Set(2, 2.0f);
+    detector.lastDistance_.Set(3, 3.0f);
+    EXPECT_FALSE(detector.lastDistance_.Empty());
     detector.isRecognized_ = true;
     detector.lastTouchEvent_ = pointerEvent;
     PointerEvent::PointerItem item1;
@@ -1943,14 +1945,14 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_ClacFingerMoveDirect
     angle = 50;
     auto direction2 = detector.GetSlidingDirection(angle);
     directions.insert(direction2);
-    std::map<int32_t, Point> points;
-    points[1] = Point(1.0f, 2.0f);
-    points[2] = Point(3.0f, 4.0f);
-    points[3] = Point(5.0f, 6.0f);
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f);
-    detector.downPoint_[3] = Point(5.0f, 6.0f);
-    int32_t count = static_cast<int32_t>(points.size());
+    FingerTable points;
+    points.Set(1, Point(1.0f, 2.0f));
+    points.Set(2, Point(3.0f, 4.0f));
+    points.Set(3, Point(5.0f, 6.0f));
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f));
+    detector.downPoint_.Set(3, Point(5.0f, 6.0f));
+    int32_t count = static_cast<int32_t>(points.Size());
     EXPECT_TRUE(count > recognizedCount);
     ASSERT_NO_FATAL_FAILURE(detector.ClacFingerMoveDirection(pointerEvent));
 }
@@ -1970,15 +1972,16 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_SortPoints_01, TestS
     std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
     ASSERT_NE(pointerEvent, nullptr);
 
-    std::map<int32_t, Point> points;
-    points[1] = Point(1.0f, 2.0f);
-    points[2] = Point(3.0f, 4.0f);
-    points[3] = Point(5.0f, 6.0f);
-    int32_t count = static_cast<int32_t>(points.size());
+    FingerTable points;
+    points.Set(1, Point(1.0f, 2.0f));
+    points.Set(2, Point(3.0f, 4.0f));
+    points.Set(3, Point(5.0f, 6.0f));
+    int32_t count = static_cast<int32_t>(points.Size());
     EXPECT_TRUE(count > 0);
-    EXPECT_FALSE(points.empty());
-    auto ret = detector.SortPoints(points);
-    EXPECT_FALSE(ret.empty());
+    EXPECT_FALSE(points.Empty());
+    std::array<int32_t, FingerTable::CAPACITY> order {};
+    auto ret = detector.SortPoints(points, order);
+    EXPECT_EQ(ret, points.Size());
 }
 
 /**
@@ -1995,12 +1998,13 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_SortPoints_02, TestS
     TouchGestureDetector detector(&env_, type, listener);
     std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
     ASSERT_NE(pointerEvent, nullptr);
-    std::map<int32_t, Point> points;
-    int32_t count = static_cast<int32_t>(points.size());
+    FingerTable points;
+    int32_t count = static_cast<int32_t>(points.Size());
     EXPECT_EQ(count, 0);
-    EXPECT_TRUE(points.empty());
-    auto ret = detector.SortPoints(points);
-    EXPECT_TRUE(ret.empty());
+    EXPECT_TRUE(points.Empty());
+    std::array<int32_t, FingerTable::CAPACITY> order {};
+    auto ret = detector.SortPoints(points, order);
+    EXPECT_EQ(ret, 0);
 }
 
 /**
@@ -2015,8 +2019,8 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_CalcClusterCenter_03
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    std::map<int32_t, Point> points;
-    EXPECT_TRUE(points.empty());
+    FingerTable points;
+    EXPECT_TRUE(points.Empty());
     Point result = detector.CalcClusterCenter(points);
     EXPECT_EQ(result.x, 0.0f);
     EXPECT_EQ(result.y, 0.0f);
@@ -2031,9 +2035,10 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_CalcClusterCenter_03
 HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_CalcClusterCenter_04, TestSize.Level1)
 {
     CALL_TEST_DEBUG;
-    std::map<int32_t, Point> points{
-        {0, Point(2.0f, 3.0f)}, {1, Point(4.0f, 5.0f)}, {2, Point(6.0f, 7.0f)}
-    };
+    FingerTable points;
+    points.Set(0, Point(2.0f, 3.0f));
+    points.Set(1, Point(4.0f, 5.0f));
+    points.Set(2, Point(6.0f, 7.0f));
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
@@ -2055,11 +2060,11 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_CalcMultiFingerMovem
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    std::map<int32_t, Point> points;
-    points[1] = Point(1.0f, 2.0f);
-    points[2] = Point(3.0f, 4.0f);
-    points[3] = Point(5.0f, 6.0f);
-    detector.movePoint_ = {}; // 设置空的 movePoint_
+    FingerTable points;
+    points.Set(1, Point(1.0f, 2.0f));
+    points.Set(2, Point(3.0f, 4.0f));
+    points.Set(3, Point(5.0f, 6.0f));
+    detector.movePoint_.Clear(); // 设置空的 movePoint_
     int32_t result = detector.CalcMultiFingerMovement(points);
     EXPECT_EQ(result, 0);
 }
@@ -2076,10 +2081,10 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_CalcMultiFingerMovem
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    std::map<int32_t, Point> points;
-    points[1] = Point(1.0f, 2.0f);
-    detector.movePoint_[1] = Point(1.0f, 2.0f);
-    detector.movePoint_[2] = Point(3.0f, 4.0f);
+    FingerTable points;
+    points.Set(1, Point(1.0f, 2.0f));
+    detector.movePoint_.Set(1, Point(1.0f, 2.0f));
+    detector.movePoint_.Set(2, Point(3.0f, 4.0f));
     int32_t result = detector.CalcMultiFingerMovement(points);
     EXPECT_EQ(result, 0);
 }
@@ -2096,11 +2101,11 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_CalcMultiFingerMovem
     auto listener = std::make_shared<MyGestureListener>();
     TouchGestureType type = TOUCH_GESTURE_TYPE_SWIPE;
     TouchGestureDetector detector(&env_, type, listener);
-    std::map<int32_t, Point> points;
-    points[1] = Point(MAXIMUM_SINGLE_SLIDE_DISTANCE + 0.0f, 0.0f);
-    points[2] = Point(1.0f, 2.0f + MAXIMUM_SINGLE_SLIDE_DISTANCE);
-    detector.movePoint_[1] = Point(0.0f, 0.0f);
-    detector.movePoint_[2] = Point(1.0f, 2.0f);
+    FingerTable points;
+    points.Set(1, Point(MAXIMUM_SINGLE_SLIDE_DISTANCE + 0.0f, 0.0f));
+    points.Set(2, Point(1.0f, 2.0f + MAXIMUM_SINGLE_SLIDE_DISTANCE));
+    detector.movePoint_.Set(1, Point(0.0f, 0.0f));
+    detector.movePoint_.Set(2, Point(1.0f, 2.0f));
     int32_t result = detector.CalcMultiFingerMovement(points);
     EXPECT_EQ(result, 2);
 }
@@ -2168,9 +2173,9 @@ HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_CheckGestureTrend_00
     std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
     ASSERT_NE(pointerEvent, nullptr);
 
-    detector.downPoint_[1] = Point(1.0f, 2.0f);
-    detector.downPoint_[2] = Point(3.0f, 4.0f);
-    detector.downPoint_[3] = Point(5.0f, 6.0f);
+    detector.downPoint_.Set(1, Point(1.0f, 2.0f));
+    detector.downPoint_.Set(2, Point(3.0f, 4.0f));
+    detector.downPoint_.Set(3, Point(5.0f, 6.0f));
     PointerEvent::PointerItem item1;
     item1.SetPointerId(1);
     PointerEvent::PointerItem item2;
@@ -2283,5 +2288,141 @@ HWTEST_F(TouchGestureDetectorTest, NotifyGestureEventTest1, TestSize.Level1)
     GestureMode mode = GestureMode::ACTION_UNKNOWN;
     ASSERT_NO_FATAL_FAILURE(detector.NotifyGestureEvent(pointerEvent, mode));
 }
+
+/**
+ * @tc.name: TouchGestureDetectorTest_CalcMotion_01
+ * @tc.desc: Verify the directions of the finger table agree with GetSlidingDirection on the angle of the motion
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_CalcMotion_01, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    TouchGestureDetector detector(&env_, TOUCH_GESTURE_TYPE_SWIPE, nullptr);
+    constexpr float threshold { 3.0f };
+    constexpr int32_t range { 12 };
+    constexpr int32_t pointerId { 9 };
+    FingerTable from;
+    FingerTable to;
+    from.Set(pointerId, Point(100.0f, 200.0f));
+
+    for (int32_t dx = -range; dx <= range; ++dx) {
+        for (int32_t dy = -range; dy <= range; ++dy) {
+            to.Set(pointerId, Point(100.0f + dx, 200.0f + dy));
+            auto motion = FingerTable::CalcMotion(from, to, threshold);
+            Point downPt = from.Get(pointerId);
+            Point movePt = to.Get(pointerId);
+            bool isMoved = detector.IsFingerMove(downPt, movePt);
+            ASSERT_EQ(motion.moved != 0, isMoved);
+            if (!isMoved) {
+                continue;
+            }
+            auto direction = detector.GetSlidingDirection(detector.GetAngle(downPt.x, downPt.y, movePt.x, movePt.y));
+            EXPECT_EQ(motion.down != 0, direction == TouchGestureDetector::SlideState::DIRECTION_DOWN);
+            EXPECT_EQ(motion.up != 0, direction == TouchGestureDetector::SlideState::DIRECTION_UP);
+            EXPECT_EQ(motion.left != 0, direction == TouchGestureDetector::SlideState::DIRECTION_LEFT);
+            EXPECT_EQ(motion.right != 0, direction == TouchGestureDetector::SlideState::DIRECTION_RIGHT);
+        }
+    }
+}
+
+/**
+ * @tc.name: TouchGestureDetectorTest_FingerTable_01
+ * @tc.desc: Verify the center, spacing and distances of the finger table skip the slots of lifted fingers
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_FingerTable_01, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    FingerTable points;
+    EXPECT_FALSE(points.Set(-1, Point(1.0f, 1.0f)));
+    EXPECT_TRUE(points.Set(0, Point(100.0f, 100.0f)));
+    EXPECT_TRUE(points.Set(5, Point(0.0f, 0.0f)));
+    EXPECT_TRUE(points.Set(6, Point(6.0f, 0.0f)));
+    EXPECT_TRUE(points.Set(9, Point(0.0f, 9.0f)));
+    EXPECT_TRUE(points.Erase(0));
+    EXPECT_FALSE(points.Erase(0));
+    EXPECT_EQ(points.Size(), 3);
+
+    Point center = points.CalcCenter();
+    EXPECT_FLOAT_EQ(center.x, 2.0f);
+    EXPECT_FLOAT_EQ(center.y, 3.0f);
+    EXPECT_FLOAT_EQ(points.CalcMaxSpacing(), std::hypot(6.0f, 9.0f));
+
+    FingerDistances distances;
+    points.CalcDistances(center, distances);
+    EXPECT_EQ(distances.Mask(), points.Mask());
+    float distance = 0.0f;
+    EXPECT_FALSE(distances.Get(0, distance));
+    ASSERT_TRUE(distances.Get(6, distance));
+    EXPECT_FLOAT_EQ(distance, std::hypot(4.0f, 3.0f));
+}
+/**
+ * @tc.name: TouchGestureDetectorTest_FingerTable_02
+ * @tc.desc: Verify pointer ids beyond the capacity take free slots and Set fails once all slots are taken
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_FingerTable_02, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    constexpr int32_t largeId { 100 };
+    FingerTable points;
+    EXPECT_TRUE(points.Set(largeId, Point(1.0f, 2.0f)));
+    EXPECT_TRUE(points.Set(0, Point(3.0f, 4.0f)));
+    EXPECT_TRUE(points.Set(largeId + 1, Point(5.0f, 6.0f)));
+    EXPECT_TRUE(points.Contains(largeId));
+    EXPECT_FLOAT_EQ(points.Get(0).x, 3.0f);
+    EXPECT_FLOAT_EQ(points.Get(largeId + 1).y, 6.0f);
+
+    std::vector<int32_t> ids;
+    points.ForEach([&ids](int32_t pointerId, const Point &) {
+        ids.push_back(pointerId);
+    });
+    EXPECT_EQ(ids, std::vector<int32_t>({ 0, largeId, largeId + 1 }));
+
+    FingerDistances distances;
+    points.CalcDistances(points.CalcCenter(), distances);
+    float distance = 0.0f;
+    ASSERT_TRUE(distances.Get(largeId + 1, distance));
+    EXPECT_FLOAT_EQ(distance, std::hypot(2.0f, 2.0f));
+
+    EXPECT_TRUE(points.Erase(largeId));
+    EXPECT_FALSE(points.Contains(largeId));
+    for (int32_t pointerId = 1; points.Size() < static_cast<size_t>(FingerTable::CAPACITY); ++pointerId) {
+        ASSERT_TRUE(points.Set(pointerId, Point(0.0f, 0.0f)));
+    }
+    EXPECT_FALSE(points.Set(largeId + 2, Point(0.0f, 0.0f)));
+    EXPECT_TRUE(points.Set(largeId + 1, Point(7.0f, 8.0f)));
+    EXPECT_FLOAT_EQ(points.Get(largeId + 1).x, 7.0f);
+}
+
+/**
+ * @tc.name: TouchGestureDetectorTest_FingerTable_03
+ * @tc.desc: Verify the motion of fingers that sit in different slots of the two tables
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TouchGestureDetectorTest, TouchGestureDetectorTest_FingerTable_03, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    constexpr float threshold { 3.0f };
+    constexpr int32_t largeId { 20 };
+    FingerTable from;
+    from.Set(largeId, Point(100.0f, 100.0f));
+    from.Set(0, Point(200.0f, 200.0f));
+    FingerTable to;
+    to.Set(0, Point(200.0f, 210.0f));
+    to.Set(largeId, Point(90.0f, 100.0f));
+
+    // The large id took slot 0 of |from| before pointer 0 came down, and slot 1 of |to|.
+    auto motion = FingerTable::CalcMotion(from, to, threshold);
+    EXPECT_EQ(motion.moved, from.Mask());
+    EXPECT_EQ(motion.left, 1U);
+    EXPECT_EQ(motion.down, 2U);
+    EXPECT_EQ(motion.up, 0U);
+    EXPECT_EQ(motion.right, 0U);
+}
 } // namespace MMI
 } // namespace OHOS
\ No newline at end of file
@@ -25,6 +25,7 @@
 #include "mouse_redispatch_store.h"
 #include "pointer_dispatch_event_cache.h"
 #include "touch_redispatch_store.h"
+#include "window_hit_index.h"
 
 namespace OHOS {
 namespace MMI {
@@ -315,6 +316,7 @@ private:
     void PrintSpecialWindow(int32_t pointerAction, const WindowInfo &touchWindow);
     void UpdateDisplayInfoByIncrementalInfo(const WindowInfo &window, OLD::DisplayGroupInfo &displayGroupInfo);
     void UpdateWindowsInfoPerDisplay(const OLD::DisplayGroupInfo &displayGroupInfo);
+    void BindHitIndex();
     std::pair<int32_t, int32_t> TransformSampleWindowXY(int32_t logicX, int32_t logicY) const;
     bool IsValidZorderWindow(const WindowInfo &window, const std::shared_ptr<PointerEvent>& pointerEvent);
     bool SkipPrivacyProtectionWindow(const std::shared_ptr<PointerEvent>& pointerEvent, const bool &isSkip);
@@ -418,6 +420,8 @@ void HandleOneHandMode(const OLD::DisplayInfo &displayInfo, std::shared_ptr<Poin
     bool SkipNavigationWindow(uint32_t flag, int32_t toolType);
     void HandleGestureInjection(bool gestureInject);
     int32_t UpdateTouchScreenTarget(std::shared_ptr<PointerEvent> pointerEvent);
+    void UpdateChangedTouchItems(std::shared_ptr<PointerEvent> pointerEvent,
+        const std::vector<WindowInfo> &windowsInfo, const OLD::DisplayInfo &displayInfo);
     void UpdateTargetTouchWinIds(const WindowInfo &item, PointerEvent::PointerItem &pointerItem,
         std::shared_ptr<PointerEvent> pointerEvent, int32_t pointerId, int32_t displayId, int32_t deviceId);
     void ClearMismatchTypeWinIds(int32_t pointerId, int32_t displayId, int32_t deviceId);
@@ -607,6 +611,7 @@ private:
 #endif // defined(OHOS_BUILD_ENABLE_TOUCH) && defined(OHOS_BUILD_ENABLE_MONITOR)
     std::map<int32_t, OLD::DisplayGroupInfo> displayGroupInfoMap_;
     std::map<int32_t, OLD::DisplayGroupInfo> displayGroupInfoMapTmp_;
+    WindowHitIndex hitIndex_;
     std::map<int32_t, bool> backCenterDisplayChangeMap_;
     bool mainGroupExisted_;
     DisplayGroupInfo displayGroupInfoTmp_;
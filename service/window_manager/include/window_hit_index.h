@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef WINDOW_HIT_INDEX_H
+#define WINDOW_HIT_INDEX_H
+
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "window_info.h"
+
+namespace OHOS {
+namespace MMI {
+/*
+ * Display-space bounding boxes of the pointer and default hot areas of every window, keyed by window id.
+ * The boxes are conservative: a point outside the box of a window can never pass the exact hot area test,
+ * so hit-testing only pays for the matrix transform of windows that may actually be under the point.
+ *
+ * The boxes are copied into one slot per element of the live window tables passed to Bind, so the check of
+ * a window is a pointer range test and a box test. Windows outside the bound tables, such as copies kept
+ * from an older layout, are never rejected. The owner must rebind whenever a bound table is modified.
+ */
+class WindowHitIndex final {
+public:
+    using DisplayOriginGetter = std::function<bool(int32_t displayId, std::pair<int32_t, int32_t> &origin)>;
+
+    void Update(int32_t groupId, const std::vector<WindowInfo> &windows, const DisplayOriginGetter &getOrigin);
+    void Bind(const std::vector<WindowInfo> &windows);
+    void Unbind();
+    void Clear();
+    bool MayContain(const WindowInfo &window, const std::vector<Rect> &rects, int32_t x, int32_t y) const;
+    size_t GetSize() const;
+
+private:
+    struct Bounds {
+        bool bounded { false };
+        int32_t left { 0 };
+        int32_t top { 0 };
+        int32_t right { -1 };
+        int32_t bottom { -1 };
+    };
+    struct HotArea {
+        std::vector<Rect> rects;
+        Bounds bounds;
+    };
+    struct Slot {
+        Bounds pointerBounds;
+        Bounds defaultBounds;
+    };
+    struct Table {
+        const WindowInfo *windows { nullptr };
+        size_t size { 0 };
+        std::vector<Slot> slots;
+    };
+    struct Entry {
+        int32_t groupId { -1 };
+        int32_t displayId { -1 };
+        bool hasOrigin { false };
+        std::pair<int32_t, int32_t> origin { 0, 0 };
+        std::vector<float> transform;
+        HotArea pointerArea;
+        HotArea defaultArea;
+    };
+
+    static bool IsSameRects(const std::vector<Rect> &lhs, const std::vector<Rect> &rhs);
+    static bool IsSameTransform(const std::vector<float> &lhs, const std::vector<float> &rhs);
+    static Bounds ComputeBounds(const Entry &entry, const std::vector<Rect> &rects);
+    static void RefreshHotArea(const Entry &entry, const std::vector<Rect> &rects, bool force, HotArea &hotArea);
+    void UpdateEntry(int32_t groupId, const WindowInfo &window, const DisplayOriginGetter &getOrigin);
+    const Slot *FindSlot(const WindowInfo &window) const;
+
+private:
+    std::unordered_map<int32_t, Entry> entries_;
+    std::vector<Table> tables_;
+    mutable size_t lastTable_ { 0 };
+};
+} // namespace MMI
+} // namespace OHOS
+
+#endif // WINDOW_HIT_INDEX_H
@@ -344,28 +344,7 @@ void InputWindowsManager::InitMouseDownInfo()
 const std::vector<WindowInfo> InputWindowsManager::GetWindowGroupInfoByDisplayIdCopy(int32_t displayId) const
 {
     CALL_DEBUG_ENTER;
-    int32_t groupId = FindDisplayGroupId(displayId);
-    if (displayId < 0) {
-        const auto& windoInfo = GetWindowInfoVector(groupId);
-        return windoInfo;
-    }
-    std::map<int32_t, WindowGroupInfo>& windowsPerDisplay =
-        const_cast<std::map<int32_t, WindowGroupInfo> &>(windowsPerDisplay_);
-
-    const auto& iter = windowsPerDisplayMap_.find(groupId);
-    windowsPerDisplay = (iter != windowsPerDisplayMap_.end()) ? iter->second : windowsPerDisplay_;
-    const auto& it = windowsPerDisplay.find(displayId);
-    if (it == windowsPerDisplay.end()) {
-        MMI_HILOGD("GetWindowInfo displayId:%{public}d is null from windowGroupInfo_", displayId);
-        const auto& windoInfo = GetWindowInfoVector(groupId);
-        return windoInfo;
-    }
-    if (it->second.windowsInfo.empty()) {
-        MMI_HILOGW("GetWindowInfo displayId:%{public}d is empty", displayId);
-        const auto& windoInfo = GetWindowInfoVector(groupId);
-        return windoInfo;
-    }
-    return it->second.windowsInfo;
+    return GetWindowGroupInfoByDisplayId(displayId);
 }
 
 const std::vector<WindowInfo>& InputWindowsManager::GetWindowGroupInfoByDisplayId(int32_t displayId) const
@@ -496,8 +475,8 @@ int32_t InputWindowsManager::GetClientFd(std::shared_ptr<PointerEvent> pointerEv
             return INVALID_FD;
         }
     }
-    std::vector<WindowInfo> windowsInfo = GetWindowGroupInfoByDisplayId(pointerEvent->GetTargetDisplayId());
-    for (const auto &item : windowsInfo) {
+    const std::vector<WindowInfo> *windowsInfo = &GetWindowGroupInfoByDisplayId(pointerEvent->GetTargetDisplayId());
+    for (const auto &item : *windowsInfo) {
         bool checkUIExtentionWindow = false;
         // Determine whether it is a safety sub window
         for (auto &uiExtentionWindowInfo : item.uiExtentionWindowInfo) {
@@ -527,9 +506,8 @@ int32_t InputWindowsManager::GetClientFd(std::shared_ptr<PointerEvent> pointerEv
     }
 
     if (windowInfo == nullptr && pointerEvent->GetTargetDisplayId() != firstBtnDownWindowInfo_.second) {
-        windowsInfo.clear();
-        windowsInfo = GetWindowGroupInfoByDisplayId(firstBtnDownWindowInfo_.second);
-        for (const auto &item : windowsInfo) {
+        windowsInfo = &GetWindowGroupInfoByDisplayId(firstBtnDownWindowInfo_.second);
+        for (const auto &item : *windowsInfo) {
             bool checkUIExtentionWindow = false;
             // Determine whether it is a safety sub window
             for (auto &uiExtentionWindowInfo : item.uiExtentionWindowInfo) {
@@ -820,8 +798,8 @@ void InputWindowsManager::HandleKeyEventWindowId(std::shared_ptr<KeyEvent> keyEv
     CHKPV(keyEvent);
     int32_t groupId = FindDisplayGroupId(keyEvent->GetTargetDisplayId());
     int32_t focusWindowId = GetFocusWindowId(groupId);
-    std::vector<WindowInfo> windowsInfo = GetWindowGroupInfoByDisplayId(keyEvent->GetTargetDisplayId());
-    for (auto &item : windowsInfo) {
+    const std::vector<WindowInfo> &windowsInfo = GetWindowGroupInfoByDisplayId(keyEvent->GetTargetDisplayId());
+    for (const auto &item : windowsInfo) {
         if (item.id == focusWindowId) {
             keyEvent->SetTargetWindowId(item.id);
             keyEvent->SetAgentWindowId(item.agentWindowId);
@@ -896,7 +874,7 @@ int32_t InputWindowsManager::GetClientFd(std::shared_ptr<PointerEvent> pointerEv
     CHKPR(udsServer_, INVALID_FD);
     CHKPR(pointerEvent, INVALID_FD);
     const WindowInfo* windowInfo = nullptr;
-    std::vector<WindowInfo> windowInfos = GetWindowGroupInfoByDisplayId(pointerEvent->GetTargetDisplayId());
+    const std::vector<WindowInfo> &windowInfos = GetWindowGroupInfoByDisplayId(pointerEvent->GetTargetDisplayId());
     for (const auto &item : windowInfos) {
         bool checkUIExtentionWindow = false;
         // Determine whether it is a safety sub window
@@ -1396,6 +1374,20 @@ void InputWindowsManager::ClearDisplayMap(const UserScreenInfo &userScreenInfo)
     eraseInvalidGroups(displayGroupInfoMapTmp_);
     eraseInvalidGroups(backCenterDisplayChangeMap_);
     eraseInvalidGroups(windowsPerDisplayMap_);
+    BindHitIndex();
+}
+
+void InputWindowsManager::BindHitIndex()
+{
+    hitIndex_.Unbind();
+    for (const auto &group : windowsPerDisplayMap_) {
+        for (const auto &item : group.second) {
+            hitIndex_.Bind(item.second.windowsInfo);
+        }
+    }
+    for (const auto &item : windowsPerDisplay_) {
+        hitIndex_.Bind(item.second.windowsInfo);
+    }
 }
 
 void InputWindowsManager::UpdateDisplayInfoExtIfNeed(OLD::DisplayGroupInfo &displayGroupInfo, bool needUpdateDisplayExt)
@@ -1494,6 +1486,15 @@ void InputWindowsManager::UpdateWindowsInfoPerDisplay(const OLD::DisplayGroupInf
             return lwindow.zOrder > rwindow.zOrder;
         });
     }
+    hitIndex_.Update(groupId, displayGroupInfo.windowsInfo,
+        [this](int32_t displayId, std::pair<int32_t, int32_t> &origin) {
+            auto physicalDisplayInfo = GetPhysicalDisplay(displayId);
+            if (physicalDisplayInfo == nullptr) {
+                return false;
+            }
+            origin = std::make_pair(physicalDisplayInfo->x, physicalDisplayInfo->y);
+            return true;
+        });
     std::map<int32_t, WindowGroupInfo>& windowsPerDisplayTmp = windowsPerDisplay_;
 
     const auto& iter = windowsPerDisplayMap_.find(groupId);
@@ -1507,6 +1508,7 @@ void InputWindowsManager::UpdateWindowsInfoPerDisplay(const OLD::DisplayGroupInf
 
     windowsPerDisplayMap_[groupId] = windowsPerDisplay;
     windowsPerDisplay_ = windowsPerDisplay;
+    BindHitIndex();
 #if defined(OHOS_BUILD_ENABLE_TOUCH) && defined(OHOS_BUILD_ENABLE_MONITOR)
     for (const auto &window : displayGroupInfo.windowsInfo) {
         if (window.windowType == static_cast<int32_t>(Rosen::WindowType::WINDOW_TYPE_TRANSPARENT_VIEW)) {
@@ -2729,7 +2731,7 @@ void InputWindowsManager::DispatchPointerCancel(int32_t displayId)
     auto lastPointerEventCopy = GetLastPointerEvent();
     CHKPV(lastPointerEventCopy);
     std::optional<WindowInfo> windowInfo;
-    std::vector<WindowInfo> windowInfos = GetWindowGroupInfoByDisplayId(displayId);
+    const std::vector<WindowInfo> &windowInfos = GetWindowGroupInfoByDisplayId(displayId);
     for (const auto &item : windowInfos) {
         if (item.id == mouseDownInfo_.id) {
             windowInfo = std::make_optional(item);
@@ -2737,7 +2739,7 @@ void InputWindowsManager::DispatchPointerCancel(int32_t displayId)
         }
     }
     if (windowInfo == std::nullopt && displayId != firstBtnDownWindowInfo_.second) {
-        std::vector<WindowInfo> firstBtnDownWindowsInfo =
+        const std::vector<WindowInfo> &firstBtnDownWindowsInfo =
             GetWindowGroupInfoByDisplayId(firstBtnDownWindowInfo_.second);
         for (const auto &item : firstBtnDownWindowsInfo) {
             if (item.id == mouseDownInfo_.id) {
@@ -4256,6 +4258,10 @@ void InputWindowsManager::InitPointerStyle(int32_t groupId)
 bool InputWindowsManager::IsInHotArea(int32_t x, int32_t y, const std::vector<Rect> &rects,
     const WindowInfo &window) const
 {
+    if (!hitIndex_.MayContain(window, rects, x, y)) {
+        UpdateCurrentDisplay(window.displayId);
+        return false;
+    }
     auto windowXY = TransformWindowXY(window, x, y);
     auto windowX = static_cast<int32_t>(windowXY.first);
     auto windowY = static_cast<int32_t>(windowXY.second);
@@ -4441,7 +4447,7 @@ std::optional<WindowInfo> InputWindowsManager::SelectWindowInfo(int32_t logicalX
         (action == PointerEvent::POINTER_ACTION_PULL_UP) ||
         ((action == PointerEvent::POINTER_ACTION_AXIS_BEGIN || action == PointerEvent::POINTER_ACTION_ROTATE_BEGIN) &&
         (pointerEvent->GetPressedButtons().empty())) || (action == PointerEvent::POINTER_ACTION_TOUCHPAD_ACTIVE);
-    std::vector<WindowInfo> windowsInfo = GetWindowGroupInfoByDisplayId(pointerEvent->GetTargetDisplayId());
+    const std::vector<WindowInfo> &windowsInfo = GetWindowGroupInfoByDisplayId(pointerEvent->GetTargetDisplayId());
     if (checkFlag) {
         int32_t targetWindowId = pointerEvent->GetTargetWindowId();
         static std::unordered_map<int32_t, int32_t> winId2ZorderMap;
@@ -4589,7 +4595,7 @@ std::optional<WindowInfo> InputWindowsManager::SelectWindowInfo(int32_t logicalX
         }
     }
     if (pointerEvent->GetTargetDisplayId() != firstBtnDownWindowInfo.second) {
-        std::vector<WindowInfo> firstBtnDownWindowsInfo =
+        const std::vector<WindowInfo> &firstBtnDownWindowsInfo =
             GetWindowGroupInfoByDisplayId(firstBtnDownWindowInfo.second);
         for (const auto &item : firstBtnDownWindowsInfo) {
             for (const auto &windowInfo : item.uiExtentionWindowInfo) {
@@ -6017,6 +6023,77 @@ std::map<int32_t, std::map<int32_t, WindowInfoEX>>& InputWindowsManager::TouchIt
         ? touchRedispatchStore_.GetTouchItemDownInfos() : touchItemDownInfos_;
 }
 
+void InputWindowsManager::UpdateChangedTouchItems(std::shared_ptr<PointerEvent> pointerEvent,
+    const std::vector<WindowInfo> &windowsInfo, const OLD::DisplayInfo &displayInfo)
+{
+    CHKPV(pointerEvent);
+    if (pointerEvent->GetPointerAction() != PointerEvent::POINTER_ACTION_MOVE) {
+        return;
+    }
+    // A move dispatched once per frame carries every finger that moved. Fingers other than the pointer of the action
+    // stay on the window they went down on and get their coordinates updated the way that pointer does.
+    int32_t pointerId = pointerEvent->GetPointerId();
+    int32_t displayId = pointerEvent->GetTargetDisplayId();
+    int32_t deviceId = pointerEvent->GetDeviceId();
+    for (const auto &changedItem : pointerEvent->GetPointerItems()) {
+        int32_t id = changedItem.GetPointerId();
+        if ((id == pointerId) || !changedItem.IsChanged()) {
+            continue;
+        }
+        pointerEvent->SetPointerId(id);
+        UpdateTransformDisplayXY(pointerEvent, windowsInfo, displayInfo);
+        pointerEvent->SetPointerId(pointerId);
+        PointerEvent::PointerItem pointerItem;
+        if (!pointerEvent->GetPointerItem(id, pointerItem)) {
+            continue;
+        }
+        std::optional<WindowInfo> touchWindow = GetWindowAndDisplayInfo(pointerItem.GetTargetWindowId(), displayId);
+        if (!touchWindow) {
+            auto &infos = TouchItemDownInfos();
+            auto devIter = infos.find(deviceId);
+            if (devIter != infos.end()) {
+                auto iter = devIter->second.find(id);
+                if (iter != devIter->second.end()) {
+                    touchWindow = iter->second.window;
+                }
+            }
+        }
+        if (!touchWindow) {
+            MMI_HILOG_DISPATCHD("No target window of pointer:%{public}d", id);
+            continue;
+        }
+        double physicalX = pointerItem.GetDisplayXPos();
+        double physicalY = pointerItem.GetDisplayYPos();
+        if (!pointerEvent->HasFlag(InputEvent::EVENT_FLAG_SIMULATE) &&
+            (INPUT_DEV_MGR->GetVendorConfig(deviceId).enableOutScreen != ENABLE_OUT_SCREEN_TOUCH)) {
+            AdjustDisplayCoordinate(displayInfo, physicalX, physicalY);
+        }
+        double logicalX = physicalX + GetLogicalPositionX(displayId);
+        double logicalY = physicalY + GetLogicalPositionY(displayId);
+        double windowX = logicalX - touchWindow->area.x;
+        double windowY = logicalY - touchWindow->area.y;
+        if (!(touchWindow->transform.empty())) {
+            auto windowXY = TransformWindowXY(*touchWindow, logicalX, logicalY);
+            windowX = windowXY.first;
+            windowY = windowXY.second;
+        }
+        pointerItem.SetTargetWindowId(touchWindow->id);
+        pointerItem.SetDisplayX(static_cast<int32_t>(physicalX));
+        pointerItem.SetDisplayY(static_cast<int32_t>(physicalY));
+        pointerItem.SetGlobalX(physicalX + displayInfo.x);
+        pointerItem.SetGlobalY(physicalY + displayInfo.y);
+        pointerItem.SetWindowX(static_cast<int32_t>(windowX));
+        pointerItem.SetWindowY(static_cast<int32_t>(windowY));
+        pointerItem.SetDisplayXPos(physicalX);
+        pointerItem.SetDisplayYPos(physicalY);
+        pointerItem.SetWindowXPos(windowX);
+        pointerItem.SetWindowYPos(windowY);
+        pointerItem.SetToolWindowX(pointerItem.GetToolDisplayX() + displayInfo.x - touchWindow->area.x);
+        pointerItem.SetToolWindowY(pointerItem.GetToolDisplayY() + displayInfo.y - touchWindow->area.y);
+        pointerEvent->UpdatePointerItem(id, pointerItem);
+    }
+}
+
 int32_t InputWindowsManager::UpdateTouchScreenTarget(std::shared_ptr<PointerEvent> pointerEvent)
 {
     CHKPR(pointerEvent, ERROR_NULL_POINTER);
@@ -6038,6 +6115,7 @@ int32_t InputWindowsManager::UpdateTouchScreenTarget(std::shared_ptr<PointerEven
     CHKPR(physicDisplayInfo, ERROR_NULL_POINTER);
     const std::vector<WindowInfo> &windowsInfo = GetWindowGroupInfoByDisplayId(displayId);
     UpdateTransformDisplayXY(pointerEvent, windowsInfo, *physicDisplayInfo);
+    UpdateChangedTouchItems(pointerEvent, windowsInfo, *physicDisplayInfo);
     int32_t pointerId = pointerEvent->GetPointerId();
     PointerEvent::PointerItem pointerItem;
     if (!pointerEvent->GetPointerItem(pointerId, pointerItem)) {
@@ -7293,7 +7371,7 @@ int32_t InputWindowsManager::UpdateJoystickTarget(std::shared_ptr<PointerEvent>
     int32_t groupId = FindDisplayGroupId(pointerEvent->GetTargetDisplayId());
     int32_t focusWindowId = GetFocusWindowId(groupId);
     const WindowInfo* windowInfo = nullptr;
-    std::vector<WindowInfo> windowsInfo = GetWindowGroupInfoByDisplayId(pointerEvent->GetTargetDisplayId());
+    const std::vector<WindowInfo> &windowsInfo = GetWindowGroupInfoByDisplayId(pointerEvent->GetTargetDisplayId());
     for (const auto &item : windowsInfo) {
         if (item.id == focusWindowId) {
             windowInfo = &item;
@@ -8828,8 +8906,8 @@ bool InputWindowsManager::IsKnuckleOnAncoWindow(std::shared_ptr<PointerEvent> po
 
     int32_t groupId = FindDisplayGroupId(pointerEvent->GetTargetDisplayId());
     const int32_t focusWindowId = GetFocusWindowId(groupId);
-    WindowInfo *windowInfo = nullptr;
-    std::vector<WindowInfo> windowInfos = GetWindowGroupInfoByDisplayId(pointerEvent->GetTargetDisplayId());
+    const WindowInfo *windowInfo = nullptr;
+    const std::vector<WindowInfo> &windowInfos = GetWindowGroupInfoByDisplayId(pointerEvent->GetTargetDisplayId());
     auto iter = find_if(windowInfos.begin(), windowInfos.end(),
         [&](const auto &item) { return item.id == focusWindowId; });
     if (iter != windowInfos.end()) {
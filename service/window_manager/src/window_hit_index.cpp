@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "window_hit_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <unordered_set>
+
+#include "mmi_log.h"
+#include "mmi_matrix3.h"
+
+#undef MMI_LOG_DOMAIN
+#define MMI_LOG_DOMAIN MMI_LOG_WINDOW
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "WindowHitIndex"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+// Window coordinates are truncated to int32 after a float transform; widen the window-space box to absorb both.
+constexpr double HIT_MARGIN { 2.0 };
+constexpr double MIN_DETERMINANT { 1e-9 };
+constexpr int32_t CORNER_COUNT { 4 };
+constexpr size_t RECT_FIELD_COUNT { 4 };
+
+struct AffineMap {
+    double originX { 0.0 };
+    double originY { 0.0 };
+    double xx { 1.0 };
+    double xy { 0.0 };
+    double yx { 0.0 };
+    double yy { 1.0 };
+};
+
+// InputWindowsManager::TransformWindowXY keeps the first two components of transform * (x, y, 1),
+// which is an affine map whatever the last row holds. Sample it the same way to stay layout agnostic.
+AffineMap GetAffineMap(const Matrix3f &matrix)
+{
+    Vector3f origin = matrix * Vector3f(0.0f, 0.0f, 1.0f);
+    Vector3f unitX = matrix * Vector3f(1.0f, 0.0f, 1.0f);
+    Vector3f unitY = matrix * Vector3f(0.0f, 1.0f, 1.0f);
+    AffineMap map;
+    map.originX = origin[0];
+    map.originY = origin[1];
+    map.xx = static_cast<double>(unitX[0]) - origin[0];
+    map.yx = static_cast<double>(unitX[1]) - origin[1];
+    map.xy = static_cast<double>(unitY[0]) - origin[0];
+    map.yy = static_cast<double>(unitY[1]) - origin[1];
+    return map;
+}
+
+int32_t ClampToInt32(double value)
+{
+    constexpr double minValue = static_cast<double>(std::numeric_limits<int32_t>::min());
+    constexpr double maxValue = static_cast<double>(std::numeric_limits<int32_t>::max());
+    return static_cast<int32_t>(std::clamp(value, minValue, maxValue));
+}
+} // namespace
+
+void WindowHitIndex::Update(int32_t groupId, const std::vector<WindowInfo> &windows,
+    const DisplayOriginGetter &getOrigin)
+{
+    std::unordered_set<int32_t> windowIds;
+    for (const auto &window : windows) {
+        UpdateEntry(groupId, window, getOrigin);
+        windowIds.insert(window.id);
+    }
+    for (auto iter = entries_.begin(); iter != entries_.end();) {
+        if ((iter->second.groupId == groupId) && (windowIds.find(iter->first) == windowIds.end())) {
+            iter = entries_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    // The slots of the bound tables were copied from the entries that just changed.
+    Unbind();
+    MMI_HILOGD("Hit index of group:%{public}d holds %{public}zu windows", groupId, windows.size());
+}
+
+void WindowHitIndex::Bind(const std::vector<WindowInfo> &windows)
+{
+    if (windows.empty()) {
+        return;
+    }
+    Table table;
+    table.windows = windows.data();
+    table.size = windows.size();
+    table.slots.resize(windows.size());
+    for (size_t i = 0; i < windows.size(); ++i) {
+        const WindowInfo &window = windows[i];
+        auto iter = entries_.find(window.id);
+        if (iter == entries_.end()) {
+            continue;
+        }
+        const Entry &entry = iter->second;
+        // A window the entry was not built from keeps unbounded slots and always takes the exact test.
+        if ((entry.displayId != window.displayId) || !IsSameTransform(entry.transform, window.transform)) {
+            continue;
+        }
+        Slot &slot = table.slots[i];
+        if (IsSameRects(entry.pointerArea.rects, window.pointerHotAreas)) {
+            slot.pointerBounds = entry.pointerArea.bounds;
+        }
+        if (IsSameRects(entry.defaultArea.rects, window.defaultHotAreas)) {
+            slot.defaultBounds = entry.defaultArea.bounds;
+        }
+    }
+    tables_.push_back(std::move(table));
+}
+
+void WindowHitIndex::Unbind()
+{
+    tables_.clear();
+    lastTable_ = 0;
+}
+
+void WindowHitIndex::Clear()
+{
+    entries_.clear();
+    Unbind();
+}
+
+size_t WindowHitIndex::GetSize() const
+{
+    return entries_.size();
+}
+
+bool WindowHitIndex::MayContain(const WindowInfo &window, const std::vector<Rect> &rects, int32_t x, int32_t y) const
+{
+    const Slot *slot = FindSlot(window);
+    if (slot == nullptr) {
+        return true;
+    }
+    const Bounds *bounds = nullptr;
+    if (&rects == &window.pointerHotAreas) {
+        bounds = &slot->pointerBounds;
+    } else if (&rects == &window.defaultHotAreas) {
+        bounds = &slot->defaultBounds;
+    } else {
+        return true;
+    }
+    return !bounds->bounded ||
+        ((x >= bounds->left) && (x <= bounds->right) && (y >= bounds->top) && (y <= bounds->bottom));
+}
+
+const WindowHitIndex::Slot *WindowHitIndex::FindSlot(const WindowInfo &window) const
+{
+    std::less<const WindowInfo *> isBefore;
+    auto isInTable = [&window, &isBefore](const Table &table) {
+        return !isBefore(&window, table.windows) && isBefore(&window, table.windows + table.size);
+    };
+    // Hit-test loops walk one table at a time, so the table of the previous window nearly always matches.
+    if ((lastTable_ >= tables_.size()) || !isInTable(tables_[lastTable_])) {
+        auto iter = std::find_if(tables_.begin(), tables_.end(), isInTable);
+        if (iter == tables_.end()) {
+            return nullptr;
+        }
+        lastTable_ = static_cast<size_t>(std::distance(tables_.begin(), iter));
+    }
+    const Table &table = tables_[lastTable_];
+    return &table.slots[static_cast<size_t>(&window - table.windows)];
+}
+
+bool WindowHitIndex::IsSameRects(const std::vector<Rect> &lhs, const std::vector<Rect> &rhs)
+{
+    static_assert(sizeof(Rect) == sizeof(int32_t) * RECT_FIELD_COUNT, "Rect must stay a packed POD");
+    return (lhs.size() == rhs.size()) &&
+        (lhs.empty() || (std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(Rect)) == 0));
+}
+
+bool WindowHitIndex::IsSameTransform(const std::vector<float> &lhs, const std::vector<float> &rhs)
+{
+    return (lhs.size() == rhs.size()) &&
+        (lhs.empty() || (std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(float)) == 0));
+}
+
+WindowHitIndex::Bounds WindowHitIndex::ComputeBounds(const Entry &entry, const std::vector<Rect> &rects)
+{
+    Bounds bounds;
+    Matrix3f matrix(entry.transform);
+    bool isIdentity = (entry.transform.size() != MATRIX3_SIZE) || matrix.IsIdentity();
+    AffineMap map;
+    double det = 1.0;
+    if (!isIdentity) {
+        if (!entry.hasOrigin) {
+            return bounds;
+        }
+        map = GetAffineMap(matrix);
+        det = map.xx * map.yy - map.xy * map.yx;
+        if (std::fabs(det) < MIN_DETERMINANT) {
+            return bounds;
+        }
+    }
+    double minX = std::numeric_limits<double>::max();
+    double minY = std::numeric_limits<double>::max();
+    double maxX = std::numeric_limits<double>::lowest();
+    double maxY = std::numeric_limits<double>::lowest();
+    for (const auto &rect : rects) {
+        if ((rect.width <= 0) || (rect.height <= 0)) {
+            continue;
+        }
+        if (isIdentity) {
+            // The display origin cancels out: x - originX is compared against rect.x - originX.
+            minX = std::min(minX, static_cast<double>(rect.x));
+            minY = std::min(minY, static_cast<double>(rect.y));
+            maxX = std::max(maxX, static_cast<double>(rect.x) + rect.width - 1);
+            maxY = std::max(maxY, static_cast<double>(rect.y) + rect.height - 1);
+            continue;
+        }
+        double left = static_cast<double>(rect.x) - entry.origin.first - HIT_MARGIN;
+        double top = static_cast<double>(rect.y) - entry.origin.second - HIT_MARGIN;
+        double right = static_cast<double>(rect.x) - entry.origin.first + rect.width + HIT_MARGIN;
+        double bottom = static_cast<double>(rect.y) - entry.origin.second + rect.height + HIT_MARGIN;
+        const double corners[CORNER_COUNT][2] = { { left, top }, { right, top }, { left, bottom }, { right, bottom } };
+        for (const auto &corner : corners) {
+            double dx = corner[0] - map.originX;
+            double dy = corner[1] - map.originY;
+            double logicX = (map.yy * dx - map.xy * dy) / det + entry.origin.first;
+            double logicY = (map.xx * dy - map.yx * dx) / det + entry.origin.second;
+            if (!std::isfinite(logicX) || !std::isfinite(logicY)) {
+                return Bounds {};
+            }
+            minX = std::min(minX, std::floor(logicX) - 1);
+            minY = std::min(minY, std::floor(logicY) - 1);
+            maxX = std::max(maxX, std::ceil(logicX) + 1);
+            maxY = std::max(maxY, std::ceil(logicY) + 1);
+        }
+    }
+    bounds.bounded = true;
+    if (minX > maxX) {
+        // No rect with a positive size, nothing can be hit; keep the default empty box.
+        return bounds;
+    }
+    bounds.left = ClampToInt32(minX);
+    bounds.top = ClampToInt32(minY);
+    bounds.right = ClampToInt32(maxX);
+    bounds.bottom = ClampToInt32(maxY);
+    return bounds;
+}
+
+void WindowHitIndex::RefreshHotArea(const Entry &entry, const std::vector<Rect> &rects, bool force, HotArea &hotArea)
+{
+    if (!force && IsSameRects(hotArea.rects, rects)) {
+        return;
+    }
+    hotArea.rects = rects;
+    hotArea.bounds = ComputeBounds(entry, rects);
+}
+
+void WindowHitIndex::UpdateEntry(int32_t groupId, const WindowInfo &window, const DisplayOriginGetter &getOrigin)
+{
+    std::pair<int32_t, int32_t> origin { 0, 0 };
+    bool hasOrigin = (getOrigin != nullptr) && getOrigin(window.displayId, origin);
+    auto [iter, inserted] = entries_.try_emplace(window.id);
+    Entry &entry = iter->second;
+    entry.groupId = groupId;
+    bool frameChanged = inserted || (entry.displayId != window.displayId) || (entry.hasOrigin != hasOrigin) ||
+        (entry.origin != origin) || !IsSameTransform(entry.transform, window.transform);
+    if (frameChanged) {
+        entry.displayId = window.displayId;
+        entry.hasOrigin = hasOrigin;
+        entry.origin = origin;
+        entry.transform = window.transform;
+    }
+    RefreshHotArea(entry, window.pointerHotAreas, frameChanged, entry.pointerArea);
+    RefreshHotArea(entry, window.defaultHotAreas, frameChanged, entry.defaultArea);
+}
+} // namespace MMI
+} // namespace OHOS
@@ -11456,6 +11456,65 @@ HWTEST_F(InputWindowsManagerTest, InputWindowsManagerTest_ReissueCancelTouchEven
     ASSERT_NE(innerIter, iter->second.end());
     EXPECT_TRUE(innerIter->second.flag);
 }
+
+/**
+ * @tc.name: InputWindowsManagerTest_UpdateChangedTouchItems_001
+ * @tc.desc: A move of two fingers brings the window coordinates of the finger besides the action pointer up to date
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputWindowsManagerTest, InputWindowsManagerTest_UpdateChangedTouchItems_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    InputWindowsManager inputWindowsMgr;
+    OLD::DisplayInfo displayInfo;
+    displayInfo.id = 0;
+    displayInfo.width = 1000;
+    displayInfo.height = 1000;
+    displayInfo.validWidth = 1000;
+    displayInfo.validHeight = 1000;
+    inputWindowsMgr.displayGroupInfoMap_[0].displaysInfo = { displayInfo };
+    WindowGroupInfo winGroupInfo;
+    WindowInfo leftWindow;
+    leftWindow.id = 1;
+    leftWindow.area = {0, 0, 500, 1000};
+    leftWindow.defaultHotAreas = { leftWindow.area };
+    winGroupInfo.windowsInfo.push_back(leftWindow);
+    WindowInfo rightWindow;
+    rightWindow.id = 2;
+    rightWindow.area = {500, 0, 500, 1000};
+    rightWindow.defaultHotAreas = { rightWindow.area };
+    winGroupInfo.windowsInfo.push_back(rightWindow);
+    inputWindowsMgr.windowsPerDisplayMap_[0][0] = winGroupInfo;
+
+    std::shared_ptr<PointerEvent> pointerEvent = PointerEvent::Create();
+    ASSERT_NE(pointerEvent, nullptr);
+    pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+    pointerEvent->SetTargetDisplayId(0);
+    PointerEvent::PointerItem item;
+    item.SetPointerId(0);
+    item.SetDisplayXPos(100);
+    item.SetDisplayYPos(100);
+    item.SetTargetWindowId(leftWindow.id);
+    item.SetToolType(PointerEvent::TOOL_TYPE_FINGER);
+    item.SetPressed(true);
+    item.SetChanged(true);
+    pointerEvent->AddPointerItem(item);
+    item.SetPointerId(1);
+    item.SetDisplayXPos(600);
+    item.SetDisplayYPos(200);
+    item.SetTargetWindowId(rightWindow.id);
+    pointerEvent->AddPointerItem(item);
+    pointerEvent->SetPointerId(0);
+    pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
+
+    EXPECT_NO_FATAL_FAILURE(inputWindowsMgr.UpdateTouchScreenTarget(pointerEvent));
+    ASSERT_TRUE(pointerEvent->GetPointerItem(1, item));
+    EXPECT_EQ(item.GetTargetWindowId(), rightWindow.id);
+    EXPECT_EQ(item.GetDisplayX(), 600);
+    EXPECT_EQ(item.GetWindowX(), 100);
+    EXPECT_EQ(item.GetWindowY(), 200);
+}
 #endif // OHOS_BUILD_ENABLE_TOUCH
 
 /**
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "mmi_matrix3.h"
+#include "window_hit_index.h"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr int32_t DISPLAY_ID { 0 };
+constexpr int32_t WINDOW_SIZE { 64 };
+constexpr int32_t WINDOWS_PER_ROW { 32 };
+constexpr int32_t HOT_AREA_COUNT { 4 };
+constexpr int32_t SCALED_WINDOW_INTERVAL { 4 };
+constexpr int32_t WINDOW_SCALE { 2 };
+
+std::vector<WindowInfo> CreateWindows(int32_t count)
+{
+    std::vector<WindowInfo> windows;
+    for (int32_t i = 0; i < count; ++i) {
+        WindowInfo window;
+        window.id = i + 1;
+        window.displayId = DISPLAY_ID;
+        window.area = { (i % WINDOWS_PER_ROW) * WINDOW_SIZE, (i / WINDOWS_PER_ROW) * WINDOW_SIZE,
+            WINDOW_SIZE, WINDOW_SIZE };
+        // Every few windows are scaled, their hot areas are then expressed in the scaled window space.
+        bool isScaled = (i % SCALED_WINDOW_INTERVAL == 0);
+        int32_t scale = isScaled ? WINDOW_SCALE : 1;
+        int32_t quarter = WINDOW_SIZE / HOT_AREA_COUNT;
+        for (int32_t j = 0; j < HOT_AREA_COUNT; ++j) {
+            Rect rect { window.area.x * scale, (window.area.y + j * quarter) * scale, WINDOW_SIZE * scale,
+                quarter * scale };
+            window.defaultHotAreas.push_back(rect);
+            window.pointerHotAreas.push_back(rect);
+        }
+        window.transform = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+        if (isScaled) {
+            window.transform[0] = static_cast<float>(WINDOW_SCALE);
+            window.transform[4] = static_cast<float>(WINDOW_SCALE);
+        }
+        windows.push_back(window);
+    }
+    return windows;
+}
+
+// Same arithmetic as InputWindowsManager::IsInHotArea with the display at the origin.
+bool IsInHotArea(int32_t x, int32_t y, const std::vector<Rect> &rects, const WindowInfo &window)
+{
+    double windowX = x;
+    double windowY = y;
+    Matrix3f transform(window.transform);
+    if (window.transform.size() == MATRIX3_SIZE && !transform.IsIdentity()) {
+        Vector3f windowXY = transform * Vector3f(x, y, 1.0f);
+        windowX = windowXY[0];
+        windowY = windowXY[1];
+    }
+    for (const auto &item : rects) {
+        if ((windowX >= item.x) && (windowX < item.x + item.width) &&
+            (windowY >= item.y) && (windowY < item.y + item.height)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GetOrigin(int32_t displayId, std::pair<int32_t, int32_t> &origin)
+{
+    origin = std::make_pair(0, 0);
+    return displayId == DISPLAY_ID;
+}
+
+void BM_HotAreaLinearScan(benchmark::State &state)
+{
+    auto windows = CreateWindows(static_cast<int32_t>(state.range(0)));
+    // The point lies in the bottom-most window so the whole z-order is walked.
+    const Rect &target = windows.back().area;
+    int32_t x = target.x + 1;
+    int32_t y = target.y + 1;
+    for (auto _ : state) {
+        int32_t hitId = -1;
+        for (const auto &window : windows) {
+            if (IsInHotArea(x, y, window.defaultHotAreas, window)) {
+                hitId = window.id;
+            }
+        }
+        benchmark::DoNotOptimize(hitId);
+    }
+    state.counters["Windows"] = windows.size();
+}
+BENCHMARK(BM_HotAreaLinearScan)->Arg(10)->Arg(100)->Arg(500);
+
+void BM_HotAreaIndexed(benchmark::State &state)
+{
+    auto windows = CreateWindows(static_cast<int32_t>(state.range(0)));
+    WindowHitIndex index;
+    index.Update(0, windows, GetOrigin);
+    index.Bind(windows);
+    const Rect &target = windows.back().area;
+    int32_t x = target.x + 1;
+    int32_t y = target.y + 1;
+    for (auto _ : state) {
+        int32_t hitId = -1;
+        for (const auto &window : windows) {
+            if (index.MayContain(window, window.defaultHotAreas, x, y) &&
+                IsInHotArea(x, y, window.defaultHotAreas, window)) {
+                hitId = window.id;
+            }
+        }
+        benchmark::DoNotOptimize(hitId);
+    }
+    state.counters["Windows"] = windows.size();
+}
+BENCHMARK(BM_HotAreaIndexed)->Arg(10)->Arg(100)->Arg(500);
+
+void BM_HotAreaIndexUpdate(benchmark::State &state)
+{
+    auto windows = CreateWindows(static_cast<int32_t>(state.range(0)));
+    WindowHitIndex index;
+    index.Update(0, windows, GetOrigin);
+    int32_t offset = 0;
+    for (auto _ : state) {
+        // One window moves per update, the rest are reused unchanged.
+        windows.front().defaultHotAreas.front().x = ++offset;
+        index.Update(0, windows, GetOrigin);
+        index.Bind(windows);
+    }
+    state.counters["Windows"] = windows.size();
+}
+BENCHMARK(BM_HotAreaIndexUpdate)->Arg(10)->Arg(100)->Arg(500);
+} // namespace
+} // namespace MMI
+} // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "window_hit_index.h"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+using namespace testing::ext;
+
+constexpr int32_t GROUP_ID { 0 };
+constexpr int32_t DISPLAY_ID { 0 };
+constexpr int32_t DISPLAY_X { 1000 };
+constexpr int32_t WINDOW_SIZE { 100 };
+} // namespace
+
+class WindowHitIndexTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+
+protected:
+    static WindowInfo CreateWindow(int32_t id, int32_t x, int32_t y)
+    {
+        WindowInfo window;
+        window.id = id;
+        window.displayId = DISPLAY_ID;
+        window.area = { x, y, WINDOW_SIZE, WINDOW_SIZE };
+        window.defaultHotAreas = { window.area };
+        window.pointerHotAreas = { window.area };
+        return window;
+    }
+
+    static bool GetOrigin(int32_t displayId, std::pair<int32_t, int32_t> &origin)
+    {
+        if (displayId != DISPLAY_ID) {
+            return false;
+        }
+        origin = std::make_pair(DISPLAY_X, 0);
+        return true;
+    }
+};
+
+/**
+ * @tc.name: WindowHitIndexTest_MayContain_001
+ * @tc.desc: Verify points outside the hot areas of an untransformed window are rejected
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(WindowHitIndexTest, WindowHitIndexTest_MayContain_001, TestSize.Level1)
+{
+    WindowHitIndex index;
+    std::vector<WindowInfo> windows { CreateWindow(1, 0, 0), CreateWindow(2, 200, 0) };
+    windows[1].pointerHotAreas = { { 200, 0, 10, 10 } };
+    index.Update(GROUP_ID, windows, GetOrigin);
+    index.Bind(windows);
+    EXPECT_EQ(index.GetSize(), 2U);
+
+    EXPECT_TRUE(index.MayContain(windows[0], windows[0].defaultHotAreas, 0, 0));
+    EXPECT_TRUE(index.MayContain(windows[0], windows[0].defaultHotAreas, 99, 99));
+    EXPECT_FALSE(index.MayContain(windows[0], windows[0].defaultHotAreas, 100, 50));
+    EXPECT_FALSE(index.MayContain(windows[0], windows[0].pointerHotAreas, 250, 50));
+
+    EXPECT_TRUE(index.MayContain(windows[1], windows[1].defaultHotAreas, 250, 50));
+    EXPECT_FALSE(index.MayContain(windows[1], windows[1].pointerHotAreas, 250, 50));
+    EXPECT_TRUE(index.MayContain(windows[1], windows[1].dragDisabledAreas, 250, 50));
+}
+
+/**
+ * @tc.name: WindowHitIndexTest_MayContain_002
+ * @tc.desc: Verify a scaled window is bounded in display space and windows outside bound tables are never rejected
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(WindowHitIndexTest, WindowHitIndexTest_MayContain_002, TestSize.Level1)
+{
+    WindowHitIndex index;
+    std::vector<WindowInfo> windows { CreateWindow(1, DISPLAY_X, 0) };
+    windows[0].transform = { 0.5f, 0.0f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.0f, 1.0f };
+    index.Update(GROUP_ID, windows, GetOrigin);
+    index.Bind(windows);
+
+    // Hot area [0, 100) in window space is [0, 200) display-local after the 0.5 scale, logical [1000, 1200).
+    EXPECT_TRUE(index.MayContain(windows[0], windows[0].defaultHotAreas, DISPLAY_X + 150, 150));
+    EXPECT_FALSE(index.MayContain(windows[0], windows[0].defaultHotAreas, DISPLAY_X + 400, 150));
+    EXPECT_FALSE(index.MayContain(windows[0], windows[0].defaultHotAreas, DISPLAY_X - 100, 150));
+
+    WindowInfo moved = windows[0];
+    moved.defaultHotAreas = { { DISPLAY_X + 200, 0, WINDOW_SIZE, WINDOW_SIZE } };
+    EXPECT_TRUE(index.MayContain(moved, moved.defaultHotAreas, DISPLAY_X + 400, 150));
+
+    index.Update(GROUP_ID, {}, GetOrigin);
+    EXPECT_EQ(index.GetSize(), 0U);
+    EXPECT_TRUE(index.MayContain(windows[0], windows[0].defaultHotAreas, DISPLAY_X + 400, 150));
+}
+
+/**
+ * @tc.name: WindowHitIndexTest_Bind_001
+ * @tc.desc: Verify only windows of bound tables whose geometry matches the index are rejected
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(WindowHitIndexTest, WindowHitIndexTest_Bind_001, TestSize.Level1)
+{
+    WindowHitIndex index;
+    std::vector<WindowInfo> windows { CreateWindow(1, 0, 0), CreateWindow(2, 200, 0) };
+    index.Update(GROUP_ID, windows, GetOrigin);
+    std::vector<WindowInfo> firstTable { windows[0] };
+    std::vector<WindowInfo> secondTable { windows[1] };
+    secondTable[0].defaultHotAreas = { { 200, 0, 10, 10 } };
+    index.Bind(firstTable);
+    index.Bind(secondTable);
+
+    EXPECT_FALSE(index.MayContain(firstTable[0], firstTable[0].defaultHotAreas, 250, 50));
+    EXPECT_FALSE(index.MayContain(secondTable[0], secondTable[0].pointerHotAreas, 50, 50));
+    EXPECT_TRUE(index.MayContain(secondTable[0], secondTable[0].defaultHotAreas, 50, 50));
+    EXPECT_FALSE(index.MayContain(firstTable[0], firstTable[0].pointerHotAreas, 250, 50));
+
+    index.Unbind();
+    EXPECT_TRUE(index.MayContain(firstTable[0], firstTable[0].defaultHotAreas, 250, 50));
+    EXPECT_EQ(index.GetSize(), 2U);
+}
+} // namespace MMI
+} // namespace OHOS
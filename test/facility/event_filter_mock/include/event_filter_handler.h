@@ -20,6 +20,7 @@
 #include "gmock/gmock.h"
 #include "i_input_event_handler.h"
 #include "ievent_filter.h"
+#include "input_event_filter_rule.h"
 
 namespace OHOS {
 namespace MMI {
@@ -28,8 +29,8 @@ public:
     IEventFilterHandler() = default;
     virtual ~IEventFilterHandler() = default;
 
-    virtual int32_t AddInputEventFilter(sptr<IEventFilter> filter,
-        int32_t filterId, int32_t priority, uint32_t deviceTags, int32_t clientPid) = 0;
+    virtual int32_t AddInputEventFilter(sptr<IEventFilter> filter, int32_t filterId, int32_t priority,
+        uint32_t deviceTags, int32_t clientPid, std::shared_ptr<const InputEventFilterRule> rule) = 0;
     virtual int32_t RemoveInputEventFilter(int32_t filterId, int32_t clientPid) = 0;
 };
 
@@ -41,7 +42,8 @@ public:
     MOCK_METHOD(void, HandleKeyEvent, (const std::shared_ptr<KeyEvent>));
     MOCK_METHOD(void, HandlePointerEvent, (const std::shared_ptr<PointerEvent>));
     MOCK_METHOD(void, HandleTouchEvent, (const std::shared_ptr<PointerEvent>));
-    MOCK_METHOD(int32_t, AddInputEventFilter, (sptr<IEventFilter>, int32_t, int32_t, uint32_t, int32_t));
+    MOCK_METHOD(int32_t, AddInputEventFilter, (sptr<IEventFilter>, int32_t, int32_t, uint32_t, int32_t,
+        std::shared_ptr<const InputEventFilterRule>));
     MOCK_METHOD(int32_t, RemoveInputEventFilter, (int32_t, int32_t));
 };
 } // namespace MMI
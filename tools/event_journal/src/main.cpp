@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "event_statistic.h"
+
+// Prints the events of multimodal_event.dmp journals pulled from a device, in the text of hidumper -e.
+int32_t main(int32_t argc, char** argv)
+{
+    if (argc < 2) {
+        printf("Usage: %s <journal file>...\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    for (int32_t i = 1; i < argc; ++i) {
+        if (OHOS::MMI::EventStatistic::DumpJournal(-1, argv[i]) < 0) {
+            fprintf(stderr, "Failed to decode %s\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
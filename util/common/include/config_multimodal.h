@@ -36,6 +36,10 @@ namespace MMI {
 #define MAX_PACKET_BUF_SIZE (1024*8)
 // Maximum buffer size of socket stream
 #define MAX_STREAM_BUF_SIZE (MAX_PACKET_BUF_SIZE*2)
+// Inline buffer size of a stream buffer before it grows into the per-thread slab
+#define MIN_STREAM_BUF_SIZE 512
+// Number of released slab blocks cached per size class and thread
+#define STREAM_BUF_SLAB_CACHE_SIZE 4
 #define MAX_VECTOR_SIZE 1000
 #define MAX_INPUT_DEVICE 64
 #define MAX_SUPPORT_KEY 5
@@ -61,6 +65,12 @@ namespace MMI {
 #define MMISEVER_WMS_DEVICE_REMOVE 2
 #define SEND_RETRY_LIMIT 50
 #define SEND_RETRY_SLEEP_TIME 500
+// Bytes a session may hold in its outbound queue before further packets are dropped
+#define MAX_SESSION_PENDING_SIZE (256*1024)
+// Packets gathered into one sendmsg call when a session queue is flushed
+#define MAX_SEND_IOV_COUNT 64
+// Unsent move packets of one pointer kept in a congested session queue, the resampler needs the latest pair
+#define MAX_COALESCE_HISTORY 2
 #define ONCE_PROCESS_NETPACKET_LIMIT 100
 #define MAX_RECV_LIMIT 32
 #define INPUT_POINTER_DEVICES "input.pointer.device"
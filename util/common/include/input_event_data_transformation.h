@@ -24,6 +24,22 @@
 
 namespace OHOS {
 namespace MMI {
+// Packet offsets of the pointer event fields that differ between recipients of the same event.
+struct PointerEventSlots {
+    static constexpr size_t MAX_POINTER_ITEM_SLOTS { 10 };
+    struct PointerItemSlot {
+        int32_t pointerId { -1 };
+        int32_t offset { -1 };
+    };
+    int32_t targetWindowId { -1 };
+    int32_t agentWindowId { -1 };
+    int32_t markEnabled { -1 };
+    int32_t pointerAction { -1 };
+    int32_t dispatchTimes { -1 };
+    size_t pointerItemCount { 0 };
+    PointerItemSlot pointerItems[MAX_POINTER_ITEM_SLOTS];
+};
+
 class InputEventDataTransformation {
     InputEventDataTransformation() = delete;
     DISALLOW_COPY_AND_MOVE(InputEventDataTransformation);
@@ -38,6 +54,7 @@ public:
     static int32_t SerializeInputEvent(std::shared_ptr<InputEvent> event, NetPacket &pkt);
     static int32_t DeserializeInputEvent(NetPacket &pkt, std::shared_ptr<InputEvent> event);
     static int32_t Marshalling(std::shared_ptr<PointerEvent> event, NetPacket &pkt);
+    static int32_t Marshalling(std::shared_ptr<PointerEvent> event, NetPacket &pkt, PointerEventSlots &slots);
     static int32_t Unmarshalling(NetPacket &pkt, std::shared_ptr<PointerEvent> event);
 #ifdef OHOS_BUILD_ENABLE_SECURITY_COMPONENT
     static int32_t MarshallingEnhanceData(std::shared_ptr<PointerEvent> event, NetPacket &pkt);
@@ -46,9 +63,12 @@ public:
     static int32_t UnmarshallingEnhanceData(NetPacket &pkt, std::shared_ptr<KeyEvent> event);
 #endif // OHOS_BUILD_ENABLE_SECURITY_COMPONENT
 private:
+    static int32_t SerializeInputEvent(std::shared_ptr<InputEvent> event, NetPacket &pkt, PointerEventSlots *slots);
+    static int32_t MarshallingInner(std::shared_ptr<PointerEvent> event, NetPacket &pkt, PointerEventSlots *slots);
     static void SerializeFingerprint(const std::shared_ptr<PointerEvent> event, NetPacket &pkt);
-    static void SerializePointerEvent(const std::shared_ptr<PointerEvent> event, NetPacket &pkt);
-    static int32_t SerializePointerItem(NetPacket &pkt, PointerEvent::PointerItem &item);
+    static void SerializePointerEvent(const std::shared_ptr<PointerEvent> event, NetPacket &pkt,
+        PointerEventSlots *slots);
+    static int32_t SerializePointerItem(NetPacket &pkt, const PointerEvent::PointerItem &item);
     static int32_t DeserializePointerItem(NetPacket &pkt, PointerEvent::PointerItem &item);
     static void SetAxisInfo(NetPacket &pkt, std::shared_ptr<PointerEvent> event);
     static void ReadFunctionKeys(NetPacket &pkt, std::shared_ptr<KeyEvent> key);
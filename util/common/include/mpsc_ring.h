@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MPSC_RING_H
+#define MPSC_RING_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace MMI {
+/*
+ * Bounded lock-free queue from any number of producer threads to exactly one consumer thread. Each cell
+ * carries a sequence number telling whose turn it is, producers claim cells by advancing tail_ and publish
+ * them through the sequence, so a producer never waits for another one to finish writing.
+ */
+template<typename T, size_t CAPACITY>
+class MpscRing final {
+    static_assert((CAPACITY > 1) && ((CAPACITY & (CAPACITY - 1)) == 0), "Capacity must be a power of two");
+
+public:
+    MpscRing()
+    {
+        for (size_t i = 0; i < CAPACITY; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~MpscRing() = default;
+    DISALLOW_COPY_AND_MOVE(MpscRing);
+
+    // Producer side, from any thread, returns false without blocking when the ring is full.
+    bool TryPush(const T &item)
+    {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell &cell = cells_[tail & MASK];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            if (sequence == tail) {
+                if (tail_.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+                    cell.item = item;
+                    cell.sequence.store(tail + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (sequence < tail) {
+                return false;
+            } else {
+                tail = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Consumer side, returns false without blocking when no item has been published yet.
+    bool TryPop(T &item)
+    {
+        size_t head = head_.load(std::memory_order_relaxed);
+        Cell &cell = cells_[head & MASK];
+        if (cell.sequence.load(std::memory_order_acquire) != head + 1) {
+            return false;
+        }
+        item = cell.item;
+        cell.sequence.store(head + CAPACITY, std::memory_order_release);
+        head_.store(head + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // An estimate, items being pushed count as soon as they are claimed.
+    size_t Size() const
+    {
+        size_t head = head_.load(std::memory_order_relaxed);
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        return (tail >= head) ? (tail - head) : 0;
+    }
+
+    bool Empty() const
+    {
+        return (Size() == 0);
+    }
+
+    static constexpr size_t Capacity()
+    {
+        return CAPACITY;
+    }
+
+private:
+    static constexpr size_t MASK { CAPACITY - 1 };
+    static constexpr size_t CACHE_LINE_SIZE { 64 };
+
+    struct Cell {
+        std::atomic<size_t> sequence { 0 };
+        T item {};
+    };
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_ { 0 };
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_ { 0 };
+    alignas(CACHE_LINE_SIZE) std::array<Cell, CAPACITY> cells_ {};
+};
+} // namespace MMI
+} // namespace OHOS
+#endif // MPSC_RING_H
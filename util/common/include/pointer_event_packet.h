@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef POINTER_EVENT_PACKET_H
+#define POINTER_EVENT_PACKET_H
+
+#include "input_event_data_transformation.h"
+
+namespace OHOS {
+namespace MMI {
+/*
+ * A pointer event encoded once and shared by all recipients of a fan-out. Before each send,
+ * the fields that differ per recipient (target and agent window, pointer action, dispatch times,
+ * mark-enabled flag and the window coordinates of the pointer item) are patched in place.
+ */
+class PointerEventPacket final {
+public:
+    explicit PointerEventPacket(MmiMessageId msgId);
+    ~PointerEventPacket() = default;
+    DISALLOW_COPY_AND_MOVE(PointerEventPacket);
+
+    int32_t Encode(std::shared_ptr<PointerEvent> event);
+    bool Patch(std::shared_ptr<PointerEvent> event);
+    bool SetMarkEnabled(bool markEnabled);
+    void Reset();
+
+    bool IsEncoded() const
+    {
+        return encoded_;
+    }
+
+    NetPacket &GetPacket()
+    {
+        return pkt_;
+    }
+
+private:
+    template<typename T>
+    bool PatchSlot(int32_t offset, const T &data);
+    bool PatchPointerItem(const PointerEvent::PointerItem &item);
+
+    NetPacket pkt_;
+    PointerEventSlots slots_;
+    bool encoded_ { false };
+};
+
+template<typename T>
+bool PointerEventPacket::PatchSlot(int32_t offset, const T &data)
+{
+    if (offset < 0) {
+        return false;
+    }
+    return pkt_.WriteAt(offset, data);
+}
+} // namespace MMI
+} // namespace OHOS
+#endif // POINTER_EVENT_PACKET_H
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace MMI {
+/*
+ * Bounded lock-free queue between exactly one producer thread and one consumer thread. The producer only
+ * writes tail_ and the consumer only writes head_, each on its own cache line, so neither side ever waits.
+ */
+template<typename T, size_t CAPACITY>
+class SpscRing final {
+    static_assert((CAPACITY > 0) && ((CAPACITY & (CAPACITY - 1)) == 0), "Capacity must be a power of two");
+
+public:
+    SpscRing() = default;
+    ~SpscRing() = default;
+    DISALLOW_COPY_AND_MOVE(SpscRing);
+
+    // Producer side, returns false without blocking when the ring is full.
+    bool TryPush(const T &item)
+    {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == CAPACITY) {
+            return false;
+        }
+        items_[tail & MASK] = item;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side, returns false without blocking when the ring is empty.
+    bool TryPop(T &item)
+    {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = items_[head & MASK];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Exact on either side, an estimate from any other thread.
+    size_t Size() const
+    {
+        size_t head = head_.load(std::memory_order_acquire);
+        size_t tail = tail_.load(std::memory_order_acquire);
+        return (tail >= head) ? (tail - head) : 0;
+    }
+
+    bool Empty() const
+    {
+        return (Size() == 0);
+    }
+
+    static constexpr size_t Capacity()
+    {
+        return CAPACITY;
+    }
+
+private:
+    static constexpr size_t MASK { CAPACITY - 1 };
+    static constexpr size_t CACHE_LINE_SIZE { 64 };
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_ { 0 };
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_ { 0 };
+    alignas(CACHE_LINE_SIZE) std::array<T, CAPACITY> items_ {};
+};
+} // namespace MMI
+} // namespace OHOS
+#endif // SPSC_RING_H
@@ -220,12 +220,29 @@ int32_t InputEventDataTransformation::NetPacketToLongPressEvent(NetPacket &pkt,
 }
 
 int32_t InputEventDataTransformation::SerializeInputEvent(std::shared_ptr<InputEvent> event, NetPacket &pkt)
+{
+    return SerializeInputEvent(event, pkt, nullptr);
+}
+
+int32_t InputEventDataTransformation::SerializeInputEvent(std::shared_ptr<InputEvent> event, NetPacket &pkt,
+    PointerEventSlots *slots)
 {
     CHKPR(event, ERROR_NULL_POINTER);
     pkt << event->GetEventType() << event->GetId() << event->GetActionTime()
         << event->GetAction() << event->GetActionStartTime() << event->GetSensorInputTime() << event->GetDeviceId()
-        << event->GetSourceType() << event->GetTargetDisplayId() << event->GetTargetWindowId()
-        << event->GetAgentWindowId() << event->GetFlag() << event->IsMarkEnabled();
+        << event->GetSourceType() << event->GetTargetDisplayId();
+    if (slots != nullptr) {
+        slots->targetWindowId = static_cast<int32_t>(pkt.GetSize());
+    }
+    pkt << event->GetTargetWindowId();
+    if (slots != nullptr) {
+        slots->agentWindowId = static_cast<int32_t>(pkt.GetSize());
+    }
+    pkt << event->GetAgentWindowId() << event->GetFlag();
+    if (slots != nullptr) {
+        slots->markEnabled = static_cast<int32_t>(pkt.GetSize());
+    }
+    pkt << event->IsMarkEnabled();
     if (pkt.ChkRWError()) {
         MMI_HILOGE("Serialize packet is failed");
         return RET_ERR;
@@ -274,26 +291,38 @@ int32_t InputEventDataTransformation::DeserializeInputEvent(NetPacket &pkt, std:
 }
 
 int32_t InputEventDataTransformation::Marshalling(std::shared_ptr<PointerEvent> event, NetPacket &pkt)
+{
+    return MarshallingInner(event, pkt, nullptr);
+}
+
+int32_t InputEventDataTransformation::Marshalling(std::shared_ptr<PointerEvent> event, NetPacket &pkt,
+    PointerEventSlots &slots)
+{
+    slots = PointerEventSlots();
+    return MarshallingInner(event, pkt, &slots);
+}
+
+int32_t InputEventDataTransformation::MarshallingInner(std::shared_ptr<PointerEvent> event, NetPacket &pkt,
+    PointerEventSlots *slots)
 {
     CHKPR(event, ERROR_NULL_POINTER);
-    if (SerializeInputEvent(event, pkt) != RET_OK) {
+    if (SerializeInputEvent(event, pkt, slots) != RET_OK) {
         MMI_HILOGE("Serialize input event failed");
         return RET_ERR;
     }
     SerializeFingerprint(event, pkt);
-    SerializePointerEvent(event, pkt);
+    SerializePointerEvent(event, pkt, slots);
     std::set<int32_t> pressedBtns { event->GetPressedButtons() };
     pkt << pressedBtns.size();
     for (int32_t btnId : pressedBtns) {
         pkt << btnId;
     }
-    std::vector<int32_t> pointerIds { event->GetPointerIds() };
-    pkt << pointerIds.size();
-    for (const auto &pointerId : pointerIds) {
-        PointerEvent::PointerItem item;
-        if (!event->GetPointerItem(pointerId, item)) {
-            MMI_HILOGE("Get pointer item failed");
-            return RET_ERR;
+    const auto &pointerItems = event->GetPointerItems();
+    pkt << pointerItems.size();
+    for (const auto &item : pointerItems) {
+        if ((slots != nullptr) && (slots->pointerItemCount < PointerEventSlots::MAX_POINTER_ITEM_SLOTS)) {
+            slots->pointerItems[slots->pointerItemCount++] = {
+                item.GetPointerId(), static_cast<int32_t>(pkt.GetSize()) };
         }
         if (SerializePointerItem(pkt, item) != RET_OK) {
             MMI_HILOGE("Serialize pointer item failed");
@@ -333,12 +362,18 @@ int32_t InputEventDataTransformation::Marshalling(std::shared_ptr<PointerEvent>
     return RET_OK;
 }
 
-void InputEventDataTransformation::SerializePointerEvent(const std::shared_ptr<PointerEvent> event, NetPacket &pkt)
+void InputEventDataTransformation::SerializePointerEvent(const std::shared_ptr<PointerEvent> event, NetPacket &pkt,
+    PointerEventSlots *slots)
 {
+    if (slots != nullptr) {
+        slots->pointerAction = static_cast<int32_t>(pkt.GetSize());
+    }
     pkt << event->GetPointerAction() << event->GetOriginPointerAction() << event->GetPointerId()
-        << event->GetButtonId() << event->GetFingerCount()
-        << event->GetZOrder() << event->GetDispatchTimes() << event->GetHandlerEventType()
-        << event->GetAxes();
+        << event->GetButtonId() << event->GetFingerCount() << event->GetZOrder();
+    if (slots != nullptr) {
+        slots->dispatchTimes = static_cast<int32_t>(pkt.GetSize());
+    }
+    pkt << event->GetDispatchTimes() << event->GetHandlerEventType() << event->GetAxes();
     for (int32_t i = PointerEvent::AXIS_TYPE_UNKNOWN; i < PointerEvent::AXIS_TYPE_MAX; ++i) {
         pkt << event->GetAxisValue(static_cast<PointerEvent::AxisType>(i));
     }
@@ -526,7 +561,7 @@ void InputEventDataTransformation::SetAxisInfo(NetPacket &pkt, std::shared_ptr<P
     event->SetAxisEventType(axisEventType);
 }
 
-int32_t InputEventDataTransformation::SerializePointerItem(NetPacket &pkt, PointerEvent::PointerItem &item)
+int32_t InputEventDataTransformation::SerializePointerItem(NetPacket &pkt, const PointerEvent::PointerItem &item)
 {
     pkt << item;
     if (pkt.ChkRWError()) {
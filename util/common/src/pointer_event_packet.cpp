@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pointer_event_packet.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "PointerEventPacket"
+
+namespace OHOS {
+namespace MMI {
+PointerEventPacket::PointerEventPacket(MmiMessageId msgId) : pkt_(msgId) {}
+
+int32_t PointerEventPacket::Encode(std::shared_ptr<PointerEvent> event)
+{
+    CHKPR(event, ERROR_NULL_POINTER);
+    Reset();
+    if (InputEventDataTransformation::Marshalling(event, pkt_, slots_) != RET_OK) {
+        MMI_HILOGE("Marshalling pointer event failed, errCode:%{public}d", STREAM_BUF_WRITE_FAIL);
+        return RET_ERR;
+    }
+    encoded_ = true;
+    return RET_OK;
+}
+
+bool PointerEventPacket::Patch(std::shared_ptr<PointerEvent> event)
+{
+    CHKPF(event);
+    if (!encoded_) {
+        return false;
+    }
+    PointerEvent::PointerItem item;
+    if (!event->GetPointerItem(event->GetPointerId(), item)) {
+        MMI_HILOGD("Can't find pointer item, pointer:%{public}d", event->GetPointerId());
+        return false;
+    }
+    return (PatchSlot(slots_.targetWindowId, event->GetTargetWindowId()) &&
+        PatchSlot(slots_.agentWindowId, event->GetAgentWindowId()) &&
+        PatchSlot(slots_.pointerAction, event->GetPointerAction()) &&
+        PatchSlot(slots_.dispatchTimes, event->GetDispatchTimes()) &&
+        PatchPointerItem(item));
+}
+
+bool PointerEventPacket::SetMarkEnabled(bool markEnabled)
+{
+    return (encoded_ && PatchSlot(slots_.markEnabled, markEnabled));
+}
+
+void PointerEventPacket::Reset()
+{
+    pkt_.Clean();
+    slots_ = PointerEventSlots();
+    encoded_ = false;
+}
+
+bool PointerEventPacket::PatchPointerItem(const PointerEvent::PointerItem &item)
+{
+    for (size_t i = 0; i < slots_.pointerItemCount; ++i) {
+        if (slots_.pointerItems[i].pointerId == item.GetPointerId()) {
+            return PatchSlot(slots_.pointerItems[i].offset, item);
+        }
+    }
+    MMI_HILOGD("No slot for pointer item:%{public}d", item.GetPointerId());
+    return false;
+}
+} // namespace MMI
+} // namespace OHOS
@@ -16,6 +16,7 @@
 #include <gtest/gtest.h>
 
 #include "input_event_data_transformation.h"
+#include "pointer_event_packet.h"
 
 namespace OHOS {
 namespace MMI {
@@ -222,5 +223,76 @@ HWTEST_F(InputEventDataTransformationTest, Unmarshalling_001, TestSize.Level1)
     ASSERT_EQ(ret, RET_OK);
     EXPECT_EQ(newEvent->GetCallingUid(), callingUid);
 }
+
+/**
+ * @tc.name: PointerEventPacket_Patch_001
+ * @tc.desc: Test that a patched packet decodes the same as a packet encoded from the modified event
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventDataTransformationTest, PointerEventPacket_Patch_001, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto pointerEvent = PointerEvent::Create();
+    ASSERT_NE(pointerEvent, nullptr);
+    PointerEvent::PointerItem item;
+    item.SetPointerId(0);
+    item.SetDisplayX(100);
+    item.SetDisplayY(200);
+    pointerEvent->AddPointerItem(item);
+    pointerEvent->SetPointerId(0);
+    pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
+    pointerEvent->SetTargetWindowId(1);
+    PointerEventPacket packet(MmiMessageId::ON_POINTER_EVENT);
+    ASSERT_EQ(packet.Encode(pointerEvent), RET_OK);
+
+    pointerEvent->SetTargetWindowId(2);
+    pointerEvent->SetAgentWindowId(3);
+    pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_CANCEL);
+    pointerEvent->SetDispatchTimes(1);
+    item.SetWindowX(10);
+    item.SetWindowY(20);
+    pointerEvent->UpdatePointerItem(0, item);
+    ASSERT_TRUE(packet.Patch(pointerEvent));
+    ASSERT_TRUE(packet.SetMarkEnabled(false));
+
+    auto newEvent = PointerEvent::Create();
+    ASSERT_NE(newEvent, nullptr);
+    ASSERT_EQ(InputEventDataTransformation::Unmarshalling(packet.GetPacket(), newEvent), RET_OK);
+    EXPECT_EQ(newEvent->GetTargetWindowId(), 2);
+    EXPECT_EQ(newEvent->GetAgentWindowId(), 3);
+    EXPECT_EQ(newEvent->GetPointerAction(), PointerEvent::POINTER_ACTION_CANCEL);
+    EXPECT_EQ(newEvent->GetDispatchTimes(), 1);
+    EXPECT_FALSE(newEvent->IsMarkEnabled());
+    PointerEvent::PointerItem newItem;
+    ASSERT_TRUE(newEvent->GetPointerItem(0, newItem));
+    EXPECT_EQ(newItem.GetWindowX(), 10);
+    EXPECT_EQ(newItem.GetWindowY(), 20);
+}
+
+/**
+ * @tc.name: PointerEventPacket_Patch_002
+ * @tc.desc: Test that patching fails before encoding and for a pointer item that was not encoded
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(InputEventDataTransformationTest, PointerEventPacket_Patch_002, TestSize.Level1)
+{
+    CALL_TEST_DEBUG;
+    auto pointerEvent = PointerEvent::Create();
+    ASSERT_NE(pointerEvent, nullptr);
+    PointerEvent::PointerItem item;
+    item.SetPointerId(0);
+    pointerEvent->AddPointerItem(item);
+    pointerEvent->SetPointerId(0);
+    PointerEventPacket packet(MmiMessageId::ON_POINTER_EVENT);
+    EXPECT_FALSE(packet.Patch(pointerEvent));
+    EXPECT_FALSE(packet.SetMarkEnabled(true));
+    ASSERT_EQ(packet.Encode(pointerEvent), RET_OK);
+    item.SetPointerId(1);
+    pointerEvent->AddPointerItem(item);
+    pointerEvent->SetPointerId(1);
+    EXPECT_FALSE(packet.Patch(pointerEvent));
+}
 } // namespace MMI
 } // namespace OHOS
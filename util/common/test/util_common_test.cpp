@@ -15,11 +15,16 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <fstream>
+#include <thread>
+#include <vector>
 
 #include <cJSON.h>
 
 #include "config_policy_utils.h"
+#include "mpsc_ring.h"
+#include "spsc_ring.h"
 #include "util.h"
 
 #include "accesstoken_kit.h"
@@ -190,5 +195,143 @@ void UtilCommonTest::BuildConfig5()
     }
     SerializeConfig(jsonConfig.get());
 }
+
+/**
+ * @tc.name: SpscRing_001
+ * @tc.desc: Verify that SpscRing keeps order across wraparound and refuses pushes when full
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(UtilCommonTest, SpscRing_001, TestSize.Level1)
+{
+    SpscRing<int32_t, 4> ring;
+    int32_t item = 0;
+    EXPECT_FALSE(ring.TryPop(item));
+    for (int32_t round = 0; round < 3; ++round) {
+        for (int32_t i = 0; i < 4; ++i) {
+            EXPECT_TRUE(ring.TryPush(round * 4 + i));
+        }
+        EXPECT_FALSE(ring.TryPush(-1));
+        EXPECT_EQ(ring.Size(), 4);
+        for (int32_t i = 0; i < 4; ++i) {
+            EXPECT_TRUE(ring.TryPop(item));
+            EXPECT_EQ(item, round * 4 + i);
+        }
+        EXPECT_TRUE(ring.Empty());
+    }
+}
+
+/**
+ * @tc.name: SpscRing_002
+ * @tc.desc: Verify that SpscRing hands every item over in order from a producer thread to a consumer thread
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(UtilCommonTest, SpscRing_002, TestSize.Level1)
+{
+    constexpr int32_t itemCount { 100000 };
+    SpscRing<int32_t, 64> ring;
+    std::atomic_bool stop { false };
+    std::thread producer([&ring, &stop] {
+        for (int32_t i = 0; (i < itemCount) && !stop;) {
+            if (ring.TryPush(i)) {
+                ++i;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+    int32_t expected = 0;
+    int32_t item = 0;
+    while (expected < itemCount) {
+        if (!ring.TryPop(item)) {
+            std::this_thread::yield();
+            continue;
+        }
+        EXPECT_EQ(item, expected);
+        if (item != expected) {
+            stop = true;
+            break;
+        }
+        ++expected;
+    }
+    producer.join();
+    EXPECT_EQ(expected, itemCount);
+    EXPECT_TRUE(ring.Empty());
+}
+
+/**
+ * @tc.name: MpscRing_001
+ * @tc.desc: Verify that MpscRing keeps order across wraparound and refuses pushes when full
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(UtilCommonTest, MpscRing_001, TestSize.Level1)
+{
+    MpscRing<int32_t, 4> ring;
+    int32_t item = 0;
+    EXPECT_FALSE(ring.TryPop(item));
+    for (int32_t round = 0; round < 3; ++round) {
+        for (int32_t i = 0; i < 4; ++i) {
+            EXPECT_TRUE(ring.TryPush(round * 4 + i));
+        }
+        EXPECT_FALSE(ring.TryPush(-1));
+        EXPECT_EQ(ring.Size(), 4);
+        for (int32_t i = 0; i < 4; ++i) {
+            EXPECT_TRUE(ring.TryPop(item));
+            EXPECT_EQ(item, round * 4 + i);
+        }
+        EXPECT_TRUE(ring.Empty());
+    }
+}
+
+/**
+ * @tc.name: MpscRing_002
+ * @tc.desc: Verify that MpscRing hands every item of several producer threads over, each producer in order
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(UtilCommonTest, MpscRing_002, TestSize.Level1)
+{
+    constexpr int32_t producerCount { 4 };
+    constexpr int32_t itemCount { 50000 };
+    MpscRing<int32_t, 64> ring;
+    std::atomic_bool stop { false };
+    std::vector<std::thread> producers;
+    for (int32_t producer = 0; producer < producerCount; ++producer) {
+        producers.emplace_back([&ring, &stop, producer] {
+            for (int32_t i = 0; (i < itemCount) && !stop;) {
+                if (ring.TryPush(producer * itemCount + i)) {
+                    ++i;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    std::vector<int32_t> expected(producerCount, 0);
+    int32_t received = 0;
+    int32_t item = 0;
+    while (received < producerCount * itemCount) {
+        if (!ring.TryPop(item)) {
+            std::this_thread::yield();
+            continue;
+        }
+        int32_t producer = item / itemCount;
+        bool isValid = (producer >= 0) && (producer < producerCount) && (item % itemCount == expected[producer]);
+        EXPECT_TRUE(isValid) << "item:" << item;
+        if (!isValid) {
+            stop = true;
+            break;
+        }
+        ++expected[producer];
+        ++received;
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    EXPECT_EQ(received, producerCount * itemCount);
+    EXPECT_TRUE(ring.Empty());
+}
 } // namespace MMI
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
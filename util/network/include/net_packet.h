@@ -33,6 +33,8 @@ namespace MMI {
 class NetPacket : public StreamBuffer {
 public:
     explicit NetPacket(MmiMessageId msgId);
+    // Read-only view of a payload owned by the caller; a copy of the view owns its data.
+    NetPacket(MmiMessageId msgId, const char *buf, size_t size);
     NetPacket(const NetPacket &pkt);
     DISALLOW_MOVE(NetPacket);
     virtual ~NetPacket();
@@ -30,10 +30,11 @@ namespace OHOS {
 namespace MMI {
 class StreamBuffer {
 public:
-    StreamBuffer() = default;
+    StreamBuffer();
     DISALLOW_MOVE(StreamBuffer);
-    virtual ~StreamBuffer() = default;
+    virtual ~StreamBuffer();
     explicit StreamBuffer(const StreamBuffer &buf);
+    StreamBuffer(const char *buf, size_t size);
     virtual StreamBuffer &operator=(const StreamBuffer &other);
     
     void Reset();
@@ -48,6 +49,7 @@ public:
 
     bool Read(char *buf, size_t size);
     virtual bool Write(const char *buf, size_t size);
+    bool WriteAt(int32_t pos, const char *buf, size_t size);
 
     bool IsEmpty() const;
     size_t Size() const;
@@ -55,6 +57,7 @@ public:
     int32_t GetAvailableBufSize() const;
 
     bool ChkRWError() const;
+    bool IsReadOnly() const;
     const std::string &GetErrorStatusRemark() const;
     const char *Data() const;
 
@@ -63,6 +66,8 @@ public:
     template<typename T>
     bool Write(const T &data);
     template<typename T>
+    bool WriteAt(int32_t pos, const T &data);
+    template<typename T>
     bool Read(std::vector<T> &data);
     template<typename T>
     bool Write(const std::vector<T> &data);
@@ -77,6 +82,9 @@ public:
 
 protected:
     bool Clone(const StreamBuffer &buf);
+    bool Attach(const char *buf, size_t size);
+    bool Reserve(int32_t size);
+    void ReleaseBuf();
 
 protected:
     enum class ErrorStatus {
@@ -90,7 +98,11 @@ protected:
 
     int32_t rPos_ { 0 };
     int32_t wPos_ { 0 };
-    char szBuff_[MAX_STREAM_BUF_SIZE+1] = {};
+    // Points to inlineBuff_, to a block of the per-thread slab, or to caller memory when read-only.
+    char *szBuff_ { inlineBuff_ };
+    int32_t capacity_ { MIN_STREAM_BUF_SIZE };
+    bool readOnly_ { false };
+    char inlineBuff_[MIN_STREAM_BUF_SIZE];
 };
 
 template<typename T>
@@ -115,6 +127,17 @@ bool StreamBuffer::Write(const T &data)
     return true;
 }
 
+template<typename T>
+bool StreamBuffer::WriteAt(int32_t pos, const T &data)
+{
+    if (!WriteAt(pos, reinterpret_cast<const char *>(&data), sizeof(data))) {
+        MMI_HILOGE("[%{public}s] pos:%{public}d size:%{public}zu,errCode:%{public}d",
+            GetErrorStatusRemark().c_str(), pos, sizeof(data), STREAM_BUF_WRITE_FAIL);
+        return false;
+    }
+    return true;
+}
+
 template<typename T>
 bool StreamBuffer::Read(std::vector<T> &data)
 {
@@ -22,7 +22,7 @@ void CircleStreamBuffer::CopyDataToBegin()
     int32_t unreadSize = UnreadSize();
     if (unreadSize > 0 && rPos_ > 0) {
         int32_t pos = 0;
-        for (int32_t i = rPos_; i <= wPos_;) {
+        for (int32_t i = rPos_; i < wPos_;) {
             szBuff_[pos++] = szBuff_[i++];
         }
     }
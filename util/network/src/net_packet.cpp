@@ -19,6 +19,11 @@ namespace OHOS {
 namespace MMI {
 NetPacket::NetPacket(MmiMessageId msgId) : msgId_(msgId) {}
 
+NetPacket::NetPacket(MmiMessageId msgId, const char *buf, size_t size) : msgId_(msgId)
+{
+    Attach(buf, size);
+}
+
 NetPacket::NetPacket(const NetPacket &pkt) : NetPacket(pkt.GetMsgId())
 {
     Clone(pkt);
@@ -15,16 +15,126 @@
 
 #include "stream_buffer.h"
 
+#include <cstring>
+#include <new>
+
 namespace OHOS {
 namespace MMI {
+namespace {
+constexpr int32_t SLAB_CLASS_COUNT { 5 };
+static_assert((MIN_STREAM_BUF_SIZE << SLAB_CLASS_COUNT) == MAX_STREAM_BUF_SIZE,
+    "Slab size classes must cover the stream buffer range");
+
+int32_t GetSlabClassSize(int32_t slabClass)
+{
+    return (MIN_STREAM_BUF_SIZE << (slabClass + 1));
+}
+
+int32_t GetSlabClass(int32_t size)
+{
+    int32_t slabClass = 0;
+    while ((slabClass < SLAB_CLASS_COUNT - 1) && (GetSlabClassSize(slabClass) < size)) {
+        ++slabClass;
+    }
+    return slabClass;
+}
+
+thread_local bool g_slabDestroyed { false };
+
+// Per-thread cache of released stream buffer blocks, grouped by power-of-two size class.
+class StreamBufferSlab final {
+public:
+    StreamBufferSlab() = default;
+    ~StreamBufferSlab()
+    {
+        g_slabDestroyed = true;
+        for (auto &freeList : freeLists_) {
+            for (int32_t i = 0; i < freeList.count; ++i) {
+                delete[] freeList.blocks[i];
+            }
+            freeList.count = 0;
+        }
+    }
+    DISALLOW_COPY_AND_MOVE(StreamBufferSlab);
+
+    char *Alloc(int32_t slabClass)
+    {
+        FreeList &freeList = freeLists_[slabClass];
+        if (freeList.count > 0) {
+            return freeList.blocks[--freeList.count];
+        }
+        return new (std::nothrow) char[GetSlabClassSize(slabClass)];
+    }
+
+    void Free(char *block, int32_t slabClass)
+    {
+        FreeList &freeList = freeLists_[slabClass];
+        if (freeList.count < STREAM_BUF_SLAB_CACHE_SIZE) {
+            freeList.blocks[freeList.count++] = block;
+            return;
+        }
+        delete[] block;
+    }
+
+private:
+    struct FreeList {
+        char *blocks[STREAM_BUF_SLAB_CACHE_SIZE] {};
+        int32_t count { 0 };
+    };
+    FreeList freeLists_[SLAB_CLASS_COUNT];
+};
+
+StreamBufferSlab *GetSlab()
+{
+    if (g_slabDestroyed) {
+        return nullptr;
+    }
+    thread_local StreamBufferSlab slab;
+    return &slab;
+}
+
+char *AllocSlabBlock(int32_t slabClass)
+{
+    StreamBufferSlab *slab = GetSlab();
+    if (slab == nullptr) {
+        return new (std::nothrow) char[GetSlabClassSize(slabClass)];
+    }
+    return slab->Alloc(slabClass);
+}
+
+void FreeSlabBlock(char *block, int32_t slabClass)
+{
+    StreamBufferSlab *slab = GetSlab();
+    if (slab == nullptr) {
+        delete[] block;
+        return;
+    }
+    slab->Free(block, slabClass);
+}
+} // namespace
+
+StreamBuffer::StreamBuffer() {}
+
 StreamBuffer::StreamBuffer(const StreamBuffer &buf)
 {
     Clone(buf);
 }
 
+StreamBuffer::StreamBuffer(const char *buf, size_t size)
+{
+    Attach(buf, size);
+}
+
+StreamBuffer::~StreamBuffer()
+{
+    ReleaseBuf();
+}
+
 StreamBuffer &StreamBuffer::operator=(const StreamBuffer &other)
 {
-    Clone(other);
+    if (this != &other) {
+        Clone(other);
+    }
     return *this;
 }
 
@@ -40,7 +150,11 @@ void StreamBuffer::Reset()
 void StreamBuffer::Clean()
 {
     Reset();
-    errno_t ret = memset_sp(&szBuff_, sizeof(szBuff_), 0, sizeof(szBuff_));
+    if (readOnly_) {
+        ReleaseBuf();
+        return;
+    }
+    errno_t ret = memset_sp(szBuff_, capacity_, 0, capacity_);
     if (ret != EOK) {
         MMI_HILOGE("Call memset_s fail");
         return;
@@ -72,7 +186,7 @@ bool StreamBuffer::Read(std::string &buf)
         rwErrorStatus_ = ErrorStatus::ERROR_STATUS_READ;
         return false;
     }
-    const char *terminator = strchr(readPtr, '\0');
+    const char *terminator = static_cast<const char *>(memchr(readPtr, '\0', UnreadSize()));
     if (terminator == nullptr) {
         MMI_HILOGE("Incomplete string in buffer, errCode:%{public}d", MEM_NOT_ENOUGH);
         rwErrorStatus_ = ErrorStatus::ERROR_STATUS_READ;
@@ -144,13 +258,23 @@ bool StreamBuffer::Write(const char *buf, size_t size)
         rwErrorStatus_ = ErrorStatus::ERROR_STATUS_WRITE;
         return false;
     }
+    if (readOnly_) {
+        MMI_HILOGE("The buffer is a read-only view, errCode:%{public}d", STREAM_BUF_WRITE_FAIL);
+        rwErrorStatus_ = ErrorStatus::ERROR_STATUS_WRITE;
+        return false;
+    }
     if (wPos_ + static_cast<int32_t>(size) > MAX_STREAM_BUF_SIZE) {
         MMI_HILOGE("The write length exceeds buffer. wIdx:%{public}d size:%{public}zu maxBufSize:%{public}d "
             "errCode:%{public}d", wPos_, size, MAX_STREAM_BUF_SIZE, MEM_OUT_OF_BOUNDS);
         rwErrorStatus_ = ErrorStatus::ERROR_STATUS_WRITE;
         return false;
     }
-    errno_t ret = memcpy_sp(&szBuff_[wPos_], GetAvailableBufSize(), buf, size);
+    if (!Reserve(wPos_ + static_cast<int32_t>(size))) {
+        MMI_HILOGE("Failed to grow buffer, errCode:%{public}d", MEM_NOT_ENOUGH);
+        rwErrorStatus_ = ErrorStatus::ERROR_STATUS_WRITE;
+        return false;
+    }
+    errno_t ret = memcpy_sp(&szBuff_[wPos_], capacity_ - wPos_, buf, size);
     if (ret != EOK) {
         MMI_HILOGE("Failed to call memcpy_sp. errCode:%{public}d", MEMCPY_SEC_FUN_FAIL);
         rwErrorStatus_ = ErrorStatus::ERROR_STATUS_WRITE;
@@ -161,6 +285,28 @@ bool StreamBuffer::Write(const char *buf, size_t size)
     return true;
 }
 
+bool StreamBuffer::WriteAt(int32_t pos, const char *buf, size_t size)
+{
+    if (ChkRWError()) {
+        return false;
+    }
+    if (buf == nullptr || readOnly_) {
+        MMI_HILOGE("Invalid input parameter or read-only buffer, errCode:%{public}d", PARAM_INPUT_INVALID);
+        return false;
+    }
+    if (pos < 0 || size > static_cast<size_t>(wPos_) || pos > wPos_ - static_cast<int32_t>(size)) {
+        MMI_HILOGE("Only written data can be overwritten. pos:%{public}d size:%{public}zu wPos:%{public}d "
+            "errCode:%{public}d", pos, size, wPos_, MEM_OUT_OF_BOUNDS);
+        return false;
+    }
+    errno_t ret = memcpy_sp(&szBuff_[pos], wPos_ - pos, buf, size);
+    if (ret != EOK) {
+        MMI_HILOGE("Failed to call memcpy_sp. errCode:%{public}d", MEMCPY_SEC_FUN_FAIL);
+        return false;
+    }
+    return true;
+}
+
 bool StreamBuffer::IsEmpty() const
 {
     return (rPos_ == wPos_);
@@ -186,6 +332,11 @@ bool StreamBuffer::ChkRWError() const
     return (rwErrorStatus_ != ErrorStatus::ERROR_STATUS_OK);
 }
 
+bool StreamBuffer::IsReadOnly() const
+{
+    return readOnly_;
+}
+
 const std::string &StreamBuffer::GetErrorStatusRemark() const
 {
     static const std::vector<std::pair<ErrorStatus, std::string>> remark {
@@ -204,13 +355,13 @@ const std::string &StreamBuffer::GetErrorStatusRemark() const
 
 const char *StreamBuffer::Data() const
 {
-    return &szBuff_[0];
+    return szBuff_;
 }
 
 const char *StreamBuffer::ReadBuf() const
 {
-    if (static_cast<size_t>(rPos_) >= sizeof(szBuff_)) {
-        MMI_HILOGE("Read position out of bounds, rPos:%{public}d, size():%{public}zu", rPos_, sizeof(szBuff_));
+    if (rPos_ < 0 || rPos_ > wPos_) {
+        MMI_HILOGE("Read position out of bounds, rPos:%{public}d, wPos:%{public}d", rPos_, wPos_);
         return nullptr;
     }
     return &szBuff_[rPos_];
@@ -226,5 +377,57 @@ bool StreamBuffer::Clone(const StreamBuffer &buf)
     Clean();
     return Write(buf.Data(), buf.Size());
 }
+
+bool StreamBuffer::Attach(const char *buf, size_t size)
+{
+    Reset();
+    if (buf == nullptr || size > MAX_STREAM_BUF_SIZE) {
+        MMI_HILOGE("Invalid view, size:%{public}zu", size);
+        rwErrorStatus_ = ErrorStatus::ERROR_STATUS_WRITE;
+        return false;
+    }
+    ReleaseBuf();
+    szBuff_ = const_cast<char *>(buf);
+    capacity_ = static_cast<int32_t>(size);
+    readOnly_ = true;
+    wPos_ = capacity_;
+    return true;
+}
+
+bool StreamBuffer::Reserve(int32_t size)
+{
+    if (size <= capacity_) {
+        return true;
+    }
+    if (readOnly_ || size > MAX_STREAM_BUF_SIZE) {
+        return false;
+    }
+    int32_t slabClass = GetSlabClass(size);
+    char *block = AllocSlabBlock(slabClass);
+    if (block == nullptr) {
+        return false;
+    }
+    if (wPos_ > 0) {
+        errno_t ret = memcpy_sp(block, GetSlabClassSize(slabClass), szBuff_, wPos_);
+        if (ret != EOK) {
+            FreeSlabBlock(block, slabClass);
+            return false;
+        }
+    }
+    ReleaseBuf();
+    szBuff_ = block;
+    capacity_ = GetSlabClassSize(slabClass);
+    return true;
+}
+
+void StreamBuffer::ReleaseBuf()
+{
+    if (!readOnly_ && (szBuff_ != inlineBuff_)) {
+        FreeSlabBlock(szBuff_, GetSlabClass(capacity_));
+    }
+    szBuff_ = inlineBuff_;
+    capacity_ = MIN_STREAM_BUF_SIZE;
+    readOnly_ = false;
+}
 } // namespace MMI
 } // namespace OHOS
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+
+#include "input_event_data_transformation.h"
+#include "uds_session.h"
+
+#undef MMI_LOG_TAG
+#define MMI_LOG_TAG "NetPacketBenchmark"
+
+namespace OHOS {
+namespace MMI {
+namespace {
+constexpr int32_t SOCKET_BUF_SIZE { 64 * 1024 };
+constexpr int32_t FINGER_DISTANCE { 50 };
+
+// Storage layout used by NetPacket before the slab-backed buffer: one zeroed array of the maximum size.
+struct FixedPacketStorage {
+    int32_t wPos { 0 };
+    char buf[MAX_STREAM_BUF_SIZE + 1] = {};
+};
+
+std::shared_ptr<PointerEvent> CreatePointerEvent(int32_t fingers)
+{
+    auto pointerEvent = PointerEvent::Create();
+    pointerEvent->SetSourceType(PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+    pointerEvent->SetPointerAction(PointerEvent::POINTER_ACTION_MOVE);
+    for (int32_t i = 0; i < fingers; ++i) {
+        PointerEvent::PointerItem item;
+        item.SetPointerId(i);
+        item.SetDisplayX(i * FINGER_DISTANCE);
+        item.SetDisplayY(i * FINGER_DISTANCE);
+        item.SetPressed(true);
+        pointerEvent->AddPointerItem(item);
+    }
+    pointerEvent->SetPointerId(0);
+    return pointerEvent;
+}
+
+std::shared_ptr<KeyEvent> CreateKeyEvent()
+{
+    auto keyEvent = KeyEvent::Create();
+    KeyEvent::KeyItem item;
+    item.SetKeyCode(KeyEvent::KEYCODE_A);
+    item.SetPressed(true);
+    keyEvent->AddKeyItem(item);
+    keyEvent->SetKeyCode(KeyEvent::KEYCODE_A);
+    keyEvent->SetKeyAction(KeyEvent::KEY_ACTION_DOWN);
+    return keyEvent;
+}
+
+class SocketPair {
+public:
+    SocketPair()
+    {
+        if (socketpair(AF_UNIX, SOCK_SEQPACKET, 0, fds_) != 0) {
+            fds_[0] = -1;
+            fds_[1] = -1;
+            return;
+        }
+        setsockopt(fds_[0], SOL_SOCKET, SO_SNDBUF, &SOCKET_BUF_SIZE, sizeof(SOCKET_BUF_SIZE));
+        setsockopt(fds_[1], SOL_SOCKET, SO_RCVBUF, &SOCKET_BUF_SIZE, sizeof(SOCKET_BUF_SIZE));
+    }
+    ~SocketPair()
+    {
+        if (fds_[1] >= 0) {
+            close(fds_[1]);
+        }
+    }
+    DISALLOW_COPY_AND_MOVE(SocketPair);
+
+    // The sending end is owned by the session.
+    int32_t SendFd() const
+    {
+        return fds_[0];
+    }
+
+    void Drain()
+    {
+        char buf[MAX_PACKET_BUF_SIZE];
+        while (recv(fds_[1], buf, sizeof(buf), MSG_DONTWAIT) > 0) {}
+    }
+
+private:
+    int32_t fds_[2] { -1, -1 };
+};
+
+void BM_MarshallingPointerEvent(benchmark::State &state)
+{
+    auto pointerEvent = CreatePointerEvent(static_cast<int32_t>(state.range(0)));
+    for (auto _ : state) {
+        NetPacket pkt(MmiMessageId::ON_POINTER_EVENT);
+        InputEventDataTransformation::Marshalling(pointerEvent, pkt);
+        benchmark::DoNotOptimize(pkt.GetData());
+    }
+    NetPacket pkt(MmiMessageId::ON_POINTER_EVENT);
+    InputEventDataTransformation::Marshalling(pointerEvent, pkt);
+    state.counters["PacketObjectBytes"] = sizeof(NetPacket);
+    state.counters["PayloadBytes"] = pkt.GetSize();
+}
+BENCHMARK(BM_MarshallingPointerEvent)->Arg(1)->Arg(2)->Arg(5)->Arg(10);
+
+void BM_MarshallingPointerEventFixedStorage(benchmark::State &state)
+{
+    auto pointerEvent = CreatePointerEvent(static_cast<int32_t>(state.range(0)));
+    NetPacket encoded(MmiMessageId::ON_POINTER_EVENT);
+    InputEventDataTransformation::Marshalling(pointerEvent, encoded);
+    for (auto _ : state) {
+        NetPacket pkt(MmiMessageId::ON_POINTER_EVENT);
+        InputEventDataTransformation::Marshalling(pointerEvent, pkt);
+        FixedPacketStorage storage;
+        memcpy_s(storage.buf, sizeof(storage.buf), pkt.GetData(), pkt.GetSize());
+        storage.wPos = static_cast<int32_t>(pkt.GetSize());
+        benchmark::DoNotOptimize(storage.buf);
+    }
+    state.counters["PacketObjectBytes"] = sizeof(NetPacket) + sizeof(FixedPacketStorage);
+    state.counters["PayloadBytes"] = encoded.GetSize();
+}
+BENCHMARK(BM_MarshallingPointerEventFixedStorage)->Arg(1)->Arg(2)->Arg(5)->Arg(10);
+
+void BM_MarshallingKeyEventSendMsg(benchmark::State &state)
+{
+    SocketPair socketPair;
+    UDSSession session("NetPacketBenchmark", 0, socketPair.SendFd(), 0, 0);
+    auto keyEvent = CreateKeyEvent();
+    for (auto _ : state) {
+        NetPacket pkt(MmiMessageId::ON_KEY_EVENT);
+        InputEventDataTransformation::KeyEventToNetPacket(keyEvent, pkt);
+        benchmark::DoNotOptimize(session.SendMsg(pkt));
+        socketPair.Drain();
+    }
+    state.counters["PacketObjectBytes"] = sizeof(NetPacket);
+    session.Close();
+}
+BENCHMARK(BM_MarshallingKeyEventSendMsg);
+
+void BM_MarshallingPointerEventSendMsg(benchmark::State &state)
+{
+    SocketPair socketPair;
+    UDSSession session("NetPacketBenchmark", 0, socketPair.SendFd(), 0, 0);
+    auto pointerEvent = CreatePointerEvent(static_cast<int32_t>(state.range(0)));
+    for (auto _ : state) {
+        NetPacket pkt(MmiMessageId::ON_POINTER_EVENT);
+        InputEventDataTransformation::Marshalling(pointerEvent, pkt);
+        benchmark::DoNotOptimize(session.SendMsg(pkt));
+        socketPair.Drain();
+    }
+    state.counters["PacketObjectBytes"] = sizeof(NetPacket);
+    session.Close();
+}
+BENCHMARK(BM_MarshallingPointerEventSendMsg)->Arg(1)->Arg(10);
+} // namespace
+} // namespace MMI
+} // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -249,5 +249,66 @@ HWTEST_F(NetPacketTest, GetMsgId_005, TestSize.Level1)
     const MmiMessageId retResult = packTmp.GetMsgId();
     EXPECT_TRUE(retResult == idMsg);
 }
+
+/**
+ * @tc.name:ReadOnlyView_001
+ * @tc.desc:Verify net packet reads the payload in place
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(NetPacketTest, ReadOnlyView_001, TestSize.Level1)
+{
+    NetPacket src(MmiMessageId::INVALID);
+    int32_t valIn = 12345;
+    std::string strIn = "view";
+    src << valIn << strIn;
+    ASSERT_FALSE(src.ChkRWError());
+
+    NetPacket pkt(MmiMessageId::INVALID, src.Data(), src.Size());
+    EXPECT_TRUE(pkt.IsReadOnly());
+    EXPECT_EQ(pkt.GetData(), src.Data());
+    EXPECT_EQ(pkt.GetSize(), src.Size());
+    int32_t valOut = 0;
+    std::string strOut;
+    pkt >> valOut >> strOut;
+    EXPECT_FALSE(pkt.ChkRWError());
+    EXPECT_EQ(valOut, valIn);
+    EXPECT_EQ(strOut, strIn);
+}
+
+/**
+ * @tc.name:ReadOnlyView_002
+ * @tc.desc:Verify net packet view rejects writes and copies into owned storage
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(NetPacketTest, ReadOnlyView_002, TestSize.Level1)
+{
+    char buf[] = { 'a', 'b', 'c', 'd' };
+    NetPacket pkt(MmiMessageId::INVALID, buf, sizeof(buf));
+    NetPacket copyPkt(pkt);
+    EXPECT_FALSE(copyPkt.IsReadOnly());
+    EXPECT_NE(copyPkt.GetData(), pkt.GetData());
+    EXPECT_EQ(copyPkt.GetSize(), sizeof(buf));
+    int32_t val = 0;
+    EXPECT_TRUE(copyPkt.Write(val));
+    EXPECT_FALSE(pkt.Write(val));
+    EXPECT_TRUE(pkt.ChkRWError());
+}
+
+/**
+ * @tc.name:ReadOnlyView_003
+ * @tc.desc:Verify string reading stops at the end of the view
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(NetPacketTest, ReadOnlyView_003, TestSize.Level1)
+{
+    char buf[] = { 'a', 'b', 'c', 'd', '\0' };
+    NetPacket pkt(MmiMessageId::INVALID, buf, sizeof(buf) - 1);
+    std::string str;
+    EXPECT_FALSE(pkt.Read(str));
+    EXPECT_TRUE(pkt.ChkRWError());
+}
 } // namespace MMI
 } // namespace OHOS
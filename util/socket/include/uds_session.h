@@ -16,7 +16,10 @@
 #ifndef UDS_SESSION_H
 #define UDS_SESSION_H
 
+#include <deque>
+#include <functional>
 #include <list>
+#include <mutex>
 
 #include "net_packet.h"
 
@@ -31,14 +34,47 @@ public:
     DISALLOW_COPY_AND_MOVE(UDSSession);
     virtual ~UDSSession() = default;
 
+    // Identifies move packets that may replace each other while they wait in the outbound queue.
+    struct CoalesceKey {
+        int32_t deviceId { -1 };
+        int32_t pointerId { -1 };
+        int32_t action { -1 };
+        int32_t windowId { -1 };
+
+        bool operator==(const CoalesceKey &other) const
+        {
+            return ((deviceId == other.deviceId) && (pointerId == other.pointerId) &&
+                (action == other.action) && (windowId == other.windowId));
+        }
+    };
+
     bool SendMsg(const char *buf, size_t size);
     bool SendMsg(NetPacket &pkt);
+    bool SendMsg(NetPacket &pkt, const CoalesceKey &key);
+    bool FlushPendingMsg();
+    bool HasPendingMsg() const;
     void Close();
     struct EventTime {
         int32_t id { 0 };
         int64_t eventTime { 0 };
         int32_t timerId { -1 };
     };
+    struct SendStatistics {
+        uint64_t sentPackets { 0 };
+        uint64_t sentBytes { 0 };
+        uint64_t batchWrites { 0 };
+        uint64_t queuedPackets { 0 };
+        uint64_t droppedPackets { 0 };
+        uint64_t coalescedPackets { 0 };
+        uint64_t socketFullCount { 0 };
+        size_t pendingBytes { 0 };
+        size_t peakPendingBytes { 0 };
+    };
+    using PendingMsgCallback = std::function<void(int32_t)>;
+
+    // While batching is on for the calling thread, packets are queued and written later by FlushPendingMsg.
+    static void SetSendBatching(bool batching);
+    static bool IsSendBatching();
 
     int32_t GetUid() const
     {
@@ -111,11 +147,31 @@ public:
     std::vector<int32_t> GetTimerIds(int32_t type);
     std::list<int32_t> DelEvents(int32_t type, int32_t id);
     int64_t GetEarliestEventTime(int32_t type = 0) const;
+    bool GetFirstEventSince(int32_t type, int64_t time, EventTime &event) const;
     bool IsEventQueueEmpty(int32_t type = 0);
     void ReportSocketBufferFull();
     std::vector<EventTime> GetEventsByType(int32_t type) const;
+    void SetPendingMsgCallback(PendingMsgCallback callback);
+    SendStatistics GetSendStatistics() const;
 
 protected:
+    struct PendingMsg {
+        std::vector<char> data;
+        size_t offset { 0 };
+        bool coalescible { false };
+        CoalesceKey key;
+    };
+    bool SendMsgInner(const char *buf, size_t size, const CoalesceKey *key);
+    bool EnqueueMsg(const char *buf, size_t size, size_t sentSize, const CoalesceKey *key);
+    void CoalescePendingMsg(const CoalesceKey &key);
+    void ConsumePendingMsg(size_t size);
+    void DropPendingMsg();
+
+    mutable std::mutex sendMtx_;
+    std::deque<PendingMsg> pendingMsgs_;
+    SendStatistics sendStats_;
+    bool congested_ { false };
+    PendingMsgCallback pendingMsgCallback_ { nullptr };
     std::map<int32_t, std::vector<EventTime>> events_;
     std::map<int32_t, bool> isAnrProcess_;
     std::string descript_;
@@ -15,6 +15,10 @@
 
 #include "uds_session.h"
 
+#include <sys/uio.h>
+
+#include <algorithm>
+
 #include "hisysevent.h"
 #include "uds_socket.h"
 
@@ -26,6 +30,12 @@ namespace MMI {
 namespace {
 const std::string FOUNDATION = "foundation";
 constexpr int32_t MINUTEINMILLIS { 60000 };
+thread_local bool g_sendBatching { false };
+
+bool IsSocketFull(int32_t err)
+{
+    return (err == EAGAIN || err == EWOULDBLOCK);
+}
 } // namespace
 
 UDSSession::UDSSession(const std::string &programName, const int32_t moduleType, const int32_t fd,
@@ -44,60 +54,220 @@ UDSSession::UDSSession(const std::string &programName, const int32_t moduleType,
 }
 
 bool UDSSession::SendMsg(const char *buf, size_t size)
+{
+    return SendMsgInner(buf, size, nullptr);
+}
+
+bool UDSSession::SendMsgInner(const char *buf, size_t size, const CoalesceKey *key)
 {
     CHKPF(buf);
     if ((size == 0) || (size > MAX_PACKET_BUF_SIZE)) {
         MMI_HILOGE("The buf size:%{public}zu", size);
         return false;
     }
-    if (fd_ < 0) {
-        MMI_HILOGE("The fd is less than 0");
+    bool becamePending = false;
+    int32_t fd = -1;
+    {
+        std::lock_guard<std::mutex> guard(sendMtx_);
+        if (fd_ < 0) {
+            MMI_HILOGE("The fd is less than 0");
+            return false;
+        }
+        size_t sentSize = 0;
+        if (pendingMsgs_.empty() && !g_sendBatching) {
+            ssize_t count = -1;
+            do {
+                count = send(fd_, buf, size, MSG_DONTWAIT | MSG_NOSIGNAL);
+            } while ((count < 0) && (errno == EINTR));
+            if (count < 0) {
+                if (!IsSocketFull(errno)) {
+                    if (errno == ENOTSOCK) {
+                        MMI_HILOGE("Got ENOTSOCK error, turn the socket to invalid");
+                        invalidSocket_ = true;
+                    }
+                    MMI_HILOGE("Send return failed,error:%{public}d fd:%{public}d, pid:%{public}d", errno, fd_, pid_);
+                    return false;
+                }
+                ++sendStats_.socketFullCount;
+                congested_ = true;
+                count = 0;
+            }
+            sentSize = static_cast<size_t>(count);
+            sendStats_.sentBytes += sentSize;
+            if (sentSize == size) {
+                ++sendStats_.sentPackets;
+                return true;
+            }
+            congested_ = true;
+        } else if (congested_ && (key != nullptr)) {
+            CoalescePendingMsg(*key);
+        }
+        becamePending = pendingMsgs_.empty();
+        fd = fd_;
+        if (!EnqueueMsg(buf, size, sentSize, key)) {
+            return false;
+        }
+    }
+    if (becamePending && (pendingMsgCallback_ != nullptr)) {
+        pendingMsgCallback_(fd);
+    }
+    return true;
+}
+
+bool UDSSession::EnqueueMsg(const char *buf, size_t size, size_t sentSize, const CoalesceKey *key)
+{
+    // A partly written packet must be completed, otherwise the stream would be corrupted.
+    if ((sentSize == 0) && (sendStats_.pendingBytes + size > MAX_SESSION_PENDING_SIZE)) {
+        ++sendStats_.droppedPackets;
+        MMI_HILOGE("Pending queue is full, drop packet, size:%{public}zu, pending:%{public}zu, fd:%{public}d, "
+            "pid:%{public}d", size, sendStats_.pendingBytes, fd_, pid_);
+        ReportSocketBufferFull();
         return false;
     }
+    PendingMsg msg { std::vector<char>(buf, buf + size), sentSize };
+    if (key != nullptr) {
+        msg.coalescible = true;
+        msg.key = *key;
+    }
+    pendingMsgs_.push_back(std::move(msg));
+    ++sendStats_.queuedPackets;
+    sendStats_.pendingBytes += size - sentSize;
+    sendStats_.peakPendingBytes = std::max(sendStats_.peakPendingBytes, sendStats_.pendingBytes);
+    return true;
+}
+
+void UDSSession::CoalescePendingMsg(const CoalesceKey &key)
+{
+    // Only packets queued after the last one that can't be coalesced are candidates, so that
+    // DOWN, UP and CANCEL keep their place relative to the moves around them.
+    size_t kept = 1;
+    for (auto iter = pendingMsgs_.end(); iter != pendingMsgs_.begin();) {
+        --iter;
+        if (!iter->coalescible || (iter->offset != 0)) {
+            break;
+        }
+        if (!(iter->key == key)) {
+            continue;
+        }
+        if (kept < MAX_COALESCE_HISTORY) {
+            ++kept;
+            continue;
+        }
+        sendStats_.pendingBytes -= iter->data.size();
+        ++sendStats_.coalescedPackets;
+        iter = pendingMsgs_.erase(iter);
+    }
+}
 
-    int32_t idx = 0;
-    int32_t retryCount = 0;
-    const int32_t bufSize = static_cast<int32_t>(size);
-    int32_t remSize = bufSize;
-    int32_t socketErrorNo = 0;
-    while (remSize > 0 && retryCount < SEND_RETRY_LIMIT) {
-        retryCount += 1;
-        auto count = send(fd_, &buf[idx], remSize, MSG_DONTWAIT | MSG_NOSIGNAL);
+bool UDSSession::FlushPendingMsg()
+{
+    std::lock_guard<std::mutex> guard(sendMtx_);
+    while (!pendingMsgs_.empty()) {
+        if (fd_ < 0) {
+            DropPendingMsg();
+            return true;
+        }
+        struct iovec iov[MAX_SEND_IOV_COUNT];
+        size_t iovCnt = 0;
+        size_t total = 0;
+        for (auto iter = pendingMsgs_.begin(); (iter != pendingMsgs_.end()) && (iovCnt < MAX_SEND_IOV_COUNT);
+            ++iter, ++iovCnt) {
+            iov[iovCnt].iov_base = iter->data.data() + iter->offset;
+            iov[iovCnt].iov_len = iter->data.size() - iter->offset;
+            total += iov[iovCnt].iov_len;
+        }
+        struct msghdr msg = {};
+        msg.msg_iov = iov;
+        msg.msg_iovlen = iovCnt;
+        ssize_t count = sendmsg(fd_, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
         if (count < 0) {
-            if (errno == EAGAIN || errno == EINTR || errno == EWOULDBLOCK) {
-                socketErrorNo = errno;
+            if (errno == EINTR) {
                 continue;
             }
+            if (IsSocketFull(errno)) {
+                ++sendStats_.socketFullCount;
+                congested_ = true;
+                return false;
+            }
             if (errno == ENOTSOCK) {
-                MMI_HILOGE("Got ENOTSOCK error, turn the socket to invalid");
                 invalidSocket_ = true;
             }
-            MMI_HILOGE("Send return failed,error:%{public}d fd:%{public}d, pid:%{public}d", errno, fd_, pid_);
-            return false;
+            MMI_HILOGE("Sendmsg return failed,error:%{public}d fd:%{public}d, pid:%{public}d", errno, fd_, pid_);
+            DropPendingMsg();
+            return true;
         }
-        idx += count;
-        remSize -= count;
-        if (remSize > 0) {
-            MMI_HILOGW("Remsize:%{public}d", remSize);
-            usleep(SEND_RETRY_SLEEP_TIME);
+        ++sendStats_.batchWrites;
+        ConsumePendingMsg(static_cast<size_t>(count));
+        if (static_cast<size_t>(count) < total) {
+            ++sendStats_.socketFullCount;
+            congested_ = true;
+            return false;
         }
     }
-    if (socketErrorNo == EWOULDBLOCK) {
-        ReportSocketBufferFull();
-    }
-    if (retryCount >= SEND_RETRY_LIMIT || remSize != 0) {
-        MMI_HILOGE("Send too many times:%{public}d/%{public}d,size:%{public}d/%{public}d errno:%{public}d, "
-                   "fd:%{public}d, pid:%{public}d", retryCount, SEND_RETRY_LIMIT, idx, bufSize, errno, fd_, pid_);
-        return false;
-    }
+    congested_ = false;
     return true;
 }
 
+bool UDSSession::HasPendingMsg() const
+{
+    std::lock_guard<std::mutex> guard(sendMtx_);
+    return !pendingMsgs_.empty();
+}
+
+void UDSSession::ConsumePendingMsg(size_t size)
+{
+    sendStats_.sentBytes += size;
+    sendStats_.pendingBytes -= size;
+    while ((size > 0) && !pendingMsgs_.empty()) {
+        auto &front = pendingMsgs_.front();
+        size_t remSize = front.data.size() - front.offset;
+        if (size < remSize) {
+            front.offset += size;
+            return;
+        }
+        size -= remSize;
+        pendingMsgs_.pop_front();
+        ++sendStats_.sentPackets;
+    }
+}
+
+void UDSSession::DropPendingMsg()
+{
+    sendStats_.droppedPackets += pendingMsgs_.size();
+    sendStats_.pendingBytes = 0;
+    pendingMsgs_.clear();
+    congested_ = false;
+}
+
+void UDSSession::SetSendBatching(bool batching)
+{
+    g_sendBatching = batching;
+}
+
+bool UDSSession::IsSendBatching()
+{
+    return g_sendBatching;
+}
+
+void UDSSession::SetPendingMsgCallback(PendingMsgCallback callback)
+{
+    pendingMsgCallback_ = callback;
+}
+
+UDSSession::SendStatistics UDSSession::GetSendStatistics() const
+{
+    std::lock_guard<std::mutex> guard(sendMtx_);
+    return sendStats_;
+}
+
 void UDSSession::Close()
 {
     CALL_DEBUG_ENTER;
     MMI_HILOGD("Enter fd:%{public}d", fd_);
     if (fd_ >= 0) {
+        FlushPendingMsg();
+        std::lock_guard<std::mutex> guard(sendMtx_);
+        DropPendingMsg();
         fdsan_close_with_tag(fd_, TAG);
         fd_ = -1;
         UpdateDescript();
@@ -129,6 +299,17 @@ bool UDSSession::SendMsg(NetPacket &pkt)
     return SendMsg(buf.Data(), buf.Size());
 }
 
+bool UDSSession::SendMsg(NetPacket &pkt, const CoalesceKey &key)
+{
+    if (pkt.ChkRWError()) {
+        MMI_HILOGE("Read and write status is error");
+        return false;
+    }
+    StreamBuffer buf;
+    pkt.MakeData(buf);
+    return SendMsgInner(buf.Data(), buf.Size(), &key);
+}
+
 void UDSSession::ReportSocketBufferFull()
 {
     int64_t now = GetSysClockTime();
@@ -245,6 +426,21 @@ int64_t UDSSession::GetEarliestEventTime(int32_t type) const
     return 0;
 }
 
+bool UDSSession::GetFirstEventSince(int32_t type, int64_t time, EventTime &event) const
+{
+    auto iter = events_.find(type);
+    if (iter == events_.end()) {
+        return false;
+    }
+    auto eventIter = std::find_if(iter->second.begin(), iter->second.end(),
+        [time](const EventTime &item) { return item.eventTime >= time; });
+    if (eventIter == iter->second.end()) {
+        return false;
+    }
+    event = *eventIter;
+    return true;
+}
+
 bool UDSSession::IsEventQueueEmpty(int32_t type)
 {
     CALL_DEBUG_ENTER;
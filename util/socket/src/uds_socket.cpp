@@ -105,12 +105,7 @@ void UDSSocket::OnReadPackets(CircleStreamBuffer &circBuf, UDSSocket::PacketCall
         if (head->size > dataSize) {
             break;
         }
-        NetPacket pkt(head->idMsg);
-        if ((head->size > 0) && (!pkt.Write(&buf[headSize], head->size))) {
-            MMI_HILOGW("Error writing data in the NetPacket. It will be retried next time. messageid:%{public}d,"
-                "size:%{public}d", head->idMsg, head->size);
-            break;
-        }
+        NetPacket pkt(head->idMsg, &buf[headSize], static_cast<size_t>(head->size));
         if (!circBuf.SeekReadPos(pkt.GetPacketLength())) {
             MMI_HILOGW("Set read position error, and this error cannot be recovered, and the buffer will be reset."
                 " packetSize:%{public}d unreadSize:%{public}d", pkt.GetPacketLength(), unreadSize);
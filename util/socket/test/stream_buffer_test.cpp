@@ -302,5 +302,50 @@ HWTEST_F(StreamBufferTest, Clone, TestSize.Level1)
     bool retResult = bufObj.CloneUnitTest(buf);
     EXPECT_FALSE(retResult);
 }
+
+/**
+ * @tc.name:Grow_001
+ * @tc.desc:Verify stream buffer grows beyond the inline storage and keeps its content
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StreamBufferTest, Grow_001, TestSize.Level1)
+{
+    StreamBuffer buf;
+    EXPECT_EQ(buf.Data(), buf.inlineBuff_);
+    constexpr int32_t count = MAX_STREAM_BUF_SIZE / static_cast<int32_t>(sizeof(int32_t));
+    for (int32_t i = 0; i < count; ++i) {
+        ASSERT_TRUE(buf.Write(i));
+    }
+    EXPECT_NE(buf.Data(), buf.inlineBuff_);
+    EXPECT_EQ(buf.Size(), static_cast<size_t>(MAX_STREAM_BUF_SIZE));
+    int32_t val = 0;
+    EXPECT_FALSE(buf.Write(val));
+    StreamBuffer copyBuf(buf);
+    for (int32_t i = 0; i < count; ++i) {
+        ASSERT_TRUE(copyBuf.Read(val));
+        EXPECT_EQ(val, i);
+    }
+}
+
+/**
+ * @tc.name:Grow_002
+ * @tc.desc:Verify released blocks are reused by the next stream buffer on the same thread
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StreamBufferTest, Grow_002, TestSize.Level1)
+{
+    char data[MIN_STREAM_BUF_SIZE * 2] = {};
+    const char *block = nullptr;
+    {
+        StreamBuffer buf;
+        ASSERT_TRUE(buf.Write(data, sizeof(data)));
+        block = buf.Data();
+    }
+    StreamBuffer buf;
+    ASSERT_TRUE(buf.Write(data, sizeof(data)));
+    EXPECT_EQ(buf.Data(), block);
+}
 } // namespace MMI
 } // namespace OHOS
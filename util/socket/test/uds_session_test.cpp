@@ -310,6 +310,26 @@ HWTEST_F(UDSSessionTest, UDSSessionTest_GetEarliestEventTime_01, TestSize.Level1
     EXPECT_EQ(ret2, 0);
 }
 
+/**
+ * @tc.name: UDSSessionTest_GetFirstEventSince_01
+ * @tc.desc: Verify uds session function GetFirstEventSince
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(UDSSessionTest, UDSSessionTest_GetFirstEventSince_01, TestSize.Level1)
+{
+    UDSSession sesObj(PROGRAM_NAME, moduleType_, writeFd_, UID_ROOT, pid_);
+    int32_t type = 1;
+    sesObj.events_[type] = { { 1, 1000, -1 }, { 2, 2000, -1 } };
+    UDSSession::EventTime event;
+    EXPECT_TRUE(sesObj.GetFirstEventSince(type, 0, event));
+    EXPECT_EQ(event.id, 1);
+    EXPECT_TRUE(sesObj.GetFirstEventSince(type, 1001, event));
+    EXPECT_EQ(event.id, 2);
+    EXPECT_FALSE(sesObj.GetFirstEventSince(type, 2001, event));
+    EXPECT_FALSE(sesObj.GetFirstEventSince(2, 0, event));
+}
+
 /**
  * @tc.name: UDSSessionTest_SaveANREvent_01
  * @tc.desc: Verify uds session function SaveANREvent
@@ -438,5 +458,102 @@ HWTEST_F(UDSSessionTest, ReportSocketBufferFull, TestSize.Level1)
     sesObj.lastReportedPid_ = sesObj.pid_;
     ASSERT_NO_FATAL_FAILURE(sesObj.ReportSocketBufferFull());
 }
+
+/**
+ * @tc.name: UDSSessionTest_SendBatching_01
+ * @tc.desc: Verify that packets sent while batching are written together by FlushPendingMsg
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(UDSSessionTest, UDSSessionTest_SendBatching_01, TestSize.Level1)
+{
+    UDSSession sesObj(PROGRAM_NAME, moduleType_, writeFd_, UID_ROOT, pid_);
+    int32_t pendingFd = -1;
+    sesObj.SetPendingMsgCallback([&pendingFd](int32_t fd) { pendingFd = fd; });
+    UDSSession::SetSendBatching(true);
+    EXPECT_TRUE(sesObj.SendMsg("1234", 4));
+    EXPECT_TRUE(sesObj.SendMsg("5678", 4));
+    UDSSession::SetSendBatching(false);
+    EXPECT_EQ(pendingFd, writeFd_);
+    EXPECT_TRUE(sesObj.HasPendingMsg());
+    char buf[16] = {};
+    EXPECT_LT(recv(readFd_, buf, sizeof(buf), MSG_DONTWAIT), 0);
+
+    EXPECT_TRUE(sesObj.FlushPendingMsg());
+    EXPECT_FALSE(sesObj.HasPendingMsg());
+    ASSERT_EQ(recv(readFd_, buf, sizeof(buf), MSG_DONTWAIT), 8);
+    EXPECT_STREQ(buf, "12345678");
+    auto stats = sesObj.GetSendStatistics();
+    EXPECT_EQ(stats.sentPackets, 2U);
+    EXPECT_EQ(stats.batchWrites, 1U);
+    EXPECT_EQ(stats.pendingBytes, 0U);
+}
+
+/**
+ * @tc.name: UDSSessionTest_SendBackpressure_01
+ * @tc.desc: Verify that a full socket queues packets instead of blocking and drops them past the limit
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(UDSSessionTest, UDSSessionTest_SendBackpressure_01, TestSize.Level1)
+{
+    UDSSession sesObj(PROGRAM_NAME, moduleType_, writeFd_, UID_ROOT, pid_);
+    char packet[MAX_PACKET_BUF_SIZE] = {};
+    while (!sesObj.HasPendingMsg()) {
+        ASSERT_TRUE(sesObj.SendMsg(packet, sizeof(packet)));
+    }
+    while (sesObj.SendMsg(packet, sizeof(packet))) {}
+    auto stats = sesObj.GetSendStatistics();
+    EXPECT_GT(stats.socketFullCount, 0U);
+    EXPECT_GT(stats.droppedPackets, 0U);
+    EXPECT_LE(stats.pendingBytes, MAX_SESSION_PENDING_SIZE);
+
+    char buf[MAX_PACKET_BUF_SIZE] = {};
+    while (!sesObj.FlushPendingMsg()) {
+        while (recv(readFd_, buf, sizeof(buf), MSG_DONTWAIT) > 0) {}
+    }
+    EXPECT_EQ(sesObj.GetSendStatistics().pendingBytes, 0U);
+}
+
+/**
+ * @tc.name: UDSSessionTest_Coalesce_01
+ * @tc.desc: Verify that a congested session keeps only the latest moves between packets that can't be coalesced
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(UDSSessionTest, UDSSessionTest_Coalesce_01, TestSize.Level1)
+{
+    UDSSession sesObj(PROGRAM_NAME, moduleType_, writeFd_, UID_ROOT, pid_);
+    char packet[MAX_PACKET_BUF_SIZE] = {};
+    while (!sesObj.HasPendingMsg()) {
+        ASSERT_TRUE(sesObj.SendMsg(packet, sizeof(packet)));
+    }
+    UDSSession::CoalesceKey key { 1, 0, 3, 2 };
+    EXPECT_TRUE(sesObj.SendMsg("D", 1));
+    for (const char *move : { "1", "2", "3", "4" }) {
+        EXPECT_TRUE(sesObj.SendMsgInner(move, 1, &key));
+    }
+    EXPECT_TRUE(sesObj.SendMsg("U", 1));
+    for (const char *move : { "5", "6", "7" }) {
+        EXPECT_TRUE(sesObj.SendMsgInner(move, 1, &key));
+    }
+    EXPECT_EQ(sesObj.GetSendStatistics().coalescedPackets, 3U);
+
+    std::string received;
+    char buf[MAX_PACKET_BUF_SIZE] = {};
+    bool drained = false;
+    while (!drained) {
+        drained = sesObj.FlushPendingMsg();
+        ssize_t count = 0;
+        while ((count = recv(readFd_, buf, sizeof(buf), MSG_DONTWAIT)) > 0) {
+            for (ssize_t i = 0; i < count; ++i) {
+                if (buf[i] != '\0') {
+                    received.push_back(buf[i]);
+                }
+            }
+        }
+    }
+    EXPECT_EQ(received, "D34U67");
+}
 } // namespace MMI
 } // namespace OHOS